@@ -48,6 +48,21 @@ typedef struct layer layer;
 struct image;
 typedef struct image image;
 
+struct batcher;
+typedef struct batcher batcher;
+
+struct label_table;
+typedef struct label_table label_table;
+
+struct layer_profiler;
+typedef struct layer_profiler layer_profiler;
+
+struct perf_counters;
+typedef struct perf_counters perf_counters;
+
+struct network_plan;
+typedef struct network_plan network_plan;
+
 // activations.h
 typedef enum {
     LINEAR, LEAKY, LOGISTIC
@@ -76,6 +91,17 @@ typedef enum{
     SSE
 } COST_TYPE;
 
+// convolutional_layer.h
+typedef enum {
+    CONV_IM2COL_GEMM,   // im2col into the workspace, then GEMM
+    CONV_GEMM_1X1,      // 1x1 stride 1 without padding: GEMM straight on the input
+    CONV_DIRECT,        // direct convolution, one output plane per kernel tap
+    CONV_IMPLICIT_GEMM, // GEMM on input patches packed tile by tile, no im2col buffer
+    CONV_DIRECT_RGB,    // direct convolution for input layers with a few channels, also reads uint8 HWC
+    CONV_DEPTHWISE,     // groups == c == n, vectorized across channels in the blocked layout
+    CONV_ALGORITHMS     // number of algorithms
+} CONV_ALGORITHM;
+
 // layer.h
 struct layer {
     LAYER_TYPE type;
@@ -125,6 +151,18 @@ struct layer {
 
     size_t workspace_size;
 
+    CONV_ALGORITHM algorithm;
+    int threads;        // OpenMP threads used by this layer, 0 keeps the default
+
+    int channel_block;          // layout of output: 0 is NCHW, 8 or 16 is NCHW[channel_block]c, see blas.h
+    int input_channel_block;    // layout the forward function expects its input in
+    float *packed_weights;      // weights reordered for the blocked convolution
+
+    int xnor;                       // binary weights and inputs, see set_convolutional_xnor()
+    uint64_t *align_bit_weights;    // sign bits of the weights, n rows of lda_align words
+    float *mean_arr;                // mean |weight| of each filter, the scale of its binary dot products
+    int lda_align;                  // 64-bit words per bit row, size*size*c bits rounded up
+
 };
 
 
@@ -157,11 +195,31 @@ typedef struct network {
 
     float *input;
     float *workspace;
+    float *input_staging;   // batch*inputs floats strided views are gathered into, see network_predict_into()
     int train;
 
     size_t workspace_size_limit;
+
+    layer_profiler *profiler;
+    perf_counters *counters;
+    network_plan *plan;     // see compile_network()
 } network;
 
+// network.h
+typedef enum {
+    TENSOR_FLOAT32, TENSOR_UINT8
+} tensor_type;
+
+// Images in caller memory, read in place by network_predict_into(). Element (k, y, x) of image b
+// is data[b*stride_b + k*stride_c + y*stride_h + x*stride_w], strides counted in elements, so CHW
+// and HWC buffers and crops of them are all views. uint8 values are scaled by 1/255.
+typedef struct tensor_view {
+    const void *data;
+    tensor_type type;
+    int w, h, c;
+    size_t stride_b, stride_c, stride_h, stride_w;
+} tensor_view;
+
 // network.h
 typedef struct network_state {
     float *truth;
@@ -170,6 +228,8 @@ typedef struct network_state {
     float *workspace;
     int train;
     int index;
+    const tensor_view *input_view;  // caller images read by the first layer instead of input, see network_predict_into()
+    float *output;                  // caller memory the network output goes to, see network_predict_into()
     network net;
 } network_state;
 
@@ -193,12 +253,25 @@ LIB_API void free_network(network net);
 
 // network.h
 LIB_API float *network_predict(network net, float *input);
+LIB_API float *network_predict_hwc_u8(network net, const unsigned char *input);
+LIB_API void network_predict_top_k(network net, float *input, int k, int *indexes, float *probs);
+LIB_API int network_predict_hwc_u8_top_k(network net, const unsigned char *input, int k, int *indexes, float *probs);
+LIB_API int network_predict_into(network net, tensor_view input, float *output);
+LIB_API tensor_view make_tensor_view_chw(const float *data, int w, int h, int c);
+LIB_API tensor_view make_tensor_view_hwc(const void *data, tensor_type type, int w, int h, int c);
+LIB_API tensor_view crop_tensor_view(tensor_view v, int dx, int dy, int w, int h);
 LIB_API void fuse_conv_batchnorm(network net);
+LIB_API int resize_network(network *net, int w, int h);
+LIB_API size_t network_prefault(network *net, int lock);
+
+// plan.h
+LIB_API int compile_network(network *net);
 
 // image.h
 LIB_API image resize_image(image im, int w, int h);
 LIB_API image make_image(int w, int h, int c);
 LIB_API image load_image_color(int w, int h);
+LIB_API image load_image_from_memory(const unsigned char *buf, int len, int channels);
 LIB_API void free_image(image m);
 LIB_API image crop_image(image im, int dx, int dy, int w, int h);
 LIB_API image resize_min(image im, int min);
@@ -210,6 +283,12 @@ LIB_API void free_layer(layer l);
 
 // utils.h
 LIB_API void top_k(float *a, int n, int k, int *index);
+LIB_API void top_k_batch(float *a, int n, int batch, int k, int *index);
+
+// labels.h
+LIB_API label_table *load_label_table(const char *filename);
+LIB_API void free_label_table(label_table *t);
+LIB_API const char *get_label(const label_table *t, int i, int *len);
 
 // http_stream.h
 LIB_API double get_time_point();
@@ -217,6 +296,12 @@ LIB_API double get_time_point();
 // gemm.h
 LIB_API void init_cpu();
 
+// batcher.h
+LIB_API batcher *make_batcher(network *net, int max_batch, int max_delay_us);
+LIB_API void free_batcher(batcher *b);
+LIB_API float *batcher_predict(batcher *b, float *input, float *output);
+LIB_API void print_batcher_stats(batcher *b);
+
 #ifdef __cplusplus
 }
 #endif  // __cplusplus
@@ -6,6 +6,21 @@
 #include <string.h>
 #include <float.h>
 
+char *get_activation_string(ACTIVATION a)
+{
+    switch(a){
+        case LOGISTIC:
+            return "logistic";
+        case LINEAR:
+            return "linear";
+        case LEAKY:
+            return "leaky";
+        default:
+            break;
+    }
+    return "relu";
+}
+
 ACTIVATION get_activation(char *s)
 {
     if (strcmp(s, "linear")==0) return LINEAR;
@@ -9,6 +9,8 @@ extern "C" {
 #endif
 ACTIVATION get_activation(char *s);
 
+char *get_activation_string(ACTIVATION a);
+
 float activate(float x, ACTIVATION a);
 void activate_array(float *x, const int n, const ACTIVATION a);
 
@@ -0,0 +1,262 @@
+#include "alloc_tracker.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#ifdef _MSC_VER
+#define ALLOC_THREAD_LOCAL __declspec(thread)
+#else
+#define ALLOC_THREAD_LOCAL __thread
+#endif
+
+// The tracker's own tables use the libc allocator directly so that they are not tracked themselves.
+
+typedef struct alloc_stats {
+    size_t live;
+    size_t peak;
+    size_t bytes;
+    size_t count;
+} alloc_stats;
+
+typedef struct alloc_site {
+    const char *filename;
+    const char *funcname;
+    int line;
+    alloc_stats stats;
+} alloc_site;
+
+typedef struct alloc_record {
+    void *ptr;
+    size_t size;
+    int site;
+    int context;
+} alloc_record;
+
+#define ALLOC_DELETED ((void*)1)
+
+int alloc_tracking = 0;
+static ALLOC_THREAD_LOCAL int alloc_context = ALLOC_CONTEXT_NONE;
+static pthread_mutex_t alloc_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static alloc_stats totals;
+static alloc_site *sites;
+static int nsites;
+static alloc_stats *contexts;       // [ncontexts], index 0 is ALLOC_CONTEXT_NONE, i+1 is layer i
+static int ncontexts;
+static alloc_record *records;       // open addressing hash table keyed by pointer
+static size_t records_size;
+static size_t records_used;         // live plus deleted slots
+
+static size_t hash_ptr(void *ptr)
+{
+    size_t h = (size_t)ptr;
+    h ^= h >> 17;
+    h *= (size_t)0x9E3779B97F4A7C15ULL;
+    return h ^ (h >> 29);
+}
+
+static alloc_record *find_record(void *ptr)
+{
+    size_t mask = records_size - 1;
+    size_t i = hash_ptr(ptr) & mask;
+    while (records[i].ptr) {
+        if (records[i].ptr == ptr) return &records[i];
+        i = (i + 1) & mask;
+    }
+    return 0;
+}
+
+static void insert_record(alloc_record r)
+{
+    size_t mask = records_size - 1;
+    size_t i = hash_ptr(r.ptr) & mask;
+    while (records[i].ptr && records[i].ptr != ALLOC_DELETED) i = (i + 1) & mask;
+    if (!records[i].ptr) records_used++;
+    records[i] = r;
+}
+
+static void grow_records()
+{
+    alloc_record *old = records;
+    size_t old_size = records_size;
+    size_t i;
+    records_size = records_size ? records_size*2 : 4096;
+    records = (alloc_record*)calloc(records_size, sizeof(alloc_record));
+    if (!records) {
+        fprintf(stderr, "Allocation tracker out of memory \n");
+        exit(EXIT_FAILURE);
+    }
+    records_used = 0;
+    for (i = 0; i < old_size; ++i) {
+        if (old[i].ptr && old[i].ptr != ALLOC_DELETED) insert_record(old[i]);
+    }
+    free(old);
+}
+
+static int find_site(const char *filename, const char *funcname, int line)
+{
+    int i;
+    for (i = 0; i < nsites; ++i) {
+        if (sites[i].line == line && (sites[i].filename == filename || 0 == strcmp(sites[i].filename, filename))) return i;
+    }
+    sites = (alloc_site*)realloc(sites, (nsites + 1)*sizeof(alloc_site));
+    memset(&sites[nsites], 0, sizeof(alloc_site));
+    sites[nsites].filename = filename;
+    sites[nsites].funcname = funcname;
+    sites[nsites].line = line;
+    return nsites++;
+}
+
+static alloc_stats *get_context_stats(int context)
+{
+    int i = context + 1;
+    if (i < 0) i = 0;
+    if (i >= ncontexts) {
+        int n = i + 16;
+        contexts = (alloc_stats*)realloc(contexts, n*sizeof(alloc_stats));
+        memset(contexts + ncontexts, 0, (n - ncontexts)*sizeof(alloc_stats));
+        ncontexts = n;
+    }
+    return &contexts[i];
+}
+
+static void add_stats(alloc_stats *s, size_t size)
+{
+    s->live += size;
+    if (s->live > s->peak) s->peak = s->live;
+    s->bytes += size;
+    s->count++;
+}
+
+void enable_alloc_tracking()
+{
+    pthread_mutex_lock(&alloc_mutex);
+    if (!records) grow_records();
+    alloc_tracking = 1;
+    pthread_mutex_unlock(&alloc_mutex);
+}
+
+void alloc_set_context(int layer)
+{
+    alloc_context = layer;
+}
+
+void alloc_track(void *ptr, size_t size, const char * const filename, const char * const funcname, const int line)
+{
+    if (!ptr) return;
+    pthread_mutex_lock(&alloc_mutex);
+    if ((records_used + 1)*2 > records_size) grow_records();
+
+    alloc_record r;
+    r.ptr = ptr;
+    r.size = size;
+    r.site = find_site(filename, funcname, line);
+    r.context = alloc_context;
+    insert_record(r);
+
+    add_stats(&totals, size);
+    add_stats(&sites[r.site].stats, size);
+    add_stats(get_context_stats(r.context), size);
+    pthread_mutex_unlock(&alloc_mutex);
+}
+
+void alloc_untrack(void *ptr)
+{
+    if (!ptr) return;
+    pthread_mutex_lock(&alloc_mutex);
+    alloc_record *r = find_record(ptr);
+    if (r) {
+        totals.live -= r->size;
+        sites[r->site].stats.live -= r->size;
+        get_context_stats(r->context)->live -= r->size;
+        r->ptr = ALLOC_DELETED;
+    }
+    pthread_mutex_unlock(&alloc_mutex);
+}
+
+alloc_totals get_alloc_totals()
+{
+    alloc_totals t;
+    pthread_mutex_lock(&alloc_mutex);
+    t.live = totals.live;
+    t.peak = totals.peak;
+    t.bytes = totals.bytes;
+    t.count = totals.count;
+    pthread_mutex_unlock(&alloc_mutex);
+    return t;
+}
+
+void reset_alloc_churn()
+{
+    int i;
+    pthread_mutex_lock(&alloc_mutex);
+    totals.bytes = totals.count = 0;
+    for (i = 0; i < nsites; ++i) sites[i].stats.bytes = sites[i].stats.count = 0;
+    for (i = 0; i < ncontexts; ++i) contexts[i].bytes = contexts[i].count = 0;
+    pthread_mutex_unlock(&alloc_mutex);
+}
+
+static int compare_sites(const void *a, const void *b)
+{
+    const alloc_site *x = (const alloc_site*)a;
+    const alloc_site *y = (const alloc_site*)b;
+    if (x->stats.peak != y->stats.peak) return x->stats.peak < y->stats.peak ? 1 : -1;
+    if (x->stats.bytes != y->stats.bytes) return x->stats.bytes < y->stats.bytes ? 1 : -1;
+    return 0;
+}
+
+static const char *base_name(const char *path)
+{
+    const char *s = strrchr(path, '/');
+    if (!s) s = strrchr(path, '\\');
+    return s ? s + 1 : path;
+}
+
+void print_alloc_report(network net, int iterations)
+{
+    int i;
+    double div = iterations > 0 ? iterations : 1;
+    const char *per = iterations > 0 ? "/inference" : "";
+
+    pthread_mutex_lock(&alloc_mutex);
+    alloc_site *sorted = (alloc_site*)calloc(nsites ? nsites : 1, sizeof(alloc_site));
+    memcpy(sorted, sites, nsites*sizeof(alloc_site));
+    qsort(sorted, nsites, sizeof(alloc_site), compare_sites);
+
+    fprintf(stderr, "\n Tracked allocations: %.1f KB live, %.1f KB peak, %.1f KB in %.1f calls%s\n",
+        totals.live / 1024., totals.peak / 1024., totals.bytes / 1024. / div, totals.count / div, per);
+#ifndef _WIN32
+    struct rusage usage;
+    if (0 == getrusage(RUSAGE_SELF, &usage)) fprintf(stderr, " Peak resident set size of the process: %ld KB\n", usage.ru_maxrss);
+#endif
+
+    fprintf(stderr, "\n %-52s %10s %12s %12s %12s\n", "call site", iterations > 0 ? "calls/inf" : "calls",
+        iterations > 0 ? "KB/inf" : "KB", "live KB", "peak KB");
+    for (i = 0; i < nsites; ++i) {
+        alloc_stats s = sorted[i].stats;
+        if (!s.peak && !s.count) continue;
+        char site[256];
+        snprintf(site, sizeof(site), "%s:%d %s", base_name(sorted[i].filename), sorted[i].line, sorted[i].funcname);
+        fprintf(stderr, " %-52.52s %10.1f %12.1f %12.1f %12.1f\n", site, s.count / div, s.bytes / 1024. / div,
+            s.live / 1024., s.peak / 1024.);
+    }
+
+    fprintf(stderr, "\n %5s  %-13s %10s %12s %12s %12s\n", "layer", "type", iterations > 0 ? "calls/inf" : "calls",
+        iterations > 0 ? "KB/inf" : "KB", "live KB", "peak KB");
+    for (i = 0; i < ncontexts; ++i) {
+        alloc_stats s = contexts[i];
+        if (!s.peak && !s.count) continue;
+        int l = i - 1;
+        if (l < 0) fprintf(stderr, " %5s  %-13s", "-", "other");
+        else fprintf(stderr, " %5d  %-13s", l, l < net.n ? get_layer_string(net.layers[l].type) : "?");
+        fprintf(stderr, " %10.1f %12.1f %12.1f %12.1f\n", s.count / div, s.bytes / 1024. / div, s.live / 1024., s.peak / 1024.);
+    }
+    pthread_mutex_unlock(&alloc_mutex);
+    free(sorted);
+}
@@ -0,0 +1,40 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+#include "darknet.h"
+#include "network.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Allocation tracking for xmalloc/xcalloc/xrealloc. Once enabled, every allocation is recorded
+// against its DARKNET_LOC call site and against the layer that was being built or run by the
+// calling thread (see alloc_set_context). Memory must be released with xfree() to be untracked;
+// blocks released with plain free() keep counting as live.
+
+#define ALLOC_CONTEXT_NONE -1
+
+typedef struct alloc_totals {
+    size_t live;            // bytes currently allocated
+    size_t peak;            // highest value of live since tracking was enabled
+    size_t bytes;           // bytes allocated since the last reset_alloc_churn()
+    size_t count;           // allocation calls since the last reset_alloc_churn()
+} alloc_totals;
+
+extern int alloc_tracking;
+
+void enable_alloc_tracking();
+void alloc_track(void *ptr, size_t size, const char * const filename, const char * const funcname, const int line);
+void alloc_untrack(void *ptr);
+void alloc_set_context(int layer);
+alloc_totals get_alloc_totals();
+void reset_alloc_churn();
+// per call site and per layer breakdown, iterations > 0 also divides churn into per-inference figures
+void print_alloc_report(network net, int iterations);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,219 @@
+#include "autotune.h"
+#include "convolutional_layer.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+// Tuning file format, one choice per line:
+//   cpu model x max_threads|layer shape|algorithm|threads|microseconds
+// Lines starting with # are ignored; later lines win over earlier ones.
+
+typedef struct tuning_entry {
+    char *cpu;
+    char *shape;
+    CONV_ALGORITHM algorithm;
+    int threads;
+} tuning_entry;
+
+static void get_tuning_cpu(char *buf, size_t len)
+{
+    char model[256];
+    int max_threads = 1;
+#if defined(_OPENMP)
+    max_threads = omp_get_max_threads();
+#endif
+    get_cpu_model(model, sizeof(model));
+    snprintf(buf, len, "%s x%d", model, max_threads);
+}
+
+static void get_layer_shape(layer l, char *buf, size_t len)
+{
+    snprintf(buf, len, "conv batch=%d c=%d h=%d w=%d n=%d groups=%d size=%d stride=%d pad=%d",
+        l.batch, l.c, l.h, l.w, l.n, l.groups, l.size, l.stride, l.pad);
+}
+
+static tuning_entry *read_tuning_file(const char *filename, int *n)
+{
+    *n = 0;
+    FILE *fp = fopen(filename, "r");
+    if (!fp) return 0;
+    tuning_entry *entries = 0;
+    char *line;
+    while ((line = fgetl(fp)) != 0) {
+        char *fields[5];
+        int i, nfields = 0;
+        char *p = line;
+        if (line[0] == '#') {
+            xfree(line);
+            continue;
+        }
+        for (i = 0; i < 5 && p; ++i) {
+            fields[nfields++] = p;
+            p = strchr(p, '|');
+            if (p) *p++ = 0;
+        }
+        if (nfields >= 4) {
+            entries = (tuning_entry*)xrealloc(entries, (*n + 1)*sizeof(tuning_entry));
+            tuning_entry *e = &entries[(*n)++];
+            e->cpu = copy_string(fields[0]);
+            e->shape = copy_string(fields[1]);
+            e->algorithm = get_conv_algorithm(fields[2]);
+            e->threads = atoi(fields[3]);
+        }
+        xfree(line);
+    }
+    fclose(fp);
+    return entries;
+}
+
+static tuning_entry *find_tuning_entry(tuning_entry *entries, int n, const char *cpu, const char *shape)
+{
+    int i;
+    for (i = n - 1; i >= 0; --i) {
+        if (0 == strcmp(entries[i].cpu, cpu) && 0 == strcmp(entries[i].shape, shape)) return &entries[i];
+    }
+    return 0;
+}
+
+static void set_threads(int threads)
+{
+#if defined(_OPENMP)
+    omp_set_num_threads(threads);
+#endif
+}
+
+// best of iterations, after one untimed call
+static double time_layer(layer l, network_state state, int threads, int iterations)
+{
+    int i;
+    double best = 0;
+    if (threads) set_threads(threads);
+    l.forward(l, state);
+    for (i = 0; i < iterations; ++i) {
+        double start = get_time_point();
+        l.forward(l, state);
+        double t = get_time_point() - start;
+        if (i == 0 || t < best) best = t;
+    }
+    return best;
+}
+
+static int same_output(float *a, float *b, int n)
+{
+    int i;
+    double max_ref = 0, max_diff = 0;
+    for (i = 0; i < n; ++i) {
+        if (fabs(a[i]) > max_ref) max_ref = fabs(a[i]);
+        if (fabs(a[i] - b[i]) > max_diff) max_diff = fabs(a[i] - b[i]);
+    }
+    return max_diff <= 1e-3*max_ref + 1e-6;
+}
+
+void autotune_network(network *net, const char *tuning_file, int iterations)
+{
+    int max_threads = 1;
+    int default_threads = 0;
+#if defined(_OPENMP)
+    max_threads = default_threads = omp_get_max_threads();
+#endif
+    if (iterations < 1) iterations = 1;
+
+    char cpu[300];
+    char shape[256];
+    get_tuning_cpu(cpu, sizeof(cpu));
+    int nentries = 0;
+    tuning_entry *entries = read_tuning_file(tuning_file, &nentries);
+    FILE *out = 0;
+    int i, a, t, loaded = 0, tuned = 0;
+
+    for (i = 0; i < net->n; ++i) {
+        layer *l = &net->layers[i];
+        // binary layers have a single kernel
+        if (l->type != CONVOLUTIONAL || l->xnor) continue;
+        get_layer_shape(*l, shape, sizeof(shape));
+
+        tuning_entry *e = find_tuning_entry(entries, nentries, cpu, shape);
+        if (e) {
+            set_convolutional_algorithm(l, e->algorithm);
+            l->threads = e->threads > max_threads ? 0 : e->threads;
+            ++loaded;
+            continue;
+        }
+
+        // candidates are timed on random data; every one has to reproduce the im2col_gemm output
+        size_t workspace_size = 0;
+        for (a = 0; a < CONV_ALGORITHMS; ++a) {
+            layer c = *l;
+            if (!conv_algorithm_supported(c, (CONV_ALGORITHM)a)) continue;
+            set_convolutional_algorithm(&c, (CONV_ALGORITHM)a);
+            if (c.workspace_size > workspace_size) workspace_size = c.workspace_size;
+        }
+        network_state state = {0};
+        state.input = (float*)xcalloc((size_t)l->batch*l->inputs, sizeof(float));
+        state.workspace = (float*)xcalloc(workspace_size/sizeof(float) + 1, sizeof(float));
+        float *reference = (float*)xcalloc((size_t)l->batch*l->outputs, sizeof(float));
+        size_t k;
+        for (k = 0; k < (size_t)l->batch*l->inputs; ++k) state.input[k] = rand_uniform(-1, 1);
+
+        layer c = *l;
+        set_convolutional_algorithm(&c, CONV_IM2COL_GEMM);
+        c.forward(c, state);
+        memcpy(reference, c.output, (size_t)l->batch*l->outputs*sizeof(float));
+
+        CONV_ALGORITHM best_algorithm = CONV_IM2COL_GEMM;
+        int best_threads = 0;
+        double best_time = 0, default_time = 0;
+        for (a = 0; a < CONV_ALGORITHMS; ++a) {
+            if (!conv_algorithm_supported(*l, (CONV_ALGORITHM)a)) continue;
+            set_convolutional_algorithm(&c, (CONV_ALGORITHM)a);
+            c.forward(c, state);
+            if (!same_output(reference, c.output, l->batch*l->outputs)) {
+                fprintf(stderr, "autotune: %s gives wrong results on layer %d, skipping it\n", get_conv_algorithm_string(c.algorithm), i);
+                continue;
+            }
+            // 1, 2, 4, ... threads, then all of them
+            for (t = 1; ; t = t*2 < max_threads ? t*2 : max_threads) {
+                double usec = time_layer(c, state, t, iterations);
+                if (a == CONV_IM2COL_GEMM && t == max_threads) default_time = usec;
+                if (best_time == 0 || usec < best_time) {
+                    best_time = usec;
+                    best_algorithm = c.algorithm;
+                    best_threads = t;
+                }
+                if (t == max_threads) break;
+            }
+        }
+        set_threads(default_threads ? default_threads : 1);
+
+        set_convolutional_algorithm(l, best_algorithm);
+        l->threads = best_threads == max_threads ? 0 : best_threads;
+        fprintf(stderr, "autotune: layer %2d %-13s %2d threads %9.1f us (im2col_gemm, all threads: %9.1f us)\n",
+            i, get_conv_algorithm_string(best_algorithm), best_threads, best_time, default_time);
+
+        if (!out) {
+            out = fopen(tuning_file, "a");
+            if (!out) fprintf(stderr, "autotune: couldn't write %s, choices will not be kept\n", tuning_file);
+        }
+        if (out) fprintf(out, "%s|%s|%s|%d|%.1f\n", cpu, shape, get_conv_algorithm_string(best_algorithm), l->threads, best_time);
+        ++tuned;
+
+        xfree(state.input);
+        xfree(state.workspace);
+        xfree(reference);
+    }
+
+    if (out) fclose(out);
+    for (i = 0; i < nentries; ++i) {
+        xfree(entries[i].cpu);
+        xfree(entries[i].shape);
+    }
+    xfree(entries);
+    recalculate_workspace_size(net);
+    fprintf(stderr, "autotune: %d layers from %s, %d layers tuned\n", loaded, tuning_file, tuned);
+}
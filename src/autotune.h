@@ -0,0 +1,19 @@
+#ifndef AUTOTUNE_H
+#define AUTOTUNE_H
+#include "darknet.h"
+#include "network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Picks the convolution algorithm and OpenMP thread count of every convolutional layer.
+// Choices are looked up in tuning_file by CPU model and layer shape; layers without an entry are
+// benchmarked with each supported candidate and the winners are appended to the file, so only
+// the first run on a machine pays for the search. Resizes the network workspace afterwards.
+void autotune_network(network *net, const char *tuning_file, int iterations);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
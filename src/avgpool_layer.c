@@ -1,6 +1,11 @@
 #include "avgpool_layer.h"
 #include "utils.h"
+#include "tensor_alloc.h"
+#include "blas.h"
 #include <stdio.h>
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
 
 avgpool_layer make_avgpool_layer(int batch, int w, int h, int c)
 {
@@ -17,7 +22,7 @@ avgpool_layer make_avgpool_layer(int batch, int w, int h, int c)
     l.outputs = l.out_c;
     l.inputs = h*w*c;
     int output_size = l.outputs * batch;
-    l.output = (float*)xcalloc(output_size, sizeof(float));
+    l.output = (float*)tensor_calloc(output_size, sizeof(float));
     l.delta = (float*)xcalloc(output_size, sizeof(float));
     l.forward = forward_avgpool_layer;
     //l.backward = backward_avgpool_layer;
@@ -25,20 +30,73 @@ avgpool_layer make_avgpool_layer(int batch, int w, int h, int c)
     return l;
 }
 
+// the output stays one value per channel
+void resize_avgpool_layer(avgpool_layer *l, int w, int h)
+{
+    l->w = w;
+    l->h = h;
+    l->inputs = h*w*l->c;
+}
+
+// Several independent partial sums, so the adds pipeline and vectorize instead of waiting on a
+// single accumulator.
+static float plane_sum(const float *x, int n)
+{
+    int i = 0, q;
+    float sum = 0;
+#if defined(__AVX__)
+    __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+    __m256 s2 = _mm256_setzero_ps(), s3 = _mm256_setzero_ps();
+    for(; i + 32 <= n; i += 32){
+        s0 = _mm256_add_ps(s0, _mm256_loadu_ps(x + i));
+        s1 = _mm256_add_ps(s1, _mm256_loadu_ps(x + i + 8));
+        s2 = _mm256_add_ps(s2, _mm256_loadu_ps(x + i + 16));
+        s3 = _mm256_add_ps(s3, _mm256_loadu_ps(x + i + 24));
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, _mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3)));
+    for(q = 0; q < 8; ++q) sum += lanes[q];
+#else
+    float s[8] = {0};
+    for(; i + 8 <= n; i += 8){
+        for(q = 0; q < 8; ++q) s[q] += x[i + q];
+    }
+    for(q = 0; q < 8; ++q) sum += s[q];
+#endif
+    for(; i < n; ++i) sum += x[i];
+    return sum;
+}
+
 void forward_avgpool_layer(const avgpool_layer l, network_state state)
 {
-    int b,i,k;
+    int k;
+    int size = l.h*l.w;
+
+    #pragma omp parallel for
+    for(k = 0; k < l.batch*l.c; ++k){
+        l.output[k] = plane_sum(state.input + (size_t)k*size, size) / size;
+    }
+}
+
+// Global average of an NCHW[block]c input. A 1x1 output is the same in both layouts, so this is
+// where a blocked network goes back to plain channel order for the classifier.
+void forward_avgpool_layer_nchwc(const avgpool_layer l, network_state state)
+{
+    int b, cb, i, q;
+    int block = l.input_channel_block;
+    int blocks = channel_blocks(l.c, block);
+    float sum[16];
 
     for(b = 0; b < l.batch; ++b){
-        for(k = 0; k < l.c; ++k){
-            int out_index = k + b*l.c;
-            l.output[out_index] = 0;
+        for(cb = 0; cb < blocks; ++cb){
+            const float *in = state.input + ((size_t)b*blocks + cb)*l.h*l.w*block;
+            for(q = 0; q < block; ++q) sum[q] = 0;
             for(i = 0; i < l.h*l.w; ++i){
-                int in_index = i + l.h*l.w*(k + b*l.c);
-                l.output[out_index] += state.input[in_index];
+                for(q = 0; q < block; ++q) sum[q] += in[i*block + q];
+            }
+            for(q = 0; q < block && cb*block + q < l.c; ++q){
+                l.output[b*l.c + cb*block + q] = sum[q] / (l.h*l.w);
             }
-            l.output[out_index] /= l.h*l.w;
         }
     }
 }
-
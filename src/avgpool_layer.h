@@ -12,7 +12,9 @@ extern "C" {
 #endif
 image get_avgpool_image(avgpool_layer l);
 avgpool_layer make_avgpool_layer(int batch, int w, int h, int c);
+void resize_avgpool_layer(avgpool_layer *l, int w, int h);
 void forward_avgpool_layer(const avgpool_layer l, network_state state);
+void forward_avgpool_layer_nchwc(const avgpool_layer l, network_state state);
 
 
 #ifdef __cplusplus
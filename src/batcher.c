@@ -0,0 +1,214 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "batcher.h"
+#include "utils.h"
+#include "trace.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// Requests are queued by concurrent callers of batcher_predict() and served by a single
+// worker thread. A batch is started as soon as max_batch requests are waiting or the
+// earliest deadline among the waiting requests has passed, whichever comes first.
+// The network must have been created for at least max_batch images, i.e. with
+// parse_network_cfg_custom(max_batch, 0), since layer outputs are sized at make time; smaller
+// batches run on the same buffers, see set_network_active_batch(), and the network batch is
+// restored after each of them. free_batcher() serves whatever is still queued before returning.
+
+static double earliest_deadline(batcher *b)
+{
+    double deadline = b->head->deadline;
+    batch_request *r;
+    for (r = b->head->next; r; r = r->next) {
+        if (r->deadline < deadline) deadline = r->deadline;
+    }
+    return deadline;
+}
+
+static void wait_until(batcher *b, double deadline)
+{
+    double remaining = deadline - get_time_point();
+    if (remaining <= 0) return;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    long long nsec = ts.tv_nsec + (long long)(remaining * 1000);
+    ts.tv_sec += nsec / 1000000000;
+    ts.tv_nsec = nsec % 1000000000;
+    pthread_cond_timedwait(&b->submitted, &b->mutex, &ts);
+}
+
+static void run_batch(batcher *b, batch_request **reqs, int n)
+{
+    network *net = b->net;
+    int i;
+    trace_begin("gather batch", n);
+    for (i = 0; i < n; ++i) {
+        memcpy(b->batch_input + (size_t)i*net->inputs, reqs[i]->input, net->inputs*sizeof(float));
+    }
+    trace_end("gather batch", n);
+
+    if (net->batch != n) set_network_active_batch(net, n);
+
+    double start = get_time_point();
+    trace_begin("batch inference", n);
+    float *out = network_predict(*net, b->batch_input);
+    trace_end("batch inference", n);
+    double end = get_time_point();
+    if (net->batch != b->net_batch) set_network_active_batch(net, b->net_batch);
+
+    for (i = 0; i < n; ++i) {
+        memcpy(reqs[i]->output, out + (size_t)i*net->outputs, net->outputs*sizeof(float));
+    }
+
+    pthread_mutex_lock(&b->mutex);
+    b->stats.batches++;
+    b->stats.requests += n;
+    b->stats.batch_size_hist[n]++;
+    b->stats.inference_sum += end - start;
+    for (i = 0; i < n; ++i) {
+        double delay = start - reqs[i]->enqueued;
+        b->stats.queue_delay_sum += delay;
+        if (delay > b->stats.queue_delay_max) b->stats.queue_delay_max = delay;
+        reqs[i]->done = 1;
+    }
+    pthread_cond_broadcast(&b->completed);
+    pthread_mutex_unlock(&b->mutex);
+}
+
+static void *batcher_thread(void *ptr)
+{
+    batcher *b = (batcher*)ptr;
+    batch_request **reqs = (batch_request**)xcalloc(b->max_batch, sizeof(batch_request*));
+    trace_set_thread_name("batcher");
+
+    pthread_mutex_lock(&b->mutex);
+    while (b->running || b->queued) {
+        if (!b->queued) {
+            pthread_cond_wait(&b->submitted, &b->mutex);
+            continue;
+        }
+        int full = b->queued >= b->max_batch;
+        // once stopping, the queue is drained without waiting for deadlines
+        if (!full && b->running && get_time_point() < earliest_deadline(b)) {
+            wait_until(b, earliest_deadline(b));
+            continue;
+        }
+        if (full) b->stats.full_batches++;
+        else b->stats.deadline_batches++;
+
+        int n = 0;
+        while (b->head && n < b->max_batch) {
+            reqs[n++] = b->head;
+            b->head = b->head->next;
+        }
+        if (!b->head) b->tail = 0;
+        b->queued -= n;
+
+        pthread_mutex_unlock(&b->mutex);
+        run_batch(b, reqs, n);
+        pthread_mutex_lock(&b->mutex);
+    }
+    pthread_mutex_unlock(&b->mutex);
+
+    xfree(reqs);
+    return 0;
+}
+
+batcher *make_batcher(network *net, int max_batch, int max_delay_us)
+{
+    if (max_batch < 1) max_batch = 1;
+    if (max_delay_us < 0) max_delay_us = 0;
+    if (max_batch > net->batch) {
+        fprintf(stderr, "batcher: max_batch = %d, but the network was built for %d images \n", max_batch, net->batch);
+        error("Batcher max_batch is larger than the network batch", DARKNET_LOC);
+    }
+
+    batcher *b = (batcher*)xcalloc(1, sizeof(batcher));
+    b->net = net;
+    b->net_batch = net->batch;
+    b->max_batch = max_batch;
+    b->max_delay_us = max_delay_us;
+    b->batch_input = (float*)xcalloc((size_t)max_batch*net->inputs, sizeof(float));
+    b->stats.batch_size_hist = (uint64_t*)xcalloc(max_batch + 1, sizeof(uint64_t));
+
+    pthread_mutex_init(&b->mutex, 0);
+    pthread_cond_init(&b->submitted, 0);
+    pthread_cond_init(&b->completed, 0);
+    b->running = 1;
+    if (pthread_create(&b->thread, 0, batcher_thread, b)) error("Thread creation failed", DARKNET_LOC);
+
+    fprintf(stderr, "batcher: max_batch = %d, max_delay = %d us \n", max_batch, max_delay_us);
+    return b;
+}
+
+void free_batcher(batcher *b)
+{
+    pthread_mutex_lock(&b->mutex);
+    b->running = 0;
+    pthread_cond_broadcast(&b->submitted);
+    pthread_mutex_unlock(&b->mutex);
+    pthread_join(b->thread, 0);
+
+    pthread_mutex_destroy(&b->mutex);
+    pthread_cond_destroy(&b->submitted);
+    pthread_cond_destroy(&b->completed);
+    xfree(b->batch_input);
+    xfree(b->stats.batch_size_hist);
+    xfree(b);
+}
+
+float *batcher_predict_deadline(batcher *b, float *input, float *output, int max_delay_us)
+{
+    batch_request r = {0};
+    r.input = input;
+    r.output = output;
+    r.enqueued = get_time_point();
+    r.deadline = r.enqueued + max_delay_us;
+
+    pthread_mutex_lock(&b->mutex);
+    if (b->tail) b->tail->next = &r;
+    else b->head = &r;
+    b->tail = &r;
+    b->queued++;
+    pthread_cond_signal(&b->submitted);
+    while (!r.done) pthread_cond_wait(&b->completed, &b->mutex);
+    pthread_mutex_unlock(&b->mutex);
+
+    return output;
+}
+
+float *batcher_predict(batcher *b, float *input, float *output)
+{
+    return batcher_predict_deadline(b, input, output, b->max_delay_us);
+}
+
+batcher_stats get_batcher_stats(batcher *b)
+{
+    pthread_mutex_lock(&b->mutex);
+    batcher_stats s = b->stats;
+    pthread_mutex_unlock(&b->mutex);
+    return s;
+}
+
+void print_batcher_stats(batcher *b)
+{
+    batcher_stats s = get_batcher_stats(b);
+    int i;
+    double avg_batch = s.batches ? (double)s.requests / s.batches : 0;
+    double avg_delay = s.requests ? s.queue_delay_sum / s.requests : 0;
+    double avg_infer = s.batches ? s.inference_sum / s.batches : 0;
+
+    fprintf(stderr, "batcher: %llu requests in %llu batches (%llu full, %llu deadline) \n",
+        (unsigned long long)s.requests, (unsigned long long)s.batches,
+        (unsigned long long)s.full_batches, (unsigned long long)s.deadline_batches);
+    fprintf(stderr, " avg batch size = %.2f / %d, queue delay avg = %.3f ms, max = %.3f ms, inference avg = %.3f ms \n",
+        avg_batch, b->max_batch, avg_delay / 1000, s.queue_delay_max / 1000, avg_infer / 1000);
+    fprintf(stderr, " batch size histogram:");
+    for (i = 1; i <= b->max_batch; ++i) {
+        if (s.batch_size_hist[i]) fprintf(stderr, " %d:%llu", i, (unsigned long long)s.batch_size_hist[i]);
+    }
+    fprintf(stderr, "\n");
+}
@@ -0,0 +1,63 @@
+#ifndef BATCHER_H
+#define BATCHER_H
+#include "darknet.h"
+
+#include <pthread.h>
+#include "network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct batch_request {
+    float *input;
+    float *output;
+    double enqueued;
+    double deadline;
+    int done;
+    struct batch_request *next;
+} batch_request;
+
+typedef struct batcher_stats {
+    uint64_t batches;
+    uint64_t requests;
+    uint64_t *batch_size_hist;  // [max_batch + 1], number of batches run with that size
+    uint64_t full_batches;      // fired because max_batch was reached
+    uint64_t deadline_batches;  // fired because the oldest deadline expired
+    double queue_delay_sum;     // microseconds from submit to batch start
+    double queue_delay_max;
+    double inference_sum;       // microseconds spent in network_predict
+} batcher_stats;
+
+struct batcher {
+    network *net;
+    int net_batch;          // net->batch at make time, restored after every smaller batch
+    int max_batch;
+    int max_delay_us;
+    float *batch_input;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t submitted;
+    pthread_cond_t completed;
+    batch_request *head;
+    batch_request *tail;
+    int queued;
+    int running;
+
+    batcher_stats stats;
+};
+
+batcher *make_batcher(network *net, int max_batch, int max_delay_us);
+void free_batcher(batcher *b);
+
+float *batcher_predict(batcher *b, float *input, float *output);
+float *batcher_predict_deadline(batcher *b, float *input, float *output, int max_delay_us);
+
+batcher_stats get_batcher_stats(batcher *b);
+void print_batcher_stats(batcher *b);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
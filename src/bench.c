@@ -0,0 +1,380 @@
+#include "network.h"
+#include "parser.h"
+#include "utils.h"
+#include "gemm.h"
+#include "im2col.h"
+#include "blas.h"
+#include "activations.h"
+#include "image.h"
+#include "maxpool_layer.h"
+#include "avgpool_layer.h"
+#include "trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+// Kernel microbenchmarks on the exact shapes of the network built by parse_network_cfg_custom().
+// Results are written as JSON so that runs before and after a kernel change can be diffed.
+
+typedef void (*bench_fn)(void *args);
+
+typedef struct bench_result {
+    int iterations;
+    double min;         // microseconds
+    double median;
+    double mean;
+} bench_result;
+
+typedef struct gemm_args {
+    int TA, TB, M, N, K;
+    float *A, *B, *C;
+} gemm_args;
+
+typedef struct im2col_args {
+    float *im;
+    int c, h, w, size, stride, pad;
+    float *col;
+} im2col_args;
+
+typedef struct maxpool_args {
+    layer l;
+    float *src;
+    float *dst;
+    int *indexes;       // the argmax kernel when set
+} maxpool_args;
+
+typedef struct avgpool_args {
+    layer l;
+    float *src;
+} avgpool_args;
+
+typedef struct softmax_args {
+    layer l;
+    float *src;
+    float *dst;
+} softmax_args;
+
+typedef struct top_k_args {
+    float *x;
+    int n, k;
+    int *index;
+} top_k_args;
+
+typedef struct activation_args {
+    float *x;
+    int n;
+    ACTIVATION a;
+} activation_args;
+
+typedef struct resize_args {
+    image im;
+    int w, h;
+} resize_args;
+
+#define TRACE_SPANS 1000
+
+static void run_trace_spans(void *ptr)
+{
+    int i;
+    for (i = 0; i < TRACE_SPANS; ++i) {
+        trace_begin("bench", i);
+        trace_end("bench", i);
+    }
+}
+
+static void run_gemm(void *ptr)
+{
+    gemm_args *a = (gemm_args*)ptr;
+    int lda = a->TA ? a->M : a->K;
+    int ldb = a->TB ? a->K : a->N;
+    gemm_cpu(a->TA, a->TB, a->M, a->N, a->K, 1, a->A, lda, a->B, ldb, 1, a->C, a->N);
+}
+
+static void run_im2col(void *ptr)
+{
+    im2col_args *a = (im2col_args*)ptr;
+    im2col_cpu(a->im, a->c, a->h, a->w, a->size, a->stride, a->pad, a->col);
+}
+
+static void run_maxpool(void *ptr)
+{
+    maxpool_args *a = (maxpool_args*)ptr;
+    layer l = a->l;
+    network_state state = {0};
+    state.input = a->src;
+    l.output = a->dst;
+    l.indexes = a->indexes;
+    forward_maxpool_layer(l, state);
+}
+
+static void run_avgpool(void *ptr)
+{
+    avgpool_args *a = (avgpool_args*)ptr;
+    network_state state = {0};
+    state.input = a->src;
+    forward_avgpool_layer(a->l, state);
+}
+
+static void run_softmax(void *ptr)
+{
+    softmax_args *a = (softmax_args*)ptr;
+    layer l = a->l;
+    softmax_cpu(a->src, l.inputs/l.groups, 1, l.inputs, l.groups, l.inputs/l.groups, 1, a->dst);
+}
+
+static void run_top_k(void *ptr)
+{
+    top_k_args *a = (top_k_args*)ptr;
+    top_k(a->x, a->n, a->k, a->index);
+}
+
+static void run_activation(void *ptr)
+{
+    activation_args *a = (activation_args*)ptr;
+    activate_array(a->x, a->n, a->a);
+}
+
+static void run_resize(void *ptr)
+{
+    resize_args *a = (resize_args*)ptr;
+    image resized = resize_image(a->im, a->w, a->h);
+    free_image(resized);
+}
+
+static float *random_array(size_t n)
+{
+    float *x = (float*)xcalloc(n, sizeof(float));
+    size_t i;
+    for (i = 0; i < n; ++i) x[i] = rand_uniform(-1, 1);
+    return x;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// One untimed call, then up to max_iterations timed calls or until min_time microseconds passed.
+static bench_result time_kernel(bench_fn fn, void *args, int max_iterations, double min_time)
+{
+    bench_result r = {0};
+    double *times = (double*)xcalloc(max_iterations, sizeof(double));
+    double total = 0;
+    int i;
+
+    fn(args);
+    for (i = 0; i < max_iterations; ++i) {
+        double start = get_time_point();
+        fn(args);
+        times[i] = get_time_point() - start;
+        total += times[i];
+        if (i >= 2 && total >= min_time) {
+            ++i;
+            break;
+        }
+    }
+    r.iterations = i;
+    qsort(times, r.iterations, sizeof(double), compare_double);
+    r.min = times[0];
+    r.median = times[r.iterations/2];
+    r.mean = total / r.iterations;
+    xfree(times);
+    return r;
+}
+
+static void set_threads(int threads)
+{
+#if defined(_OPENMP)
+    omp_set_num_threads(threads);
+#endif
+}
+
+static void print_result(FILE *fp, int *first, const char *kernel, int index, const char *shape,
+    int threads, bench_result r, double flops, double bytes)
+{
+    fprintf(fp, "%s\n    {\"kernel\": \"%s\", \"layer\": %d, \"shape\": {%s}, \"threads\": %d, \"iterations\": %d, "
+        "\"min_us\": %.1f, \"median_us\": %.1f, \"mean_us\": %.1f",
+        *first ? "" : ",", kernel, index, shape, threads, r.iterations, r.min, r.median, r.mean);
+    if (flops > 0 && r.median > 0) fprintf(fp, ", \"gflops\": %.3f", flops / (r.median * 1000));
+    if (bytes > 0 && r.median > 0) fprintf(fp, ", \"gbps\": %.3f", bytes / (r.median * 1000));
+    fprintf(fp, "}");
+    fflush(fp);
+    *first = 0;
+}
+
+void run_bench(int argc, char **argv)
+{
+    char *outfile = find_char_arg(argc, argv, "-out", 0);
+    char *thread_list = find_char_arg(argc, argv, "-threads", 0);
+    int max_iterations = find_int_arg(argc, argv, "-iters", 50);
+    double min_time = find_float_arg(argc, argv, "-min_ms", 200) * 1000;
+
+    int max_threads = 1;
+#if defined(_OPENMP)
+    max_threads = omp_get_max_threads();
+#endif
+    int nthreads = 0;
+    int *threads;
+    if (thread_list) threads = read_intlist(thread_list, &nthreads, 1);
+    else {
+        // 1, 2, 4, ... up to all hardware threads
+        int t;
+        threads = (int*)xcalloc(32, sizeof(int));
+        for (t = 1; t < max_threads && nthreads < 31; t *= 2) threads[nthreads++] = t;
+        threads[nthreads++] = max_threads;
+    }
+
+    FILE *fp = stdout;
+    if (outfile) {
+        fp = fopen(outfile, "w");
+        if (!fp) file_error(outfile);
+    }
+
+    srand(2222222);
+    network net = parse_network_cfg_custom(1, 0);
+    char cpu[256];
+    get_cpu_model(cpu, sizeof(cpu));
+
+    fprintf(fp, "{\n  \"cpu\": \"%s\",\n  \"openmp\": %s,\n  \"max_threads\": %d,\n  \"results\": [",
+        cpu, max_threads > 1 ? "true" : "false", max_threads);
+    int first = 1;
+    char shape[256];
+    int i, t, v;
+
+    for (t = 0; t < nthreads; ++t) {
+        set_threads(threads[t]);
+        fprintf(stderr, "Benchmarking kernels with %d threads\n", threads[t]);
+
+        for (i = 0; i < net.n; ++i) {
+            layer l = net.layers[i];
+            if (l.type == CONVOLUTIONAL) {
+                int M = l.n;
+                int N = l.out_h*l.out_w;
+                int K = l.size*l.size*l.c/l.groups;
+
+                gemm_args g;
+                g.M = M; g.N = N; g.K = K;
+                g.A = random_array((size_t)M*K);
+                g.B = random_array((size_t)K*N);
+                g.C = random_array((size_t)M*N);
+                for (v = 0; v < 4; ++v) {
+                    static const char *names[] = {"gemm_nn", "gemm_nt", "gemm_tn", "gemm_tt"};
+                    g.TA = v >> 1;
+                    g.TB = v & 1;
+                    bench_result r = time_kernel(run_gemm, &g, max_iterations, min_time);
+                    sprintf(shape, "\"M\": %d, \"N\": %d, \"K\": %d", M, N, K);
+                    print_result(fp, &first, names[v], i, shape, threads[t], r, 2.0*M*N*K, 0);
+                }
+                xfree(g.A);
+                xfree(g.B);
+
+                im2col_args c;
+                c.c = l.c; c.h = l.h; c.w = l.w;
+                c.size = l.size; c.stride = l.stride; c.pad = l.pad;
+                c.im = random_array((size_t)l.inputs);
+                c.col = random_array((size_t)K*N);
+                bench_result r = time_kernel(run_im2col, &c, max_iterations, min_time);
+                sprintf(shape, "\"c\": %d, \"h\": %d, \"w\": %d, \"size\": %d, \"stride\": %d, \"pad\": %d",
+                    l.c, l.h, l.w, l.size, l.stride, l.pad);
+                print_result(fp, &first, "im2col_cpu", i, shape, threads[t], r, 0, 4.0*((size_t)l.inputs + (size_t)K*N));
+                xfree(c.im);
+                xfree(c.col);
+
+                activation_args a;
+                a.x = g.C;
+                a.n = l.outputs;
+                a.a = l.activation;
+                r = time_kernel(run_activation, &a, max_iterations, min_time);
+                sprintf(shape, "\"n\": %d, \"activation\": \"%s\"", a.n, get_activation_string(a.a));
+                print_result(fp, &first, "activate_array", i, shape, threads[t], r, 0, 8.0*a.n);
+                xfree(g.C);
+            }
+            else if (l.type == MAXPOOL) {
+                maxpool_args m;
+                m.l = l;
+                m.l.batch = 1;
+                m.src = random_array((size_t)l.inputs);
+                m.dst = random_array((size_t)l.outputs);
+                m.indexes = (int*)xcalloc(l.outputs, sizeof(int));
+                sprintf(shape, "\"c\": %d, \"h\": %d, \"w\": %d, \"size\": %d, \"stride\": %d, \"pad\": %d",
+                    l.c, l.h, l.w, l.size, l.stride, l.pad);
+                bench_result r = time_kernel(run_maxpool, &m, max_iterations, min_time);
+                print_result(fp, &first, "forward_maxpool_layer_avx", i, shape, threads[t], r, 0, 4.0*(l.inputs + l.outputs));
+                xfree(m.indexes);
+                m.indexes = 0;
+                r = time_kernel(run_maxpool, &m, max_iterations, min_time);
+                print_result(fp, &first, l.size == 2 && l.stride == 2 ? "forward_maxpool_2x2_s2" : "forward_maxpool_inference",
+                    i, shape, threads[t], r, 0, 4.0*(l.inputs + l.outputs));
+                xfree(m.src);
+                xfree(m.dst);
+            }
+            else if (l.type == AVGPOOL) {
+                avgpool_args a;
+                a.l = l;
+                a.l.batch = 1;
+                a.src = random_array((size_t)l.inputs);
+                bench_result r = time_kernel(run_avgpool, &a, max_iterations, min_time);
+                sprintf(shape, "\"c\": %d, \"h\": %d, \"w\": %d", l.c, l.h, l.w);
+                print_result(fp, &first, "forward_avgpool_layer", i, shape, threads[t], r, 0, 4.0*(l.inputs + l.outputs));
+                xfree(a.src);
+            }
+            else if (l.type == SOFTMAX) {
+                softmax_args s;
+                s.l = l;
+                s.src = random_array((size_t)l.inputs);
+                s.dst = random_array((size_t)l.outputs);
+                bench_result r = time_kernel(run_softmax, &s, max_iterations, min_time);
+                sprintf(shape, "\"n\": %d, \"groups\": %d", l.inputs, l.groups);
+                print_result(fp, &first, "softmax_cpu", i, shape, threads[t], r, 0, 4.0*(l.inputs + l.outputs));
+                xfree(s.src);
+                xfree(s.dst);
+
+                // class selection on this head and on a 21842-class (ImageNet-22k) one
+                int n, k;
+                for (n = l.inputs; n; n = n == 21842 ? 0 : 21842) {
+                    for (k = 5; k <= 100; k += 95) {
+                        top_k_args a;
+                        a.x = random_array(n);
+                        a.n = n;
+                        a.k = k;
+                        a.index = (int*)xcalloc(k, sizeof(int));
+                        r = time_kernel(run_top_k, &a, max_iterations, min_time);
+                        sprintf(shape, "\"n\": %d, \"k\": %d", n, k);
+                        print_result(fp, &first, "top_k", i, shape, threads[t], r, 0, 4.0*n);
+                        xfree(a.x);
+                        xfree(a.index);
+                    }
+                }
+            }
+        }
+
+        // the classifier's preprocessing: resize_min() of the input image to the network size
+        resize_args z;
+        z.im = load_image_color(0, 0);
+        z.w = z.im.w < z.im.h ? net.w : (z.im.w * net.w) / z.im.h;
+        z.h = z.im.w < z.im.h ? (z.im.h * net.w) / z.im.w : net.w;
+        bench_result r = time_kernel(run_resize, &z, max_iterations, min_time);
+        sprintf(shape, "\"c\": %d, \"h\": %d, \"w\": %d, \"out_h\": %d, \"out_w\": %d", z.im.c, z.im.h, z.im.w, z.h, z.w);
+        print_result(fp, &first, "resize_image", -1, shape, threads[t], r, 0, 0);
+        free_image(z.im);
+
+        // a begin/end pair of the flight recorder, what every traced layer and kernel pays
+        int was_enabled = trace_enabled;
+        if (!was_enabled) enable_trace(1 << 16);
+        r = time_kernel(run_trace_spans, 0, max_iterations, min_time);
+        trace_enabled = was_enabled;
+        sprintf(shape, "\"spans\": %d", TRACE_SPANS);
+        print_result(fp, &first, "trace_span", -1, shape, threads[t], r, 0, 0);
+    }
+    fprintf(fp, "\n  ]\n}\n");
+
+    if (fp != stdout) fclose(fp);
+    xfree(threads);
+    free_network(net);
+}
@@ -48,6 +48,24 @@ void softmax(float *input, int n, float *output, int stride)
 }
 
 
+float log_sum_exp(const float *x, int n)
+{
+    int i, q;
+    float largest = -FLT_MAX;
+    float s[8] = {0};
+    for(i = 0; i < n; ++i){
+        if(x[i] > largest) largest = x[i];
+    }
+    // independent partial sums so the exp calls vectorize
+    for(i = 0; i + 8 <= n; i += 8){
+        for(q = 0; q < 8; ++q) s[q] += expf(x[i + q] - largest);
+    }
+    for(; i < n; ++i) s[0] += expf(x[i] - largest);
+    float sum = 0;
+    for(q = 0; q < 8; ++q) sum += s[q];
+    return largest + logf(sum);
+}
+
 void softmax_cpu(float *input, int n, int batch, int batch_offset, int groups, int group_offset, int stride, float *output)
 {
     int g, b;
@@ -58,3 +76,37 @@ void softmax_cpu(float *input, int n, int batch, int batch_offset, int groups, i
     }
 }
 
+
+void nchw_to_nchwc(const float *src, float *dst, int batch, int c, int h, int w, int block)
+{
+    int b, k;
+    int blocks = channel_blocks(c, block);
+    size_t i, plane = (size_t)h*w;
+    for(b = 0; b < batch; ++b){
+        float *out = dst + (size_t)b*blocks*block*plane;
+        for(k = 0; k < blocks*block; ++k){
+            float *o = out + (size_t)(k/block)*block*plane + k%block;
+            if (k >= c) {
+                for(i = 0; i < plane; ++i) o[i*block] = 0;
+                continue;
+            }
+            const float *in = src + ((size_t)b*c + k)*plane;
+            for(i = 0; i < plane; ++i) o[i*block] = in[i];
+        }
+    }
+}
+
+void nchwc_to_nchw(const float *src, float *dst, int batch, int c, int h, int w, int block)
+{
+    int b, k;
+    int blocks = channel_blocks(c, block);
+    size_t i, plane = (size_t)h*w;
+    for(b = 0; b < batch; ++b){
+        const float *in = src + (size_t)b*blocks*block*plane;
+        for(k = 0; k < c; ++k){
+            const float *s = in + (size_t)(k/block)*block*plane + k%block;
+            float *out = dst + ((size_t)b*c + k)*plane;
+            for(i = 0; i < plane; ++i) out[i] = s[i*block];
+        }
+    }
+}
@@ -16,6 +16,19 @@ void l2_cpu(int n, float *pred, float *truth, float *delta, float *error);
 
 void softmax(float *input, int n, float *output, int stride);
 void softmax_cpu(float *input, int n, int batch, int batch_offset, int groups, int group_offset, int stride, float *output);
+// log(sum(exp(x))), computed as max + log(sum(exp(x - max))); softmax(x)[i] = exp(x[i] - log_sum_exp(x))
+float log_sum_exp(const float *x, int n);
+
+// Blocked channel layout NCHW[block]c: channels are grouped in blocks of block (8 or 16) and the
+// channels of one block are stored next to each other for every pixel, so channel k of pixel
+// (y, x) in image b lives at (((b*blocks + k/block)*h + y)*w + x)*block + k%block with
+// blocks = ceil(c/block). Lanes past the last channel are zero.
+static inline int channel_blocks(int c, int block)
+{
+    return (c + block - 1) / block;
+}
+void nchw_to_nchwc(const float *src, float *dst, int batch, int c, int h, int w, int block);
+void nchwc_to_nchw(const float *src, float *dst, int batch, int c, int h, int w, int block);
 
 #ifdef __cplusplus
 }
@@ -3,25 +3,73 @@
 #include "parser.h"
 #include "blas.h"
 #include "assert.h"
-#include "classifier.h"
+#include "http_stream.h"
+#include "ipc_ring.h"
+#include "profiler.h"
+#include "perf_counters.h"
+#include "alloc_tracker.h"
+#include "trace.h"
+#include "tensor_alloc.h"
+#include "autotune.h"
+#include "optimize.h"
+#include "histogram.h"
+#include "labels.h"
+#include "plan.h"
+#include "batcher.h"
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 #ifdef WIN32
 #include <time.h>
 #else
 #include <sys/time.h>
 #endif
 
-void predict_classifier(int top)
+// convolution algorithm choices, see autotune.h; set with -tune <file>
+static char *tuning_file = 0;
+// NCHW[block]c activations when 8 or 16, see set_network_channel_block(); set with -channel_block <n>
+static int channel_block = 0;
+// binary convolutional layers, see set_network_xnor(); set with -xnor
+static int xnor = 0;
+// square input resolution in place of the 224x224 the network is defined with; set with -size <n>
+static int input_size = 0;
+// fault in weights and buffers at load, see network_prefault(); set with -prefault, -mlock also locks them
+static int prefault = 0;
+static int lock_memory = 0;
+// run layer by layer instead of from a compiled plan, see compile_network(); set with -no_plan
+static int no_plan = 0;
+// class names, one per line; set with -labels <file>
+static char *label_file = "data/imagenet.shortnames.list";
+
+static network load_classifier(int batch)
 {
-    network net = parse_network_cfg_custom(1, 0);
+    network net = parse_network_cfg_custom(batch, 0);
     load_weights(&net);
-    set_batch_network(&net, 1);
+    set_batch_network(&net, batch);
+    if (input_size && (input_size != net.w || input_size != net.h)) resize_network(&net, input_size, input_size);
     srand(2222222);
 
     fuse_conv_batchnorm(net);
+    optimize_network(&net);
+    if (xnor) set_network_xnor(&net);
+    if (tuning_file) autotune_network(&net, tuning_file, 5);
+    if (channel_block) set_network_channel_block(&net, channel_block);
+    if (!no_plan) {
+        compile_network(&net);
+        fprintf(stderr, "plan: %d ops, %d with their own kernel\n", net.plan->n, net.plan->native);
+    }
+    if (prefault || lock_memory) {
+        size_t bytes = network_prefault(&net, lock_memory);
+        fprintf(stderr, "%s %.1f MB of tensors\n", lock_memory ? "Locked" : "Pre-faulted", bytes / (1024.*1024.));
+    }
+    return net;
+}
 
-    char *name_list;
-    name_list = (char*)malloc(sizeof(char)* 512);
-    strcpy(name_list, "data/imagenet.shortnames.list");
+void predict_classifier(int top)
+{
+    network net = load_classifier(1);
+    label_table *labels = load_label_table(label_file);
+    if (!labels) fprintf(stderr, "Couldn't open label file %s, printing class indexes\n", label_file);
 
     int classes = 1000;
     printf(" classes = %d, output in cfg = %d \n", classes, net.layers[net.n - 1].c);
@@ -31,11 +79,12 @@ void predict_classifier(int top)
             l.outputs, classes);
         getchar();
     }
-    top = 5;
+    if (!top) top = 5;
     if (top > classes) top = classes;
 
     int i = 0;
     int* indexes = (int*)xcalloc(top, sizeof(int));
+    float *probs = (float*)xcalloc(top, sizeof(float));
     char buff[256];
     char *input = buff;
     double begin = get_time_point();
@@ -48,14 +97,15 @@ void predict_classifier(int top)
     float *X = cropped.data;
 
     double time = get_time_point();
-    float *predictions = network_predict(net, X);
+    network_predict_top_k(net, X, top, indexes, probs);
     printf("%s: Predicted in %lf milli-seconds.\n", "dog", ((double)get_time_point() - time) / 1000);
 
-    top_k(predictions, net.outputs, top, indexes);
-
     for(i = 0; i < top; ++i){
         int index = indexes[i];
-        printf("%s: %f\n",names[index], predictions[index]);
+        int len;
+        const char *name = get_label(labels, index, &len);
+        if (name) printf("%.*s: %f\n", len, name, probs[i]);
+        else printf("%d: %f\n", index, probs[i]);
     }
 
     free_image(cropped);
@@ -67,8 +117,352 @@ void predict_classifier(int top)
     double end = get_time_point();
     printf("Executing: %lf milli-seconds.\n", (end - begin) / 1000);
     
-    free(indexes);
+    xfree(indexes);
+    xfree(probs);
+    free_label_table(labels);
+    free_network(net);
+}
+
+void profile_classifier(int iterations, int warmup)
+{
+    network net = load_classifier(1);
+    if (iterations < 1) iterations = 1;
+
+    image im = load_image_color(0, 0);
+    image resized = resize_min(im, net.w);
+    image cropped = crop_image(resized, (resized.w - net.w)/2, (resized.h - net.h)/2, net.w, net.h);
+
+    int i;
+    for (i = 0; i < warmup; ++i) network_predict(net, cropped.data);
+
+    net.profiler = make_layer_profiler(net.n, iterations);
+    for (i = 0; i < iterations; ++i) network_predict(net, cropped.data);
+
+    fprintf(stderr, "Measuring machine roofline...\n");
+    roofline roof = measure_roofline();
+    print_layer_profile(net, net.profiler, roof);
+
+    free_layer_profiler(net.profiler);
+    net.profiler = 0;
+    free_image(cropped);
+    if (resized.data != im.data) free_image(resized);
+    free_image(im);
     free_network(net);
 }
 
+// Hardware counter breakdown of the forward pass, see perf_counters.h. fp_event is a raw
+// PERF_TYPE_RAW config for the CPU's FP operation event, e.g. 0x4710 on recent Intel cores.
+void perf_classifier(int iterations, int warmup, uint64_t fp_event)
+{
+    network net = load_classifier(1);
+    if (iterations < 1) iterations = 1;
+
+    image im = load_image_color(0, 0);
+    image resized = resize_min(im, net.w);
+    image cropped = crop_image(resized, (resized.w - net.w)/2, (resized.h - net.h)/2, net.w, net.h);
+
+    int i;
+    for (i = 0; i < warmup; ++i) network_predict(net, cropped.data);
+
+    net.counters = make_perf_counters(net.n, fp_event);
+    if (net.counters) {
+        // the counters only see the calling thread, so run every layer on it
+        // instead of reporting the master thread's share of a parallel layer
+#if defined(_OPENMP)
+        int default_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        for (i = 0; i < net.n; ++i) net.layers[i].threads = 0;
+#endif
+        for (i = 0; i < iterations; ++i) network_predict(net, cropped.data);
+#if defined(_OPENMP)
+        omp_set_num_threads(default_threads);
+#endif
+        print_perf_counters(net, net.counters);
+        free_perf_counters(net.counters);
+        net.counters = 0;
+    }
+
+    free_image(cropped);
+    if (resized.data != im.data) free_image(resized);
+    free_image(im);
+    free_network(net);
+}
+
+static image preprocess_classifier_image(network net)
+{
+    trace_begin("preprocess", 0);
+    image im = load_image_color(0, 0);
+    image resized = resize_min(im, net.w);
+    image cropped = crop_image(resized, (resized.w - net.w)/2, (resized.h - net.h)/2, net.w, net.h);
+    if (resized.data != im.data) free_image(resized);
+    free_image(im);
+    trace_end("preprocess", 0);
+    return cropped;
+}
+
+typedef struct batch_client {
+    batcher *b;
+    float *input;
+    float *output;
+    int iterations;
+} batch_client;
+
+static void *batch_client_thread(void *ptr)
+{
+    batch_client *c = (batch_client*)ptr;
+    int i;
+    for (i = 0; i < c->iterations; ++i) batcher_predict(c->b, c->input, c->output);
+    return 0;
+}
+
+// clients threads each send iterations single-image requests through a batcher, the way
+// concurrent server connections would, then the batcher statistics are printed
+void batch_classifier(int max_batch, int max_delay_us, int clients, int iterations)
+{
+    if (max_batch < 1) max_batch = 1;
+    if (clients < 1) clients = 1;
+    network net = load_classifier(max_batch);
+    image cropped = preprocess_classifier_image(net);
+    batcher *b = make_batcher(&net, max_batch, max_delay_us);
+    batch_client *c = (batch_client*)xcalloc(clients, sizeof(batch_client));
+    pthread_t *threads = (pthread_t*)xcalloc(clients, sizeof(pthread_t));
+    int i;
+
+    double start = get_time_point();
+    for (i = 0; i < clients; ++i) {
+        c[i].b = b;
+        c[i].input = cropped.data;
+        c[i].output = (float*)xcalloc(net.outputs, sizeof(float));
+        c[i].iterations = iterations;
+        if (pthread_create(&threads[i], 0, batch_client_thread, &c[i])) error("Thread creation failed", DARKNET_LOC);
+    }
+    for (i = 0; i < clients; ++i) pthread_join(threads[i], 0);
+    double end = get_time_point();
+
+    print_batcher_stats(b);
+    fprintf(stderr, " %d clients x %d requests in %.3f s, %.1f img/s\n", clients, iterations,
+        (end - start) / 1000000, clients*iterations / ((end - start) / 1000000));
+
+    free_batcher(b);
+    for (i = 0; i < clients; ++i) xfree(c[i].output);
+    xfree(c);
+    xfree(threads);
+    free_image(cropped);
+    free_network(net);
+}
+
+// Where the bytes go: the footprint left by loading the network, then the allocations made by
+// each preprocess + inference round trip after the warmup passes.
+void memory_classifier(int iterations, int warmup)
+{
+    enable_alloc_tracking();
+    network net = load_classifier(1);
+    if (iterations < 1) iterations = 1;
+    fprintf(stderr, "\n Network setup\n");
+    print_alloc_report(net, 0);
+
+    int i, top = net.outputs < 5 ? net.outputs : 5;
+    int *indexes = (int*)xcalloc(top, sizeof(int));
+    float *probs = (float*)xcalloc(top, sizeof(float));
+    for (i = 0; i < warmup + iterations; ++i) {
+        if (i == warmup) reset_alloc_churn();
+        image im = preprocess_classifier_image(net);
+        network_predict_top_k(net, im.data, top, indexes, probs);
+        free_image(im);
+    }
+    fprintf(stderr, "\n Inference, %d iterations\n", iterations);
+    print_alloc_report(net, iterations);
+    xfree(indexes);
+    xfree(probs);
+    free_network(net);
+    // whatever is still live was never released, or released with free() instead of xfree()
+    alloc_totals t = get_alloc_totals();
+    fprintf(stderr, "\n Leaked after free_network(): %.1f KB\n", t.live / 1024.);
+}
+
+// Runs warmup passes, then either a fixed number of iterations or a fixed duration for every
+// (threads, batch) pair. One iteration preprocesses batch images and runs one batched inference.
+void benchmark_classifier(char *batch_list, char *thread_list, int warmup, int iterations, float duration, char *outfile)
+{
+    int nbatches, nthreads, i, b, t;
+    int *batches = read_intlist(batch_list, &nbatches, 1);
+    int max_threads = 1;
+#if defined(_OPENMP)
+    max_threads = omp_get_max_threads();
+#endif
+    int *threads = read_intlist(thread_list, &nthreads, max_threads);
+
+    int max_batch = 1;
+    for (b = 0; b < nbatches; ++b) {
+        if (batches[b] < 1) batches[b] = 1;
+        if (batches[b] > max_batch) max_batch = batches[b];
+    }
+    network net = load_classifier(max_batch);
+    float *X = (float*)xcalloc((size_t)max_batch*net.inputs, sizeof(float));
+
+    // microseconds, up to 100 s with ~0.8% precision
+    hdr_histogram *latency = make_hdr_histogram(100000000, 8);
+    hdr_histogram *preprocess = make_hdr_histogram(100000000, 8);
+    hdr_histogram *inference = make_hdr_histogram(100000000, 8);
+
+    FILE *fp = 0;
+    if (outfile) {
+        fp = fopen(outfile, "w");
+        if (!fp) file_error(outfile);
+        char cpu[256];
+        get_cpu_model(cpu, sizeof(cpu));
+        fprintf(fp, "{\n  \"cpu\": \"%s\",\n  \"max_threads\": %d,\n  \"runs\": [", cpu, max_threads);
+    }
+
+    fprintf(stderr, "\n threads batch  iters   img/s   latency ms: p50      p90      p99    p99.9   | preprocess p50  inference p50\n");
+    for (t = 0; t < nthreads; ++t) {
+#if defined(_OPENMP)
+        omp_set_num_threads(threads[t]);
+#endif
+        for (b = 0; b < nbatches; ++b) {
+            int batch = batches[b];
+            set_batch_network(&net, batch);
+            reset_hdr_histogram(latency);
+            reset_hdr_histogram(preprocess);
+            reset_hdr_histogram(inference);
+
+            int iter;
+            double begin = 0;
+            for (iter = 0; ; ++iter) {
+                if (iter == warmup) begin = get_time_point();
+                if (iter >= warmup) {
+                    int measured = iter - warmup;
+                    if (duration > 0 && get_time_point() - begin >= duration*1000000) break;
+                    if (duration <= 0 && measured >= iterations) break;
+                }
+
+                double start = get_time_point();
+                for (i = 0; i < batch; ++i) {
+                    double p = get_time_point();
+                    image cropped = preprocess_classifier_image(net);
+                    memcpy(X + (size_t)i*net.inputs, cropped.data, net.inputs*sizeof(float));
+                    free_image(cropped);
+                    if (iter >= warmup) hdr_record(preprocess, (int64_t)(get_time_point() - p));
+                }
+                double infer = get_time_point();
+                network_predict(net, X);
+                double end = get_time_point();
+
+                if (iter >= warmup) {
+                    hdr_record(inference, (int64_t)(end - infer));
+                    hdr_record(latency, (int64_t)(end - start));
+                }
+            }
+            double wall = (get_time_point() - begin) / 1000000;
+            int measured = iter - warmup;
+            double throughput = wall > 0 ? measured*batch / wall : 0;
+
+            fprintf(stderr, " %7d %5d %6d %7.2f %18.3f %8.3f %8.3f %8.3f   | %14.3f %14.3f\n",
+                threads[t], batch, measured, throughput,
+                hdr_value_at_percentile(latency, 50) / 1000., hdr_value_at_percentile(latency, 90) / 1000.,
+                hdr_value_at_percentile(latency, 99) / 1000., hdr_value_at_percentile(latency, 99.9) / 1000.,
+                hdr_value_at_percentile(preprocess, 50) / 1000., hdr_value_at_percentile(inference, 50) / 1000.);
+
+            if (fp) {
+                fprintf(fp, "%s\n    {\"threads\": %d, \"batch\": %d, \"warmup\": %d, \"iterations\": %d, \"images\": %d, "
+                    "\"wall_s\": %.3f, \"throughput_ips\": %.3f,\n     \"latency_us\": ",
+                    (t || b) ? "," : "", threads[t], batch, warmup, measured, measured*batch, wall, throughput);
+                print_hdr_json(fp, latency);
+                fprintf(fp, ",\n     \"preprocess_us\": ");
+                print_hdr_json(fp, preprocess);
+                fprintf(fp, ",\n     \"inference_us\": ");
+                print_hdr_json(fp, inference);
+                fprintf(fp, "}");
+            }
+        }
+    }
+    if (fp) {
+        fprintf(fp, "\n  ]\n}\n");
+        fclose(fp);
+    }
+
+    free_hdr_histogram(latency);
+    free_hdr_histogram(preprocess);
+    free_hdr_histogram(inference);
+    xfree(X);
+    xfree(batches);
+    xfree(threads);
+    free_network(net);
+}
+
+void serve_classifier(int port, int top)
+{
+    network net = load_classifier(1);
+    if (!top) top = 5;
+    label_table *labels = load_label_table(label_file);
+    if (!labels) fprintf(stderr, "Couldn't open label file %s, answering with class indexes\n", label_file);
+    run_classifier_server(net, labels, port, top);
+    free_label_table(labels);
+    free_network(net);
+}
+
+void serve_classifier_ipc(char *socket_path, int nslots, int top)
+{
+    network net = load_classifier(1);
+    if (!top) top = 5;
+    run_classifier_ipc(net, socket_path, nslots, top);
+    free_network(net);
+}
+
+void run_classifier(int argc, char **argv)
+{
+    if(argc < 3){
+        fprintf(stderr, "usage: %s %s [predict/server/ipc/batch/profile/perf/memory/benchmark] [-t top] [-port port] [-socket path] [-slots n] [-max_batch n] [-max_delay_us us] [-clients n] [-iters n] [-warmup n] [-fp_event 0x4710] [-trace] [-no_trace] [-trace_out trace.json] [-trace_slow_ms ms] [-tune tuning.txt] [-labels names.list] [-xnor] [-channel_block n] [-size 224] [-prefault] [-mlock] [-hugetlb] [-no_plan] [-duration s] [-batches 1,2,4] [-threads 1,2,4] [-out file.json]\n", argv[0], argv[1]);
+        return;
+    }
+
+    int top = find_int_arg(argc, argv, "-t", 0);
+    int port = find_int_arg(argc, argv, "-port", 8070);
+    char *socket_path = find_char_arg(argc, argv, "-socket", "/tmp/darknet_ipc.sock");
+    int nslots = find_int_arg(argc, argv, "-slots", 8);
+    int max_batch = find_int_arg(argc, argv, "-max_batch", 8);
+    int max_delay_us = find_int_arg(argc, argv, "-max_delay_us", 2000);
+    int clients = find_int_arg(argc, argv, "-clients", 8);
+    int iterations = find_int_arg(argc, argv, "-iters", 100);
+    int warmup = find_int_arg(argc, argv, "-warmup", 5);
+    float duration = find_float_arg(argc, argv, "-duration", 0);
+    char *batch_list = find_char_arg(argc, argv, "-batches", "1");
+    char *thread_list = find_char_arg(argc, argv, "-threads", 0);
+    char *outfile = find_char_arg(argc, argv, "-out", 0);
+    uint64_t fp_event = strtoull(find_char_arg(argc, argv, "-fp_event", "0"), 0, 0);
+    char *trace_out = find_char_arg(argc, argv, "-trace_out", 0);
+    tuning_file = find_char_arg(argc, argv, "-tune", 0);
+    channel_block = find_int_arg(argc, argv, "-channel_block", 0);
+    label_file = find_char_arg(argc, argv, "-labels", label_file);
+    xnor = find_arg(argc, argv, "-xnor");
+    input_size = find_int_arg(argc, argv, "-size", 0);
+    prefault = find_arg(argc, argv, "-prefault");
+    tensor_hugetlb = find_arg(argc, argv, "-hugetlb");
+    lock_memory = find_arg(argc, argv, "-mlock");
+    no_plan = find_arg(argc, argv, "-no_plan");
+    float trace_slow_ms = find_float_arg(argc, argv, "-trace_slow_ms", 0);
+    char *trace_prefix = find_char_arg(argc, argv, "-trace_prefix", "trace_slow");
+    // The flight recorder is on for the serving modes, so GET /trace and slow request dumps work
+    // without a restart: a span costs ~130 ns against a forward pass of hundreds of ms, see
+    // "trace_span" in darknet bench. The measuring modes only trace when asked to.
+    int measuring = !strcmp(argv[2], "profile") || !strcmp(argv[2], "perf") || !strcmp(argv[2], "memory") || !strcmp(argv[2], "benchmark");
+    int trace = find_arg(argc, argv, "-trace") || trace_out || trace_slow_ms > 0 || !measuring;
+    if (trace && !find_arg(argc, argv, "-no_trace")) {
+        enable_trace(find_int_arg(argc, argv, "-trace_events", 1 << 16));
+        trace_set_thread_name("main");
+        if (trace_slow_ms > 0) trace_slow_requests(trace_slow_ms, trace_prefix);
+    }
+    if(0==strcmp(argv[2], "predict")) predict_classifier(top);
+    else if(0==strcmp(argv[2], "server")) serve_classifier(port, top);
+    else if(0==strcmp(argv[2], "ipc")) serve_classifier_ipc(socket_path, nslots, top);
+    else if(0==strcmp(argv[2], "batch")) batch_classifier(max_batch, max_delay_us, clients, iterations);
+    else if(0==strcmp(argv[2], "profile")) profile_classifier(iterations, warmup);
+    else if(0==strcmp(argv[2], "perf")) perf_classifier(iterations, warmup, fp_event);
+    else if(0==strcmp(argv[2], "memory")) memory_classifier(iterations, warmup);
+    else if(0==strcmp(argv[2], "benchmark")) benchmark_classifier(batch_list, thread_list, warmup, iterations, duration, outfile);
+    else fprintf(stderr, "Not an option under classifier: %s\n", argv[2]);
+
+    if (trace_out) dump_trace(trace_out);
+}
+
 
@@ -1,21854 +0,0 @@
-#ifndef CLASSIFIER_H
-#define CLASSIFIER_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-static char* names[]={"kit fox",
-"English setter",
-"Siberian husky",
-"Australian terrier",
-"English springer",
-"grey whale",
-"lesser panda",
-"Egyptian cat",
-"ibex",
-"Persian cat",
-"cougar",
-"gazelle",
-"porcupine",
-"sea lion",
-"malamute",
-"badger",
-"Great Dane",
-"Walker hound",
-"Welsh springer spaniel",
-"whippet",
-"Scottish deerhound",
-"killer whale",
-"mink",
-"African elephant",
-"Weimaraner",
-"soft-coated wheaten terrier",
-"Dandie Dinmont",
-"red wolf",
-"Old English sheepdog",
-"jaguar",
-"otterhound",
-"bloodhound",
-"Airedale",
-"hyena",
-"meerkat",
-"giant schnauzer",
-"titi",
-"three-toed sloth",
-"sorrel",
-"black-footed ferret",
-"dalmatian",
-"black-and-tan coonhound",
-"papillon",
-"skunk",
-"Staffordshire bullterrier",
-"Mexican hairless",
-"Bouvier des Flandres",
-"weasel",
-"miniature poodle",
-"Cardigan",
-"malinois",
-"bighorn",
-"fox squirrel",
-"colobus",
-"tiger cat",
-"Lhasa",
-"impala",
-"coyote",
-"Yorkshire terrier",
-"Newfoundland",
-"brown bear",
-"red fox",
-"Norwegian elkhound",
-"Rottweiler",
-"hartebeest",
-"Saluki",
-"grey fox",
-"schipperke",
-"Pekinese",
-"Brabancon griffon",
-"West Highland white terrier",
-"Sealyham terrier",
-"guenon",
-"mongoose",
-"indri",
-"tiger",
-"Irish wolfhound",
-"wild boar",
-"EntleBucher",
-"zebra",
-"ram",
-"French bulldog",
-"orangutan",
-"basenji",
-"leopard",
-"Bernese mountain dog",
-"Maltese dog",
-"Norfolk terrier",
-"toy terrier",
-"vizsla",
-"cairn",
-"squirrel monkey",
-"groenendael",
-"clumber",
-"Siamese cat",
-"chimpanzee",
-"komondor",
-"Afghan hound",
-"Japanese spaniel",
-"proboscis monkey",
-"guinea pig",
-"white wolf",
-"ice bear",
-"gorilla",
-"borzoi",
-"toy poodle",
-"Kerry blue terrier",
-"ox",
-"Scotch terrier",
-"Tibetan mastiff",
-"spider monkey",
-"Doberman",
-"Boston bull",
-"Greater Swiss Mountain dog",
-"Appenzeller",
-"Shih-Tzu",
-"Irish water spaniel",
-"Pomeranian",
-"Bedlington terrier",
-"warthog",
-"Arabian camel",
-"siamang",
-"miniature schnauzer",
-"collie",
-"golden retriever",
-"Irish terrier",
-"affenpinscher",
-"Border collie",
-"hare",
-"boxer",
-"silky terrier",
-"beagle",
-"Leonberg",
-"German short-haired pointer",
-"patas",
-"dhole",
-"baboon",
-"macaque",
-"Chesapeake Bay retriever",
-"bull mastiff",
-"kuvasz",
-"capuchin",
-"pug",
-"curly-coated retriever",
-"Norwich terrier",
-"flat-coated retriever",
-"hog",
-"keeshond",
-"Eskimo dog",
-"Brittany spaniel",
-"standard poodle",
-"Lakeland terrier",
-"snow leopard",
-"Gordon setter",
-"dingo",
-"standard schnauzer",
-"hamster",
-"Tibetan terrier",
-"Arctic fox",
-"wire-haired fox terrier",
-"basset",
-"water buffalo",
-"American black bear",
-"Angora",
-"bison",
-"howler monkey",
-"hippopotamus",
-"chow",
-"giant panda",
-"American Staffordshire terrier",
-"Shetland sheepdog",
-"Great Pyrenees",
-"Chihuahua",
-"tabby",
-"marmoset",
-"Labrador retriever",
-"Saint Bernard",
-"armadillo",
-"Samoyed",
-"bluetick",
-"redbone",
-"polecat",
-"marmot",
-"kelpie",
-"gibbon",
-"llama",
-"miniature pinscher",
-"wood rabbit",
-"Italian greyhound",
-"lion",
-"cocker spaniel",
-"Irish setter",
-"dugong",
-"Indian elephant",
-"beaver",
-"Sussex spaniel",
-"Pembroke",
-"Blenheim spaniel",
-"Madagascar cat",
-"Rhodesian ridgeback",
-"lynx",
-"African hunting dog",
-"langur",
-"Ibizan hound",
-"timber wolf",
-"cheetah",
-"English foxhound",
-"briard",
-"sloth bear",
-"Border terrier",
-"German shepherd",
-"otter",
-"koala",
-"tusker",
-"echidna",
-"wallaby",
-"platypus",
-"wombat",
-"revolver",
-"umbrella",
-"schooner",
-"soccer ball",
-"accordion",
-"ant",
-"starfish",
-"chambered nautilus",
-"grand piano",
-"laptop",
-"strawberry",
-"airliner",
-"warplane",
-"airship",
-"balloon",
-"space shuttle",
-"fireboat",
-"gondola",
-"speedboat",
-"lifeboat",
-"canoe",
-"yawl",
-"catamaran",
-"trimaran",
-"container ship",
-"liner",
-"pirate",
-"aircraft carrier",
-"submarine",
-"wreck",
-"half track",
-"tank",
-"missile",
-"bobsled",
-"dogsled",
-"bicycle-built-for-two",
-"mountain bike",
-"freight car",
-"passenger car",
-"barrow",
-"shopping cart",
-"motor scooter",
-"forklift",
-"electric locomotive",
-"steam locomotive",
-"amphibian",
-"ambulance",
-"beach wagon",
-"cab",
-"convertible",
-"jeep",
-"limousine",
-"minivan",
-"Model T",
-"racer",
-"sports car",
-"go-kart",
-"golfcart",
-"moped",
-"snowplow",
-"fire engine",
-"garbage truck",
-"pickup",
-"tow truck",
-"trailer truck",
-"moving van",
-"police van",
-"recreational vehicle",
-"streetcar",
-"snowmobile",
-"tractor",
-"mobile home",
-"tricycle",
-"unicycle",
-"horse cart",
-"jinrikisha",
-"oxcart",
-"bassinet",
-"cradle",
-"crib",
-"four-poster",
-"bookcase",
-"china cabinet",
-"medicine chest",
-"chiffonier",
-"table lamp",
-"file",
-"park bench",
-"barber chair",
-"throne",
-"folding chair",
-"rocking chair",
-"studio couch",
-"toilet seat",
-"desk",
-"pool table",
-"dining table",
-"entertainment center",
-"wardrobe",
-"Granny Smith",
-"orange",
-"lemon",
-"fig",
-"pineapple",
-"banana",
-"jackfruit",
-"custard apple",
-"pomegranate",
-"acorn",
-"hip",
-"ear",
-"rapeseed",
-"corn",
-"buckeye",
-"organ",
-"upright",
-"chime",
-"drum",
-"gong",
-"maraca",
-"marimba",
-"steel drum",
-"banjo",
-"cello",
-"violin",
-"harp",
-"acoustic guitar",
-"electric guitar",
-"cornet",
-"French horn",
-"trombone",
-"harmonica",
-"ocarina",
-"panpipe",
-"bassoon",
-"oboe",
-"sax",
-"flute",
-"daisy",
-"yellow lady's slipper",
-"cliff",
-"valley",
-"alp",
-"volcano",
-"promontory",
-"sandbar",
-"coral reef",
-"lakeside",
-"seashore",
-"geyser",
-"hatchet",
-"cleaver",
-"letter opener",
-"plane",
-"power drill",
-"lawn mower",
-"hammer",
-"corkscrew",
-"can opener",
-"plunger",
-"screwdriver",
-"shovel",
-"plow",
-"chain saw",
-"cock",
-"hen",
-"ostrich",
-"brambling",
-"goldfinch",
-"house finch",
-"junco",
-"indigo bunting",
-"robin",
-"bulbul",
-"jay",
-"magpie",
-"chickadee",
-"water ouzel",
-"kite",
-"bald eagle",
-"vulture",
-"great grey owl",
-"black grouse",
-"ptarmigan",
-"ruffed grouse",
-"prairie chicken",
-"peacock",
-"quail",
-"partridge",
-"African grey",
-"macaw",
-"sulphur-crested cockatoo",
-"lorikeet",
-"coucal",
-"bee eater",
-"hornbill",
-"hummingbird",
-"jacamar",
-"toucan",
-"drake",
-"red-breasted merganser",
-"goose",
-"black swan",
-"white stork",
-"black stork",
-"spoonbill",
-"flamingo",
-"American egret",
-"little blue heron",
-"bittern",
-"crane",
-"limpkin",
-"American coot",
-"bustard",
-"ruddy turnstone",
-"red-backed sandpiper",
-"redshank",
-"dowitcher",
-"oystercatcher",
-"European gallinule",
-"pelican",
-"king penguin",
-"albatross",
-"great white shark",
-"tiger shark",
-"hammerhead",
-"electric ray",
-"stingray",
-"barracouta",
-"coho",
-"tench",
-"goldfish",
-"eel",
-"rock beauty",
-"anemone fish",
-"lionfish",
-"puffer",
-"sturgeon",
-"gar",
-"loggerhead",
-"leatherback turtle",
-"mud turtle",
-"terrapin",
-"box turtle",
-"banded gecko",
-"common iguana",
-"American chameleon",
-"whiptail",
-"agama",
-"frilled lizard",
-"alligator lizard",
-"Gila monster",
-"green lizard",
-"African chameleon",
-"Komodo dragon",
-"triceratops",
-"African crocodile",
-"American alligator",
-"thunder snake",
-"ringneck snake",
-"hognose snake",
-"green snake",
-"king snake",
-"garter snake",
-"water snake",
-"vine snake",
-"night snake",
-"boa constrictor",
-"rock python",
-"Indian cobra",
-"green mamba",
-"sea snake",
-"horned viper",
-"diamondback",
-"sidewinder",
-"European fire salamander",
-"common newt",
-"eft",
-"spotted salamander",
-"axolotl",
-"bullfrog",
-"tree frog",
-"tailed frog",
-"whistle",
-"wing",
-"paintbrush",
-"hand blower",
-"oxygen mask",
-"snorkel",
-"loudspeaker",
-"microphone",
-"screen",
-"mouse",
-"electric fan",
-"oil filter",
-"strainer",
-"space heater",
-"stove",
-"guillotine",
-"barometer",
-"rule",
-"odometer",
-"scale",
-"analog clock",
-"digital clock",
-"wall clock",
-"hourglass",
-"sundial",
-"parking meter",
-"stopwatch",
-"digital watch",
-"stethoscope",
-"syringe",
-"magnetic compass",
-"binoculars",
-"projector",
-"sunglasses",
-"loupe",
-"radio telescope",
-"bow",
-"cannon",
-"assault rifle",
-"rifle",
-"projectile",
-"computer keyboard",
-"typewriter keyboard",
-"crane",
-"lighter",
-"abacus",
-"cash machine",
-"slide rule",
-"desktop computer",
-"hand-held computer",
-"notebook",
-"web site",
-"harvester",
-"thresher",
-"printer",
-"slot",
-"vending machine",
-"sewing machine",
-"joystick",
-"switch",
-"hook",
-"car wheel",
-"paddlewheel",
-"pinwheel",
-"potter's wheel",
-"gas pump",
-"carousel",
-"swing",
-"reel",
-"radiator",
-"puck",
-"hard disc",
-"sunglass",
-"pick",
-"car mirror",
-"solar dish",
-"remote control",
-"disk brake",
-"buckle",
-"hair slide",
-"knot",
-"combination lock",
-"padlock",
-"nail",
-"safety pin",
-"screw",
-"muzzle",
-"seat belt",
-"ski",
-"candle",
-"jack-o'-lantern",
-"spotlight",
-"torch",
-"neck brace",
-"pier",
-"tripod",
-"maypole",
-"mousetrap",
-"spider web",
-"trilobite",
-"harvestman",
-"scorpion",
-"black and gold garden spider",
-"barn spider",
-"garden spider",
-"black widow",
-"tarantula",
-"wolf spider",
-"tick",
-"centipede",
-"isopod",
-"Dungeness crab",
-"rock crab",
-"fiddler crab",
-"king crab",
-"American lobster",
-"spiny lobster",
-"crayfish",
-"hermit crab",
-"tiger beetle",
-"ladybug",
-"ground beetle",
-"long-horned beetle",
-"leaf beetle",
-"dung beetle",
-"rhinoceros beetle",
-"weevil",
-"fly",
-"bee",
-"grasshopper",
-"cricket",
-"walking stick",
-"cockroach",
-"mantis",
-"cicada",
-"leafhopper",
-"lacewing",
-"dragonfly",
-"damselfly",
-"admiral",
-"ringlet",
-"monarch",
-"cabbage butterfly",
-"sulphur butterfly",
-"lycaenid",
-"jellyfish",
-"sea anemone",
-"brain coral",
-"flatworm",
-"nematode",
-"conch",
-"snail",
-"slug",
-"sea slug",
-"chiton",
-"sea urchin",
-"sea cucumber",
-"iron",
-"espresso maker",
-"microwave",
-"Dutch oven",
-"rotisserie",
-"toaster",
-"waffle iron",
-"vacuum",
-"dishwasher",
-"refrigerator",
-"washer",
-"Crock Pot",
-"frying pan",
-"wok",
-"caldron",
-"coffeepot",
-"teapot",
-"spatula",
-"altar",
-"triumphal arch",
-"patio",
-"steel arch bridge",
-"suspension bridge",
-"viaduct",
-"barn",
-"greenhouse",
-"palace",
-"monastery",
-"library",
-"apiary",
-"boathouse",
-"church",
-"mosque",
-"stupa",
-"planetarium",
-"restaurant",
-"cinema",
-"home theater",
-"lumbermill",
-"coil",
-"obelisk",
-"totem pole",
-"castle",
-"prison",
-"grocery store",
-"bakery",
-"barbershop",
-"bookshop",
-"butcher shop",
-"confectionery",
-"shoe shop",
-"tobacco shop",
-"toyshop",
-"fountain",
-"cliff dwelling",
-"yurt",
-"dock",
-"brass",
-"megalith",
-"bannister",
-"breakwater",
-"dam",
-"chainlink fence",
-"picket fence",
-"worm fence",
-"stone wall",
-"grille",
-"sliding door",
-"turnstile",
-"mountain tent",
-"scoreboard",
-"honeycomb",
-"plate rack",
-"pedestal",
-"beacon",
-"mashed potato",
-"bell pepper",
-"head cabbage",
-"broccoli",
-"cauliflower",
-"zucchini",
-"spaghetti squash",
-"acorn squash",
-"butternut squash",
-"cucumber",
-"artichoke",
-"cardoon",
-"mushroom",
-"shower curtain",
-"jean",
-"carton",
-"handkerchief",
-"sandal",
-"ashcan",
-"safe",
-"plate",
-"necklace",
-"croquet ball",
-"fur coat",
-"thimble",
-"pajama",
-"running shoe",
-"cocktail shaker",
-"chest",
-"manhole cover",
-"modem",
-"tub",
-"tray",
-"balance beam",
-"bagel",
-"prayer rug",
-"kimono",
-"hot pot",
-"whiskey jug",
-"knee pad",
-"book jacket",
-"spindle",
-"ski mask",
-"beer bottle",
-"crash helmet",
-"bottlecap",
-"tile roof",
-"mask",
-"maillot",
-"Petri dish",
-"football helmet",
-"bathing cap",
-"teddy",
-"holster",
-"pop bottle",
-"photocopier",
-"vestment",
-"crossword puzzle",
-"golf ball",
-"trifle",
-"suit",
-"water tower",
-"feather boa",
-"cloak",
-"red wine",
-"drumstick",
-"shield",
-"Christmas stocking",
-"hoopskirt",
-"menu",
-"stage",
-"bonnet",
-"meat loaf",
-"baseball",
-"face powder",
-"scabbard",
-"sunscreen",
-"beer glass",
-"hen-of-the-woods",
-"guacamole",
-"lampshade",
-"wool",
-"hay",
-"bow tie",
-"mailbag",
-"water jug",
-"bucket",
-"dishrag",
-"soup bowl",
-"eggnog",
-"mortar",
-"trench coat",
-"paddle",
-"chain",
-"swab",
-"mixing bowl",
-"potpie",
-"wine bottle",
-"shoji",
-"bulletproof vest",
-"drilling platform",
-"binder",
-"cardigan",
-"sweatshirt",
-"pot",
-"birdhouse",
-"hamper",
-"ping-pong ball",
-"pencil box",
-"pay-phone",
-"consomme",
-"apron",
-"punching bag",
-"backpack",
-"groom",
-"bearskin",
-"pencil sharpener",
-"broom",
-"mosquito net",
-"abaya",
-"mortarboard",
-"poncho",
-"crutch",
-"Polaroid camera",
-"space bar",
-"cup",
-"racket",
-"traffic light",
-"quill",
-"radio",
-"dough",
-"cuirass",
-"military uniform",
-"lipstick",
-"shower cap",
-"monitor",
-"oscilloscope",
-"mitten",
-"brassiere",
-"French loaf",
-"vase",
-"milk can",
-"rugby ball",
-"paper towel",
-"earthstar",
-"envelope",
-"miniskirt",
-"cowboy hat",
-"trolleybus",
-"perfume",
-"bathtub",
-"hotdog",
-"coral fungus",
-"bullet train",
-"pillow",
-"toilet tissue",
-"cassette",
-"carpenter's kit",
-"ladle",
-"stinkhorn",
-"lotion",
-"hair spray",
-"academic gown",
-"dome",
-"crate",
-"wig",
-"burrito",
-"pill bottle",
-"chain mail",
-"theater curtain",
-"window shade",
-"barrel",
-"washbasin",
-"ballpoint",
-"basketball",
-"bath towel",
-"cowboy boot",
-"gown",
-"window screen",
-"agaric",
-"cellular telephone",
-"nipple",
-"barbell",
-"mailbox",
-"lab coat",
-"fire screen",
-"minibus",
-"packet",
-"maze",
-"pole",
-"horizontal bar",
-"sombrero",
-"pickelhaube",
-"rain barrel",
-"wallet",
-"cassette player",
-"comic book",
-"piggy bank",
-"street sign",
-"bell cote",
-"fountain pen",
-"Windsor tie",
-"volleyball",
-"overskirt",
-"sarong",
-"purse",
-"bolo tie",
-"bib",
-"parachute",
-"sleeping bag",
-"television",
-"swimming trunks",
-"measuring cup",
-"espresso",
-"pizza",
-"breastplate",
-"shopping basket",
-"wooden spoon",
-"saltshaker",
-"chocolate sauce",
-"ballplayer",
-"goblet",
-"gyromitra",
-"stretcher",
-"water bottle",
-"dial telephone",
-"soap dispenser",
-"jersey",
-"school bus",
-"jigsaw puzzle",
-"plastic bag",
-"reflex camera",
-"diaper",
-"Band Aid",
-"ice lolly",
-"velvet",
-"tennis ball",
-"gasmask",
-"doormat",
-"Loafer",
-"ice cream",
-"pretzel",
-"quilt",
-"maillot",
-"tape player",
-"clog",
-"iPod",
-"bolete",
-"scuba diver",
-"pitcher",
-"matchstick",
-"bikini",
-"sock",
-"CD player",
-"lens cap",
-"thatch",
-"vault",
-"beaker",
-"bubble",
-"cheeseburger",
-"parallel bars",
-"flagpole",
-"coffee mug",
-"rubber eraser",
-"stole",
-"carbonara",
-"dumbbell",
-"singles",
-"Virginia deer",
-"eastern grey squirrel",
-"gelding",
-"pylon",
-"table-tennis table",
-"peacock",
-"Segway",
-"surfing",
-"tamandua",
-"knocker",
-"steering wheel",
-"motorcycling",
-"coati",
-"sitar",
-"range",
-"backhoe",
-"agaric",
-"dashboard",
-"water polo",
-"concrete mixer",
-"treadmill",
-"golf bag",
-"skateboarding",
-"royal tennis",
-"tartan",
-"four-wheel drive",
-"sport utility",
-"sedan",
-"print",
-"luggage rack",
-"softball",
-"windmill",
-"ben",
-"red admiral",
-"jalousie",
-"towel rail",
-"truss",
-"strand",
-"ice hockey",
-"sconce",
-"wind turbine",
-"plush",
-"stained-glass window",
-"ballpark",
-"thoroughbred",
-"love seat",
-"red-spotted purple",
-"miller",
-"Adelie",
-"freight liner",
-"clock tower",
-"acrobatics",
-"shaving brush",
-"ewe",
-"ottoman",
-"African violet",
-"bicycle wheel",
-"cork",
-"windmill",
-"satin",
-"comma",
-"coffee mill",
-"baggage",
-"wasp's nest",
-"batting glove",
-"Ferris wheel",
-"push-bike",
-"porthole",
-"football stadium",
-"gas tank",
-"barbecue",
-"handlebar",
-"hula-hoop",
-"fairground",
-"rapier",
-"garter stitch",
-"exercise bike",
-"control tower",
-"carryall",
-"minute hand",
-"cog",
-"riverbank",
-"water nymph",
-"common dandelion",
-"android",
-"hairbrush",
-"redberry",
-"fret",
-"display window",
-"pepper mill",
-"litterbin",
-"drapery",
-"ducking",
-"fly-fishing",
-"broad jump",
-"sprinkler",
-"water-skiing",
-"chicory",
-"sail",
-"volleyball",
-"rugby",
-"Texas bluebonnet",
-"computer monitor",
-"tortoiseshell",
-"airplane propeller",
-"solar array",
-"figure skating",
-"air conditioner",
-"purple loosestrife",
-"gearshift",
-"outboard motor",
-"cowslip",
-"Abyssinian",
-"dip",
-"workstation",
-"cosy",
-"bunker",
-"neon lamp",
-"campanile",
-"casket",
-"verbena",
-"amphora",
-"sumo",
-"common foxglove",
-"sprocket",
-"jelly bean",
-"emperor penguin",
-"night-blooming cereus",
-"clock radio",
-"black birch",
-"bomber jacket",
-"Virginia bluebell",
-"bayonet",
-"walker",
-"altarpiece",
-"tattoo",
-"bridle",
-"rocker arm",
-"water turkey",
-"spiderwort",
-"flange",
-"mute swan",
-"laser printer",
-"carburetor",
-"coverlet",
-"mountainside",
-"baritone",
-"auto racing",
-"baluster",
-"gal",
-"peach bells",
-"taffeta",
-"grandfather",
-"asparagus",
-"horizontal stabilizer",
-"world",
-"grate",
-"marsh marigold",
-"white rhinoceros",
-"movement",
-"split rail",
-"rollerblading",
-"longhorn",
-"muffler",
-"church tower",
-"light bulb",
-"American agave",
-"backpacking tent",
-"overall",
-"New World goldfinch",
-"sectional",
-"wing chair",
-"transom",
-"integrated circuit",
-"dad",
-"spar",
-"picture frame",
-"no-hit game",
-"alternator",
-"drill press",
-"strawflower",
-"hepatica",
-"rangefinder",
-"blinker",
-"Welsh pony",
-"nib",
-"wagon wheel",
-"rotor",
-"tie",
-"denim",
-"jetliner",
-"sculling",
-"external drive",
-"window frame",
-"mourning dove",
-"censer",
-"stapler",
-"batting helmet",
-"flagon",
-"machete",
-"windshield",
-"hedgehog",
-"weeping willow",
-"chief executive officer",
-"hepatica",
-"pet",
-"Asiatic black bear",
-"chinchilla",
-"uke",
-"Atlantic bottlenose dolphin",
-"hair",
-"dishtowel",
-"flintlock",
-"Bermuda shorts",
-"lavender",
-"searchlight",
-"millwheel",
-"piano keyboard",
-"luna moth",
-"bumper",
-"parrot",
-"skirt",
-"manhole",
-"coffee table",
-"footstool",
-"judo",
-"Dalai Lama",
-"armored personnel carrier",
-"voile",
-"saber",
-"thoroughbred",
-"wild carrot",
-"gemsbok",
-"caster",
-"butterfly orchid",
-"cow",
-"sideboard",
-"horseshoe crab",
-"match play",
-"cassette recorder",
-"photomicrograph",
-"drafting table",
-"pediment",
-"tramline",
-"shipping",
-"kitten",
-"wainscoting",
-"fried rice",
-"helix",
-"marguerite",
-"pumpkin",
-"white-bellied swallow",
-"Tulipa gesneriana",
-"common dolphin",
-"face",
-"red squirrel",
-"bicycling",
-"shipwreck",
-"banded purple",
-"cornice",
-"pendant earring",
-"forsythia",
-"aardvark",
-"seashell",
-"spat",
-"shoulder bag",
-"fallow deer",
-"yearling",
-"common teasel",
-"tufted titmouse",
-"ancient",
-"professional golf",
-"purl",
-"vehicle",
-"okra",
-"great grandmother",
-"common lilac",
-"rose mallow",
-"newspaper",
-"crucifix",
-"chukka",
-"armlet",
-"fulmar",
-"wapiti",
-"doily",
-"Greco-Roman wrestling",
-"bleeding heart",
-"kitchen table",
-"bluebonnet",
-"Cape buffalo",
-"spun yarn",
-"crape myrtle",
-"dewdrop",
-"great blue heron",
-"medalist",
-"vaulting horse",
-"spinning wheel",
-"skyscraper",
-"Tahitian",
-"forget-me-not",
-"watercourse",
-"guitarist",
-"gargoyle",
-"bee balm",
-"pumpkin",
-"hunting knife",
-"flutist",
-"lectern",
-"skateboarder",
-"foil",
-"pant leg",
-"hedge sparrow",
-"dresser",
-"automatic pistol",
-"chicory",
-"dialog box",
-"chamberpot",
-"black rhinoceros",
-"fireweed",
-"half-mast",
-"pillow sham",
-"pavilion",
-"scarf joint",
-"microprocessor",
-"filly",
-"dressing gown",
-"shell",
-"Arabian",
-"child",
-"radio antenna",
-"butterweed",
-"morris dancer",
-"sparrow hawk",
-"groom",
-"brioche",
-"floret",
-"rainbow",
-"earthworm",
-"cellist",
-"tine",
-"toupee",
-"balldress",
-"map",
-"angel's trumpet",
-"ruin",
-"fur",
-"pronghorn",
-"speed skating",
-"used-car",
-"stick",
-"early spider orchid",
-"stuffed peppers",
-"snowdrift",
-"flats",
-"least sandpiper",
-"stick",
-"console table",
-"ventilator",
-"portable",
-"kepi",
-"pylon",
-"viceroy",
-"shoreline",
-"Olympian Zeus",
-"pestle",
-"great-niece",
-"life",
-"air compressor",
-"fanjet",
-"scuba diving",
-"fieldfare",
-"tree swallow",
-"personnel carrier",
-"night-blooming cereus",
-"sonogram",
-"assembly hall",
-"circuit breaker",
-"chair",
-"speed skate",
-"soapwort",
-"worsted",
-"raspberry",
-"burlap",
-"flat panel display",
-"Pyracantha",
-"cemetery",
-"turban",
-"deer hunting",
-"bottle green",
-"dandelion green",
-"pieta",
-"aigrette",
-"turntable",
-"cover girl",
-"clutch bag",
-"kiwi",
-"pea jacket",
-"color guard",
-"Malay",
-"shire",
-"crock",
-"french fries",
-"credenza",
-"hockey stick",
-"mourning cloak",
-"potty seat",
-"glass",
-"balsamroot",
-"medal play",
-"red clover",
-"gravy boat",
-"garter belt",
-"Guinness",
-"meadow buttercup",
-"jackass penguin",
-"coursing",
-"tooth",
-"hawfinch",
-"housetop",
-"fluorescent lamp",
-"black-backed gull",
-"bookshelf",
-"earplug",
-"millipede",
-"fawn",
-"baseball bat",
-"soup-strainer",
-"organ loft",
-"bugloss",
-"tomahawk",
-"blackcap",
-"black-necked stilt",
-"hand truck",
-"bedstead",
-"tempura",
-"rose window",
-"crimson",
-"snow thrower",
-"lesser whitethroat",
-"palomino",
-"ball",
-"staff sergeant",
-"wicker",
-"garbage heap",
-"great-nephew",
-"parquet",
-"coupe",
-"nave",
-"eggs Benedict",
-"damask",
-"flush toilet",
-"Angora",
-"pedometer",
-"control room",
-"bristle brush",
-"kookaburra",
-"telephone booth",
-"Windsor chair",
-"red-winged blackbird",
-"cinnamon roll",
-"briefs",
-"cloister",
-"sundress",
-"mammillaria",
-"unicyclist",
-"covered bridge",
-"coelogyne",
-"fairy bluebird",
-"phoebe",
-"beer mug",
-"headstock",
-"parhelion",
-"gorse",
-"common European dogwood",
-"fire-eater",
-"professional football",
-"rock climbing",
-"cyclamen",
-"tin",
-"marjoram",
-"Japanese morning glory",
-"pipe",
-"smasher",
-"hang glider",
-"abutment",
-"birdbath",
-"jotter",
-"litter",
-"artist's model",
-"butterfly bush",
-"dining area",
-"sausage dog",
-"piggery",
-"English sparrow",
-"Turk's-cap",
-"platinum blond",
-"song sparrow",
-"alarm clock",
-"tortoiseshell",
-"chaise longue",
-"flintlock",
-"academic costume",
-"graffito",
-"Arnica montana",
-"adding machine",
-"waterside",
-"director",
-"jonquil",
-"pipefitting",
-"stud",
-"Swedish meatball",
-"musk rose",
-"Venus's flytrap",
-"raven",
-"bougainvillea",
-"little brother",
-"field bindweed",
-"finder",
-"white admiral",
-"tinfoil",
-"serval",
-"sheet",
-"carthorse",
-"people",
-"potto",
-"stockroom",
-"sphinx",
-"slate roof",
-"mountain laurel",
-"majolica",
-"coal black",
-"repository",
-"bufo",
-"pique",
-"binder",
-"tread",
-"attorney general",
-"hydraulic press",
-"videocassette recorder",
-"bumper car",
-"professional baseball",
-"cow parsley",
-"ern",
-"blue peafowl",
-"common hyacinth",
-"jack-in-the-pulpit",
-"ice hockey rink",
-"sport",
-"camper",
-"tailback",
-"flash",
-"stacks",
-"pulp",
-"Christmas cactus",
-"netball",
-"calliandra",
-"curler",
-"large periwinkle",
-"cobweb",
-"forward",
-"Roman arch",
-"cross bun",
-"stoneware",
-"banana bread",
-"cape jasmine",
-"settle",
-"tongue",
-"frock",
-"pepper shaker",
-"pitching coach",
-"CD-R",
-"casing",
-"faience",
-"hand cream",
-"CD-ROM",
-"recliner",
-"striped bass",
-"clary",
-"sketch",
-"risotto",
-"reticle",
-"white clover",
-"touch football",
-"kitty",
-"great-aunt",
-"Japanese maple",
-"sidecar",
-"muscovy duck",
-"hack",
-"rope bridge",
-"organist",
-"stinging nettle",
-"pocket watch",
-"Indian pipe",
-"amorphophallus",
-"bird's-foot violet",
-"caller ID",
-"furnishing",
-"carriageway",
-"dish rack",
-"heiress",
-"nail polish",
-"beldam",
-"Dall sheep",
-"teriyaki",
-"stateroom",
-"laughing gull",
-"chow",
-"bookmark",
-"timer",
-"toga virilis",
-"deviled egg",
-"coltsfoot",
-"Papuan",
-"native",
-"cygnet",
-"automation",
-"portfolio",
-"cabbage palm",
-"cube",
-"broiler",
-"radish",
-"broodmare",
-"castor-oil plant",
-"pith hat",
-"talus",
-"lass",
-"thatch",
-"common marigold",
-"young buck",
-"igloo",
-"prairie rattlesnake",
-"soccer player",
-"spoke",
-"place",
-"slide fastener",
-"tapestry",
-"toy",
-"headboard",
-"cross-country skiing",
-"harness",
-"sconce",
-"rim",
-"ballet skirt",
-"transvestite",
-"saddlebag",
-"common evening primrose",
-"taillight",
-"challah",
-"willet",
-"ready-to-wear",
-"cloud",
-"answering machine",
-"waterfront",
-"vane",
-"granddaughter",
-"Chinese gooseberry",
-"tureen",
-"cab",
-"truffle",
-"viola",
-"bootlace",
-"chemise",
-"taro",
-"petal",
-"candied apple",
-"soccer",
-"miniature golf",
-"front porch",
-"asparagus",
-"Sauvignon blanc",
-"daisy fleabane",
-"ceiling",
-"slip-on",
-"bottle-nosed whale",
-"redbud",
-"black squirrel",
-"snowsuit",
-"ribbing",
-"gravestone",
-"creme brulee",
-"ambassador",
-"local",
-"archery",
-"love-in-a-mist",
-"garbage",
-"thyme",
-"night-blooming cereus",
-"goshawk",
-"cuckoopint",
-"azure",
-"German iris",
-"salad bowl",
-"puppy",
-"cockhorse",
-"giant clam",
-"biplane",
-"stele",
-"necklet",
-"sea otter",
-"crest",
-"door",
-"reformer",
-"comforter",
-"Byelorussian",
-"bottle",
-"hemline",
-"book bag",
-"leotard",
-"owlet",
-"spoon",
-"sari",
-"bidet",
-"Latin",
-"reticulated python",
-"bowling shoe",
-"futon",
-"gaiter",
-"coypu",
-"tea urn",
-"waders",
-"bangle",
-"snowbank",
-"pencil",
-"porter",
-"azalea",
-"English lavender",
-"red spruce",
-"team sport",
-"cruet",
-"high-rise",
-"O ring",
-"vodka",
-"cormorant",
-"Canada thistle",
-"clasp",
-"showjumping",
-"rattan",
-"red fox",
-"sun parlor",
-"Charolais",
-"Tommy gun",
-"bird's foot trefoil",
-"sedge warbler",
-"knot",
-"chives",
-"car tire",
-"steam engine",
-"adapter",
-"spirea",
-"common allamanda",
-"oyster shell",
-"harbor seal",
-"baobab",
-"wick",
-"plumbago",
-"downy woodpecker",
-"coconut",
-"leash",
-"kasbah",
-"hour hand",
-"upholstery",
-"mallard",
-"cricket bat",
-"lady",
-"kitchenware",
-"right-hander",
-"leopard",
-"olive green",
-"common valerian",
-"blue whale",
-"blackboard",
-"redhead",
-"periwinkle",
-"fingerboard",
-"hard hat",
-"locker",
-"breakfast table",
-"capybara",
-"beekeeper",
-"harness",
-"feeder",
-"water hyacinth",
-"hexapod",
-"brown thrasher",
-"percale",
-"lever",
-"patriarch",
-"arete",
-"book",
-"book",
-"senator",
-"bunya bunya",
-"couch",
-"durian",
-"common lady's-slipper",
-"mountain ash",
-"golden barrel cactus",
-"bicycle seat",
-"beret",
-"pop",
-"musk mallow",
-"manatee",
-"cotton candy",
-"boxing glove",
-"backboard",
-"tongue",
-"saguaro",
-"playground",
-"capitol",
-"sanderling",
-"wagtail",
-"deputy",
-"tractor",
-"tap",
-"lady's smock",
-"noseband",
-"worsted",
-"radiotelephone",
-"camisole",
-"forelock",
-"muscat",
-"sweet scabious",
-"crane fly",
-"butterfly weed",
-"chestnut",
-"pinata",
-"inositol",
-"borage",
-"aquatic",
-"belly",
-"broadcaster",
-"gondolier",
-"egg yolk",
-"blush wine",
-"bufflehead",
-"rambutan",
-"oleander",
-"horse-trail",
-"sea holly",
-"yard bird",
-"conference room",
-"lacrosse",
-"belted kingfisher",
-"defile",
-"extremum",
-"whistle",
-"bear cub",
-"grainfield",
-"potage",
-"watermelon",
-"lasagna",
-"sheik",
-"Cooper's hawk",
-"bulb",
-"basketball court",
-"paella",
-"cassette tape",
-"scatter rug",
-"kid",
-"impala lily",
-"Minnesotan",
-"Sudanese",
-"chocolate",
-"tail",
-"quack-quack",
-"whistling swan",
-"shoulder patch",
-"frozen custard",
-"sumo wrestler",
-"smoothie",
-"bock",
-"meat grinder",
-"latch",
-"palisade",
-"radial",
-"sake",
-"kestrel",
-"corn chowder",
-"airframe",
-"electrician",
-"reamer",
-"metropolitan",
-"cotton flannel",
-"cassowary",
-"crossbill",
-"operating room",
-"winter aconite",
-"flute",
-"Tasmanian devil",
-"billboard",
-"suds",
-"kilt",
-"aperitif",
-"cooling tower",
-"avocado",
-"hooded merganser",
-"coleslaw",
-"bee balm",
-"ladder-back",
-"insurance broker",
-"scaffolding",
-"polo mallet",
-"double bed",
-"two-hitter",
-"bluff",
-"gamboge",
-"baby",
-"lawn chair",
-"frond",
-"pistol grip",
-"fancy dress",
-"marquetry",
-"jambalaya",
-"fireweed",
-"Eurasian kingfisher",
-"cue ball",
-"ice plant",
-"horseweed",
-"rose moss",
-"musher",
-"sun",
-"viscount",
-"white-breasted nuthatch",
-"gin and tonic",
-"thermos",
-"Kenyan",
-"first-aid kit",
-"four-wheeler",
-"tourist",
-"stairwell",
-"Gambian",
-"liqueur glass",
-"hovercraft",
-"cocktail dress",
-"twin",
-"coriander",
-"blister pack",
-"Barrow's goldeneye",
-"canteen",
-"irrigation ditch",
-"great white heron",
-"tree sparrow",
-"canal boat",
-"lens",
-"food processor",
-"common raccoon",
-"Baltimore oriole",
-"black-eyed Susan",
-"bush hibiscus",
-"corolla",
-"sire",
-"mustachio",
-"professional wrestling",
-"elk",
-"clustered bellflower",
-"pannier",
-"musk ox",
-"crapaud",
-"animal trainer",
-"rosebud",
-"ring-necked pheasant",
-"little egret",
-"cappuccino",
-"rocker",
-"bristlecone pine",
-"cheerleader",
-"hedge violet",
-"semaphore",
-"central processing unit",
-"speedskater",
-"delivery truck",
-"assembly",
-"hedgehog cactus",
-"bergenia",
-"bull thistle",
-"bladder campion",
-"cinquefoil",
-"inula",
-"cellulose tape",
-"main rotor",
-"bootee",
-"autogiro",
-"ice",
-"grey",
-"meadow cranesbill",
-"hummus",
-"valise",
-"chassis",
-"mountain goat",
-"blacktail prairie dog",
-"Chardonnay",
-"romper",
-"street",
-"shoveler",
-"wood ibis",
-"topiary",
-"chalice",
-"silo",
-"circus acrobat",
-"Rollerblade",
-"cosmos",
-"woof",
-"heroine",
-"cold cream",
-"marabou",
-"herb robert",
-"garden lettuce",
-"nymph",
-"floor lamp",
-"automobile engine",
-"heel",
-"radiator",
-"seeded player",
-"fedora",
-"father-in-law",
-"peahen",
-"Bahamian",
-"wiper",
-"wood pigeon",
-"barn owl",
-"pegboard",
-"chorus frog",
-"kin",
-"roller skate",
-"stob",
-"rosemary",
-"cowbird",
-"hortensia",
-"cranberry sauce",
-"shot glass",
-"Dixie cup",
-"gnu",
-"fire alarm",
-"diet",
-"booster",
-"oxeye daisy",
-"twayblade",
-"high-definition television",
-"truss bridge",
-"bunk bed",
-"mule",
-"blackbuck",
-"facsimile",
-"frog orchid",
-"point-and-shoot camera",
-"brocade",
-"gazebo",
-"prairie gentian",
-"concert",
-"paintball",
-"Cognac",
-"maid",
-"afghan",
-"barbecued spareribs",
-"pintail",
-"tramway",
-"commissioner",
-"finger-painting",
-"beef stew",
-"caftan",
-"Aberdeen Angus",
-"demonstrator",
-"sea trout",
-"pigtail",
-"thrush nightingale",
-"barbados cherry",
-"sashimi",
-"ridgeling",
-"lamppost",
-"gabardine",
-"red-shouldered hawk",
-"bath salts",
-"cavern",
-"cymbid",
-"Haitian",
-"boater",
-"southern buckthorn",
-"arctic",
-"motorcycle cop",
-"red gum",
-"Clydesdale",
-"Zamboni",
-"beagling",
-"villa",
-"demitasse",
-"Sheetrock",
-"lollipop",
-"hybrid petunia",
-"post horse",
-"carabiner",
-"brussels sprouts",
-"Durham",
-"stylist",
-"pothole",
-"sleigh bed",
-"scallop shell",
-"harrier eagle",
-"papaya",
-"Japanese persimmon",
-"sachet",
-"wild rice",
-"chipboard",
-"gun enclosure",
-"menorah",
-"chinook",
-"headset",
-"white campion",
-"ocean",
-"Secretary of State",
-"G-string",
-"bone china",
-"basil",
-"greenish blue",
-"camcorder",
-"concrete",
-"screech owl",
-"trumpet honeysuckle",
-"flugelhorn",
-"layette",
-"cattle egret",
-"case knife",
-"mandarin duck",
-"robber fly",
-"salwar",
-"dressing table",
-"doughnut",
-"facade",
-"runner",
-"honeypot",
-"surf casting",
-"diver",
-"angel's trumpet",
-"spin dryer",
-"chameleon",
-"wand",
-"snow",
-"vitamin A1",
-"manageress",
-"volleyball net",
-"antiperspirant",
-"street clothes",
-"tree sparrow",
-"cords",
-"sundew",
-"bricks and mortar",
-"caryatid",
-"bridesmaid",
-"trestle bridge",
-"eyepiece",
-"celebrant",
-"scarlet pimpernel",
-"gas range",
-"onion",
-"green salad",
-"squill",
-"creepy-crawly",
-"hunk",
-"little owl",
-"salad nicoise",
-"earflap",
-"bird feeder",
-"spray gun",
-"bunny",
-"Cheops",
-"amazon",
-"blue tit",
-"Nissen hut",
-"Kalashnikov",
-"skylark",
-"kremlin",
-"shoebill",
-"shopping bag",
-"frigate bird",
-"telephoto lens",
-"peplum",
-"moss pink",
-"echidna",
-"wastepaper basket",
-"wood ibis",
-"workroom",
-"ankle brace",
-"telpherage",
-"Michaelmas daisy",
-"figure skate",
-"swami",
-"nylons",
-"cardoon",
-"cocotte",
-"headstall",
-"twin bed",
-"parsley",
-"dirndl",
-"corn poppy",
-"nut bread",
-"cloche",
-"light heavyweight",
-"mayor",
-"lip-gloss",
-"punch bowl",
-"pottage",
-"mango",
-"fledgling",
-"mousse",
-"four-wheel drive",
-"barrel",
-"banana boat",
-"trouser",
-"bathroom",
-"Sauterne",
-"ring",
-"settee",
-"lavaliere",
-"safe-deposit",
-"godson",
-"leatherette",
-"schoolmate",
-"radish",
-"hedge trimmer",
-"dahlia",
-"euphonium",
-"palace",
-"vaulter",
-"singlet",
-"slicer",
-"Pilsner",
-"cockateel",
-"kangaroo paw",
-"Cub Scout",
-"master bedroom",
-"hexagon",
-"cenotaph",
-"Barberton daisy",
-"Netherlander",
-"intersection",
-"Korean",
-"gravel",
-"chandelier",
-"hospital bed",
-"flash memory",
-"pier",
-"whole wheat flour",
-"maroon",
-"pale ale",
-"special",
-"snow bunting",
-"crinoline",
-"dustpan",
-"barrette",
-"common wood sorrel",
-"yolk",
-"pothos",
-"speakerphone",
-"tendril",
-"cabinetwork",
-"farm horse",
-"brake disk",
-"streetlight",
-"superhighway",
-"bandsaw",
-"panting",
-"pressure cooker",
-"girdle",
-"old man",
-"cereal bowl",
-"felt",
-"hurling",
-"architecture",
-"harmonium",
-"chain",
-"blueberry",
-"cellar",
-"smocking",
-"scrub brush",
-"tablespoon",
-"sweet corn",
-"graining",
-"library",
-"street",
-"bill",
-"felt-tip pen",
-"monkshood",
-"crowd",
-"log cabin",
-"newel post",
-"hack",
-"elephant seal",
-"golden pothos",
-"popcorn",
-"outhouse",
-"patch pocket",
-"fish and chips",
-"tape",
-"wax plant",
-"eaves",
-"fried egg",
-"emerald",
-"tea cart",
-"fan blade",
-"daily",
-"Bowie knife",
-"rowing boat",
-"leaf shape",
-"man",
-"crayon",
-"trumpetfish",
-"chipping sparrow",
-"whiskey bottle",
-"pillion",
-"city hall",
-"golden pheasant",
-"cheerleader",
-"creeping bugle",
-"couch",
-"Dumpster",
-"Homo sapiens sapiens",
-"cranberry juice",
-"cockpit",
-"demagogue",
-"joinery",
-"scrambled eggs",
-"technician",
-"sidewalk",
-"sheep",
-"keyhole",
-"power line",
-"polyanthus",
-"roulette",
-"first lieutenant",
-"checkout",
-"tabletop",
-"nasturtium",
-"schnapps",
-"engineering",
-"skateboard",
-"ground fir",
-"bouquet",
-"bunk",
-"resort area",
-"fleur-de-lis",
-"power steering",
-"opera",
-"Bolivian",
-"Friesian",
-"buckskins",
-"bay",
-"slider",
-"frozen yogurt",
-"cabin cruiser",
-"saunterer",
-"lean-to",
-"fishing eagle",
-"bog star",
-"cantaloupe",
-"mouth",
-"music stand",
-"fiddlestick",
-"brilliantine",
-"pinball machine",
-"bairn",
-"barred owl",
-"bath oil",
-"signorina",
-"Mason jar",
-"nymph",
-"rubber band",
-"garden nasturtium",
-"razorbill",
-"Japanese beetle",
-"batting cage",
-"trestle",
-"borage",
-"Secretary of the Interior",
-"scanner",
-"baguet",
-"baseball cap",
-"chow mein",
-"pen",
-"jewelweed",
-"barbet",
-"chasm",
-"pectoral sandpiper",
-"holster",
-"glasses case",
-"sand",
-"crevice",
-"Kickapoo",
-"snowboard",
-"locket",
-"satchel",
-"tankard",
-"alpinist",
-"moorhen",
-"cow pen",
-"whooper",
-"crown",
-"chain",
-"silversword",
-"wild geranium",
-"hi-fi",
-"Tibetan",
-"waterwheel",
-"bee orchid",
-"ruby-crowned kinglet",
-"common broom",
-"tabloid",
-"javelin",
-"sauna",
-"klammath weed",
-"zebra finch",
-"spider orchid",
-"velour",
-"chiffon",
-"lecture room",
-"barrel",
-"loggia",
-"millstone",
-"flatlet",
-"soupspoon",
-"econometrician",
-"golf-club head",
-"daphnia",
-"parlor",
-"fire-eater",
-"juggler",
-"attache case",
-"hay bale",
-"kisser",
-"knitting needle",
-"news magazine",
-"flatbed",
-"Senegalese",
-"trumpeter",
-"trampoline",
-"brogan",
-"bone",
-"caftan",
-"lobster pot",
-"gazpacho",
-"anthill",
-"ramekin",
-"mainsail",
-"penitentiary",
-"spotted flycatcher",
-"cookstove",
-"root beer",
-"broom beard grass",
-"pogo stick",
-"plywood",
-"epee",
-"gas oven",
-"Global Positioning System",
-"sweet false chamomile",
-"breakfast area",
-"bullring",
-"second cousin",
-"wave",
-"decolletage",
-"rodeo",
-"won ton",
-"swastika",
-"bobby pin",
-"papaw",
-"retaining wall",
-"Muscadet",
-"heavyweight",
-"energizer",
-"banner",
-"amusement park",
-"whinchat",
-"drugstore",
-"waxwork",
-"meander",
-"congee",
-"heat sink",
-"switch grass",
-"commuter",
-"peony",
-"western white pine",
-"wild raspberry",
-"nightgown",
-"saute",
-"cardinal",
-"claret",
-"pollinator",
-"biryani",
-"pina colada",
-"cassette deck",
-"European sandpiper",
-"block",
-"flan",
-"birdcage",
-"baby",
-"lieutenant colonel",
-"ticking",
-"European white lily",
-"dog violet",
-"coat hanger",
-"premature baby",
-"organza",
-"string bean",
-"balloonist",
-"hurricane deck",
-"window box",
-"hang glider",
-"bullfighting",
-"piste",
-"seahorse",
-"hard cider",
-"batik",
-"common mullein",
-"petite marmite",
-"stuffed mushroom",
-"tequila",
-"ground ivy",
-"fountain grass",
-"stray",
-"putter",
-"buffer",
-"comet",
-"bomber",
-"woodcarving",
-"baseball glove",
-"halter",
-"garnish",
-"selvage",
-"megaphone",
-"sea fan",
-"rabbit hutch",
-"very important person",
-"analog watch",
-"long-head coneflower",
-"northern pike",
-"roll-on",
-"cigarette butt",
-"terraced house",
-"penknife",
-"windshield wiper",
-"cricket",
-"straightener",
-"snow pea",
-"cockerel",
-"canister",
-"sour bread",
-"recovery room",
-"toilet bowl",
-"tyrannosaur",
-"big sister",
-"quartz battery",
-"television receiver",
-"vitamin C",
-"tailpipe",
-"field thistle",
-"stonechat",
-"col",
-"monstrance",
-"gift wrapping",
-"herbivore",
-"quarter horse",
-"ice-cream sundae",
-"rumpus room",
-"eyepatch",
-"clary sage",
-"French lavender",
-"snorkel",
-"choir",
-"tent-fly",
-"cat box",
-"horse racing",
-"high priest",
-"barrel cactus",
-"pin oak",
-"wild thyme",
-"keyboardist",
-"raiser",
-"hammock",
-"hail",
-"bungee",
-"chocolate mousse",
-"major",
-"buzzard",
-"gopher tortoise",
-"Chablis",
-"water meter",
-"benthos",
-"donna",
-"blender",
-"Mauser",
-"avocet",
-"rye",
-"mulch",
-"chancel",
-"dusty miller",
-"mate",
-"corbel",
-"minaret",
-"frittata",
-"French toast",
-"mosaic",
-"home brew",
-"water faucet",
-"beard",
-"swivel chair",
-"acropolis",
-"largemouth",
-"abbey",
-"tabby",
-"driver",
-"copperhead",
-"stirrup",
-"Boston fern",
-"Tennessee walker",
-"artichoke",
-"honor guard",
-"chapatti",
-"enchantress",
-"sweat pants",
-"electric organ",
-"column",
-"dry vermouth",
-"range hood",
-"Red Delicious",
-"rape",
-"splint",
-"catapult",
-"gourd",
-"antipasto",
-"plaza",
-"carnation",
-"star",
-"wood anemone",
-"English primrose",
-"male fern",
-"boot",
-"atrium",
-"Japanese deer",
-"carnivore",
-"yearling",
-"doe",
-"guelder rose",
-"chicory",
-"stretch pants",
-"ice-cream cake",
-"frogfish",
-"tarpaulin",
-"chicken soup",
-"balaclava",
-"tor",
-"feverfew",
-"three-hitter",
-"flyweight",
-"aqua vitae",
-"locker room",
-"wether",
-"teacup",
-"wide-angle lens",
-"hook",
-"ladder-back",
-"osprey",
-"awning",
-"wedding",
-"chest protector",
-"pooch",
-"rose mallow",
-"orange daisy",
-"fondant",
-"envelope",
-"duckling",
-"blackberry",
-"goosander",
-"snorkeling",
-"philatelist",
-"broad bean",
-"Frank",
-"bok choy",
-"basket",
-"absinth",
-"cayenne",
-"blackbird",
-"bottled water",
-"trooper",
-"timber",
-"stable",
-"chestnut",
-"tomatillo",
-"bell",
-"banquet",
-"rainbow trout",
-"macrame",
-"appointee",
-"heart",
-"chipmunk",
-"purple clematis",
-"safety bicycle",
-"shuttle bus",
-"Japanese black pine",
-"lentil soup",
-"downhill",
-"field mustard",
-"brass",
-"hand-me-down",
-"greater yellowlegs",
-"fanny pack",
-"croquet mallet",
-"hip roof",
-"duffel bag",
-"Ritz",
-"document",
-"pie plant",
-"staff member",
-"lifeguard",
-"white-throated sparrow",
-"Cameroonian",
-"hydrofoil",
-"platter",
-"common ageratum",
-"middleweight",
-"chairlift",
-"brunch",
-"pharmacist",
-"lemon",
-"driveshaft",
-"green snake",
-"lip",
-"London plane",
-"mangrove",
-"crystal",
-"siskin",
-"common jasmine",
-"hollandaise",
-"villa",
-"cross-country riding",
-"mother-in-law's tongue",
-"generator",
-"Tanzanian",
-"whisk",
-"seeder",
-"ashtray",
-"griddle",
-"evening bag",
-"bluebird",
-"bran muffin",
-"square dancer",
-"luggage compartment",
-"tropical pitcher plant",
-"autofocus",
-"tape drive",
-"silencer",
-"Hawaiian guitar",
-"swamp sparrow",
-"Zimbabwean",
-"drawing room",
-"weekender",
-"liparis",
-"streambed",
-"samosa",
-"hitter",
-"water heater",
-"tidal basin",
-"ossuary",
-"dik-dik",
-"camouflage",
-"fiance",
-"Jordanian",
-"rolling pin",
-"slingback",
-"turret",
-"hen",
-"jennet",
-"playpen",
-"woodhewer",
-"bushing",
-"church bell",
-"bear grass",
-"double knit",
-"tennis pro",
-"Joe-Pye weed",
-"pave",
-"pochard",
-"painted beauty",
-"crinoline",
-"gumbo",
-"trestle table",
-"schnitzel",
-"balloon flower",
-"Turkish coffee",
-"extension cord",
-"wireless local area network",
-"sluice",
-"umbel",
-"microeconomist",
-"sky",
-"aisle",
-"commander in chief",
-"hydroplane racing",
-"poll",
-"Coca Cola",
-"fuel injection",
-"bird pepper",
-"monkey puzzle",
-"English muffin",
-"riverbed",
-"varietal",
-"kachina",
-"airport",
-"saltwort",
-"oolong",
-"red-hot poker",
-"mihrab",
-"cocoa",
-"jersey",
-"Walkman",
-"syndic",
-"Hessian boot",
-"millstone",
-"carpenter",
-"outfall",
-"curbstone",
-"mocha",
-"field pansy",
-"patriarch",
-"slacks",
-"switchblade",
-"killdeer",
-"whelk",
-"pampas grass",
-"racquetball",
-"platform bed",
-"Indian rhinoceros",
-"Japanese iris",
-"blacktop",
-"dinner jacket",
-"stud",
-"jodhpurs",
-"telephone pole",
-"business district",
-"kurta",
-"basil",
-"handset",
-"file folder",
-"gloriosa",
-"orphan",
-"cantle",
-"cookie sheet",
-"cafe au lait",
-"drawbridge",
-"hill myna",
-"Western diamondback",
-"watch case",
-"cardcase",
-"bowling alley",
-"mattress cover",
-"canvasback",
-"pompadour",
-"cornice",
-"matador",
-"cigar cutter",
-"skunk cabbage",
-"baptismal font",
-"bitters",
-"refectory",
-"egg",
-"parula warbler",
-"tiger lily",
-"field house",
-"nanny",
-"skin-diver",
-"soda water",
-"lymphocyte",
-"carport",
-"chocolate fudge",
-"amphitheater",
-"sugar candy",
-"sea hare",
-"open-face sandwich",
-"dessert spoon",
-"staple gun",
-"envelope",
-"worker bee",
-"general",
-"garment bag",
-"maypop",
-"autobahn",
-"Atlantic puffin",
-"polo shirt",
-"Humvee",
-"spice rack",
-"grotto",
-"banderillero",
-"gaillardia",
-"black-crowned night heron",
-"oboist",
-"weigela",
-"Dictaphone",
-"dwarf iris",
-"marsh mallow",
-"yarrow",
-"eccentric",
-"catsup",
-"jade green",
-"mistress",
-"henbit",
-"beachwear",
-"head",
-"commuter",
-"strawberry tree",
-"chickpea",
-"clothespin",
-"fleabane",
-"brussels sprout",
-"winter melon",
-"Laconian",
-"great horned owl",
-"caricaturist",
-"nan",
-"flowerbed",
-"triple sec",
-"dairy",
-"round of golf",
-"cardinal",
-"kauri",
-"Zulu",
-"Armagnac",
-"cowberry",
-"mouthpiece",
-"wild calla",
-"bling",
-"puppeteer",
-"beer drinker",
-"adder",
-"field sparrow",
-"chocolate pudding",
-"blacksmith",
-"finback",
-"Shetland pony",
-"cheese fondue",
-"panty girdle",
-"soda can",
-"electrolytic",
-"florist's chrysanthemum",
-"yellow jasmine",
-"tudung",
-"equalizer",
-"ridge",
-"dulcimer",
-"grappa",
-"barn swallow",
-"coneflower",
-"enamel",
-"poached egg",
-"halfback",
-"yak",
-"toby",
-"Fleet Street",
-"blue catfish",
-"sand tiger",
-"flying buttress",
-"snaffle",
-"stoop",
-"first base",
-"cultivated land",
-"first lady",
-"waratah",
-"headquarters",
-"arnica",
-"lovebird",
-"common morel",
-"parasol",
-"disk clutch",
-"Xerox",
-"vitamin P",
-"vitamin B12",
-"long sleeve",
-"certified public accountant",
-"hot pants",
-"pitch pine",
-"pantie",
-"drawers",
-"cake mix",
-"boar",
-"grey",
-"bride",
-"false sago",
-"bullion",
-"coach house",
-"bass guitar",
-"Japanese banana",
-"meadow clary",
-"black belt",
-"Canterbury bell",
-"smallmouth",
-"treadmill",
-"great white heron",
-"enchilada",
-"rummer",
-"captain",
-"camisole",
-"wild garlic",
-"oak fern",
-"ultramarine",
-"peach",
-"hawkweed",
-"autostrada",
-"adit",
-"anaconda",
-"artwork",
-"skinhead",
-"jello",
-"hermit thrush",
-"Bewick's swan",
-"dress suit",
-"trail bike",
-"stubble",
-"common polypody",
-"Riesling",
-"Easter lily",
-"telegraph key",
-"envelope",
-"garlic bread",
-"perianth",
-"salad bar",
-"steppe",
-"club sandwich",
-"nude",
-"garden forget-me-not",
-"Tuareg",
-"flood",
-"Statehouse",
-"charcoal",
-"boy scout",
-"Rhone wine",
-"parfait",
-"spoor",
-"lanyard",
-"octagon",
-"brown bread",
-"quarterback",
-"quilted bedspread",
-"hookah",
-"Pepsi",
-"hamburger bun",
-"entrepreneur",
-"saddle oxford",
-"snake's head fritillary",
-"undies",
-"chemise",
-"skidder",
-"chickpea",
-"carnation",
-"honey bun",
-"mortar",
-"Montrachet",
-"automobile horn",
-"skylight",
-"gingham",
-"rafter",
-"pantile",
-"climbing frame",
-"scarlet runner",
-"cable",
-"cornstalk",
-"mockingbird",
-"raisin bread",
-"chili sauce",
-"hand calculator",
-"concert-goer",
-"detached house",
-"coq au vin",
-"lasso",
-"hyssop",
-"globe thistle",
-"paper clip",
-"slide",
-"Jerusalem artichoke",
-"tetrahedron",
-"mock orange",
-"lemon lily",
-"finger",
-"little sister",
-"handcuff",
-"horse wrangler",
-"pavlova",
-"oilcloth",
-"snow-in-summer",
-"common mugwort",
-"greenshank",
-"ice-cream cone",
-"rubber boot",
-"gunnysack",
-"disk jockey",
-"long trousers",
-"sorghum",
-"pontoon",
-"calf",
-"fire extinguisher",
-"cotton thistle",
-"pilot whale",
-"ao dai",
-"steamroller",
-"wristwatch",
-"tawny owl",
-"city",
-"country store",
-"ironweed",
-"kennel",
-"bathrobe",
-"rattan",
-"drawer",
-"fly tent",
-"choline",
-"musk thistle",
-"courthouse",
-"Yugoslav",
-"bush",
-"trawler",
-"shellflower",
-"jade vine",
-"ragged orchid",
-"pea soup",
-"King Charles spaniel",
-"hubcap",
-"snook",
-"paddy",
-"bow and arrow",
-"shovel",
-"dill",
-"cliff swallow",
-"cadaver",
-"hijab",
-"masterpiece",
-"fish geranium",
-"kettle",
-"sanitary napkin",
-"carrot stick",
-"Mountie",
-"peanut brittle",
-"dam",
-"jackal",
-"windowsill",
-"butterfly orchid",
-"bodice",
-"picador",
-"pale yellow",
-"beanie",
-"petiole",
-"tenor saxophonist",
-"bungalow",
-"gnomon",
-"stock saddle",
-"field glass",
-"rigging",
-"wood grain",
-"Speaker",
-"settlement house",
-"swamp milkweed",
-"paper nautilus",
-"tangerine",
-"champagne",
-"crescent roll",
-"library",
-"Schmidt telescope",
-"stemless carline thistle",
-"motorcyclist",
-"alpine ash",
-"planchet",
-"water closet",
-"casuist",
-"hand luggage",
-"hyssop",
-"spaghetti and meatballs",
-"cannelloni",
-"cedar waxwing",
-"water dog",
-"brick red",
-"linkage",
-"sweep hand",
-"purple heather",
-"macaroni and cheese",
-"butter knife",
-"refreshment",
-"malt",
-"St. Augustine grass",
-"wainscot",
-"compass",
-"gas heater",
-"tamale",
-"table saw",
-"referee",
-"borsch",
-"projector",
-"dracaena",
-"peppermint",
-"Reuben",
-"Abyssinian banana",
-"glassblower",
-"floss",
-"small stores",
-"artilleryman",
-"lapwing",
-"ranch",
-"garbage man",
-"dwarf banana",
-"commelina",
-"currant",
-"adulteress",
-"landlocked salmon",
-"pasqueflower",
-"nan",
-"tiger lily",
-"Eritrean",
-"rotunda",
-"catsup bottle",
-"mezzanine",
-"royal fern",
-"blended whiskey",
-"bowler hat",
-"mistletoe",
-"manor",
-"fusee drive",
-"pistachio",
-"dispensary",
-"swamp",
-"amputee",
-"sculptor",
-"schoolmaster",
-"Chinese anise",
-"dwarf iris",
-"livestock",
-"chronograph",
-"nectarine",
-"jockey",
-"plaster",
-"motel room",
-"swamp azalea",
-"hippeastrum",
-"space station",
-"duchess",
-"catacomb",
-"dovetail",
-"cockscomb",
-"common spotted orchid",
-"brittlebush",
-"cleats",
-"cloche",
-"hotchpotch",
-"cabin car",
-"prey",
-"indigo",
-"light beer",
-"bear's breech",
-"jonquil",
-"analyzer",
-"alyssum",
-"spur gear",
-"ice tea",
-"honey buzzard",
-"twayblade",
-"dirndl",
-"atlas moth",
-"croquette",
-"carafe",
-"flyweight",
-"professional basketball",
-"multivitamin",
-"air terminal",
-"phial",
-"roll-on",
-"skunk cabbage",
-"bird of paradise",
-"rose",
-"cooter",
-"camping",
-"divided highway",
-"herbage",
-"sweet vermouth",
-"common comfrey",
-"eggplant",
-"office building",
-"glutton",
-"gefilte fish",
-"bicycle rack",
-"swamp birch",
-"Venetian blind",
-"Pernod",
-"Norway spruce",
-"portrait camera",
-"bastion",
-"vitamin Bc",
-"Ugandan",
-"Indian red",
-"okapi",
-"emu",
-"vin ordinaire",
-"chintz",
-"shrimp cocktail",
-"numbat",
-"tall oat grass",
-"cable car",
-"stopcock",
-"ham sandwich",
-"Yemeni",
-"stanhopea",
-"plate",
-"chicken broth",
-"common yellowthroat",
-"California poppy",
-"radio",
-"chocolate egg",
-"mess jacket",
-"tea table",
-"physostegia",
-"Japanese flowering cherry",
-"confectionery",
-"chicken cacciatore",
-"painted nettle",
-"popover",
-"white rice",
-"strapless",
-"mohair",
-"electrical cable",
-"coil spring",
-"arterial road",
-"miniature fan palm",
-"spectator pump",
-"pesto",
-"interlocutor",
-"eastern kingbird",
-"dongle",
-"vitamin B6",
-"stuffed tomato",
-"cough drop",
-"okra",
-"black",
-"barbecue",
-"burial mound",
-"firstborn",
-"corn snake",
-"amberjack",
-"bollard",
-"horn",
-"Black African",
-"elbow pad",
-"Camembert",
-"circle",
-"Japanese apricot",
-"hearing aid",
-"rock star",
-"creature",
-"taster",
-"bubble gum",
-"scull",
-"lemon balm",
-"chaetodon",
-"anemometer",
-"brake drum",
-"fuselage",
-"courthouse",
-"aqualung",
-"yellow adder's tongue",
-"reception desk",
-"guy",
-"buffalo wing",
-"ginger beer",
-"robin",
-"pantothenic acid",
-"marsh hawk",
-"yellow journalism",
-"exhaust",
-"cardamom",
-"Tabasco",
-"ax handle",
-"patriarch",
-"floor",
-"pine snake",
-"spoiler",
-"hood",
-"sphagnum",
-"parrotfish",
-"orphanage",
-"redpoll",
-"beef Wellington",
-"white spruce",
-"cherry plum",
-"scapular",
-"field lens",
-"broomstick",
-"mouser",
-"wood thrush",
-"Nebraskan",
-"hotelier",
-"milk thistle",
-"soya milk",
-"Munich beer",
-"boucle",
-"snowy egret",
-"dust storm",
-"steward",
-"kudzu",
-"oriental poppy",
-"presbytery",
-"burro",
-"orange soda",
-"stonecrop",
-"splashboard",
-"menagerie",
-"dormer",
-"wire cutter",
-"yellow bells",
-"Dubliner",
-"shore pine",
-"cousin",
-"racing gig",
-"Morgan",
-"gold plate",
-"villager",
-"snifter",
-"granny's bonnets",
-"egg roll",
-"Spode",
-"amabilis fir",
-"babbler",
-"pestle",
-"heliopsis",
-"halter",
-"black spruce",
-"President of the United States",
-"ski slope",
-"chocolate fondue",
-"lockstitch",
-"motel",
-"Epipactis helleborine",
-"tabbouleh",
-"Yorkshire pudding",
-"overpass",
-"Timorese",
-"presbyter",
-"tablefork",
-"bottle gourd",
-"tiara",
-"vintage",
-"pilgrim",
-"reindeer moss",
-"shower stall",
-"towel rack",
-"kachina",
-"chef's salad",
-"breeder",
-"cow parsnip",
-"walker",
-"Black woman",
-"Irish coffee",
-"portrait lens",
-"lateen",
-"gilt",
-"successor",
-"cargo container",
-"Lithuanian",
-"mayapple",
-"paisley",
-"highchair",
-"strawberry jam",
-"flying fox",
-"field scabious",
-"blue-eyed grass",
-"screw",
-"Frisbee",
-"dressing room",
-"cholla",
-"walkie-talkie",
-"red currant",
-"centrifugal pump",
-"smorgasbord",
-"hot rod",
-"marcher",
-"rowanberry",
-"welwitschia",
-"amphitheater",
-"pew",
-"concert band",
-"bosom",
-"pillbox",
-"seagrass",
-"openwork",
-"meadow goldenrod",
-"shower",
-"chicken sandwich",
-"Boston ivy",
-"plastron",
-"oilfield",
-"stuffed tomato",
-"juniper berries",
-"frame",
-"Spanish mackerel",
-"family room",
-"powder horn",
-"fight",
-"maguey",
-"bunker",
-"work-shirt",
-"air filter",
-"nosh",
-"sugar bowl",
-"foothill",
-"reliquary",
-"tugboat",
-"horsebox",
-"grater",
-"palace",
-"board member",
-"campsite",
-"halibut",
-"geneva",
-"ginger ale",
-"high commissioner",
-"genet",
-"bodywork",
-"spaghetti",
-"protractor",
-"pipe cutter",
-"wood anemone",
-"turkey cock",
-"surge suppressor",
-"green turtle",
-"spoiler",
-"bedsitting room",
-"television room",
-"ballot box",
-"shasta daisy",
-"impeller",
-"capote",
-"bitter",
-"California wine",
-"lock",
-"spinnaker",
-"gill fungus",
-"baby's breath",
-"nut and bolt",
-"moonflower",
-"houseboat",
-"distributor cap",
-"coffee bean",
-"gusset",
-"bowling ball",
-"knitwear",
-"frieze",
-"mistflower",
-"roadster",
-"cue",
-"circuitry",
-"brake",
-"butt hinge",
-"Chickasaw",
-"leopard frog",
-"wing tip",
-"puree",
-"mantel",
-"pantheon",
-"grandfather clock",
-"cockchafer",
-"pomegranate",
-"cleaners",
-"eyeshadow",
-"Oregon cedar",
-"rock hopper",
-"hawksbill turtle",
-"agriculturist",
-"yellow-crowned night heron",
-"Albanian",
-"pumpkin seed",
-"chateau",
-"goggles",
-"camper trailer",
-"bracket fungus",
-"cigarette case",
-"signal box",
-"saddle blanket",
-"poison ivy",
-"set gun",
-"cattleya",
-"dry fly",
-"concert hall",
-"personal digital assistant",
-"talcum",
-"deodorant",
-"common starling",
-"painted turtle",
-"kea",
-"plenipotentiary",
-"pantyhose",
-"masjid",
-"buskin",
-"hurdle",
-"cocktail lounge",
-"belting",
-"sour dock",
-"knife blade",
-"sugar snap pea",
-"paddle",
-"dickeybird",
-"brace",
-"keep",
-"call center",
-"yacht",
-"lead pencil",
-"tumbler",
-"production line",
-"tetra",
-"private",
-"French window",
-"express",
-"ski boot",
-"pinto",
-"broad bean",
-"American crow",
-"screech owl",
-"snapper",
-"power cord",
-"Manx",
-"rambutan",
-"sun deck",
-"stonefish",
-"golden eagle",
-"national monument",
-"readout",
-"cork oak",
-"hacksaw",
-"beer can",
-"bathe",
-"tussock bellflower",
-"wet suit",
-"mihrab",
-"big game",
-"highlighter",
-"sprocket",
-"measuring worm",
-"grapefruit",
-"samovar",
-"distributor point",
-"steak knife",
-"incubator",
-"loon",
-"temporary hookup",
-"hippodrome",
-"hot spring",
-"spacesuit",
-"flea market",
-"clay pigeon",
-"catbird",
-"earmuff",
-"tetherball",
-"yellowfin",
-"cellophane",
-"lanolin",
-"clapperboard",
-"velveteen",
-"police dog",
-"cashew",
-"sequencer",
-"mango",
-"duplex house",
-"bazaar",
-"Golden Delicious",
-"red carpet",
-"collet",
-"kickstand",
-"broadloom",
-"diskette",
-"tank engine",
-"compact",
-"diesel-electric locomotive",
-"whale shark",
-"water moccasin",
-"mountain avens",
-"tropic bird",
-"ginkgo",
-"ski cap",
-"fixative",
-"glockenspiel",
-"chopine",
-"ethernet",
-"herring gull",
-"skeleton key",
-"finger paint",
-"conference table",
-"great crested grebe",
-"harbor",
-"white-crowned sparrow",
-"Bullock's oriole",
-"guestroom",
-"boutique",
-"cable television",
-"roulette wheel",
-"Luger",
-"Latin American",
-"trumpeter",
-"blindfold",
-"baby",
-"freshwater bass",
-"home plate",
-"bonefish",
-"giant sunflower",
-"giant tortoise",
-"planking",
-"pigeon hawk",
-"oceanfront",
-"door",
-"bazaar",
-"common wasp",
-"conformation",
-"kick starter",
-"kid glove",
-"corydalis",
-"shuttlecock",
-"writing desk",
-"ivory gull",
-"shirttail",
-"diving suit",
-"weka",
-"downy birch",
-"altar",
-"wild sage",
-"tufted puffin",
-"cabinet",
-"Orpington",
-"cineraria",
-"bottom",
-"dial",
-"coracle",
-"resort hotel",
-"soap dish",
-"spotted owl",
-"billiard room",
-"ghetto blaster",
-"red-breasted nuthatch",
-"hatchling",
-"chalet",
-"bracteole",
-"crusher",
-"mixer",
-"net melon",
-"farmhouse",
-"Dutch oven",
-"transept",
-"penlight",
-"palmyra",
-"stewing pan",
-"solar cell",
-"crochet needle",
-"black-winged stilt",
-"germander speedwell",
-"crinkleroot",
-"truncheon",
-"bunchberry",
-"hatchback",
-"sounding board",
-"mixing faucet",
-"chess master",
-"bisque",
-"Brie",
-"Sitka spruce",
-"pawn",
-"Mexican-American",
-"space rocket",
-"choreographer",
-"collared peccary",
-"duffel",
-"nacho",
-"patchcord",
-"carpet snake",
-"omnivore",
-"watering can",
-"hall of residence",
-"streamer fly",
-"sunroof",
-"great grandson",
-"oil refinery",
-"billiard player",
-"ivy geranium",
-"key palm",
-"pinwheel",
-"yellow-shafted flicker",
-"purple onion",
-"soldering iron",
-"condominium",
-"fishing gear",
-"heat pump",
-"marine iguana",
-"cuckoo clock",
-"Bletilla striata",
-"headrest",
-"spotted salamander",
-"field hockey ball",
-"pound",
-"carboy",
-"vertical stabilizer",
-"groundsheet",
-"cinnamon bread",
-"acorn squash",
-"sheathing",
-"lakefront",
-"Jeffrey pine",
-"synthesizer",
-"olive",
-"apple",
-"pannier",
-"ponderosa",
-"Jew's-ear",
-"latch",
-"equatorial",
-"metasequoia",
-"permit",
-"bloomers",
-"town hall",
-"fava bean",
-"casino",
-"bier",
-"jampot",
-"common snapping turtle",
-"clary sage",
-"oatmeal",
-"Dutchman's breeches",
-"massif",
-"Guyanese",
-"heifer",
-"handball",
-"sweat suit",
-"pomelo",
-"Iceland moss",
-"customhouse",
-"sandbag",
-"archer",
-"gyrfalcon",
-"sword cane",
-"marmite",
-"whole snipe",
-"blue crab",
-"sugar spoon",
-"brownstone",
-"chicken wire",
-"lizardfish",
-"dump truck",
-"chicken yard",
-"chamois",
-"electric",
-"idle pulley",
-"jujube",
-"wrestling mat",
-"aoudad",
-"Burmese cat",
-"water shamrock",
-"dormitory",
-"Unknown Soldier",
-"hearse",
-"bumper",
-"clipper",
-"desert pea",
-"critter",
-"semitrailer",
-"backboard",
-"common St John's wort",
-"Atlantic manta",
-"song thrush",
-"jukebox",
-"quoin",
-"eastern chipmunk",
-"copper beech",
-"paintball gun",
-"bull",
-"package store",
-"fraise",
-"royal poinciana",
-"niqab",
-"traction engine",
-"objective",
-"day nursery",
-"ski lodge",
-"orphan",
-"summer house",
-"cereal box",
-"router",
-"sleuth",
-"jodhpur",
-"polyp",
-"croquet",
-"sport kite",
-"green onion",
-"tulle",
-"etagere",
-"tussock caterpillar",
-"rest house",
-"elderberry",
-"bridal wreath",
-"Torrey pine",
-"silver wattle",
-"kidney bean",
-"pentode",
-"laelia",
-"Allen wrench",
-"sporran",
-"red drum",
-"tricot",
-"heterodyne receiver",
-"magazine rack",
-"stone curlew",
-"trawler",
-"suckling",
-"niblick",
-"sandwich plate",
-"double door",
-"Togolese",
-"pitching wedge",
-"desert tortoise",
-"cloth cap",
-"date palm",
-"webbing",
-"jumper",
-"frogmouth",
-"copperhead",
-"covered couch",
-"black mallee",
-"riser",
-"scraper",
-"gauntlet",
-"pantheon",
-"food court",
-"muntjac",
-"grocery bag",
-"bread-bin",
-"transmission shaft",
-"primigravida",
-"window seat",
-"crab apple",
-"seat",
-"Fresnel lens",
-"dendrobium",
-"hatchback",
-"little theater",
-"butter dish",
-"back porch",
-"umbrella tree",
-"carrot",
-"seventy-eight",
-"coconut",
-"music stool",
-"Tesla coil",
-"bay willow",
-"American basswood",
-"sabot",
-"wheel and axle",
-"gazette",
-"lute",
-"bassinet",
-"hart",
-"mecca",
-"breadbasket",
-"silverfish",
-"handball",
-"Scotch pine",
-"box camera",
-"stately home",
-"Hereford",
-"tread",
-"single-breasted jacket",
-"desk phone",
-"deodar",
-"professional boxing",
-"fly casting",
-"box wrench",
-"black oak",
-"martello tower",
-"red campion",
-"bullock",
-"sweet William",
-"bay leaf",
-"dollhouse",
-"flounder",
-"fox hunting",
-"beanbag",
-"king mackerel",
-"rouge",
-"film advance",
-"common mallow",
-"parasitic jaeger",
-"satellite receiver",
-"nurse shark",
-"chesterfield",
-"tomatillo",
-"plimsoll",
-"hatbox",
-"bloomer",
-"foul-weather gear",
-"longleaf pine",
-"horse mackerel",
-"tree lizard",
-"bark",
-"belfry",
-"Treasury",
-"perch",
-"purple finch",
-"stag beetle",
-"fragrant orchid",
-"tachymeter",
-"tadpole",
-"cookie jar",
-"knee piece",
-"agueweed",
-"bones",
-"chick",
-"golf glove",
-"toothpick",
-"taboret",
-"rotor blade",
-"field artillery",
-"purple willow",
-"redhead",
-"spark plug",
-"guava",
-"voice mail",
-"cross",
-"butterfly valve",
-"star magnolia",
-"olive",
-"room light",
-"Australian turtledove",
-"embassy",
-"Iraqi",
-"singles",
-"nestling",
-"spinning rod",
-"radial engine",
-"rowan",
-"sandbox",
-"boss",
-"moccasin flower",
-"veneer",
-"mint",
-"American chestnut",
-"white whale",
-"CPU board",
-"florist",
-"press box",
-"hurricane lamp",
-"giant kangaroo",
-"greater whitethroat",
-"winter jasmine",
-"blue",
-"department store",
-"southern red oak",
-"saber saw",
-"corn muffin",
-"bellbottom trousers",
-"toaster oven",
-"red eft",
-"condominium",
-"galago",
-"sunbather",
-"redpoll",
-"common European earwig",
-"songbird",
-"linnet",
-"light meter",
-"bracer",
-"tepee",
-"gumbo",
-"water glass",
-"roofing",
-"spathiphyllum",
-"shofar",
-"sand lizard",
-"washroom",
-"Brussels carpet",
-"brachyuran",
-"home room",
-"floatplane",
-"knee brace",
-"solar heater",
-"felucca",
-"gas ring",
-"maguey",
-"manse",
-"blue columbine",
-"cuppa",
-"cigar band",
-"male orchis",
-"mudskipper",
-"couscous",
-"Chinese parasol tree",
-"dude ranch",
-"banyan",
-"gopher snake",
-"sundrops",
-"aviary",
-"African daisy",
-"missel thrush",
-"Photostat",
-"stone pine",
-"circus tent",
-"tangle",
-"printer cable",
-"grease-gun",
-"rose chafer",
-"light pen",
-"plantain",
-"hearth",
-"bullfinch",
-"post oak",
-"slow loris",
-"Newtonian telescope",
-"head",
-"punt",
-"spindle",
-"New England aster",
-"spotted sandpiper",
-"pond pine",
-"grass skirt",
-"bug",
-"black rat snake",
-"tabasco",
-"bull shark",
-"tennis camp",
-"scrambler",
-"popinjay",
-"bing cherry",
-"ministry",
-"cash register",
-"redheaded woodpecker",
-"kameez",
-"farmer's market",
-"roan",
-"harpy",
-"European toad",
-"pizzeria",
-"camshaft",
-"hemp nettle",
-"chicken coop",
-"cottage pink",
-"daybed",
-"observatory",
-"airdock",
-"mountain devil",
-"newsstand",
-"kingfish",
-"snow gum",
-"jackdaw",
-"lacquerware",
-"peeler",
-"miro",
-"sister ship",
-"damask rose",
-"pack",
-"snowshoe",
-"Liberian",
-"paramecium",
-"tidytips",
-"professional tennis",
-"bookend",
-"wood swallow",
-"cayuse",
-"cranberry",
-"rock squirrel",
-"steak au poivre",
-"soul patch",
-"female mammal",
-"sash fastener",
-"songwriter",
-"oxeye daisy",
-"apse",
-"floor joist",
-"hand towel",
-"wheatear",
-"cero",
-"soul mate",
-"golden fig",
-"bus stop",
-"psycholinguist",
-"convenience store",
-"manor hall",
-"mountain sandwort",
-"Euopean hoopoe",
-"haricot vert",
-"mausoleum",
-"violist",
-"flashlight battery",
-"chard",
-"fixer-upper",
-"bank martin",
-"testudo",
-"diving duck",
-"kohlrabi",
-"Omani",
-"sphygmomanometer",
-"greyhound racing",
-"chestnut",
-"rattlesnake plantain",
-"chaffinch",
-"wolf pup",
-"teakettle",
-"cairn",
-"souk",
-"resident commissioner",
-"chuckwalla",
-"gaiter",
-"capercaillie",
-"liver chestnut",
-"bean sprout",
-"land line",
-"ambassador",
-"green pepper",
-"common chickweed",
-"Sharpie",
-"Oriental arborvitae",
-"oncidium",
-"pallone",
-"currawong",
-"sweet alyssum",
-"fire tower",
-"eyebrow pencil",
-"redfish",
-"apricot",
-"clementine",
-"blucher",
-"wigwam",
-"pangolin",
-"buggy",
-"common oak",
-"jumbojet",
-"laser",
-"cigarette holder",
-"racquetball",
-"georgette",
-"cleft",
-"scouring pad",
-"drum printer",
-"pond scum",
-"American red squirrel",
-"caranday",
-"swamp willow",
-"blindworm",
-"brook trout",
-"defense system",
-"nyala",
-"three-way calling",
-"mizzen",
-"shuttle",
-"African lily",
-"Oregon white oak",
-"rain tree",
-"fuel gauge",
-"oriental cherry",
-"wahoo",
-"pear",
-"jungle gym",
-"bass fiddle",
-"outrigger",
-"angelfish",
-"Old World coot",
-"lime",
-"battlement",
-"yarmulke",
-"herpes varicella zoster",
-"burp gun",
-"Alpine glacier",
-"stun gun",
-"pilot boat",
-"Southern crab apple",
-"bushtit",
-"pullet",
-"polo pony",
-"jackfruit",
-"raw vegetable",
-"French marigold",
-"golden shower tree",
-"spike lavender",
-"wahoo",
-"brass knucks",
-"cabbage palm",
-"diesel-hydraulic locomotive",
-"red jungle fowl",
-"prairie sunflower",
-"rye",
-"loofa",
-"icecap",
-"shade tree",
-"secretary bird",
-"saffron",
-"cos",
-"muskrat",
-"videodisk",
-"Carolina wren",
-"candy bar",
-"Bohemian waxwing",
-"flowering almond",
-"cold frame",
-"raglan",
-"pine siskin",
-"quince",
-"western red cedar",
-"red maple",
-"adobe",
-"agora",
-"kumquat",
-"tenement",
-"bantam",
-"bayberry",
-"water jump",
-"great granddaughter",
-"snips",
-"porcupinefish",
-"brochette",
-"love-in-a-mist",
-"Iceland poppy",
-"common sage",
-"pace car",
-"camel racing",
-"slipcover",
-"nopal",
-"shoehorn",
-"calypso",
-"rhea",
-"in-basket",
-"maple syrup",
-"cold chisel",
-"Pacific ridley",
-"dietary",
-"aperture",
-"lapin",
-"rock hyrax",
-"house wren",
-"litchi",
-"ragged robin",
-"control center",
-"shoebox",
-"arabesque",
-"eider",
-"silver birch",
-"bantamweight",
-"ax head",
-"softball",
-"blue gum",
-"Bechtel crab",
-"tomato sauce",
-"green douglas fir",
-"sweet gum",
-"macaroni salad",
-"red phalarope",
-"budgerigar",
-"Bedford cord",
-"Uzi",
-"green woodpecker",
-"ohmmeter",
-"bacon-lettuce-tomato sandwich",
-"hackney",
-"Easter egg",
-"motmot",
-"red pine",
-"opium poppy",
-"gat",
-"pussy willow",
-"greater scaup",
-"ocelot",
-"persimmon",
-"western hemlock",
-"carambola",
-"pinion",
-"Malcolm stock",
-"bobsled",
-"larkspur",
-"wood drake",
-"pinetum",
-"red gum",
-"draft beer",
-"funnel",
-"terrarium",
-"Pinot blanc",
-"doodlebug",
-"brittle star",
-"salsa",
-"cantaloup",
-"pollack",
-"stockpot",
-"eastern hemlock",
-"rock wren",
-"burqa",
-"squash",
-"aircraft engine",
-"billy",
-"flamingo flower",
-"odontoglossum",
-"old squaw",
-"redstart",
-"sheepskin coat",
-"mate",
-"flathead catfish",
-"gentianella",
-"bilberry",
-"bog rein orchid",
-"incense cedar",
-"mew",
-"Colorado spruce",
-"cob",
-"portmanteau",
-"grenadine",
-"common ginger",
-"masdevallia",
-"compound microscope",
-"sobralia",
-"white fungus",
-"guppy",
-"chapterhouse",
-"honey",
-"green frog",
-"sea swallow",
-"African marigold",
-"astrolabe",
-"verdigris",
-"yellowhammer",
-"carrot juice",
-"oxlip",
-"medicine ball",
-"highboy",
-"grass frog",
-"gamebag",
-"surgery",
-"mincer",
-"mulloway",
-"cactus wren",
-"box office",
-"resonator",
-"table-mountain pine",
-"European curlew",
-"supernova",
-"cabbageworm",
-"peach",
-"plane seat",
-"asp",
-"Yquem",
-"tomato hornworm",
-"rook",
-"quadruped",
-"chador",
-"micrometer",
-"dabchick",
-"Afro-wig",
-"balsam fir",
-"bucket seat",
-"sage green",
-"macon",
-"blue poppy",
-"chinquapin oak",
-"black pine",
-"spinach",
-"chrysalis",
-"carnauba",
-"tee",
-"bearberry",
-"shirt button",
-"tree of heaven",
-"southern white cedar",
-"covered wagon",
-"brood hen",
-"spadix",
-"European catfish",
-"winter wren",
-"bulldog clip",
-"carpetbag",
-"study hall",
-"chino",
-"simian",
-"closeup lens",
-"cookie cutter",
-"grapefruit",
-"mandola",
-"sassaby",
-"Allegheny plum",
-"piaffe",
-"scorpion fly",
-"booby",
-"draft animal",
-"field tent",
-"cumin",
-"laurel oak",
-"smooth-leaved elm",
-"American arborvitae",
-"American toad",
-"grinding wheel",
-"mountain ash",
-"cuttlefish",
-"pipistrelle",
-"parer",
-"safety rail",
-"Clark's nutcracker",
-"side-blotched lizard",
-"giant hornet",
-"wicket",
-"dugout",
-"electric toothbrush",
-"dhow",
-"common four-o'clock",
-"long-eared owl",
-"anchor",
-"near beer",
-"tansy",
-"creme caramel",
-"guided missile frigate",
-"shelduck",
-"durian",
-"compact",
-"iron tree",
-"shiitake",
-"polo",
-"camouflage",
-"pedal pusher",
-"salon",
-"tangerine",
-"lacebark",
-"Swiss mountain pine",
-"goalpost",
-"poolroom",
-"space capsule",
-"wild cherry",
-"dress hat",
-"wave",
-"raglan sleeve",
-"cassia",
-"Jerusalem artichoke",
-"cabbage palmetto",
-"marsh harrier",
-"American redstart",
-"sea squirt",
-"cliff diving",
-"sparrow hawk",
-"watch cap",
-"frankfurter bun",
-"police boat",
-"flash camera",
-"neem",
-"eastern meadowlark",
-"Italian cypress",
-"orb-weaving spider",
-"graniteware",
-"sewing basket",
-"latex paint",
-"rock dove",
-"stator",
-"leaf lettuce",
-"roulette",
-"broadcloth",
-"Spork",
-"panicle",
-"sternwheeler",
-"cider vinegar",
-"brown creeper",
-"cowfish",
-"closed gentian",
-"chickpea",
-"port",
-"pimento",
-"sheeting",
-"matilija poppy",
-"hawk owl",
-"guava",
-"papaya",
-"huisache",
-"European shrike",
-"racing skiff",
-"yellow warbler",
-"gumbo-limbo",
-"North Carolinian",
-"staysail",
-"court",
-"iced coffee",
-"money belt",
-"shaver",
-"Psychopsis papilio",
-"sumo ring",
-"refection",
-"kingfish",
-"clock pendulum",
-"greater butterfly orchid",
-"disk harrow",
-"tawny eagle",
-"polyphemus moth",
-"pieplant",
-"Nicaraguan",
-"bocce ball",
-"California box elder",
-"porbeagle",
-"crown of thorns",
-"Mexican sunflower",
-"fennel",
-"stream orchid",
-"slip ring",
-"white fir",
-"fold",
-"moss campion",
-"fairy ring",
-"hose",
-"pony-trekking",
-"western larch",
-"meadow pipit",
-"Cape May warbler",
-"longan",
-"bookmobile",
-"junk shop",
-"lemon shark",
-"smelling bottle",
-"solan",
-"widow",
-"sea pen",
-"universal joint",
-"day game",
-"goldcrest",
-"maiden pink",
-"biographer",
-"rotunda",
-"oriel",
-"arranger",
-"gambrel",
-"Angora",
-"fen orchid",
-"leading rein",
-"Wilson's snipe",
-"European nuthatch",
-"natterjack",
-"athletic supporter",
-"mouflon",
-"emergency room",
-"swallow-tailed coat",
-"western meadowlark",
-"feather star",
-"Navy SEAL",
-"toilet bag",
-"loquat",
-"lesser butterfly orchid",
-"thumbhole",
-"breathalyzer",
-"featherweight",
-"collards",
-"mayfly",
-"confessional",
-"mountain ebony",
-"redwing",
-"Norway maple",
-"refractometer",
-"stagecoach",
-"gasoline gauge",
-"octopus",
-"baker",
-"Rhode Island red",
-"European tortoise",
-"cardiologist",
-"Punjabi",
-"Arkansas kingbird",
-"tamarind",
-"drum brake",
-"flash",
-"yellowtail",
-"stokes' aster",
-"emperor",
-"free house",
-"sour gum",
-"ruddy duck",
-"hamadryad",
-"command module",
-"tinamou",
-"Norway lobster",
-"washstand",
-"European hornbeam",
-"roaster",
-"black-necked grebe",
-"tallgrass",
-"leopard lizard",
-"anastigmat",
-"Blackburn",
-"deutzia",
-"ground rattler",
-"Christmas fern",
-"wild pink",
-"sesame seed",
-"carrycot",
-"Italian parsley",
-"nectar",
-"roll-on roll-off",
-"true laurel",
-"anisette",
-"candy corn",
-"flowering maple",
-"revers",
-"dun",
-"tobacco hornworm",
-"common sunflower",
-"common grape hyacinth",
-"cardiograph",
-"electric meter",
-"herb Paris",
-"goalmouth",
-"spruce grouse",
-"canopy",
-"wind poppy",
-"stemma",
-"gateleg table",
-"lumper",
-"speckled rattlesnake",
-"gudgeon",
-"rough-legged hawk",
-"internal drive",
-"pomelo",
-"piece de resistance",
-"storm door",
-"clementine",
-"Japanese pink",
-"settler",
-"yellow jacket",
-"Fraser fir",
-"royal palm",
-"cicada killer",
-"cayenne",
-"guava",
-"bluewing",
-"red baneberry",
-"lesser yellowlegs",
-"cache",
-"bog rose",
-"sparring partner",
-"ski jumping",
-"sherry",
-"glacier lily",
-"beer mat",
-"shredder",
-"American widgeon",
-"protectionist",
-"green olive",
-"black-tailed deer",
-"Alpine fir",
-"dispatch case",
-"whipping cream",
-"African daisy",
-"cantilever bridge",
-"maraschino",
-"rhea",
-"ink bottle",
-"dacha",
-"hagberry tree",
-"lesser rorqual",
-"orchard oriole",
-"candidate",
-"cuticle",
-"breadfruit",
-"fishbowl",
-"giant puffball",
-"closed gentian",
-"Joshua tree",
-"tie rod",
-"beard lichen",
-"flame tree",
-"stegosaur",
-"acerola",
-"Swan River daisy",
-"common murre",
-"flowering almond",
-"protegee",
-"loggerhead shrike",
-"Wilson's warbler",
-"Japanese honeysuckle",
-"basilisk",
-"skimmer",
-"hybrid tuberous begonia",
-"pumpkin ash",
-"chafing dish",
-"collared lizard",
-"iced-tea spoon",
-"scrubbird",
-"Iceland poppy",
-"grey kingbird",
-"wallflower",
-"slick",
-"diesel",
-"Swiss pine",
-"ethernet cable",
-"ketch",
-"lightship",
-"black cherry",
-"swordtail",
-"Monterey cypress",
-"lightweight",
-"Floridian",
-"Sabine",
-"stall",
-"contact",
-"viola da gamba",
-"hemstitch",
-"upland sandpiper",
-"box spring",
-"sassafras",
-"radome",
-"lesser scaup",
-"bluefin",
-"yellow-bellied sapsucker",
-"armored car",
-"cabin class",
-"Moorish arch",
-"webcam",
-"aquavit",
-"overall",
-"sergeant major",
-"soft shield fern",
-"gin and it",
-"bobolink",
-"subcompact",
-"falconer",
-"black morel",
-"roadrunner",
-"lab bench",
-"thong",
-"coffee urn",
-"weeping beech",
-"caladenia",
-"southern live oak",
-"scanner",
-"wine vinegar",
-"common speedwell",
-"European roller",
-"fuji",
-"snag",
-"piping plover",
-"concertina",
-"secateurs",
-"meat thermometer",
-"supercomputer",
-"funnel",
-"dais",
-"western fence lizard",
-"spruce pine",
-"pommel horse",
-"Cassegrainian telescope",
-"pitta",
-"India-rubber tree",
-"mangosteen",
-"tamp",
-"aposematic coloration",
-"dustcloth",
-"birth",
-"Atlas cedar",
-"reed bunting",
-"jabiru",
-"sainfoin",
-"press photographer",
-"golden oriole",
-"laryngoscope",
-"thermal printer",
-"winder",
-"doubles",
-"cricket ball",
-"dabbling duck",
-"tonic",
-"Buddhist",
-"Morris chair",
-"swatter",
-"quaking aspen",
-"ancient pine",
-"American larch",
-"evaporative cooler",
-"click beetle",
-"yellow-breasted chat",
-"souchong",
-"bluegill",
-"pied-billed grebe",
-"tricorn",
-"spring beauty",
-"southern magnolia",
-"rowel",
-"chili",
-"hard roll",
-"flathead",
-"satsuma",
-"gangplank",
-"bourguignon",
-"cockfighting",
-"greenwing",
-"plum tomato",
-"fly orchid",
-"gnatcatcher",
-"spotted eagle ray",
-"ovenbird",
-"brassavola",
-"mocha",
-"candy cane",
-"afterburner",
-"thriftshop",
-"study",
-"winter crookneck",
-"grinder",
-"muskellunge",
-"sacred ibis",
-"inverter",
-"sandwort",
-"deer fern",
-"stair-carpet",
-"Cotes de Provence",
-"ovenbird",
-"rex begonia",
-"American woodcock",
-"poison ash",
-"lowland fir",
-"pawpaw",
-"loblolly pine",
-"kinkajou",
-"European hackberry",
-"pest",
-"coralwood",
-"Bedouin",
-"acetate rayon",
-"snuffbox",
-"radiator cap",
-"basket oak",
-"table-tennis racquet",
-"smew",
-"midge",
-"telescopic sight",
-"radish",
-"great burdock",
-"separate",
-"damask violet",
-"broadbill",
-"bourbon",
-"blacktip shark",
-"gift shop",
-"khimar",
-"date",
-"woodland caribou",
-"policeman bird",
-"grey birch",
-"American elm",
-"strawflower",
-"officiant",
-"hart's-tongue",
-"straight razor",
-"Spanish elm",
-"radicchio",
-"white croaker",
-"vicuna",
-"soft-shell clam",
-"flannel",
-"adonis",
-"bonito",
-"kittiwake",
-"English walnut",
-"soldierfish",
-"hipflask",
-"spotted crake",
-"Streptopelia turtur",
-"American maidenhair fern",
-"corn cockle",
-"telephone cord",
-"canopy",
-"playback",
-"diocesan",
-"marsh orchid",
-"manakin",
-"purple grackle",
-"cob",
-"fishmonger",
-"otoscope",
-"vermillion flycatcher",
-"inhaler",
-"instar",
-"licentiate",
-"myrtle warbler",
-"goat herder",
-"benthos",
-"toggle",
-"drumhead",
-"piranha",
-"doorplate",
-"vault",
-"triptych",
-"red-necked grebe",
-"transporter",
-"vernier caliper",
-"flathead",
-"Portuguese man-of-war",
-"countrywoman",
-"vacation home",
-"Bactrian camel",
-"night-light",
-"module",
-"lemon curd",
-"carancha",
-"painted daisy",
-"bok choy",
-"ratatouille",
-"troll",
-"escarpment",
-"cinnabar",
-"computerized axial tomography scanner",
-"lychgate",
-"sowbread",
-"bedside",
-"guided missile cruiser",
-"reel",
-"cleat",
-"hemostat",
-"blue shark",
-"Seven Wonders of the Ancient World",
-"motorized wheelchair",
-"pillow block",
-"horned puffin",
-"prickly pear",
-"electric range",
-"mother's daughter",
-"vein",
-"Oregon maple",
-"bird dog",
-"faceplate",
-"wren warbler",
-"feather reed grass",
-"common alder",
-"Adam's needle",
-"straitjacket",
-"organ-grinder",
-"gantry",
-"bikini pants",
-"peristyle",
-"herpes",
-"terry",
-"toad lily",
-"celandine",
-"red-breasted sapsucker",
-"bragger",
-"green peafowl",
-"fuschia",
-"quoits",
-"house martin",
-"dome",
-"herpes simplex 1",
-"touraco",
-"meeting house",
-"vacuum gauge",
-"cat's-ear",
-"crisphead lettuce",
-"carpet moth",
-"European rabbit",
-"puff adder",
-"Old World scops owl",
-"fire pink",
-"fruit punch",
-"ant bear",
-"black walnut",
-"stroboscope",
-"white mangrove",
-"pine grosbeak",
-"cast",
-"check-in",
-"ring-necked parakeet",
-"matai",
-"shingle oak",
-"fieldwork",
-"rue anemone",
-"landing net",
-"ouzo",
-"herringbone",
-"lyceum",
-"hydrogen bomb",
-"mullein pink",
-"masher",
-"evening grosbeak",
-"water vole",
-"livingstone daisy",
-"tomatillo",
-"cavalier hat",
-"interphone",
-"wild lupine",
-"goosefish",
-"sugar maple",
-"plantain",
-"white dead nettle",
-"Monterey pine",
-"bugle",
-"veloute",
-"marsh gentian",
-"Bermuda buttercup",
-"alehouse",
-"Peter Pan",
-"thong",
-"LP",
-"tulip tree",
-"scanner",
-"scarlet tanager",
-"music hall",
-"angel shark",
-"pecan",
-"eight ball",
-"rosy boa",
-"outboard motorboat",
-"garage",
-"fanlight",
-"black cottonwood",
-"notornis",
-"mountain fern",
-"lunar crater",
-"reddish orange",
-"whitetip shark",
-"executant",
-"European ladies' tresses",
-"washboard",
-"revolving door",
-"case knife",
-"balloonfish",
-"greater kudu",
-"tarpan",
-"cog",
-"wet fly",
-"Irish soda bread",
-"basement",
-"broken arch",
-"canopic jar",
-"muscat",
-"kazoo",
-"bobsledding",
-"loaner",
-"black guillemot",
-"English saddle",
-"garlic mustard",
-"Foucault pendulum",
-"mulberry",
-"clotted cream",
-"dove's foot geranium",
-"Atlantic ridley",
-"convector",
-"ground floor",
-"European wildcat",
-"poinsettia",
-"hideaway",
-"great barracuda",
-"black beech",
-"bushy aster",
-"cornflower",
-"tam",
-"true slime mold",
-"carving knife",
-"holly fern",
-"railroad tunnel",
-"crimson clover",
-"disposal",
-"etamine",
-"suspension",
-"plasmodium",
-"political scientist",
-"minnow",
-"Spanish rice",
-"twist bit",
-"subway train",
-"Scleroderma citrinum",
-"saw palmetto",
-"console",
-"gimlet",
-"hand pump",
-"waratah",
-"rock rattlesnake",
-"keel",
-"server",
-"curlew sandpiper",
-"hone",
-"sable antelope",
-"inkle",
-"photostat",
-"foresail",
-"sallet",
-"tiger salamander",
-"chutney",
-"onlooker",
-"Exmoor",
-"tiramisu",
-"drawing room",
-"battery",
-"sour orange",
-"juniper berry",
-"beeper",
-"funeral home",
-"fescue",
-"Maksutov telescope",
-"ranch house",
-"jai alai",
-"carob",
-"socket",
-"popcorn",
-"sandbar shark",
-"pipal",
-"summer tanager",
-"oast",
-"skipjack",
-"rolling stock",
-"dropper",
-"great snipe",
-"turnip greens",
-"cowpea",
-"honeycomb",
-"ichneumon fly",
-"maternity hospital",
-"harp seal",
-"nylon",
-"bomb shelter",
-"horse tick",
-"litchi",
-"camel's hair",
-"mimosa",
-"bur oak",
-"anvil",
-"belay",
-"pinhead",
-"continental breakfast",
-"burglar alarm",
-"Mojave rattlesnake",
-"auxiliary storage",
-"lightwood",
-"ratepayer",
-"cecropia",
-"retractor",
-"quadrate",
-"pepper tree",
-"Venus' slipper",
-"abattoir",
-"strawflower",
-"firewater",
-"purple saxifrage",
-"black rat",
-"pack",
-"pepper pot",
-"mayweed",
-"winger",
-"whitetip shark",
-"great yellow gentian",
-"snowdrop anemone",
-"garden angelica",
-"soy sauce",
-"white poplar",
-"inkwell",
-"crouton",
-"gas gun",
-"honey locust",
-"house of cards",
-"ice maker",
-"moquette",
-"arrack",
-"casualty",
-"butterfly orchid",
-"eau de vie",
-"mosquitofish",
-"prairie smoke",
-"haft",
-"horseshoe",
-"steel",
-"peach orchard",
-"Mexican hat",
-"encaustic",
-"shoe",
-"pennywhistle",
-"sweet woodruff",
-"hull",
-"doorsill",
-"globe amaranth",
-"day school",
-"housedog",
-"crown princess",
-"oxbow",
-"maxi",
-"positron emission tomography scanner",
-"compere",
-"European turkey oak",
-"peanut",
-"sentry box",
-"house physician",
-"hot line",
-"loquat",
-"rove beetle",
-"riband",
-"flowering fern",
-"fan vaulting",
-"ceibo",
-"bongo",
-"bat boy",
-"omelet pan",
-"European ash",
-"breadwinner",
-"gaff topsail",
-"clerestory",
-"bushbuck",
-"bluethroat",
-"khukuri",
-"Father",
-"portcullis",
-"candy egg",
-"brake lining",
-"lawn furniture",
-"buckskin",
-"garden pea",
-"Brazilian rosewood",
-"Italian bread",
-"horn poppy",
-"silk tree",
-"Christmasberry",
-"hotel-casino",
-"poplin",
-"false lupine",
-"desert sunflower",
-"mimeograph",
-"alpenstock",
-"cork tree",
-"cultivar",
-"common mosquito",
-"pollard",
-"black marlin",
-"understudy",
-"lancet window",
-"college",
-"breadfruit",
-"Herero",
-"Labourite",
-"bar printer",
-"squaw grass",
-"stelis",
-"firing chamber",
-"sycamore",
-"artificial horizon",
-"radiologist",
-"pansy orchid",
-"bicycle pump",
-"wraparound",
-"bell gable",
-"home computer",
-"orchard grass",
-"carving fork",
-"bergamot",
-"honeycreeper",
-"sewing room",
-"radiator",
-"core",
-"brown bat",
-"goose grass",
-"adjutant general",
-"Erlenmeyer flask",
-"massasauga",
-"tail rotor",
-"cardinal tetra",
-"Drambuie",
-"wine palm",
-"Sarcoscypha coccinea",
-"shantung",
-"Calvados",
-"garganey",
-"vicar",
-"house mouse",
-"creeping oxalis",
-"digital subscriber line",
-"cedar elm",
-"backgammon board",
-"blackberry-lily",
-"pallid bat",
-"New Zealander",
-"Barbadian",
-"rose geranium",
-"European spider crab",
-"gharry",
-"electric hammer",
-"mustard",
-"Chinese lantern",
-"laundry cart",
-"filament",
-"mozzarella",
-"gooseberry",
-"sukiyaki",
-"porkpie",
-"culvert",
-"altazimuth",
-"plum pudding",
-"serin",
-"Spanish dagger",
-"Asian crocodile",
-"crevalle jack",
-"mascara",
-"pig bed",
-"alderman",
-"northern shrike",
-"Sufi",
-"purple-fringed orchid",
-"derringer",
-"linseed",
-"hockey skate",
-"bell jar",
-"Japanese wistaria",
-"mantled ground squirrel",
-"western toad",
-"lieutenant commander",
-"mechanical piano",
-"ovoid",
-"paddlefish",
-"demijohn",
-"coast live oak",
-"brick",
-"gearset",
-"tailstock",
-"phonograph needle",
-"winery",
-"tuberose",
-"mother's boy",
-"shot tower",
-"crucian carp",
-"carpet pad",
-"lamb's-quarter",
-"Menorah",
-"common white dogwood",
-"hypanthium",
-"rosebay",
-"wild medlar",
-"soil horizon",
-"sweet orange",
-"bitterroot",
-"hand glass",
-"cloisonne",
-"towpath",
-"gum ball",
-"margay",
-"carambola",
-"bolt cutter",
-"charger",
-"vibraphone",
-"gueridon",
-"elephant tree",
-"wood-frog",
-"ash grey",
-"duffel coat",
-"third base",
-"chunga",
-"glebe house",
-"lake trout",
-"encephalartos",
-"Japanese oak",
-"northern red oak",
-"pruner",
-"blue orchid",
-"Biloxi",
-"western wood pewee",
-"corselet",
-"alabaster",
-"anechoic chamber",
-"grass pink",
-"wax begonia",
-"blue daisy",
-"pennyroyal",
-"Asian tiger mosquito",
-"cheese souffle",
-"flat bench",
-"caramel",
-"sump pump",
-"bush violet",
-"common fennel",
-"corner",
-"skullcap",
-"asparagus fern",
-"white mangrove",
-"calceolaria",
-"sateen",
-"saltbox",
-"hollowware",
-"head nurse",
-"coal miner",
-"mountain lily",
-"tufted vetch",
-"European perch",
-"line officer",
-"steamer",
-"stickball",
-"shin guard",
-"cauliflower",
-"Monegasque",
-"hatpin",
-"wolffish",
-"trackball",
-"khaki",
-"arthrogram",
-"rocket larkspur",
-"naval commander",
-"Gemini",
-"ski binding",
-"department head",
-"Chenin blanc",
-"wingstem",
-"knothole",
-"aerides",
-"sweet bay",
-"tautog",
-"gangway",
-"waterspout",
-"Hudsonian godwit",
-"armyworm",
-"incinerator",
-"kidney vetch",
-"pine nut",
-"cypress vine",
-"hip tile",
-"sorrel tree",
-"relay",
-"bench press",
-"Kentucky coffee tree",
-"dobson",
-"sapling",
-"false lily of the valley",
-"veld",
-"phaius",
-"vitamin B2",
-"beaker",
-"wall tent",
-"sieva bean",
-"dusty miller",
-"sewing kit",
-"cavalry horse",
-"diaper",
-"butterfly pea",
-"Spam",
-"saddlebill",
-"pearly everlasting",
-"kowhai",
-"Sister",
-"moneywort",
-"organdy",
-"pine marten",
-"bareboat",
-"hot-water bottle",
-"baby blue-eyes",
-"silver lime",
-"common cotton grass",
-"malmsey",
-"blue pea",
-"baggage car",
-"pineapple",
-"folding saw",
-"cotton rose",
-"brawler",
-"black duck",
-"Weizenbock",
-"pool player",
-"Gujarati",
-"wild duck",
-"purple sage",
-"sage grouse",
-"mail train",
-"arm guard",
-"short-spurred fragrant orchid",
-"queen",
-"eparchy",
-"spring peeper",
-"ortolan",
-"shoulder",
-"fighter pilot",
-"American beech",
-"snowcap",
-"novitiate",
-"roller",
-"butcherbird",
-"canyon oak",
-"brompton stock",
-"firebrick",
-"rudder",
-"light cream",
-"Primus stove",
-"nonsmoker",
-"probationer",
-"harp",
-"kosher",
-"surcoat",
-"videotape",
-"zebu",
-"first class",
-"yam",
-"car",
-"rissole",
-"miso",
-"funambulism",
-"attic",
-"curling iron",
-"shutter",
-"encolure",
-"split-pea soup",
-"yellow rocket",
-"gas oven",
-"ultracentrifuge",
-"chamomile",
-"canteen",
-"eyeliner",
-"yellow squash",
-"Irish stew",
-"collar",
-"doublet",
-"machinist",
-"septic tank",
-"snap bean",
-"Polyporus squamosus",
-"western tanager",
-"creeping St John's wort",
-"back",
-"sinkhole",
-"perforation",
-"Romanian",
-"epergne",
-"fez",
-"comfrey",
-"sidecar",
-"beach pea",
-"screen door",
-"instigator",
-"plughole",
-"woodbine",
-"pigweed",
-"hip pocket",
-"common scoter",
-"squeegee",
-"Surinam cherry",
-"porringer",
-"body stocking",
-"eatage",
-"shallot",
-"enlarger",
-"common canary",
-"trophy case",
-"gun case",
-"plow horse",
-"hot plate",
-"pearl oyster",
-"margarita",
-"madras",
-"backspace key",
-"pigeon guillemot",
-"pajama",
-"buckthorn berry",
-"homestead",
-"bedbug",
-"Linotype",
-"trundle bed",
-"granadilla",
-"theremin",
-"chin rest",
-"bouillabaisse",
-"tumble-dryer",
-"truffle",
-"cassava",
-"kurrajong",
-"gyroscope",
-"European silver fir",
-"C-clamp",
-"politician",
-"green soybean",
-"exponent",
-"flame tree",
-"scissortail",
-"achimenes",
-"crown daisy",
-"soft tree fern",
-"spaghetti squash",
-"pale violet",
-"beaver",
-"dashiki",
-"washboard",
-"driving wheel",
-"sack",
-"foulard",
-"sputnik",
-"boatbill",
-"English elm",
-"sack coat",
-"grog",
-"golliwog",
-"Malayan tapir",
-"May wine",
-"calash",
-"stile",
-"windjammer",
-"American sycamore",
-"rotor head",
-"fast food",
-"balata",
-"dragonet",
-"Emmenthal",
-"metronome",
-"negative",
-"meadow saxifrage",
-"rabbit ears",
-"chenille",
-"round",
-"hobby",
-"crankshaft",
-"Wilson's phalarope",
-"Murphy bed",
-"soil pipe",
-"forecourt",
-"policyholder",
-"tarmacadam",
-"loyalist",
-"gyro",
-"Queen's crape myrtle",
-"shortcake",
-"apple butter",
-"pumpkinseed",
-"heronry",
-"yellow perch",
-"baggage claim",
-"escarpment",
-"diaphragm",
-"mescal bean",
-"shunter",
-"flax",
-"columbarium",
-"Joe-Pye weed",
-"Neandertal man",
-"casement",
-"hole-in-the-wall",
-"Verdicchio",
-"futurist",
-"eaglet",
-"tassel hyacinth",
-"pup tent",
-"fawn lily",
-"cabbage palm",
-"pogonia",
-"hospital ship",
-"water mill",
-"Oregon grape",
-"lentil",
-"grindstone",
-"banana split",
-"inkberry",
-"coonskin cap",
-"bazooka",
-"wrap",
-"anise hyssop",
-"Java sparrow",
-"red-eyed vireo",
-"common opossum",
-"clintonia",
-"bustle",
-"booster",
-"tribesman",
-"soy",
-"panhandle",
-"jaboticaba",
-"locking pliers",
-"Sauvignon grape",
-"ghat",
-"screw",
-"oximeter",
-"white croaker",
-"saucepot",
-"eggbeater",
-"reticule",
-"cabbage bark",
-"looking-glass plant",
-"head gasket",
-"California sycamore",
-"cowbell",
-"Aleuria aurantia",
-"Herr",
-"lever",
-"spider orchid",
-"cashew",
-"shift key",
-"solar house",
-"wood chisel",
-"white",
-"mantilla",
-"stamp",
-"bolero",
-"rear admiral",
-"garden rake",
-"Lao",
-"crowbar",
-"lapdog",
-"buttermilk biscuit",
-"yellow bedstraw",
-"pickerel frog",
-"dowel",
-"serjeant-at-law",
-"mill-hand",
-"lambrequin",
-"state treasurer",
-"red silk-cotton tree",
-"coiffeur",
-"star anise",
-"shoulder pad",
-"marshal",
-"sitar player",
-"gown",
-"ground cedar",
-"hedge maple",
-"caddie",
-"pitahaya",
-"corn marigold",
-"stick cinnamon",
-"woodland star",
-"Eurasian green toad",
-"anti",
-"blueweed",
-"medicinal leech",
-"gaur",
-"chocolate kiss",
-"kit fox",
-"mother",
-"butte",
-"audio CD",
-"blast furnace",
-"vitamin D",
-"nutgrass",
-"cornice",
-"black sheep",
-"hearing aid",
-"lingonberry",
-"quad",
-"lentil",
-"riding crop",
-"pratincole",
-"pentagon",
-"sea lavender",
-"nerita",
-"flatmate",
-"catboat",
-"water clover",
-"angiopteris",
-"mushy peas",
-"crown imperial",
-"music school",
-"woodshed",
-"platy",
-"Turk's-cap",
-"rundle",
-"reading teacher",
-"hardtack",
-"balloon sail",
-"oriental spruce",
-"bluefish",
-"white mulberry",
-"horned violet",
-"satin bowerbird",
-"treasure flower",
-"sustaining pedal",
-"mimosa",
-"spurge nettle",
-"sea green",
-"hasp",
-"lederhosen",
-"pink cockatoo",
-"long johns",
-"basket weave",
-"freewheel",
-"thrust bearing",
-"timber tree",
-"orphan",
-"falafel",
-"common camas",
-"bird of passage",
-"bird's foot trefoil",
-"electric eel",
-"fizz",
-"grape arbor",
-"serape",
-"brace",
-"hazelnut",
-"kylix",
-"horse mackerel",
-"cassia bark",
-"lizard orchid",
-"spat",
-"Brown Swiss",
-"pocket flap",
-"pillory",
-"purplish blue",
-"rolling mill",
-"tappet",
-"broccoli rabe",
-"semi-detached house",
-"mushroom coral",
-"fly orchid",
-"nougat bar",
-"ball hawk",
-"sand wedge",
-"shirred egg",
-"black locust",
-"strip lighting",
-"drop scone",
-"brush turkey",
-"ball",
-"tragopan",
-"dallisgrass",
-"tuatara",
-"great knapweed",
-"potentiometer",
-"Kiliwa",
-"Pacific bottlenose dolphin",
-"accelerator",
-"Darwin tulip",
-"osteopath",
-"Arizona cypress",
-"manna ash",
-"butterbur",
-"cornelian cherry",
-"American holly",
-"nopal",
-"tanker",
-"foreshore",
-"ditty bag",
-"gas lamp",
-"safety razor",
-"chanter",
-"fomite",
-"chip",
-"striped killifish",
-"catalytic converter",
-"plaice",
-"dusty miller",
-"takin",
-"gerenuk",
-"corn chamomile",
-"Japanese pagoda tree",
-"boneset",
-"common osier",
-"Guinean",
-"taro",
-"plotter",
-"celandine poppy",
-"churn",
-"steenbok",
-"edible mussel",
-"sensitive fern",
-"triode",
-"black raspberry",
-"zoo keeper",
-"feather ball",
-"dredger",
-"starlet",
-"cornpone",
-"coat button",
-"rosinweed",
-"toy Manchester",
-"crested cariama",
-"finger food",
-"basilisk",
-"shotgun shell",
-"comfort food",
-"mountain hemlock",
-"candytuft",
-"Stilton",
-"record changer",
-"anklet",
-"ball valve",
-"Mediterranean snapdragon",
-"BVD",
-"sand cat",
-"Galloway",
-"nutmeg",
-"water-mint",
-"woodwaxen",
-"citron",
-"ark shell",
-"federalist",
-"drone",
-"cheekpiece",
-"hyperbaric chamber",
-"addax",
-"field-emission microscope",
-"synchronous converter",
-"men's room",
-"medlar",
-"electronic fetal monitor",
-"Sazerac",
-"false indigo",
-"roof",
-"passe-partout",
-"meadow spittlebug",
-"Phytophthora infestans",
-"oast house",
-"hedge nettle",
-"voting booth",
-"slender salamander",
-"telephone jack",
-"true bug",
-"scouring rush",
-"Scotch egg",
-"matchbook",
-"aperea",
-"cytomegalovirus",
-"garlic press",
-"cove",
-"whitebark pine",
-"Slovene",
-"narrow wale",
-"mother's milk",
-"Audubon's warbler",
-"prickly poppy",
-"cowl",
-"tailorbird",
-"mud brick",
-"bamboo palm",
-"welt",
-"Afghan",
-"Virginia spring beauty",
-"dinner bell",
-"night jasmine",
-"fly rod",
-"microtome",
-"aerie",
-"carinate",
-"picker",
-"brick trowel",
-"loving cup",
-"swathe",
-"green mayonnaise",
-"rivet",
-"bandbox",
-"newsroom",
-"tea tortrix",
-"bobby",
-"gig",
-"hush puppy",
-"garlic chive",
-"piston rod",
-"aspidistra",
-"bluejack oak",
-"harvest-lice",
-"strap hinge",
-"sour mash",
-"macadamia nut",
-"histiocyte",
-"fan belt",
-"shelf bracket",
-"abelia",
-"Hottentot fig",
-"fish chowder",
-"abettor",
-"compote",
-"beige",
-"dioon",
-"hop",
-"haymaker",
-"oilskin",
-"magnetometer",
-"tool bag",
-"tambour",
-"call girl",
-"gringo",
-"fairy light",
-"broad-leaved plantain",
-"second base",
-"zebra mussel",
-"Japanese cedar",
-"pistia",
-"swamp chestnut oak",
-"cashmere",
-"double cream",
-"samisen",
-"lamb curry",
-"companion",
-"kapok",
-"julep",
-"sweet woodruff",
-"gardener",
-"jewfish",
-"inspector general",
-"collembolan",
-"wheel bug",
-"bass",
-"scrubland",
-"wryneck",
-"macrozamia",
-"trouser press",
-"clove",
-"tiger cowrie",
-"yawl",
-"collard",
-"dildo",
-"pony cart",
-"ormer",
-"annual",
-"tessera",
-"chancellery",
-"two-toed sloth",
-"queen",
-"old lady",
-"wringer",
-"spritzer",
-"baggage",
-"black mangrove",
-"black-eyed Susan",
-"semifinalist",
-"highlighter",
-"alfalfa",
-"Easter daisy",
-"escapement",
-"operating table",
-"neutral spirits",
-"bursar",
-"roble",
-"entablature",
-"girl wonder",
-"farm boy",
-"ring ouzel",
-"permanent press",
-"auklet",
-"beefsteak tomato",
-"gaming table",
-"tea bag",
-"manul",
-"giant bamboo",
-"Ozark chinkapin",
-"matzo",
-"furrow",
-"smoothhound",
-"CD-ROM drive",
-"powdery mildew",
-"copilot",
-"garden",
-"American merganser",
-"bunsen burner",
-"Asian longhorned beetle",
-"lead tree",
-"creeping buttercup",
-"Percheron",
-"back brace",
-"axseed",
-"cub",
-"soul food",
-"rabbi",
-"edelweiss",
-"mineshaft",
-"fox grape",
-"sandwort",
-"torque wrench",
-"leisure wear",
-"Mae West",
-"broccoli",
-"loach",
-"maraschino",
-"heavy cream",
-"silkworm",
-"cirque",
-"vintner",
-"whitewash",
-"butterfly pea",
-"two-toed sloth",
-"midiron",
-"ceriman",
-"Bulgarian",
-"operating microscope",
-"sambuca",
-"California fuchsia",
-"silver maple",
-"tangelo",
-"black bean",
-"lugsail",
-"starting gate",
-"leek",
-"sunflower seed",
-"fish fry",
-"clinker",
-"synagogue",
-"coscoroba",
-"brae",
-"uphill",
-"common limpet",
-"golden plover",
-"cedar of Lebanon",
-"amphibian",
-"Canary wine",
-"taipan",
-"agua",
-"feeder",
-"parallel",
-"mater",
-"pink calla",
-"meat counter",
-"yagi",
-"crab cactus",
-"cacao bean",
-"bowfin",
-"alley cat",
-"stonefly",
-"Eastern cottonwood",
-"vernier scale",
-"marginal wood fern",
-"dancing-master",
-"detective",
-"yam",
-"textile screw pine",
-"hooch",
-"spinet",
-"single prop",
-"sassafras",
-"goose barnacle",
-"triple cream",
-"China tree",
-"peeper",
-"dressmaker",
-"snatch block",
-"ironmongery",
-"dressing case",
-"creeping bellflower",
-"silver sage",
-"honeydew",
-"eastern red-backed salamander",
-"peg",
-"nombril",
-"danish",
-"mashie",
-"anarchist",
-"alligator snapping turtle",
-"shepherd",
-"American white pine",
-"runner",
-"chalice vine",
-"rheumatologist",
-"defibrillator",
-"yellow chamomile",
-"lemon balm",
-"peacekeeper",
-"native beech",
-"sandwich board",
-"Bavarian",
-"titrator",
-"paneling",
-"deer mouse",
-"poteen",
-"sugar snap pea",
-"meadow salsify",
-"town crier",
-"best",
-"basinet",
-"common myrtle",
-"night lizard",
-"cushaw",
-"Tampax",
-"camphor tree",
-"gentile",
-"orange peel",
-"putty knife",
-"pyromaniac",
-"Brummie",
-"fever tree",
-"double",
-"nest",
-"inferior",
-"cabbage tree",
-"graduated cylinder",
-"mucor",
-"woodborer",
-"earthwork",
-"potato salad",
-"four-hitter",
-"gooseberry",
-"water vole",
-"ziggurat",
-"grapefruit juice",
-"four-in-hand",
-"cranberry bush",
-"diode",
-"videotape",
-"Mohican",
-"niacin",
-"beetroot",
-"shirtsleeve",
-"cork tree",
-"two-eyed violet",
-"white ash",
-"drawing chalk",
-"baked Alaska",
-"bone-ash cup",
-"toastrack",
-"diastema",
-"bed jacket",
-"dwarf astilbe",
-"yellow honeysuckle",
-"cow pasture",
-"sheet pile",
-"saxhorn",
-"upholstery material",
-"California white oak",
-"Spanish bayonet",
-"horsemint",
-"littleneck",
-"deflector",
-"magician",
-"standard transmission",
-"blue marlin",
-"shallot",
-"feijoa",
-"collar",
-"board",
-"jump suit",
-"common staghorn fern",
-"priory",
-"Xhosa",
-"Loranthaceae",
-"barbecued wing",
-"barmaid",
-"spit",
-"lemon juice",
-"umbrella plant",
-"field pennycress",
-"centenarian",
-"queen bee",
-"fish stick",
-"black bread",
-"dirk",
-"secularist",
-"German American",
-"spotted weakfish",
-"iron foundry",
-"speed bump",
-"yellow-fever mosquito",
-"gag",
-"frame",
-"black-eyed pea",
-"alcoholic",
-"involucre",
-"sperm whale",
-"balanced diet",
-"wax bean",
-"butcher's broom",
-"winter heath",
-"Mainer",
-"Australian pine",
-"gas guzzler",
-"double-breasted jacket",
-"pod",
-"palo verde",
-"trimmer",
-"wattmeter",
-"dyer's woad",
-"crotalaria",
-"vine maple",
-"sulky",
-"jack pine",
-"thumb",
-"Wilton",
-"Panchen Lama",
-"welder",
-"badminton court",
-"business editor",
-"Arabian coffee",
-"Kamchatkan sea eagle",
-"foamflower",
-"steep",
-"plane",
-"freckle",
-"cerebral cortex",
-"Vouvray",
-"tea",
-"forest tent caterpillar",
-"neckerchief",
-"accelerator",
-"jig",
-"bridal wreath",
-"highball glass",
-"New England clam chowder",
-"beach strawberry",
-"call waiting",
-"baton twirler",
-"double boiler",
-"Dutch elm",
-"car bomb",
-"filmy fern",
-"breviary",
-"Florida gallinule",
-"dace",
-"parsnip",
-"riparian forest",
-"crescent",
-"earplug",
-"grab bar",
-"cusk",
-"foglamp",
-"screwtop",
-"black mangrove",
-"mascot",
-"Welsh poppy",
-"gas holder",
-"support hose",
-"salsify",
-"red beech",
-"Indian python",
-"caroler",
-"pineapple juice",
-"lowboy",
-"terra sigillata",
-"black olive",
-"hypodermic needle",
-"radio-phonograph",
-"moussaka",
-"miter joint",
-"creche",
-"tuning fork",
-"black wattle",
-"affiliate",
-"vertical tail",
-"kiwi",
-"red morning-glory",
-"piping crow",
-"runway",
-"Kashmiri",
-"studio apartment",
-"sea feather",
-"Judas tree",
-"boatbuilder",
-"corn earworm",
-"fallboard",
-"Victrola",
-"lechwe",
-"goat willow",
-"turret clock",
-"Canada anemone",
-"leaf lettuce",
-"savoy cabbage",
-"headpiece",
-"Lebanese",
-"fothergilla",
-"hemlock",
-"toolshed",
-"silver tree",
-"blue-headed vireo",
-"weatherman",
-"cylinder",
-"caltrop",
-"adjutant bird",
-"driving iron",
-"millet",
-"European woolly thistle",
-"rose apple",
-"clown",
-"schoolfriend",
-"eastern coral snake",
-"barbecue",
-"executive vice president",
-"long-billed marsh wren",
-"brittle bladder fern",
-"tank destroyer",
-"left-hander",
-"matting",
-"catchment",
-"balsa raft",
-"eastern fence lizard",
-"color tube",
-"corncrib",
-"electric typewriter",
-"westland pine",
-"elder statesman",
-"whey",
-"plonk",
-"mound",
-"cittern",
-"nest egg",
-"copyholder",
-"China aster",
-"basking shark",
-"gavial",
-"common duckweed",
-"vanilla orchid",
-"red-shafted flicker",
-"granadilla",
-"sylph",
-"sty",
-"vest pocket",
-"potherb",
-"little brown bat",
-"Trapezium",
-"ordinary",
-"adult",
-"purple-fringed orchid",
-"abseiler",
-"disco",
-"metal detector",
-"beefsteak fungus",
-"ilang-ilang",
-"barley grass",
-"hawser",
-"suture",
-"brake shoe",
-"staghorn coral",
-"barbecue sauce",
-"Browning machine gun",
-"sarcophagus",
-"disa",
-"oven thermometer",
-"rosemary",
-"track",
-"gorget",
-"quince",
-"royal",
-"piston ring",
-"teak",
-"pin cherry",
-"Komi",
-"walking fern",
-"sloe",
-"synchronous motor",
-"fire-bellied toad",
-"Teleprompter",
-"co-star",
-"cape gooseberry",
-"oscillograph",
-"bass clarinet",
-"cock of the rock",
-"Tyke",
-"showy milkweed",
-"safety valve",
-"branch water",
-"sweet marjoram",
-"hugger",
-"crampon",
-"fairy godmother",
-"band-tailed pigeon",
-"snow-on-the-mountain",
-"minibar",
-"foreland",
-"grosgrain",
-"dita",
-"rampion",
-"calligrapher",
-"jointed charlock",
-"master",
-"sheepshead",
-"barrelhouse",
-"Carolina allspice",
-"mastic",
-"brake pad",
-"whiskey sour",
-"casement window",
-"conveyer belt",
-"stolon",
-"pavonia",
-"shinny",
-"witch elm",
-"logwood",
-"hostel",
-"pageboy",
-"vesper sparrow",
-"pyrrhuloxia",
-"common carline thistle",
-"wafer",
-"boysenberry",
-"screw augur",
-"hack",
-"American white oak",
-"governor general",
-"Mother Hubbard",
-"game fowl",
-"drosophila",
-"delft",
-"nymphet",
-"tollbooth",
-"chough",
-"Russian dressing",
-"plum tomato",
-"American saddle horse",
-"dusky salamander",
-"black medick",
-"red valerian",
-"cordage",
-"Elastoplast",
-"conacaste",
-"backlighting",
-"swell",
-"riveting machine",
-"cowpen daisy",
-"openbill",
-"water speedwell",
-"picture hat",
-"crested myna",
-"servo",
-"bletia",
-"garden trowel",
-"muscadine",
-"common caper",
-"false lily of the valley",
-"aralia",
-"sharp-tailed grouse",
-"cigar smoker",
-"bandoneon",
-"Chinese alligator",
-"crazy",
-"point lace",
-"charcoal",
-"Texas horned lizard",
-"marinara",
-"backstay",
-"Gatling gun",
-"piston",
-"game fish",
-"fall armyworm",
-"grammarian",
-"beer hall",
-"guadalupe fur seal",
-"sugar palm",
-"peanut",
-"velvet ant",
-"light machine gun",
-"rya",
-"cling film",
-"adobo",
-"myrtle oak",
-"angelica",
-"balsam apple",
-"windbreak",
-"brother-in-law",
-"snap brim",
-"automobile factory",
-"clavichord",
-"dusky shark",
-"edible banana",
-"altar boy",
-"California lady's slipper",
-"schoolbag",
-"wax bean",
-"Atlantic walrus",
-"bullpen",
-"straw wine",
-"thatch palm",
-"potluck",
-"tamarind",
-"charcuterie",
-"sod house",
-"tie rack",
-"liebfraumilch",
-"clinician",
-"scarlet lychnis",
-"Spanish iris",
-"bread knife",
-"water oak",
-"bedpan",
-"Angolan",
-"bassarisk",
-"Alaska fur seal",
-"African wild ass",
-"milk float",
-"froghopper",
-"Verpa bohemica",
-"water cooler",
-"chop suey",
-"ranker",
-"red helleborine",
-"Prince of Wales",
-"marmalade tree",
-"car train",
-"giant red paintbrush",
-"desert sand verbena",
-"right whale",
-"baron",
-"stevia",
-"asterism",
-"five-spot",
-"catapult",
-"Silex",
-"fiberscope",
-"refresher",
-"beef Bourguignonne",
-"snood",
-"divot",
-"waterproof",
-"crabeater seal",
-"Missouri primrose",
-"bumper guard",
-"rock opera",
-"Lilo",
-"coffee can",
-"smokehouse",
-"buffalo grass",
-"propjet",
-"ice tongs",
-"poop deck",
-"acorn barnacle",
-"veal parmesan",
-"shower room",
-"collins",
-"ringhals",
-"silage",
-"jawfish",
-"trouser cuff",
-"contour feather",
-"songstress",
-"rachis",
-"White Russian",
-"stanchion",
-"mastaba",
-"flatbed press",
-"viand",
-"legal representative",
-"espalier",
-"organic light-emitting diode",
-"sushi",
-"scorer",
-"haricot",
-"pinna",
-"plectranthus",
-"jungle cat",
-"dried apricot",
-"coach horse",
-"white fringed orchis",
-"veal cordon bleu",
-"bath",
-"dallier",
-"marching order",
-"donkey jacket",
-"Panama tree",
-"aerator",
-"klaxon",
-"pinnacle",
-"shouldered arch",
-"lesser celandine",
-"common eland",
-"Grand Marnier",
-"cock of the rock",
-"phlomis",
-"Japanese umbrella pine",
-"morning room",
-"dead-man's-fingers",
-"little auk",
-"bascule",
-"house paint",
-"home fries",
-"great skua",
-"cesspool",
-"flying gurnard",
-"wild crab",
-"checkerbloom",
-"Wollemi pine",
-"cheese dip",
-"coif",
-"charwoman",
-"tea ball",
-"waif",
-"Arctic ground squirrel",
-"parishioner",
-"stabilizer bar",
-"potentiometer",
-"black cohosh",
-"medlar",
-"willow oak",
-"cascara buckthorn",
-"scoutmaster",
-"Canada lily",
-"poppy seed",
-"paper mulberry",
-"blackthorn",
-"garrison cap",
-"inductee",
-"aeschynanthus",
-"interior live oak",
-"black spleenwort",
-"wild service tree",
-"sling",
-"nicad",
-"swab",
-"sego lily",
-"eiderdown",
-"fruit cocktail",
-"pallasite",
-"weeping spruce",
-"shiv",
-"sea lamprey",
-"coachman",
-"half binding",
-"American white birch",
-"gainer",
-"Concord grape",
-"yellow birch",
-"fucus",
-"common room",
-"io moth",
-"red osier",
-"crucible",
-"galangal",
-"salmagundi",
-"pepper steak",
-"cap opener",
-"swizzle stick",
-"tomato juice",
-"Nobelist",
-"Sarawakian",
-"African monitor",
-"sleeping beauty",
-"stereoscope",
-"curd",
-"pyramid bugle",
-"applejack",
-"dosser",
-"rake handle",
-"pilot light",
-"Eames chair",
-"Scotch and soda",
-"bell heather",
-"dinette",
-"blackpoll",
-"dogie",
-"sound camera",
-"cattle guard",
-"mashie niblick",
-"edible cockle",
-"monocle",
-"steak tartare",
-"partaker",
-"sidesaddle",
-"communications satellite",
-"porkfish",
-"water hemlock",
-"drawbar",
-"ultramicroscope",
-"Jamaican cherry",
-"craftsman",
-"lovage",
-"common apricot",
-"drum majorette",
-"backsword",
-"smooth alder",
-"Amniota",
-"dribbler",
-"theosophist",
-"dolman",
-"ivory tree",
-"Green Beret",
-"pipe smoker",
-"mayoress",
-"mignonette",
-"crampon",
-"henbane",
-"kirtle",
-"death's-head moth",
-"instep",
-"great St John's wort",
-"lorry",
-"black-necked cobra",
-"ball carrier",
-"Jordan almond",
-"byway",
-"earless lizard",
-"marble",
-"andiron",
-"high-protein diet",
-"buzzer",
-"ice floe",
-"crankcase",
-"Bofors gun",
-"sockeye",
-"veery",
-"Delaware",
-"caravansary",
-"prairie coneflower",
-"star apple",
-"suiting",
-"cot",
-"call forwarding",
-"American gallinule",
-"glossy snake",
-"rose chafer",
-"instant coffee",
-"placket",
-"Tarahumara",
-"pulsar",
-"philodendron",
-"orange tortrix",
-"cypress spurge",
-"Welsh rarebit",
-"music box",
-"giant crab",
-"vanilla bean",
-"water thrush",
-"prayer shawl",
-"gouge",
-"promoter",
-"dagga",
-"black currant",
-"bitter cassava",
-"drain basket",
-"snare",
-"digital audiotape",
-"retainer",
-"olive drab",
-"gluten bread",
-"graham cracker",
-"cheddar pink",
-"caregiver",
-"spray paint",
-"Anglo-American",
-"boatyard",
-"backbencher",
-"Link trainer",
-"bell arch",
-"weir",
-"arbor",
-"millionairess",
-"sour cream",
-"earthtongue",
-"crawlspace",
-"crossjack",
-"balalaika",
-"crupper",
-"western redbud",
-"guinea hen",
-"rangeland",
-"gaboon viper",
-"common louse",
-"single-leaf",
-"horseshoe",
-"balsam poplar",
-"triskelion",
-"jack-in-the-box",
-"jester",
-"rain stick",
-"glove compartment",
-"imperial moth",
-"Japanese beech",
-"biotin",
-"turnip",
-"oligarch",
-"western skink",
-"mudguard",
-"retsina",
-"data system",
-"green bristlegrass",
-"visiting professor",
-"beaded lizard",
-"weathercock",
-"Sloppy Joe",
-"high tea",
-"lightweight",
-"record sleeve",
-"cooler",
-"nodding onion",
-"pigs in blankets",
-"torque converter",
-"district attorney",
-"bunting",
-"orrery",
-"radiator hose",
-"common plum",
-"wood spurge",
-"calamus",
-"chicken Kiev",
-"pin",
-"lath",
-"telephone bell",
-"thistledown",
-"audiotape",
-"gypsy moth",
-"snuffer",
-"pari-mutuel machine",
-"peanut butter",
-"hearthrug",
-"sack",
-"Old World yew",
-"chives",
-"stovepipe",
-"xenolith",
-"mattock",
-"mangle",
-"electric chair",
-"backup system",
-"Empire",
-"blackwash",
-"dodder",
-"Allegheny chinkapin",
-"finger plate",
-"junk",
-"brown rice",
-"wild angelica",
-"chinaberry",
-"mason",
-"rasp",
-"den",
-"violet wood sorrel",
-"nosewheel",
-"plenum",
-"merino",
-"kirtle",
-"Igbo",
-"ensign",
-"sex symbol",
-"Belgian endive",
-"sugarberry",
-"yellow salsify",
-"purple emperor",
-"atlas",
-"African clawed frog",
-"leatherjacket",
-"midwife",
-"sac fungus",
-"European cuckoo",
-"three-day event",
-"Mexican poppy",
-"wagon tire",
-"armyworm",
-"rain gauge",
-"Oregon ash",
-"columbarium",
-"spectrophotometer",
-"Milanese",
-"pointing trowel",
-"casualty",
-"Eastern hop hornbeam",
-"lobe",
-"mouthpiece",
-"au pair girl",
-"giant water bug",
-"Browning automatic rifle",
-"laser-guided bomb",
-"drone",
-"white alder",
-"cockleshell",
-"mufti",
-"gravy",
-"berm",
-"boat hook",
-"marshmallow",
-"pet shop",
-"cowpea",
-"tactician",
-"wading pool",
-"anchovy dressing",
-"flip",
-"shackle",
-"Wedgwood",
-"thick-billed murre",
-"erecting prism",
-"giant salamander",
-"sleeper",
-"quiver",
-"chain store",
-"wing tip",
-"New World tapir",
-"witches' butter",
-"gendarme",
-"ginseng",
-"common maidenhair",
-"graduate nurse",
-"balsam pear",
-"hoatzin",
-"philanthropist",
-"axle bar",
-"gas meter",
-"moth mullein",
-"ragbag",
-"Chinese cabbage",
-"celery stick",
-"rutabaga",
-"scalpel",
-"cape marigold",
-"variometer",
-"argali",
-"brig",
-"shuffleboard",
-"wort",
-"Orlon",
-"epiphyllum",
-"allice shad",
-"coffee filter",
-"solar telescope",
-"Japanese linden",
-"thinning shears",
-"golden wattle",
-"queen triggerfish",
-"millinery",
-"surfbird",
-"flame fish",
-"clove",
-"dicamptodon",
-"red-bellied terrapin",
-"turmeric",
-"baya",
-"air horn",
-"Indian coral tree",
-"punnet",
-"sharkskin",
-"water crowfoot",
-"bight",
-"desert iguana",
-"Texas toad",
-"volva",
-"dredge",
-"Turkey red",
-"chemical plant",
-"gemma",
-"dice cup",
-"orange marmalade",
-"mistletoe",
-"surveyor",
-"frozen orange juice",
-"pallette",
-"poultryman",
-"burbot",
-"courlan",
-"captain",
-"saddlery",
-"bodyguard",
-"dwarf tulip",
-"black ash",
-"pulse",
-"nailbrush",
-"tickseed sunflower",
-"legless lizard",
-"shirtwaist",
-"polling booth",
-"chickeree",
-"garlic chive",
-"common thyme",
-"multichannel recorder",
-"screw thread",
-"sangoma",
-"calliopsis",
-"geoduck",
-"colleen",
-"bandicoot rat",
-"pastis",
-"swamp sunflower",
-"scorekeeper",
-"Honduras mahogany",
-"Australian pitcher plant",
-"triangle",
-"elevator shaft",
-"green pea soup",
-"carrel",
-"prairie aster",
-"bird's-nest fungus",
-"scarlet clematis",
-"gook",
-"mescal button",
-"carcase",
-"mulatto",
-"ejection seat",
-"strawberry daiquiri",
-"goat grass",
-"car battery",
-"babu",
-"chief of staff",
-"monilia",
-"Siberian crab",
-"ridge rope",
-"Morchella semilibera",
-"nutmeg",
-"moosewood",
-"graham bread",
-"California four o'clock",
-"zwieback",
-"velvetleaf",
-"abelmosk",
-"shadow box",
-"corned beef hash",
-"newsreader",
-"backstairs",
-"cutwork",
-"sherbert",
-"tooth fungus",
-"angel-wing begonia",
-"greasepaint",
-"common milkwort",
-"potato vine",
-"CD drive",
-"crepe de Chine",
-"sporting man",
-"koto",
-"armet",
-"barking frog",
-"celeriac",
-"drainage ditch",
-"black box",
-"steel blue",
-"clotheshorse",
-"corn speedwell",
-"drawknife",
-"spritsail",
-"vichyssoise",
-"modeler",
-"pocketcomb",
-"limey",
-"suslik",
-"cockpit",
-"digester",
-"brig",
-"raita",
-"troll",
-"benedictine",
-"rock wren",
-"lock",
-"Barnaby's thistle",
-"school bell",
-"school ship",
-"Soave",
-"falchion",
-"swaddling clothes",
-"terrine",
-"smoke screen",
-"rivulus",
-"sweet lemon",
-"cullis",
-"bustier",
-"peppermint",
-"Philadelphia fleabane",
-"Hampshire",
-"active",
-"charnel house",
-"face guard",
-"Quebecois",
-"facilitator",
-"tongue depressor",
-"bitternut",
-"heath aster",
-"sapodilla",
-"bluestem",
-"centrist",
-"Canterbury bell",
-"needlenose pliers",
-"groats",
-"tapa",
-"Qatari",
-"paper feed",
-"tilt-top table",
-"plastering trowel",
-"brazil nut",
-"rotogravure",
-"patriot",
-"manicurist",
-"bacon and eggs",
-"puffbird",
-"lightweight",
-"golden willow",
-"kaiser roll",
-"duff",
-"girandole",
-"seaside daisy",
-"Kurdistan",
-"Skivvies",
-"showboat",
-"fire bell",
-"lock-gate",
-"greater masterwort",
-"weald",
-"ice ax",
-"toetoe",
-"mess kit",
-"bucking bronco",
-"black turnstone",
-"backscratcher",
-"backpacker",
-"basement",
-"marbleization",
-"trigger",
-"satsuma",
-"fall-blooming hydrangea",
-"mountain lady's slipper",
-"yellow oleander",
-"crookneck",
-"ex-president",
-"Venn diagram",
-"psaltery",
-"bulwark",
-"old boy",
-"linear leaf",
-"aril",
-"butt weld",
-"fall webworm",
-"pruner",
-"bald-faced hornet",
-"nougat",
-"tailgate",
-"field speedwell",
-"potsherd",
-"center punch",
-"long beech fern",
-"desert paintbrush",
-"canyon treefrog",
-"bushel basket",
-"Eurasian",
-"swamp horsetail",
-"cryptanalyst",
-"wicket",
-"school newspaper",
-"captive",
-"spider brake",
-"electric mixer",
-"tumbleweed",
-"mason wasp",
-"sash window",
-"paddock",
-"wet bar",
-"oxtongue",
-"stevia",
-"wheat rust",
-"scute",
-"switch engine",
-"mud dauber",
-"dotterel",
-"snailflower",
-"common barberry",
-"mulligatawny",
-"cinnamon bark",
-"cigar box",
-"trivet",
-"proof spirit",
-"cream soda",
-"western grey squirrel",
-"baby powder",
-"Bren",
-"Japanese yew",
-"sailcloth",
-"Basket Maker",
-"bannock",
-"basidiocarp",
-"aphelion",
-"erect bugle",
-"limiter",
-"bosc",
-"Przewalski's horse",
-"helmet orchid",
-"audiometer",
-"battle cruiser",
-"grass widower",
-"staphylococcus",
-"Congolese",
-"common pitcher plant",
-"parliamentary agent",
-"Virginia snakeroot",
-"mockernut",
-"Siberian elm",
-"backbench",
-"rough",
-"chervil",
-"chlamys",
-"nationalist",
-"galantine",
-"screwdriver",
-"falsifier",
-"cancerweed",
-"spur",
-"jerkin",
-"porte-cochere",
-"dill pickle",
-"Montagu's harrier",
-"tetrode",
-"true fungus",
-"American quaking aspen",
-"vitamin B1",
-"leopard lily",
-"eggdrop soup",
-"aurochs",
-"core bit",
-"Jaws of Life",
-"trousseau",
-"parquetry",
-"Disciotis venosa",
-"tender",
-"beef goulash",
-"vitamin K1",
-"pepper spray",
-"covered smut",
-"hook",
-"sports announcer",
-"weapons carrier",
-"foxtail grass",
-"sloe gin",
-"mezereon",
-"antifouling paint",
-"pavior",
-"pile driver",
-"security consultant",
-"monkey-wrench",
-"Indian hemp",
-"amaretto",
-"American wistaria",
-"A-line",
-"market strategist",
-"rainbow runner",
-"souvlaki",
-"binturong",
-"stiletto",
-"gastrula",
-"Vietnamese",
-"Old World hop hornbeam",
-"cold cathode",
-"pier table",
-"houndstooth check",
-"prop root",
-"leaf-footed bug",
-"sedge wren",
-"Dutch iris",
-"drop curtain",
-"opossum rat",
-"lame",
-"pollen tube",
-"doubletree",
-"compression bandage",
-"pinon pine",
-"catmint",
-"pier arch",
-"kingmaker",
-"deanery",
-"loofah",
-"fullback",
-"fencing mask",
-"flying boat",
-"carpet sweeper",
-"lemon-scented gum",
-"Accipitriformes",
-"kit",
-"pigfish",
-"clipper",
-"dolmas",
-"lesser centaury",
-"blood agar",
-"water violet",
-"raw milk",
-"lemonade",
-"vicar-general",
-"supply closet",
-"Anzac",
-"confectioner",
-"ignition key",
-"velvet grass",
-"white willow",
-"John Dory",
-"ruddiness",
-"wheel",
-"common horsetail",
-"hubbard squash",
-"speculum",
-"Spanish bayonet",
-"mountain mint",
-"glint",
-"foxhole",
-"housemate",
-"bootjack",
-"sleigh bell",
-"clog dancer",
-"Mexican mint",
-"rendering",
-"Hausa",
-"star saxifrage",
-"spring squill",
-"clothesbrush",
-"liquid metal reactor",
-"Columbia tiger lily",
-"sorrel",
-"cartwheel",
-"Jersey",
-"Caucasian walnut",
-"desert willow",
-"surveyor",
-"elbow",
-"Santa Gertrudis",
-"fringe bush",
-"industry analyst",
-"lyrebird",
-"Cortland",
-"arroz con pollo",
-"catechist",
-"tank top",
-"jew's harp",
-"cereal oat",
-"heartleaf",
-"short sleeve",
-"butty",
-"butterfly plant",
-"stud finder",
-"felloe",
-"beer garden",
-"clevis",
-"wood warbler",
-"demerara",
-"cornetfish",
-"mince",
-"Jamaica rum",
-"Spanish broom",
-"binnacle",
-"camise",
-"ferrule",
-"Copt",
-"hall",
-"minicar",
-"scimitar",
-"cryptogam",
-"miter box",
-"limestone fern",
-"Marsala",
-"Parliamentarian",
-"gravy",
-"woolly bear moth",
-"formula",
-"squash bug",
-"pigmentation",
-"plate",
-"skin graft",
-"radiotelegraph",
-"hellbender",
-"soft pedal",
-"lavender cotton",
-"propagator",
-"Bailey bridge",
-"cottage pie",
-"rotgut",
-"A battery",
-"pintle",
-"off-line equipment",
-"European swift",
-"shrimp butter",
-"plumb bob",
-"trunk lid",
-"succotash",
-"yellow cypress",
-"heartleaf",
-"antelope squirrel",
-"sambar",
-"maternity ward",
-"deciduous plant",
-"bartlett",
-"Riesling",
-"sour cherry",
-"Klansman",
-"poke",
-"academician",
-"sociolinguist",
-"bird's nest fern",
-"common privet",
-"scale fern",
-"tachograph",
-"oyster stuffing",
-"pusher",
-"green June beetle",
-"staghorn sumac",
-"lockage",
-"master",
-"bap",
-"harlequin",
-"blackfly",
-"spotted coral root",
-"kahikatea",
-"cabana",
-"riot gun",
-"apple mint",
-"kob",
-"praline",
-"confidant",
-"pahautea",
-"float",
-"city father",
-"Zen Buddhist",
-"pessimist",
-"conference center",
-"banksia rose",
-"comfit",
-"sweet cicely",
-"winged bean",
-"henroost",
-"myope",
-"bunt",
-"nailfile",
-"yellow mountain saxifrage",
-"cruise control",
-"abandoned ship",
-"water chinquapin",
-"spanker",
-"wing nut",
-"puccoon",
-"pier glass",
-"Atlantic sailfish",
-"medlar",
-"buttercrunch",
-"rough-skinned newt",
-"planter's punch",
-"Dutch iris",
-"control key",
-"committeewoman",
-"torpedo-boat destroyer",
-"garambulla",
-"tree heath",
-"gladiator",
-"September elm",
-"inclinometer",
-"snowbell",
-"call-in",
-"sunsuit",
-"microfiche",
-"bluestocking",
-"cheval glass",
-"server",
-"franking machine",
-"sugar syrup",
-"Macoun",
-"transport ship",
-"alderfly",
-"wash-and-wear",
-"Abbe condenser",
-"bush nasturtium",
-"wild leek",
-"canary seed",
-"Northern Baptist",
-"sweet wormwood",
-"jaboticaba",
-"cardroom",
-"autoradiograph",
-"ash-pan",
-"sprinkler system",
-"rattrap",
-"claymore",
-"parts bin",
-"forest red gum",
-"thermonuclear reactor",
-"Indian crocus",
-"lector",
-"heir apparent",
-"leafy spurge",
-"masquerader",
-"varicella zoster virus",
-"cucumber tree",
-"hedger",
-"Shumard oak",
-"zooplankton",
-"quartermaster",
-"arrester",
-"bridge",
-"hop clover",
-"meadow foxtail",
-"winter hazel",
-"portable circular saw",
-"penuche",
-"limpa",
-"blue toadflax",
-"mesophyte",
-"Alpine anemone",
-"pet sitter",
-"avocado",
-"streptococcus",
-"fiber optic cable",
-"river red gum",
-"hornist",
-"chicken taco",
-"red spider",
-"tape grass",
-"densitometer",
-"salmonberry",
-"tiger snake",
-"hot toddy",
-"silver fern",
-"candlenut",
-"buckram",
-"local call",
-"defoliator",
-"king",
-"mahoe",
-"lever lock",
-"social insect",
-"winter purslane",
-"bootblack",
-"fireball",
-"ramie",
-"bellbird",
-"prepuce",
-"capote",
-"Chinese forget-me-not",
-"Pisces",
-"costume",
-"California black oak",
-"tree lupine",
-"golden polypody",
-"liger",
-"California whipsnake",
-"urodele",
-"sapodilla",
-"skillet bread",
-"duckpin",
-"supremo",
-"asparagus bean",
-"kampong",
-"endameba",
-"cow pony",
-"rider",
-"motherwort",
-"Persian iris",
-"soursop",
-"kohlrabi",
-"Parisienne",
-"irons",
-"doubles",
-"feijoa",
-"farmplace",
-"cottage cheese",
-"bezoar goat",
-"subcontractor",
-"blunderbuss",
-"down",
-"purple martin",
-"Lapp",
-"crenate leaf",
-"tobacco pouch",
-"beach towel",
-"Santa Lucia fir",
-"monetarist",
-"stringer",
-"ocellated turkey",
-"Texas purple spike",
-"ackee",
-"caddy",
-"hedge mustard",
-"second-rater",
-"strawberry bush",
-"valedictorian",
-"steak sauce",
-"prairie gourd",
-"aspirant",
-"mint",
-"Valenciennes",
-"vodka martini",
-"American persimmon",
-"big brown bat",
-"Mycenaen",
-"mouthpiece",
-"norfolk island pine",
-"pennyroyal",
-"Jewish rye bread",
-"granadilla",
-"tract house",
-"wall",
-"shuttle helicopter",
-"blackjack oak",
-"Lippizan",
-"storm window",
-"white zinnia",
-"sickle",
-"sushi bar",
-"polish",
-"baldric",
-"brooklime",
-"church hat",
-"control circuit",
-"vicuna",
-"death adder",
-"eukaryote",
-"durmast",
-"field soybean",
-"jacket potato",
-"wild basil",
-"queen consort",
-"brooklime",
-"octant",
-"blue false indigo",
-"broccoli raab",
-"step-down transformer",
-"date bread",
-"blue ash",
-"duffer",
-"oak chestnut",
-"pennant",
-"wedge",
-"Florentine iris",
-"morion",
-"weakfish",
-"morning dress",
-"public address system",
-"spearmint",
-"Ashkenazi",
-"sow",
-"interpreter",
-"Metis",
-"pita",
-"iron lung",
-"parfait glass",
-"cylinder lock",
-"immortelle",
-"obstetrical toad",
-"tee hinge",
-"successor",
-"western",
-"working girl",
-"julienne",
-"AND circuit",
-"spaghetti junction",
-"fer-de-lance",
-"enlisted woman",
-"star",
-"lightning rod",
-"bilge pump",
-"pacer",
-"horse nettle",
-"African oil palm",
-"blastocyst",
-"air hammer",
-"bamboo fern",
-"remote terminal",
-"lambkin",
-"money cowrie",
-"Pelham",
-"clinical thermometer",
-"wiggler",
-"guru",
-"false indigo",
-"tea bag",
-"foredeck",
-"king",
-"baby shoe",
-"mule",
-"grab bag",
-"silver-bell tree",
-"knitting machine",
-"cobia",
-"roulette ball",
-"larder",
-"button pink",
-"rumble seat",
-"noria",
-"queen mother",
-"solar thermal system",
-"aquaplane",
-"highbrow",
-"rusty blackbird",
-"desktop",
-"lima bean",
-"pontoon bridge",
-"watercress",
-"wild cabbage",
-"tumbleweed",
-"dressing sack",
-"compact-disk burner",
-"spittoon",
-"marrow",
-"sporophyte",
-"second fiddle",
-"pot-au-feu",
-"specialty store",
-"dry",
-"mole",
-"khadi",
-"japonica",
-"lovage",
-"squamous cell",
-"lobe",
-"European creeper",
-"brown pine",
-"bladderpod",
-"rumble",
-"French Canadian",
-"mascarpone",
-"Pacific halibut",
-"perennial ryegrass",
-"wine lover",
-"turbot",
-"longwool",
-"silver tree fern",
-"dust cover",
-"synchromesh",
-"corn pudding",
-"alpine azalea",
-"garboard",
-"cane sugar",
-"observation dome",
-"condensation pump",
-"hind",
-"taximeter",
-"hand drill",
-"gas thermometer",
-"jammer",
-"buffing wheel",
-"handstamp",
-"prairie mallow",
-"turkey stew",
-"sun spurge",
-"duck pate",
-"kibble",
-"Cassin's kingbird",
-"apadana",
-"Devon",
-"grinner",
-"oocyte",
-"blank",
-"header",
-"schoolmaster",
-"guard ship",
-"intravenous pyelogram",
-"rimu",
-"luff",
-"Mediterranean fruit fly",
-"singlestick",
-"lady-in-waiting",
-"curb",
-"birch",
-"limekiln",
-"orthoscope",
-"serotine",
-"Spanish oak",
-"swamp cottonwood",
-"edger",
-"city man",
-"picnicker",
-"white basswood",
-"Parsons table",
-"Christmas begonia",
-"perspirer",
-"Pacific tree toad",
-"Cape tulip",
-"finger bowl",
-"blue pike",
-"greengage",
-"handcar",
-"milkweed",
-"potbelly",
-"river dolphin",
-"creel",
-"typewriter carriage",
-"banteng",
-"pawnbroker's shop",
-"huon pine",
-"biennial",
-"man of action",
-"foundress",
-"caveman",
-"featheredge",
-"jordan almond",
-"sandblaster",
-"coralberry",
-"low-calorie diet",
-"hoot owl",
-"garter",
-"bain-marie",
-"wrecker",
-"fenugreek",
-"double-hung window",
-"idol",
-"scullery",
-"balloon vine",
-"summer savory",
-"winged spindle tree",
-"Helvella crispa",
-"walrus mustache",
-"gas engine",
-"boulle",
-"rush grass",
-"rue",
-"hoe handle",
-"cat fancier",
-"deerstalker",
-"dunker",
-"American red plum",
-"fall dandelion",
-"groover",
-"sprag",
-"stair-rod",
-"wish-wash",
-"pricket",
-"architrave",
-"California laurel",
-"net melon",
-"Arizona sycamore",
-"executive secretary",
-"silverweed",
-"silky cornel",
-"surface ship",
-"square sail",
-"common purslane",
-"villa",
-"holly-leaved cherry",
-"sweet birch",
-"pecan",
-"artillery shell",
-"breast pocket",
-"pirogi",
-"scarlet runner",
-"rabbit brush",
-"mealworm",
-"leather carp",
-"palette knife",
-"Jerusalem sage",
-"boneshaker",
-"slit lamp",
-"digital voltmeter",
-"polar glacier",
-"square-rigger",
-"homogenized milk",
-"Sten gun",
-"lesser calamint",
-"pyrograph",
-"Korean lawn grass",
-"Zinfandel",
-"crepe fern",
-"western ragweed",
-"clasp knife",
-"distributor housing",
-"cartouche",
-"scooter",
-"ski parka",
-"jackknife",
-"Carolina spring beauty",
-"soft diet",
-"candlesnuffer",
-"horse trader",
-"step stool",
-"agouti",
-"accelerometer",
-"annual fern",
-"judge advocate",
-"angelica",
-"roll film",
-"treehopper",
-"ombu",
-"comer",
-"sultanate",
-"kitchen help",
-"hooded ladies' tresses",
-"milking machine",
-"knuckle joint",
-"Jamaica honeysuckle",
-"music teacher",
-"sauerkraut",
-"Weston cell",
-"slivovitz",
-"Worcester sauce",
-"tall bellflower",
-"chancery",
-"prophetess",
-"casquet",
-"shortfin mako",
-"sorus",
-"visual display unit",
-"asp",
-"grenadier",
-"black pepper",
-"crottle",
-"erasable programmable read-only memory",
-"jabot",
-"ratchet",
-"disk controller",
-"chief petty officer",
-"tap wrench",
-"white mountain ash",
-"cultivated rice",
-"flying phalanger",
-"skillet corn bread",
-"BB gun",
-"Elamite",
-"European red elder",
-"reed rhapis",
-"ciderpress",
-"inga",
-"torpedo",
-"wild teasel",
-"bean curd",
-"oeil de boeuf",
-"acuminate leaf",
-"bitter lemon",
-"hitchrack",
-"Lorraine cross",
-"hostess",
-"European dogtooth",
-"adz",
-"polonaise",
-"rock sandwort",
-"Waldorf salad",
-"myrmecophile",
-"klystron",
-"mole rat",
-"draba",
-"corn borer",
-"robusta coffee",
-"chub mackerel",
-"leatherleaf",
-"chronometer",
-"Moselle",
-"sea aster",
-"fennel",
-"slop basin",
-"constable",
-"Brunswick stew",
-"hydraulic pump",
-"French omelet",
-"icebreaker",
-"Manx shearwater",
-"press of sail",
-"ninepin",
-"blue succory",
-"bootstrap",
-"hallstand",
-"chit",
-"firefly",
-"bearded seal",
-"fuel filter",
-"jezebel",
-"mate",
-"Roquefort",
-"cheesecloth",
-"plasterer",
-"blue pimpernel",
-"lake dwelling",
-"shrink-wrap",
-"goat cheese",
-"common gum cistus",
-"coastland",
-"Sunday best",
-"wild tobacco",
-"mandrake",
-"common unicorn plant",
-"barbican",
-"culotte",
-"blockhouse",
-"German iris",
-"tarragon",
-"caramel",
-"wild rosemary",
-"grain",
-"voyager",
-"squirting cucumber",
-"eastern narrow-mouthed toad",
-"creeping fern",
-"luge",
-"saffron",
-"garland flower",
-"furnace room",
-"starship",
-"Oriental scops owl",
-"Italian honeysuckle",
-"berserker",
-"Chinese elm",
-"scrubber",
-"bishop pine",
-"French polish",
-"compromiser",
-"skimmer",
-"river shad",
-"lobster thermidor",
-"leadwort",
-"man-of-the-earth",
-"razorblade",
-"vicegerent",
-"empress",
-"link",
-"ham and eggs",
-"wild lily of the valley",
-"blackfish",
-"splicer",
-"fossa",
-"mara",
-"moneygrubber",
-"brachiopod",
-"fauteuil",
-"caldera",
-"finish coat",
-"croupier",
-"termer",
-"leopard's-bane",
-"sei whale",
-"molucca balm",
-"dolly",
-"dog food",
-"term infant",
-"soft roll",
-"episcia",
-"sewer",
-"inquiry agent",
-"active citizen",
-"perry",
-"California newt",
-"moon shell",
-"bladderwrack",
-"common shrew",
-"dill",
-"Dutch elm fungus",
-"key lime",
-"electrometer",
-"divorce lawyer",
-"lamb's-quarters",
-"apple turnover",
-"shipmate",
-"Guernsey",
-"legionnaire",
-"electric blanket",
-"Rocky mountain pinon",
-"tobacco mildew",
-"stinking iris",
-"forestiera",
-"departure lounge",
-"wiper motor",
-"jurist",
-"scarlet runner",
-"pallbearer",
-"batter's box",
-"inertial guidance system",
-"fines herbes",
-"oilcan",
-"sisal",
-"mustache cup",
-"steamed pudding",
-"Visayan",
-"fiesta flower",
-"lady tulip",
-"lungless salamander",
-"batiste",
-"electrical system",
-"blazing star",
-"car carrier",
-"Walloon",
-"mother hen",
-"stump",
-"mulled cider",
-"secondary coil",
-"Alexandria senna",
-"etui",
-"scrumpy",
-"Havasupai",
-"jawbreaker",
-"glume",
-"ex-husband",
-"Eskimo",
-"Joint Direct Attack Munition",
-"number theorist",
-"five-hitter",
-"pinstripe",
-"Olympian",
-"common mackerel",
-"stone bass",
-"bigos",
-"Bahraini",
-"airbrush",
-"great ragweed",
-"glass lizard",
-"hand fern",
-"roundel",
-"riding master",
-"shoetree",
-"yellow avens",
-"old fashioned",
-"dolman",
-"stinger",
-"nursling",
-"legate",
-"faille",
-"golden fern",
-"bedpost",
-"shop steward",
-"kidney bean",
-"bladderwort",
-"internist",
-"limeade",
-"Bruneian",
-"Coloradan",
-"playsuit",
-"wintergreen oil",
-"Cantabrigian",
-"mutton snapper",
-"shot putter",
-"hand grenade",
-"moccasin",
-"cobnut",
-"marrow",
-"separatist",
-"cockscomb",
-"discharge pipe",
-"Gabonese",
-"spade bit",
-"chicken cordon bleu",
-"varnish tree",
-"European wood mouse",
-"striped gentian",
-"Ayrshire",
-"curassow",
-"moo goo gai pan",
-"malarial mosquito",
-"glow tube",
-"ledger board",
-"bib-and-tucker",
-"European chestnut",
-"suffragette",
-"color wash",
-"gaffsail",
-"golden larch",
-"voting machine",
-"Kahlua",
-"lungi",
-"amusement arcade",
-"Uzbek",
-"butternut",
-"mold",
-"mule's ears",
-"dickey",
-"shrimper",
-"trophozoite",
-"dreadnought",
-"shepherd's purse",
-"greenhouse whitefly",
-"spotted gum",
-"copperware",
-"perfect game",
-"semigloss",
-"spawn",
-"telecom hotel",
-"stakeholder",
-"mason wasp",
-"flibbertigibbet",
-"chin strap",
-"fringed pink",
-"saki",
-"urchin",
-"memorizer",
-"roulade",
-"whiting",
-"cling",
-"corncrake",
-"Queen of England",
-"choo-choo",
-"empty",
-"heating pad",
-"playmate",
-"visualizer",
-"popcorn ball",
-"absconder",
-"sou'wester",
-"target acquisition system",
-"mock-up",
-"dental floss",
-"tray cloth",
-"haddock",
-"bulblet fern",
-"housing commissioner",
-"delayed action",
-"anchor light",
-"harbor porpoise",
-"water wings",
-"PT boat",
-"night latch",
-"fennel",
-"doorframe",
-"green-tailed towhee",
-"grey polypody",
-"torture chamber",
-"American germander",
-"Chinese wistaria",
-"cattalo",
-"accompanist",
-"rifleman",
-"alpine clover",
-"contrarian",
-"lemon peel",
-"Mexican cypress",
-"sprog",
-"dado",
-"Galilean telescope",
-"desmid",
-"lockup",
-"Latin",
-"American raspberry",
-"mescal",
-"butternut",
-"prairie orchid",
-"downy yellow violet",
-"green hellebore",
-"radio compass",
-"bread and butter pickle",
-"Cherokee rose",
-"knish",
-"destroyer escort",
-"Arkansan",
-"langlaufer",
-"pyxis",
-"winter savory",
-"velocipede",
-"motley",
-"winter savory",
-"law student",
-"barren ground caribou",
-"apple dumpling",
-"field hospital",
-"works",
-"city editor",
-"European flatfish",
-"Morchella crassipes",
-"life office",
-"boot camp",
-"cream sauce",
-"cape aloe",
-"acetate disk",
-"devil ray",
-"tile cutter",
-"Plymouth Rock",
-"microspore",
-"godown",
-"Syrian",
-"tiercel",
-"American cranberry",
-"lesser spearwort",
-"anopheline",
-"Spanish oyster plant",
-"wire cloth",
-"attic fan",
-"birch beer",
-"small computer system interface",
-"crook",
-"ribbon fern",
-"explorer's gentian",
-"nagami",
-"I-beam",
-"rosebud cherry",
-"Jerusalem artichoke",
-"Stillson wrench",
-"pluralist",
-"district manager",
-"Levantine",
-"orangeade",
-"part-timer",
-"post horn",
-"Oregon grape",
-"contadino",
-"cargo helicopter",
-"silverpoint",
-"chaja",
-"California bluebell",
-"case",
-"Shasta",
-"cheese cutter",
-"Leishmania",
-"avalanche lily",
-"iron horse",
-"bialy",
-"Yana",
-"Delawarean",
-"Prussian",
-"nonpareil",
-"hammer",
-"hoper",
-"chewink",
-"anil",
-"skim milk",
-"desert four o'clock",
-"crescent wrench",
-"white marlin",
-"blue jasmine",
-"malacca",
-"anadama bread",
-"purple poppy mallow",
-"ganglion cell",
-"ligature",
-"no-parking zone",
-"golden clematis",
-"Cotswold",
-"aliterate",
-"shebeen",
-"yardarm",
-"superbug",
-"fanaloka",
-"stinking cedar",
-"spirochete",
-"wort",
-"pater",
-"heaume",
-"thermocouple",
-"ironing",
-"naval tactical data system",
-"European goatsucker",
-"prairie cordgrass",
-"accused",
-"foreign agent",
-"halberd",
-"western mugwort",
-"esthetician",
-"Persian lilac",
-"cracked-wheat bread",
-"crosscut saw",
-"rock penstemon",
-"paper cutter",
-"crematory",
-"ideologist",
-"cattley guava",
-"margarine",
-"creosote bush",
-"hoary plantain",
-"spark gap",
-"lumberjack",
-"Greek valerian",
-"mission bells",
-"tight end",
-"bigeye",
-"large crabgrass",
-"stone marten",
-"cleat",
-"lentil",
-"bay scallop",
-"lector",
-"charger",
-"assemblywoman",
-"second lieutenant",
-"boil smut",
-"sarsaparilla",
-"hydromel",
-"cat flea",
-"pinfish",
-"whole milk",
-"hairnet",
-"myeloblast",
-"peasant",
-"blind curve",
-"first offender",
-"dwarf-white trillium",
-"Brother",
-"coatdress",
-"gun emplacement",
-"tamarisk gerbil",
-"snap",
-"air cushion",
-"trailing edge",
-"potato vine",
-"gig",
-"everlasting pea",
-"champion",
-"dibble",
-"rattail cactus",
-"timothy",
-"prince's-feather",
-"cutlas",
-"lockring",
-"sealing wax",
-"Brussels lace",
-"corn mint",
-"highboard",
-"she-oak",
-"wild celery",
-"pillar",
-"Burberry",
-"Hakka",
-"leucothoe",
-"bell tent",
-"gallery",
-"coontie",
-"leather fern",
-"smack",
-"adenovirus",
-"linoleum",
-"chain wrench",
-"tammy",
-"gas fixture",
-"nut bar",
-"baneberry",
-"butterscotch",
-"goat's rue",
-"bullock",
-"grey snapper",
-"mother-in-law",
-"hyson",
-"wayfaring tree",
-"mollie",
-"needle spike rush",
-"buckwheat",
-"bayberry",
-"brush-tailed phalanger",
-"dry rot",
-"harborage",
-"stormy petrel",
-"Oriental beetle",
-"Atlantic halibut",
-"coping saw",
-"simple fruit",
-"viscose rayon",
-"surgeonfish",
-"upstairs",
-"security system",
-"common ragweed",
-"verticillium",
-"pancake batter",
-"hawk's-beard",
-"Dutchman's-pipe",
-"refrigeration system",
-"European parsley fern",
-"Ivy Leaguer",
-"totalitarian",
-"gonococcus",
-"towhead",
-"showy sunflower",
-"pallium",
-"multiengine airplane",
-"hair trigger",
-"rabbit-eared bandicoot",
-"siskiyou lewisia",
-"fuel system",
-"flat arch",
-"broad beech fern",
-"Alpine lady fern",
-"bracken",
-"Kentucky black bass",
-"rut",
-"mountain maple",
-"tunaburger",
-"umbrella fern",
-"white-headed stilt",
-"meat hook",
-"panhandler",
-"washhouse",
-"barnyard",
-"safety lamp",
-"leg",
-"ripple mark",
-"paper",
-"sagebrush lizard",
-"light heavyweight",
-"common nutcracker",
-"operator",
-"stalking-horse",
-"horseless carriage",
-"fishhook",
-"suction cup",
-"peg",
-"Ungulata",
-"false teeth",
-"round-bottom flask",
-"Luba",
-"campaign hat",
-"firebox",
-"rudder",
-"parapet",
-"ice pack",
-"appellant",
-"spirit stove",
-"metheglin",
-"common bamboo",
-"soapwort gentian",
-"pannikin",
-"time capsule",
-"burn bag",
-"folk poet",
-"tropical prawn",
-"end man",
-"new caledonian pine",
-"linen",
-"web",
-"free trader",
-"jury box",
-"railing",
-"pignut",
-"leaker",
-"potboy",
-"rubber boa",
-"white snakeroot",
-"plumber",
-"Candida albicans",
-"surfboat",
-"woman",
-"promulgator",
-"eyecup",
-"wild China tree",
-"rattlesnake master",
-"Viyella",
-"alpine salamander",
-"ailanthus silkworm",
-"Albatrellus ovinus",
-"war room",
-"meadow vole",
-"robotics equipment",
-"rotary actuator",
-"Engelmann spruce",
-"pinesap",
-"beefcake",
-"native speaker",
-"ridge",
-"injector",
-"water chute",
-"salmonberry",
-"decoupage",
-"bottlebrush",
-"date plum",
-"circlet",
-"American mountain ash",
-"pocketbook",
-"horsemint",
-"sweet four o'clock",
-"kirpan",
-"pinto bean",
-"chervil",
-"equator",
-"range animal",
-"candy thermometer",
-"calanthe",
-"cul",
-"stipendiary",
-"brahman",
-"pelican crossing",
-"topgallant",
-"wild senna",
-"sliding window",
-"carrier pigeon",
-"Tatar",
-"quadruplet",
-"bumboat",
-"spearmint oil",
-"slip clutch",
-"young Turk",
-"golden yarrow",
-"shank",
-"glasswort",
-"dental plaque",
-"Manduca sexta",
-"Northern bedstraw",
-"dent corn",
-"Life Saver",
-"western wall flower",
-"bedder",
-"wherry",
-"Tuscarora",
-"scrapple",
-"borstal",
-"reflux condenser",
-"problem solver",
-"nondriver",
-"perforation",
-"eastern cricket frog",
-"white wood aster",
-"broad buckler-fern",
-"Cape primrose",
-"herringbone",
-"head louse",
-"earl",
-"baton",
-"recording system",
-"primary color for light",
-"cherry laurel",
-"pomfret",
-"ratafia",
-"chocolate milk",
-"obscurantist",
-"revisionist",
-"rood screen",
-"magnetic needle",
-"commensal",
-"oil tycoon",
-"celebrant",
-"domicile",
-"harvest mouse",
-"California nutmeg",
-"greater spearwort",
-"black-billed cuckoo",
-"winepress",
-"demographer",
-"straw boss",
-"diabetic diet",
-"sweetmeat",
-"rabbet",
-"ming tree",
-"basketweaver",
-"freestone",
-"walk-in",
-"Aryan",
-"box coat",
-"audio amplifier",
-"chicken salad",
-"churidars",
-"whydah",
-"box",
-"batman",
-"siren",
-"selectman",
-"gouger",
-"drip coffee",
-"Caesar salad",
-"interpreter",
-"whinstone",
-"grey goldenrod",
-"minicomputer",
-"honey crisp",
-"hypercoaster",
-"Irishman",
-"swamp white oak",
-"reed canary grass",
-"globeflower",
-"cynthia moth",
-"fennel seed",
-"canthus",
-"chino",
-"blind date",
-"tar pit",
-"watermelon begonia",
-"fishtail palm",
-"overcast",
-"Pearmain",
-"primary color for pigments",
-"coal seam",
-"wherry",
-"safety bolt",
-"cretonne",
-"Michigan lily",
-"inflater",
-"moneybag",
-"huckleberry",
-"brassard",
-"bush vetch",
-"looking glass tree",
-"pinwheel roll",
-"alfalfa sprout",
-"sea kale",
-"clinometer",
-"achira",
-"lorgnette",
-"potter wasp",
-"gilded flicker",
-"tody",
-"capulin",
-"captain's chair",
-"crackle",
-"gerardia",
-"prie-dieu",
-"venture capitalist",
-"New Jerseyan",
-"block and tackle",
-"elf cup",
-"bur reed",
-"automatic transmission",
-"wax palm",
-"flytrap",
-"crack willow",
-"coachwhip",
-"swizzle",
-"lugger",
-"Dewar flask",
-"baster",
-"oxyacetylene torch",
-"Culex quinquefasciatus",
-"St Peter's wort",
-"wild hyacinth",
-"Russian almond",
-"burrfish",
-"wintergreen",
-"katsura tree",
-"butcher knife",
-"perfumery",
-"thresher",
-"porte-cochere",
-"sheepwalk",
-"hypotenuse",
-"Dalmatian iris",
-"buttercup squash",
-"demiglace",
-"goldenseal",
-"preceptor",
-"rigger",
-"poikilotherm",
-"old-age pensioner",
-"posthouse",
-"wood horsetail",
-"repeater",
-"reciprocating engine",
-"Rambouillet",
-"terra cotta",
-"togs",
-"battledore",
-"horizontal tail",
-"missile defense system",
-"trier",
-"morello",
-"woolly adelgid",
-"munition",
-"double creme",
-"in-fighting",
-"squirrel corn",
-"crow's nest",
-"antler moth",
-"brake cylinder",
-"bandoleer",
-"noticer",
-"Parmesan",
-"hipline",
-"cheapskate",
-"Dubonnet",
-"mole rat",
-"bog aster",
-"ribbon tree",
-"meadow rue",
-"nard",
-"ratel",
-"loose smut",
-"snapping shrimp",
-"golden glow",
-"basil thyme",
-"Florida strap fern",
-"moonshine",
-"flume",
-"lace fern",
-"black bream",
-"orchestra pit",
-"archerfish",
-"exile",
-"ringdove",
-"career man",
-"godfather",
-"bottom-feeder",
-"pasteurized milk",
-"dental implant",
-"pedicel",
-"Catalpa speciosa",
-"yellow foxglove",
-"lancet arch",
-"steam shovel",
-"sampan",
-"patrol boat",
-"sailor cap",
-"tollgate",
-"monal",
-"velociraptor",
-"cacique",
-"jack oak",
-"cursed crowfoot",
-"creep",
-"Parry manzanita",
-"common matrimony vine",
-"grace cup",
-"caecilian",
-"spurge laurel",
-"prickly lettuce",
-"Regius professor",
-"camail",
-"Sitka willow",
-"Courtelle",
-"gin sling",
-"dogmatist",
-"guest",
-"saltine",
-"dust cover",
-"sport",
-"sweeper",
-"feist",
-"lady's-eardrop",
-"vibist",
-"wire stripper",
-"tenpin",
-"interplanetary space",
-"beet green",
-"pruning knife",
-"drainage system",
-"gunnery",
-"ballet master",
-"lime juice",
-"flak catcher",
-"lacrosse ball",
-"Canadian aspen",
-"beatnik",
-"railhead",
-"utilizer",
-"spadefish",
-"Arizona white oak",
-"city university",
-"dense blazing star",
-"hedger",
-"chain pickerel",
-"right-hand man",
-"namby-pamby",
-"nacelle",
-"redneck",
-"tumbler",
-"Chief Secretary",
-"cannon",
-"cupola",
-"kummel",
-"papaya juice",
-"Burton",
-"Stanley Steamer",
-"loganberry",
-"stylus",
-"square meal",
-"rock bass",
-"western ladies' tresses",
-"dramatist",
-"assignee",
-"tandoor",
-"trumpetwood",
-"segregator",
-"green adder's mouth",
-"coral necklace",
-"ani",
-"iceboat",
-"densimeter",
-"oxtail soup",
-"kernel",
-"cos lettuce",
-"greenishness",
-"panchromatic film",
-"Parker House roll",
-"oatmeal",
-"backsaw",
-"double Gloucester",
-"bailey",
-"storage cell",
-"giant",
-"coconut milk",
-"broadtail",
-"barouche",
-"loir",
-"soybean meal",
-"white-leaved rockrose",
-"junction barrier",
-"spandrel",
-"sweat bag",
-"goldilocks",
-"flowering wintergreen",
-"cockspur",
-"beef fondue",
-"holding cell",
-"cardamom",
-"cagoule",
-"Kamia",
-"tangelo",
-"Herschelian telescope",
-"wine bar",
-"kachina",
-"sand sage",
-"guy",
-"ivory palm",
-"citrus mealybug",
-"topper",
-"ladyfish",
-"force pump",
-"fanion",
-"calaba",
-"Iowa",
-"orrisroot",
-"ivorybill",
-"Secretary of Agriculture",
-"gagman",
-"dry cell",
-"hypnotist",
-"kenaf",
-"grey alder",
-"deathwatch beetle",
-"gagman",
-"magnetic stripe",
-"trap door",
-"abdominal wall",
-"prefab",
-"broomcorn millet",
-"architeuthis",
-"angler",
-"Pacific giant salamander",
-"barbette carriage",
-"low-fat diet",
-"veal scallopini",
-"B battery",
-"wallah",
-"landing flap",
-"pistachio",
-"jaguarundi",
-"nagi",
-"cicerone",
-"felt fungus",
-"Aertex",
-"stocks",
-"smooth aster",
-"patchouli",
-"lemon sole",
-"sleeper",
-"basket fern",
-"dundathu pine",
-"anjou",
-"Moreton Bay chestnut",
-"broom sedge",
-"candid camera",
-"red angel's trumpet",
-"oilstone",
-"cinnamon toast",
-"Pacific walrus",
-"fruit custard",
-"Jehovah's Witness",
-"mate",
-"voyeur",
-"Esselen",
-"achromatic lens",
-"sanguine",
-"brine shrimp",
-"dunce cap",
-"swot",
-"transit instrument",
-"grey willow",
-"pack",
-"bench clamp",
-"Nova Scotian",
-"gadgetry",
-"silvery spleenwort",
-"enchantress",
-"rough fish",
-"morula",
-"giant taro",
-"sorus",
-"roux",
-"polyhedral angle",
-"spruce beer",
-"Chicano",
-"cola extract",
-"outfielder",
-"kohleria",
-"white-rumped shrike",
-"car-ferry",
-"subway token",
-"spoon bread",
-"totara",
-"corn borer",
-"bowhead",
-"tensimeter",
-"water scooter",
-"flickertail",
-"Catholicos",
-"pleaser",
-"blue-eyed Mary",
-"calabash",
-"handyman",
-"cascades frog",
-"facing",
-"scarlet oak",
-"lutist",
-"ginger",
-"tree tomato",
-"Harvey Wallbanger",
-"tent peg",
-"insectivore",
-"fusil",
-"swale",
-"chinning bar",
-"bladderpod",
-"New Dealer",
-"dhoti",
-"proscenium arch",
-"common vetchling",
-"channel",
-"collect call",
-"safflower",
-"Texas tortoise",
-"test equipment",
-"theca",
-"RAM disk",
-"sheep sorrel",
-"rammer",
-"buttonhook",
-"honey mesquite",
-"dominus",
-"babirusa",
-"queen",
-"Aspergillus fumigatus",
-"crash barrier",
-"nonmember",
-"Muscovite",
-"verdin",
-"Australopithecus afarensis",
-"Turkish Delight",
-"stalked puffball",
-"giardia",
-"divider",
-"mountain skink",
-"head smut",
-"pacemaker",
-"evaporated milk",
-"rattlesnake fern",
-"flamethrower",
-"navy bean",
-"bather",
-"steed",
-"showy orchis",
-"stone crab",
-"artichoke heart",
-"phantom orchid",
-"space helmet",
-"swamp laurel",
-"privateer",
-"junior",
-"surcoat",
-"bristlegrass",
-"flower girl",
-"aphid lion",
-"penthouse",
-"lemonade mix",
-"coude telescope",
-"natal plum",
-"scriber",
-"wood nettle",
-"rape suspect",
-"resplendent quetzel",
-"western poppy",
-"choir loft",
-"fore-topsail",
-"thyme-leaved sandwort",
-"erotic",
-"short circuit",
-"outdoors",
-"flowering tobacco",
-"hookup",
-"aviatrix",
-"corker",
-"horehound",
-"horn",
-"swamp pine",
-"water biscuit",
-"cherimoya",
-"vaporizer",
-"courtier",
-"European sole",
-"full skirt",
-"Mother Carey's chicken",
-"cymule",
-"huck",
-"white snapdragon",
-"mountain nyala",
-"country borage",
-"bonduc",
-"casein paint",
-"grampus",
-"shrimpfish",
-"lodge",
-"dragee",
-"black walnut",
-"caraway seed",
-"roper",
-"glass cutter",
-"tab key",
-"Richardson's geranium",
-"demigod",
-"chichipe",
-"Italian ryegrass",
-"cadet",
-"electrograph",
-"rudd",
-"carpenteria",
-"foie gras",
-"lignum vitae",
-"hedge nettle",
-"pledger",
-"American hackberry",
-"flageolet",
-"beaked hazelnut",
-"reflectometer",
-"sticky geranium",
-"marriage bed",
-"white pepper",
-"japanese clover",
-"whiteface",
-"gnat",
-"extrovert",
-"Canada plum",
-"talipot",
-"chicken stew",
-"egg foo yong",
-"fraxinella",
-"skibob",
-"saucer magnolia",
-"jacket",
-"green smut fungus",
-"cloakroom",
-"landing skid",
-"booth",
-"ice milk",
-"dipole",
-"striped coral root",
-"red buckeye",
-"roughcast",
-"breaststroker",
-"cowherb",
-"razor clam",
-"first-aid station",
-"briarroot",
-"clambake",
-"lander",
-"Bramley's Seedling",
-"frail",
-"jird",
-"minisub",
-"luging",
-"poison milkweed",
-"European lobster",
-"epidemiologist",
-"spandex",
-"paloverde",
-"marumi",
-"bypass condenser",
-"punter",
-"petty spurge",
-"Coryphaena hippurus",
-"bilberry",
-"vermillion rockfish",
-"witness box",
-"viscometer",
-"pulque",
-"Massachusetts fern",
-"herring salad",
-"ridge tile",
-"mesa",
-"dwarf grey willow",
-"southern aster",
-"punch pliers",
-"tarnished plant bug",
-"hoop pine",
-"Japanese red pine",
-"benedick",
-"rebozo",
-"silver plate",
-"silver willow",
-"mouse-ear hawkweed",
-"bonito shark",
-"abutment arch",
-"noble cane",
-"tiger rattlesnake",
-"pongee",
-"jumping plant louse",
-"pattypan squash",
-"giant ryegrass",
-"railroad bed",
-"stiff aster",
-"imperial Japanese morning glory",
-"laundry",
-"winter cress",
-"large white petunia",
-"tea maker",
-"pen-and-ink",
-"early warning system",
-"lug",
-"monocot",
-"sea wormwood",
-"breechblock",
-"postage meter",
-"third rail",
-"Mongoloid",
-"Australopithecus boisei",
-"umbrella tent",
-"stirrer",
-"Dumpy level",
-"beroe",
-"post and lintel",
-"green spleenwort",
-"tomato paste",
-"dishpan",
-"stentor",
-"sweatband",
-"cobbler",
-"New York fern",
-"gaff",
-"prairie willow",
-"cyclops",
-"jigsaw",
-"rotavirus",
-"pallet",
-"eastern ground snake",
-"boiling water reactor",
-"acute triangle",
-"agora",
-"European cranberry",
-"roebuck",
-"surgical dressing",
-"busboy",
-"cannikin",
-"feedlot",
-"common pond-skater",
-"cochin",
-"horsehair lichen",
-"fetter",
-"sapote",
-"fichu",
-"dermatologist",
-"fire tongs",
-"creme anglais",
-"foster-mother",
-"laurelwood",
-"chicken snake",
-"mincemeat",
-"rocker",
-"wild spinach",
-"powder and shot",
-"butterwort",
-"auxiliary engine",
-"mamey",
-"hart's-tongue",
-"sucking pig",
-"American turkey oak",
-"troopship",
-"buttermilk",
-"divi-divi",
-"boatswain's chair",
-"soda fountain",
-"southern flying squirrel",
-"elastic",
-"cutaway",
-"housekeeper",
-"renegade",
-"apple rust",
-"bridoon",
-"machicolation",
-"stunt",
-"keyhole limpet",
-"personality",
-"solitary vireo",
-"epidendron",
-"Jihadist",
-"boffin",
-"bettong",
-"terror",
-"partial denture",
-"pusher",
-"saltcellar",
-"capstan",
-"large poodle",
-"Bibb lettuce",
-"low-bush blueberry",
-"staple",
-"banded krait",
-"sickroom",
-"barnyard grass",
-"wandflower",
-"woodworm",
-"bluegrass",
-"squirrel's-foot fern",
-"rabbitfish",
-"delta wing",
-"milking shorthorn",
-"limber pine",
-"guru",
-"gamine",
-"scythe",
-"sweetsop",
-"Gruyere",
-"bloodmobile",
-"mine detector",
-"American mistletoe",
-"silver beech",
-"hound's-tongue",
-"Lombardy poplar",
-"basket fern",
-"pink-and-white everlasting",
-"redtail",
-"Aladdin's lamp",
-"mace",
-"outtake",
-"condensed milk",
-"Canada wild rye",
-"silver perch",
-"waxflower",
-"taxer",
-"Chinese chestnut",
-"Our Lord's candle",
-"mugwump",
-"school system",
-"salp",
-"osso buco",
-"dress shirt",
-"butterweed",
-"low-fat milk",
-"couchette",
-"broomcorn",
-"proscenium",
-"mill agent",
-"smut grass",
-"humpback",
-"southern spadefoot",
-"military leader",
-"canebrake rattlesnake",
-"tailor-made",
-"ebony",
-"beach house",
-"flying gecko",
-"hoary alison",
-"typhoid bacillus",
-"Romanov",
-"vanilla pudding",
-"sweet cicely",
-"Spodoptera exigua",
-"dress rack",
-"flannel",
-"skipjack",
-"bolognese pasta sauce",
-"rooibos",
-"thunderer",
-"blessed thistle",
-"gauntlet",
-"mahatma",
-"granadilla",
-"laurel sumac",
-"Yuma",
-"thyme-leaved speedwell",
-"encyclical",
-"twill",
-"linocut",
-"manna gum",
-"spark arrester",
-"cocklebur",
-"Indian hemp",
-"lemon oil",
-"Hall's honeysuckle",
-"raceway",
-"flop",
-"Himalayan lilac",
-"one-flowered wintergreen",
-"photosphere",
-"silvery spleenwort",
-"convex polygon",
-"canarybird flower",
-"foster-sister",
-"fluffy omelet",
-"palanquin",
-"roll",
-"dandelion green",
-"Javanese",
-"workpiece",
-"Carmelite",
-"bread mold",
-"schlemiel",
-"wild lily of the valley",
-"grugru",
-"solenoid",
-"puff batter",
-"skep",
-"balance wheel",
-"Gadaba",
-"portia tree",
-"mobcap",
-"two-man tent",
-"scuffle",
-"firebrat",
-"ant lion",
-"anise",
-"caster",
-"giant petrel",
-"American water spaniel",
-"naboom",
-"treasure ship",
-"foster-son",
-"fiddleneck",
-"alidade",
-"sugar refinery",
-"wild oat",
-"water beetle",
-"generic",
-"damson plum",
-"abrocome",
-"detainee",
-"pitch pipe",
-"coast",
-"nilgai",
-"radiotherapy equipment",
-"heart-leaved aster",
-"gristmill",
-"grocer",
-"Appaloosa",
-"Cheviot",
-"brake pedal",
-"lantana",
-"cave myotis",
-"Rob Roy",
-"sea spider",
-"latrine",
-"carpophore",
-"recycling plant",
-"coondog",
-"brace and bit",
-"funambulist",
-"eggar",
-"mantelet",
-"postdoc",
-"mezzanine",
-"coco plum",
-"pulse generator",
-"high-vitamin diet",
-"menhaden",
-"mechanical engineer",
-"bergamot mint",
-"Chuvash",
-"grated cheese",
-"helicon",
-"belladonna",
-"beet armyworm",
-"eelgrass",
-"resuscitator",
-"interrupted fern",
-"arrow grass",
-"cistern",
-"Pacific herring",
-"colostrum",
-"journal bearing",
-"Fauve",
-"wrist pin",
-"canape",
-"choice morsel",
-"quadraphony",
-"guard boat",
-"shortgrass",
-"claymore mine",
-"hitching post",
-"cargo door",
-"decoder",
-"gym rat",
-"Cocopa",
-"commander",
-"apple of Peru",
-"seckel",
-"yellow goatfish",
-"dog flea",
-"dodo",
-"oconee bells",
-"Tudor arch",
-"turkey stuffing",
-"ebony spleenwort",
-"wheat flag smut",
-"scolopendrium",
-"Brazilian pepper tree",
-"gusset",
-"inspector",
-"lunar excursion module",
-"baron",
-"plantigrade mammal",
-"Creole",
-"phosphate",
-"aromatic aster",
-"ghee",
-"audiovisual",
-"onychophoran",
-"cotton stainer",
-"lieutenant junior grade",
-"spheroid",
-"amen corner",
-"caper sauce",
-"Caladium bicolor",
-"dyer's rocket",
-"seaside goldenrod",
-"flint corn",
-"Very pistol",
-"rotifer",
-"steeplechaser",
-"rouleau",
-"escape wheel",
-"Namibian",
-"millivoltmeter",
-"emmer",
-"climatologist",
-"agateware",
-"sea lyme grass",
-"inclinometer",
-"water fennel",
-"saddle seat",
-"vicar",
-"garden cress",
-"ski rack",
-"Norfolk jacket",
-"casaba",
-"coast rhododendron",
-"sericea lespedeza",
-"hematocrit",
-"autopilot",
-"tilter",
-"finish coat",
-"Pennsylvanian",
-"shrubby St John's wort",
-"podocarp",
-"percussion cap",
-"ceriman",
-"peanut bar",
-"gean",
-"jack",
-"durra",
-"rotor",
-"carob",
-"cottage tulip",
-"three-spined stickleback",
-"trencher",
-"elevator",
-"kalumpang",
-"abaca",
-"Australopithecus robustus",
-"active matrix screen",
-"water bed",
-"hatmaker",
-"lodestone",
-"cat food",
-"overcup oak",
-"balletomane",
-"popgun",
-"rheometer",
-"process cheese",
-"frog legs",
-"heartleaf arnica",
-"p-n-p transistor",
-"steam turbine",
-"Tulu",
-"scalene triangle",
-"licorice fern",
-"coffee break",
-"trade unionist",
-"starved aster",
-"firing pin",
-"water gum",
-"Masonite",
-"hairspring",
-"seminarian",
-"blue racer",
-"forecastle",
-"scrub pine",
-"Atlantic spiny dogfish",
-"kopje",
-"orphrey",
-"fan tracery",
-"gee-gee",
-"vixen",
-"interstellar space",
-"Harris Tweed",
-"sawmill",
-"lemon mint",
-"bitewing",
-"ringlet",
-"Chinese mustard",
-"paleontologist",
-"American hazel",
-"brigantine",
-"clay-colored robin",
-"zombie",
-"nectarine",
-"West Indian jasmine",
-"pineapple weed",
-"rusher",
-"gynecologist",
-"pole",
-"thylacine",
-"myrtle beech",
-"golden cup",
-"woodruff",
-"T-bar lift",
-"terebinth",
-"service club",
-"homegirl",
-"Blue Mountain tea",
-"figwort",
-"New Hampshirite",
-"Stayman",
-"tonometer",
-"white turnip",
-"messuage",
-"cruet-stand",
-"colliery",
-"connecting room",
-"lesser twayblade",
-"bland diet",
-"crown prince",
-"beggarwoman",
-"restharrow",
-"bower actinidia",
-"firebug",
-"hepatic tanager",
-"telegraph",
-"Spodoptera frugiperda",
-"spackle",
-"carpenter's square",
-"pyx",
-"supermom",
-"thickhead",
-"whorled milkweed",
-"Arctic char",
-"Chinese rhubarb",
-"pince-nez",
-"wolverine",
-"tomato concentrate",
-"cascarilla bark",
-"red underwing",
-"leather flower",
-"Jerusalem thorn",
-"bullpen",
-"Salisbury steak",
-"anode",
-"coffeeberry",
-"bottling plant",
-"fritter batter",
-"aerial torpedo",
-"matrix",
-"local oscillator",
-"stalked puffball",
-"bruin",
-"three-cornered leek",
-"wassail",
-"stabling",
-"damping off fungus",
-"myriapod",
-"osier",
-"lesser kudu",
-"cownose ray",
-"chokecherry",
-"wagon",
-"obstetrician",
-"Glengarry",
-"even-pinnate leaf",
-"wine sauce",
-"osteocyte",
-"baker's yeast",
-"heir presumptive",
-"blackjack",
-"tympanist",
-"golden fern",
-"fipple",
-"Japanese oak",
-"bar mask",
-"stamping machine",
-"argus",
-"knobcone pine",
-"oil beetle",
-"lanai",
-"upper berth",
-"condenser",
-"proctologist",
-"catechu",
-"wild spurge",
-"vestry",
-"ground snake",
-"proton accelerator",
-"walker",
-"scarlet bush",
-"transom",
-"lagging",
-"bouillon",
-"slender loris",
-"black currant",
-"developer",
-"football hero",
-"plum sauce",
-"striped mullet",
-"prince charming",
-"fictional animal",
-"prosimian",
-"lug wrench",
-"lemonwood",
-"kirsch",
-"spy satellite",
-"black caraway",
-"Thompson Seedless",
-"bead tree",
-"purple fringeless orchid",
-"Virginia strawberry",
-"chigetai",
-"punkie",
-"gall wasp",
-"addressing machine",
-"rock polypody",
-"good-king-henry",
-"spring cankerworm",
-"wimple",
-"noncandidate",
-"saskatoon",
-"hacienda",
-"Darjeeling",
-"snowberry",
-"lounging pajama",
-"ascospore",
-"ski-plane",
-"hedgehog cereus",
-"Welsh onion",
-"yautia",
-"coaster brake",
-"sickle cell",
-"parrot's beak",
-"fuller's teasel",
-"painted greenling",
-"scablands",
-"stuffed cabbage",
-"barrel organ",
-"etcher",
-"dwarf maple",
-"camp",
-"Australian blacksnake",
-"currycomb",
-"obtuse triangle",
-"rose gum",
-"psychrometer",
-"abridger",
-"torpedo",
-"carpet loom",
-"sodalist",
-"slender rush",
-"loligo",
-"sclerometer",
-"wimp",
-"dotted gayfeather",
-"green ash",
-"pinstripe",
-"moralist",
-"medusa's head",
-"garden centipede",
-"heath aster",
-"fool's parsley",
-"olla podrida",
-"Potawatomi",
-"Edam",
-"toothache tree",
-"hulk",
-"seabag",
-"narthex",
-"compartment",
-"prairie star",
-"lookdown",
-"B-flat clarinet",
-"event planner",
-"clip lead",
-"shirting",
-"milk punch",
-"supercharger",
-"macadamia nut",
-"giant coreopsis",
-"computer store",
-"martingale",
-"keyboard buffer",
-"summer flounder",
-"squash ball",
-"gas turbine",
-"object ball",
-"plier",
-"black mulberry",
-"reef squirrelfish",
-"scampi",
-"willow aster",
-"bowler",
-"striped marlin",
-"smooth muscle cell",
-"diplodocus",
-"Liberty ship",
-"sponge cloth",
-"guitarfish",
-"walking leaf",
-"showroom",
-"California bluebell",
-"bolo",
-"turnbuckle",
-"boysenberry",
-"hardware",
-"Gael",
-"imago",
-"endorser",
-"jujube",
-"dust bag",
-"rapporteur",
-"field wormwood",
-"low-water mark",
-"naval missile",
-"Pacific yew",
-"reversible",
-"crabapple jelly",
-"poniard",
-"barricade",
-"spawner",
-"simnel",
-"seltzer",
-"deckle edge",
-"needle",
-"timbale",
-"satellite transmitter",
-"organization man",
-"job candidate",
-"orderly",
-"native cranberry",
-"fir clubmoss",
-"coaming",
-"chartered accountant",
-"electron accelerator",
-"Sierra plum",
-"American foxhound",
-"long underwear",
-"Penobscot",
-"blueberry yogurt",
-"biretta",
-"cascara",
-"Paranthropus",
-"Dorian",
-"nun's habit",
-"lenten rose",
-"Augustinian",
-"designer",
-"northern phalarope",
-"mombin",
-"hazel mouse",
-"reeve",
-"waffler",
-"telegraphy",
-"Verpa conica",
-"ignition coil",
-"Japanese oyster",
-"S-shape",
-"divining rod",
-"ant thrush",
-"throat protector",
-"interlocutor",
-"Desmodus rotundus",
-"pere david's deer",
-"attenuator",
-"Cypriot",
-"red sandalwood",
-"pendulum watch",
-"broadcloth",
-"striped drum",
-"sequence",
-"safety arch",
-"diapensia",
-"hog",
-"western spadefoot",
-"chlorella",
-"comb-footed spider",
-"Chechen",
-"darning needle",
-"C-ration",
-"hard beech",
-"piano action",
-"scaling ladder",
-"Nepal trumpet flower",
-"ravigote",
-"screw wrench",
-"ramekin",
-"Lyonnaise sauce",
-"dinner napkin",
-"partial veil",
-"masseuse",
-"coatrack",
-"mooring tower",
-"blue-eyed African daisy",
-"English horn",
-"baton",
-"rope tow",
-"toll bridge",
-"massage parlor",
-"quark cheese",
-"lounging jacket",
-"tall goldenrod",
-"flying jib",
-"coordinate axis",
-"barley-sugar",
-"integrator",
-"worm gear",
-"captain",
-"sweatshop",
-"class",
-"layer",
-"chili powder",
-"dripping pan",
-"oatcake",
-"newsroom",
-"tadpole shrimp",
-"rake",
-"trade magazine",
-"silks",
-"ram's-head",
-"senior",
-"knower",
-"masseur",
-"yam",
-"peg",
-"wheel tree",
-"hardbake",
-"test room",
-"long-spurred violet",
-"creeping spike rush",
-"shrapnel",
-"coffee senna",
-"matchbox",
-"creeping soft grass",
-"welder's mask",
-"pickaback plant",
-"urial",
-"hooded pitcher plant",
-"incense cedar",
-"Ohio buckeye",
-"ant cow",
-"skeleton fork fern",
-"Indiaman",
-"swamp ash",
-"testatrix",
-"marang",
-"spherocyte",
-"Winesap",
-"Indian mallow",
-"teju",
-"Yersinia pestis",
-"dye-works",
-"sauerbraten",
-"coral bean tree",
-"safe house",
-"postulator",
-"eyas",
-"lotus",
-"wood vise",
-"lady-of-the-night",
-"East German",
-"cymling",
-"rock candy",
-"western omelet",
-"anoa",
-"rainbow seaperch",
-"crossover voter",
-"Finn",
-"tree shrew",
-"hog plum",
-"Federal",
-"shagbark",
-"clockwork",
-"Alexandrian laurel",
-"metal wood",
-"brill",
-"military chaplain",
-"trend-setter",
-"call-back",
-"Indian rat snake",
-"spurred gentian",
-"Japanese maple",
-"forest goat",
-"bee moth",
-"viola da braccio",
-"duckboard",
-"armyworm",
-"hangnail",
-"counterbore",
-"cream-of-tartar tree",
-"Mullah",
-"bonbon",
-"water hazard",
-"temple orange",
-"corporatist",
-"rough bindweed",
-"Turkish bath",
-"mistletoe fig",
-"beach sand verbena",
-"caddisworm",
-"English plantain",
-"brown Betty",
-"power pack",
-"lion's-ear",
-"Francis turbine",
-"stayer",
-"dichondra",
-"marsh St-John's wort",
-"squab",
-"energizer",
-"common horehound",
-"mantispid",
-"pullback",
-"handwheel",
-"spark arrester",
-"yakuza",
-"Virginian witch hazel",
-"grunter",
-"waterworks",
-"bondwoman",
-"chain printer",
-"stockjobber",
-"coconut milk",
-"yardgrass",
-"blue chip",
-"bridle path",
-"riser",
-"pleurothallis",
-"saltwort",
-"salal",
-"broadside",
-"blackboard eraser",
-"bastard",
-"Para rubber tree",
-"red bat",
-"digital-analog converter",
-"calabash",
-"cashier",
-"cow shark",
-"horned pout",
-"microphage",
-"monologist",
-"woolly monkey",
-"Illinoisan",
-"marsh horsetail",
-"distaff",
-"siris",
-"eparch",
-"gooseneck loosestrife",
-"sounding rocket",
-"multiprocessor",
-"saiga",
-"xerographic printer",
-"madrona",
-"right triangle",
-"sweet gale",
-"red maids",
-"wolfsbane",
-"pork-and-veal goulash",
-"French sorrel",
-"mutterer",
-"Venetian sumac",
-"drumlin",
-"white crappie",
-"squire",
-"large-flowered calamint",
-"northern cricket frog",
-"mushroom sauce",
-"supertanker",
-"morello",
-"auxiliary boiler",
-"Virginia thimbleweed",
-"cottage tent",
-"bubble shell",
-"big shellbark",
-"wormwood sage",
-"cider gum",
-"coast lily",
-"American feverfew",
-"Peruvian balsam",
-"purple silkweed",
-"tobacco moth",
-"desk dictionary",
-"rock elm",
-"eastern indigo snake",
-"Japanese privet",
-"lamb",
-"levee",
-"L-plate",
-"soapfish",
-"painted tongue",
-"scuttle",
-"markhor",
-"Marburg virus",
-"mackinaw",
-"major",
-"crypt",
-"ball and chain",
-"domestic silkworm moth",
-"bottom feeder",
-"mistress",
-"death house",
-"freight elevator",
-"bellyband",
-"Pulex irritans",
-"Bacillus anthracis",
-"fire control radar",
-"hysterosalpingogram",
-"turbogenerator",
-"decompound leaf",
-"vambrace",
-"scentless camomile",
-"Medinilla magnifica",
-"prima ballerina",
-"Northern Spy",
-"quartz lamp",
-"grains of paradise",
-"justiciar",
-"felt fern",
-"seismograph",
-"Madagascar jasmine",
-"imaret",
-"white perch",
-"Alpine mouse-ear",
-"tea bread",
-"yellow bass",
-"poseuse",
-"espionage agent",
-"punching bag",
-"eurypterid",
-"orange sneezeweed",
-"banded stilt",
-"armhole",
-"postern",
-"mother",
-"kapuka",
-"catechumen",
-"Soubise",
-"Sauvignon blanc",
-"gunnery sergeant",
-"self-starter",
-"ceratozamia",
-"Atlantic cod",
-"Reoviridae",
-"blood cup",
-"horseshoe bat",
-"oriental plane",
-"voussoir",
-"fetterbush",
-"samara",
-"truncated pyramid",
-"lingcod",
-"athenaeum",
-"shyster",
-"Carolina hemlock",
-"submarine torpedo",
-"floating fern",
-"yataghan",
-"sun tea",
-"viola d'amore",
-"conenose",
-"ventilation shaft",
-"walk-up apartment",
-"saury",
-"wild wheat",
-"porcupine ball",
-"tahini",
-"kris",
-"grass fern",
-"drip pan",
-"black bryony",
-"Scotch broth",
-"tapioca pudding",
-"southwestern toad",
-"Hare Krishna",
-"guimpe",
-"wild madder",
-"megalocyte",
-"teaching fellow",
-"shrubby penstemon",
-"lesser wintergreen",
-"privet hedge",
-"Fahrenheit thermometer",
-"stern chaser",
-"prickly ash",
-"pump room",
-"ricer",
-"chicken mousse",
-"wing commander",
-"sun gear",
-"bolus",
-"alpine milk vetch",
-"opera cloak",
-"twinjet",
-"Goldie's fern",
-"abnegator",
-"alphabet soup",
-"node",
-"grape jelly",
-"early coral root",
-"Tarzan",
-"quarterstaff",
-"greeter",
-"Eurasian woodcock",
-"primary coil",
-"quirt",
-"tinkerer",
-"bolt",
-"creme de fraise",
-"voltage regulator",
-"news photography",
-"Jat",
-"bristly locust",
-"Gouda",
-"dickey",
-"lobster butter",
-"dwarf flowering almond",
-"fagot stitch",
-"Reform Jew",
-"ostrich fern",
-"bathyscaphe",
-"purple mullein",
-"alpaca",
-"civic leader",
-"jellaba",
-"Arizona ash",
-"wasabi",
-"Irishwoman",
-"choke",
-"stockinet",
-"religionist",
-"sewage disposal plant",
-"bittersweet",
-"Hyphantria cunea",
-"pheasant under glass",
-"screen actor",
-"chapterhouse",
-"quoit",
-"horseshoe bat",
-"rapper",
-"cupule",
-"planetary gear",
-"cascade penstemon",
-"redoubt",
-"salt",
-"areaway",
-"megalomaniac",
-"bush willow",
-"amethystine python",
-"plains spadefoot",
-"colour supplement",
-"kick pleat",
-"bell apple",
-"narwhal",
-"slippery elm",
-"stenograph",
-"baa-lamb",
-"quadrant",
-"balker",
-"jobcentre",
-"spit curl",
-"bastard indigo",
-"malacca",
-"serow",
-"adobe lily",
-"yacca",
-"palestra",
-"penalty box",
-"scrub beefwood",
-"reenactor",
-"screening",
-"white bryony",
-"alderleaf Juneberry",
-"harpoon",
-"alpine clubmoss",
-"neurosurgeon",
-"surrey",
-"sweet calabash",
-"Scotch laburnum",
-"coquille",
-"French honeysuckle",
-"extrados",
-"pipe cleaner",
-"southwestern white pine",
-"Virginian stock",
-"scaly lentinus",
-"aileron",
-"carob bar",
-"swordfish",
-"Alpine woodsia",
-"negus",
-"wireworm",
-"sweep",
-"goldfields",
-"drop arch",
-"European bream",
-"roly-poly",
-"pin",
-"bastard wing",
-"fustian",
-"wild buckwheat",
-"lake whitefish",
-"overcoat",
-"water filter",
-"Bermuda chub",
-"New Zealand spinach",
-"high-hat cymbal",
-"European larch",
-"radiologic technologist",
-"fine-tooth comb",
-"brunch coat",
-"splice",
-"electronic converter",
-"overmantel",
-"extern",
-"taper",
-"cluster bomb",
-"teletypewriter",
-"pinwheel",
-"trailing arbutus",
-"quipu",
-"creeping zinnia",
-"orange milkwort",
-"tabard",
-"Australopithecus africanus",
-"melancholy thistle",
-"insole",
-"courser",
-"darkroom",
-"surface-to-air missile system",
-"bark-louse",
-"Confederate",
-"neritina",
-"clip-on",
-"spouter",
-"trench knife",
-"outside caliper",
-"dhak",
-"Limburger",
-"chuck wagon",
-"buttercup squash",
-"shirtdress",
-"pouter pigeon",
-"dirty old man",
-"zodiac",
-"fennel flower",
-"mother figure",
-"appointment",
-"Manichaean",
-"lignum",
-"bouffant",
-"rum sling",
-"Ravenna grass",
-"hibachi",
-"gin rickey",
-"American harvest mouse",
-"cocozelle",
-"western wheatgrass",
-"black crappie",
-"rhombus",
-"Missouri goldenrod",
-"barndoor",
-"wild mango",
-"pneumococcus",
-"Boston lettuce",
-"ratline",
-"desert holly",
-"cobweb",
-"fluoroscope",
-"ethnologist",
-"tor",
-"bullshot",
-"stockade",
-"greave",
-"rock sea bass",
-"slip-joint pliers",
-"taxi dancer",
-"schizophrenic",
-"zill",
-"creme de menthe",
-"orange-blossom orchid",
-"divot",
-"supplejack",
-"busybody",
-"casemaking clothes moth",
-"ramrod",
-"gearbox",
-"birdcall",
-"Wiffle",
-"thwart",
-"beauty consultant",
-"chicken paprika",
-"trawl",
-"skep",
-"spirometer",
-"hopper",
-"kvass",
-"doggie bag",
-"bath chair",
-"showy daisy",
-"wild tamarind",
-"Tarsius syrichta",
-"glyptics",
-"Algerian",
-"cargo area",
-"bunk",
-"Velveeta",
-"iconoclast",
-"clinch",
-"New Caledonian yew",
-"false mallow",
-"Japanese tree lilac",
-"convex polyhedron",
-"water boatman",
-"cruise missile",
-"finisher",
-"colonoscope",
-"cumin",
-"wickiup",
-"saccharin",
-"whipcord",
-"trailer camp",
-"eryngo",
-"cuckold",
-"yam bean",
-"fighting chair",
-"forewoman",
-"galingale",
-"citron",
-"positivist",
-"four-lined plant bug",
-"suet pudding",
-"field pea",
-"Circaea lutetiana",
-"deer grass",
-"trap-door spider",
-"common corn salad",
-"mirror carp",
-"sounder",
-"second-in-command",
-"seaside alder",
-"burgoo",
-"ming tree",
-"curry sauce",
-"courbaril",
-"green alder",
-"figure loom",
-"fauld",
-"halfbeak",
-"squelch circuit",
-"cladode",
-"winter cress",
-"tongue and groove joint",
-"dwarf dandelion",
-"joss house",
-"western buttercup",
-"welted thistle",
-"potato tree",
-"anglewing",
-"cookfire",
-"marzipan",
-"hood latch",
-"seed shrimp",
-"common moonseed",
-"toasting fork",
-"bevel",
-"three-quarter binding",
-"midwife toad",
-"stage director",
-"Pentecostal",
-"technical sergeant",
-"golden-beard penstemon",
-"drunk",
-"silky oak",
-"corn gluten feed",
-"T-square",
-"stoker",
-"selling agent",
-"cruse",
-"server",
-"rope-a-dope",
-"bicorn",
-"matzo meal",
-"wide wale",
-"roadblock",
-"false foxglove",
-"tuck box",
-"bandsman",
-"smoke bush",
-"machinist's vise",
-"Highlander",
-"scholiast",
-"self-starter",
-"Swedish rye bread",
-"spark transmitter",
-"maverick",
-"maquiladora",
-"cabinetmaker",
-"compress",
-"rainbow shower",
-"huntsman's horn",
-"mackinaw",
-"copper rockfish",
-"lappet",
-"nitrate bacterium",
-"telephone plug",
-"soutache",
-"Dacron",
-"toboggan",
-"sissoo",
-"yogi",
-"laurel-tree",
-"vice chancellor",
-"Christ's-thorn",
-"cartridge fuse",
-"serial port",
-"quassia",
-"tarweed",
-"pecopteris",
-"beggarweed",
-"anchovy pear",
-"bookbindery",
-"woodland oxeye",
-"toad rush",
-"sandalwood tree",
-"marsh andromeda",
-"Tyrian purple",
-"boothose",
-"tragedienne",
-"fragrant cliff fern",
-"festoon",
-"bondwoman",
-"melancholic",
-"butternut squash",
-"exhaust valve",
-"semi-skimmed milk",
-"glowworm",
-"Virginia oyster",
-"Identikit",
-"ayah",
-"gallows tree",
-"Carioca",
-"monoplane",
-"jewels-of-opar",
-"scallop",
-"moth miller",
-"marsh cress",
-"lobed spleenwort",
-"ricotta",
-"emitter",
-"arame",
-"tub gurnard",
-"army attache",
-"maniac",
-"organizer",
-"pheasant's-eye",
-"Melba toast",
-"homeboy",
-"Bavarian cream",
-"Maximilian's sunflower",
-"backstop",
-"Tremella foliacea",
-"yellow avens",
-"spreading fleabane",
-"plumb level",
-"false rue anemone",
-"zabaglione",
-"climbing maidenhair",
-"doeskin",
-"walking shoe",
-"lancewood",
-"material",
-"jacksnipe",
-"South American poison toad",
-"agonist",
-"hinny",
-"paper mill",
-"psychophysicist",
-"valley girl",
-"toast mistress",
-"jorum",
-"tiler",
-"chicken Tetrazzini",
-"trivet",
-"grasshopper",
-"three-mile limit",
-"kink",
-"kiang",
-"pole horse",
-"jig",
-"Cornish heath",
-"hedge thorn",
-"false alumroot",
-"Popper",
-"remount",
-"photojournalist",
-"sideroblast",
-"stonecress",
-"Agave tequilana",
-"Japanese lilac",
-"hawse",
-"maenad",
-"air bag",
-"leaf spring",
-"dwarf willow",
-"soda cracker",
-"contralto",
-"moleskin",
-"pilaster",
-"Audubon's caracara",
-"pia",
-"American organ",
-"bleu cheese dressing",
-"betel palm",
-"PC board",
-"almond willow",
-"socializer",
-"tone arm",
-"stammerer",
-"free-liver",
-"scaler",
-"Gentianopsis crinita",
-"leak",
-"black haw",
-"hound's-tongue",
-"grass pea",
-"Stassano furnace",
-"coralbells",
-"ministrant",
-"perihelion",
-"Luxemburger",
-"powder-post termite",
-"arboreal salamander",
-"cushion flower",
-"foramen magnum",
-"pyrethrum",
-"poacher",
-"woolly mammoth",
-"horned chameleon",
-"tearaway",
-"father-figure",
-"tufted gentian",
-"salmi",
-"finger millet",
-"physa",
-"registrar",
-"polyoma",
-"bamboo shoot",
-"matchlock",
-"seine",
-"congress boot",
-"bulgur pilaf",
-"monosodium glutamate",
-"Kentucky wonder",
-"mycologist",
-"kedgeree",
-"ragweed pollen",
-"boarfish",
-"yellow pimpernel",
-"tan",
-"northern Jacob's ladder",
-"macrobiotic diet",
-"migrant shrike",
-"big-cone spruce",
-"colonialist",
-"white dogtooth violet",
-"bath asparagus",
-"webbing clothes moth",
-"ladies' room",
-"experimenter",
-"prairie bird's-foot trefoil",
-"bootleg",
-"cognitive neuroscientist",
-"fire chief",
-"flagfish",
-"dendrite",
-"stinking goosefoot",
-"fore edge",
-"hogfish",
-"Spanish cedar",
-"hotel-casino",
-"Tory",
-"life-support system",
-"pea flour",
-"cash bar",
-"Chenin blanc",
-"white-footed mouse",
-"Canada garlic",
-"salt-rising bread",
-"roomette",
-"mastodon",
-"bell founder",
-"long iron",
-"bi-fold door",
-"fig-bird",
-"European water shrew",
-"dyer's weed",
-"frog orchid",
-"allosaur",
-"Florida yew",
-"wild potato vine",
-"crape fern",
-"flat-topped white aster",
-"klebsiella",
-"oil heater",
-"waxmallow",
-"enjoyer",
-"mesocarp",
-"semidesert",
-"senior vice president",
-"coccidium",
-"burrawong",
-"syllabub",
-"jump suit",
-"harrier",
-"leaf roller",
-"cherrystone",
-"cinchona tree",
-"touring car",
-"eulogist",
-"air force officer",
-"red goosefoot",
-"cat thyme",
-"smoothbore",
-"slugger",
-"cardiac monitor",
-"cobber",
-"blister rust",
-"musicologist",
-"rolled biscuit",
-"Braun's holly fern",
-"hog plum",
-"nonpasserine bird",
-"pascal celery",
-"damson",
-"Jonathan",
-"Sheraton",
-"cohune palm",
-"egg white",
-"baton",
-"sixth-former",
-"Siberian pea tree",
-"choanocyte",
-"wineskin",
-"auditor",
-"detention home",
-"Leichtlin's camas",
-"Chartreuse",
-"clusia",
-"club car",
-"wattle and daub",
-"security blanket",
-"common American shad",
-"assistant professor",
-"marsh pea",
-"camomile tea",
-"gopher hole",
-"gravure",
-"Freudian",
-"spirillum",
-"maharani",
-"equilateral",
-"crow garlic",
-"mammee apple",
-"felwort",
-"hardtop",
-"dillenia",
-"curlycup gumweed",
-"pilot engine",
-"calcimine",
-"wooly lip fern",
-"bitter dock",
-"wineberry",
-"jumper",
-"monolingual",
-"spinning frame",
-"old-timer",
-"native cat",
-"diving petrel",
-"sodium-vapor lamp",
-"marchand de vin",
-"sexton",
-"matelote",
-"interior designer",
-"windfall",
-"mole salamander",
-"minder",
-"bodkin",
-"neutron bomb",
-"Caloscypha fulgens",
-"slinger ring",
-"mezzo-soprano",
-"aura",
-"Southern Baptist",
-"viscacha",
-"midfield",
-"tie",
-"prosthetist",
-"round-headed leek",
-"yellow mariposa tulip",
-"canary grass",
-"staddle",
-"Tokay",
-"Muenster",
-"brazil nut",
-"California black walnut",
-"applesauce",
-"penologist",
-"virgin's bower",
-"tenon",
-"steward",
-"Jerusalem oak",
-"red-bellied snake",
-"bindery",
-"scow",
-"fluid flywheel",
-"bullhead",
-"satinleaf",
-"clove",
-"double glazing",
-"matron",
-"wild parsnip",
-"winged elm",
-"shoot-'em-up",
-"musk deer",
-"white rust",
-"lock",
-"Cornishman",
-"Vidalia onion",
-"corn spurry",
-"freeloader",
-"justice of the peace",
-"inlay",
-"myxobacteria",
-"tiglon",
-"tangram",
-"German ivy",
-"scented fern",
-"woolly daisy",
-"caretaker",
-"gastroscope",
-"scuppernong",
-"spotted sunfish",
-"guilloche",
-"codling",
-"wormcast",
-"Eskimo curlew",
-"tayra",
-"European fly honeysuckle",
-"septuagenarian",
-"third gear",
-"coatee",
-"red alder",
-"water ice",
-"cubitiere",
-"frame buffer",
-"gamboge tree",
-"pernyi moth",
-"chicken Marengo",
-"Galliano",
-"Lincoln",
-"true sago palm",
-"hunter's sauce",
-"carpet beater",
-"alpine goldenrod",
-"arch support",
-"vehicle-borne transmission",
-"jilt",
-"paternoster",
-"redcap",
-"Siberian larch",
-"hoary plantain",
-"swan's down",
-"chicane",
-"reverse",
-"divan",
-"kneeler",
-"alexic",
-"mock turtle soup",
-"daffodil garlic",
-"mission bells",
-"squilla",
-"ursinia",
-"winter's bark",
-"trifoliate orange",
-"discina",
-"frijole",
-"Swiss steak",
-"maildrop",
-"knotgrass",
-"dog fennel",
-"drum sander",
-"heroin addict",
-"costume",
-"camber arch",
-"shining willow",
-"lutefisk",
-"red porgy",
-"microfossil",
-"good old boy",
-"angle bracket",
-"pitcher sage",
-"bordelaise",
-"heat exchanger",
-"carrion",
-"bush jacket",
-"fanjet",
-"coach",
-"blackface",
-"sicklepod",
-"Manhattan clam chowder",
-"daisywheel printer",
-"olive",
-"Sphacelotheca",
-"Spanish needles",
-"brown root rot fungus",
-"boudoir",
-"encyclopedist",
-"V-8 juice",
-"red haw",
-"brass buttons",
-"gym suit",
-"skywalk",
-"water wagon",
-"gas-turbine ship",
-"stoup",
-"lisle",
-"sailor suit",
-"box beam",
-"balm of gilead",
-"housemaster",
-"hayrack",
-"neutralist",
-"water elm",
-"brook thistle",
-"doyenne",
-"nark",
-"alpha-tocopheral",
-"WASP",
-"hydrilla",
-"water-shield",
-"footlocker",
-"variola major",
-"pargeting",
-"ion engine",
-"yellow globe lily",
-"Malecite",
-"bloodleaf",
-"yellow sand verbena",
-"whorled loosestrife",
-"packinghouse",
-"Carolina parakeet",
-"Virginia waterleaf",
-"armband",
-"red rockfish",
-"factory ship",
-"moon trefoil",
-"jump seat",
-"water gillyflower",
-"yerba mansa",
-"chamfer bit",
-"compass saw",
-"hopsacking",
-"Indian rhododendron",
-"sickbed",
-"treacle",
-"honey eater",
-"mailsorter",
-"seabeach sandwort",
-"sob sister",
-"primrose jasmine",
-"prince consort",
-"elocutionist",
-"wishing cap",
-"runner",
-"trestle",
-"sugar water",
-"half-and-half dressing",
-"fringed poppy mallow",
-"portiere",
-"bung",
-"swan orchid",
-"weather satellite",
-"beef broth",
-"marblewood",
-"sapper",
-"agitator",
-"wren-tit",
-"grade",
-"allspice tree",
-"spacewalker",
-"American hornbeam",
-"sieva bean",
-"dill seed",
-"potoroo",
-"love-in-winter",
-"alembic",
-"Cheshire cheese",
-"small white aster",
-"Oregonian",
-"flipper",
-"twill",
-"differential gear",
-"Prince Albert",
-"licorice",
-"foster-father",
-"Melkite",
-"portraitist",
-"Yosemite toad",
-"Cox's Orange Pippin",
-"slender wheatgrass",
-"knob",
-"silique",
-"Rocky Mountain bee plant",
-"stirrup pump",
-"chicken hawk",
-"sweetbrier",
-"Sierra lodgepole pine",
-"poulette",
-"biohazard suit",
-"striated muscle cell",
-"Geiger counter",
-"World Wide Web",
-"turmeric",
-"prairie wake-robin",
-"latchet",
-"pushball",
-"grill",
-"shooting lodge",
-"floating-moss",
-"refried beans",
-"boojum tree",
-"red poll",
-"toothbrush tree",
-"rabbiteye blueberry",
-"red haw",
-"sweet vetch",
-"delta",
-"upland cotton",
-"ballet mistress",
-"padrone",
-"complementary color",
-"great Solomon's-seal",
-"bud brush",
-"brandy sling",
-"spinster",
-"Andorran",
-"Mojave aster",
-"mackinaw",
-"golden calla",
-"bottom rot fungus",
-"segmental arch",
-"periwinkle",
-"hellion",
-"topknot",
-"copper",
-"Mexican hyssop",
-"weeping love grass",
-"point woman",
-"pathogen",
-"fall cankerworm",
-"common shiner",
-"silverspot",
-"corer",
-"atomic pile",
-"crystal detector",
-"yellow spot fungus",
-"truncated cone",
-"saprobe",
-"variegated horsetail",
-"Cro-magnon",
-"cercaria",
-"aglet",
-"pollster",
-"oyster bed",
-"pancake turner",
-"egg cream",
-"sporozoite",
-"quirk molding",
-"mutisia",
-"sound bow",
-"physic nut",
-"sugar-bush",
-"cow",
-"magnetron",
-"jungle hen",
-"brassie",
-"rock bit",
-"taco sauce",
-"seeded raisin",
-"desert selaginella",
-"folding door",
-"vinegarroon",
-"Pinot blanc",
-"rye",
-"ellipsoid",
-"betel nut",
-"tree of knowledge",
-"ambrosia",
-"long tom",
-"breechloader",
-"bicolor lespediza",
-"cosmetician",
-"monoblast",
-"American oil palm",
-"prancer",
-"farina",
-"caiman lizard",
-"hardball",
-"bullock's heart",
-"cotton rat",
-"whiting",
-"weather ship",
-"sharecropper",
-"creamcups",
-"gas bracket",
-"divinity",
-"ornithologist",
-"yellow twining snapdragon",
-"showy goldenrod",
-"end man",
-"heptagon",
-"sand dropseed",
-"round file",
-"guama",
-"blue elder",
-"sand spurry",
-"raccoon dog",
-"zigzag goldenrod",
-"fast reactor",
-"arctic willow",
-"cyclopean masonry",
-"punter",
-"sgraffito",
-"slattern",
-"storage ring",
-"clipper",
-"pulasan",
-"short-tailed shrew",
-"scammony",
-"daybook",
-"umbrella tree",
-"coloring",
-"element of a cone",
-"gesneriad",
-"cane",
-"burgoo",
-"western coral snake",
-"friendship plant",
-"Leydig cell",
-"scrutineer",
-"hairy golden aster",
-"inclined fault",
-"water milfoil",
-"bryozoan",
-"nardoo",
-"native pomegranate",
-"curly grass",
-"Florence fennel",
-"resurrection plant",
-"ice water",
-"crown",
-"ploughman's lunch",
-"clustered lady's slipper",
-"kitchenette",
-"sand sedge",
-"pouched mouse",
-"roadbed",
-"parsley haw",
-"predecessor",
-"super heavyweight",
-"seedless raisin",
-"mailbag",
-"sparling",
-"codling moth",
-"squama",
-"Bercy",
-"thermoelectric thermometer",
-"Jaculus jaculus",
-"saltpan",
-"firmer chisel",
-"round whitefish",
-"ramrod",
-"criollo",
-"pinch bar",
-"slash pocket",
-"thigh pad",
-"velvet plant",
-"intergalactic space",
-"brazilian ironwood",
-"whaleboat",
-"sirrah",
-"hanging fly",
-"aspirator",
-"Dominican",
-"dribbler",
-"yellow-eyed grass",
-"Cornish",
-"geophysicist",
-"tarmacadam",
-"marchioness",
-"rattlesnake orchid",
-"Alaska Native",
-"ilama",
-"myrrh tree",
-"zucchini",
-"licorice root",
-"nosebag",
-"lounger",
-"troposphere",
-"virginal",
-"spaghetti Western",
-"Virgin Mary",
-"waterwheel plant",
-"dry nurse",
-"enate",
-"carpet shark",
-"rijsttaffel",
-"stuffing nut",
-"caraway seed bread",
-"Leotia lubrica",
-"kaffiyeh",
-"Boston baked beans",
-"halophyte",
-"backscratcher",
-"instillator",
-"trefoil arch",
-"pip",
-"digitizer",
-"dosemeter",
-"Carolinian",
-"French sorrel",
-"boards",
-"historian",
-"rangpur",
-"clansman",
-"goral",
-"leatherjacket",
-"coiner",
-"fleece",
-"white globe lily",
-"storm cellar",
-"roundhouse",
-"mediatrix",
-"butterfly flower",
-"swamp gum",
-"prairie vole",
-"rhizomatous begonia",
-"common tobacco",
-"Marco Polo sheep",
-"subarachnoid space",
-"broomweed",
-"safety net",
-"silky wisteria",
-"swagger stick",
-"spectacled caiman",
-"derris root",
-"soap pad",
-"chop-suey greens",
-"summer hyacinth",
-"palo santo",
-"carbohydrate loading",
-"chinch bug",
-"roadman",
-"sheep plant",
-"messiah",
-"desk officer",
-"banquette",
-"drugget",
-"trumpet arch",
-"great duckweed",
-"purdah",
-"heartbreaker",
-"hasty pudding",
-"alligator weed",
-"dragee",
-"yellow bristlegrass",
-"Jacob's ladder",
-"campstool",
-"coffee fern",
-"sweet fern",
-"little chief hare",
-"cat-o'-nine-tails",
-"rep",
-"American red elder",
-"divorcee",
-"black salsify",
-"cambric",
-"sennit",
-"Canada ginger",
-"wonderer",
-"Formica",
-"cream-colored courser",
-"zooid",
-"European beggar-ticks",
-"sorrel tree",
-"piddock",
-"blolly",
-"red-flowered silky oak",
-"bay",
-"Hooker's onion",
-"dark horse",
-"cone clutch",
-"Roman hyacinth",
-"paintbox",
-"mestiza",
-"green alder",
-"bill",
-"panicled aster",
-"mammogram",
-"snuffbox fern",
-"Rediffusion",
-"swamp fly honeysuckle",
-"stoup",
-"psychiatrist",
-"nodding groundsel",
-"student union",
-"cold duck",
-"bee beetle",
-"playbox",
-"Psychopsis krameriana",
-"nosh-up",
-"earthnut",
-"narthex",
-"single-rotor helicopter",
-"revetment",
-"sweetleaf",
-"seasoned salt",
-"piculet",
-"speckled alder",
-"mackerel scad",
-"common yellowwood",
-"devisee",
-"static tube",
-"Spanish heath",
-"umbrella plant",
-"fucoid",
-"Chilean",
-"coral-root bittercress",
-"fanatic",
-"cachou",
-"agony aunt",
-"bird's-foot fern",
-"washwoman",
-"torchbearer",
-"placoderm",
-"frosted bat",
-"spicemill",
-"Cape lobster",
-"hard-shell crab",
-"colonizer",
-"camphor daisy",
-"friar's-cowl",
-"false tamarisk",
-"toggle joint",
-"tinsmith",
-"theorist",
-"hydrologist",
-"loganberry",
-"universal donor",
-"northern whiting",
-"tent-caterpillar moth",
-"russet",
-"kangaroo mouse",
-"African scented mahogany",
-"bastinado",
-"breast implant",
-"betel",
-"grade separation",
-"vox humana",
-"stodge",
-"Maryland chicken",
-"Anguillan",
-"oil pump",
-"governor's plum",
-"narcissist",
-"deadwood",
-"private citizen",
-"winker",
-"ropewalker",
-"gidgee",
-"Lothario",
-"ski resort",
-"major-domo",
-"von Neumann machine",
-"belaying pin",
-"water parsnip",
-"Fissipedia",
-"luggage carrier",
-"spring water",
-"oyster stew",
-"kohl",
-"celesta",
-"date-nut bread",
-"punchboard",
-"sunniness",
-"hospital train",
-"man",
-"rack and pinion",
-"mixer",
-"pousse-cafe",
-"narrow goldenrod",
-"Maxim gun",
-"stiff",
-"recruiting-sergeant",
-"watch glass",
-"white hellebore",
-"tung tree",
-"prairie white-fringed orchid",
-"beef Stroganoff",
-"scoffer",
-"grassy death camas",
-"Shawnee cake",
-"tapioca",
-"Short's aster",
-"banker",
-"laparoscope",
-"honeyflower",
-"Caterpillar",
-"electric clock",
-"baling wire",
-"huntress",
-"Surinam toad",
-"art school",
-"incurable",
-"Canton crepe",
-"apple juice",
-"hipline",
-"bronchoscope",
-"marshmallow fluff",
-"Texan",
-"wild fig",
-"sawed-off shotgun",
-"forestay",
-"red kauri",
-"fish slice",
-"Egyptian grass",
-"English walnut",
-"brown sauce",
-"ogee arch",
-"nectary",
-"chambray",
-"leather flower",
-"phloem",
-"Persian violet",
-"bomb calorimeter",
-"western narrow-mouthed toad",
-"soup du jour",
-"sickle alfalfa",
-"caracolito",
-"periscope",
-"coralberry",
-"sword bean",
-"sigmoidoscope",
-"water locust",
-"hygrodeik",
-"sycamore",
-"sheikdom",
-"ballistocardiograph",
-"clove",
-"akee",
-"fucoid",
-"jacquard",
-"cat's-ear",
-"puritan",
-"slender wild oat",
-"smooth softshell",
-"purchasing agent",
-"landing craft",
-"chartist",
-"lace bug",
-"sharksucker",
-"Virginia chain fern",
-"horseradish",
-"namer",
-"ripcord",
-"personage",
-"aspirin powder",
-"puku",
-"Wankel engine",
-"nightcap",
-"velvet bent",
-"roridula",
-"cytogeneticist",
-"olm",
-"almond extract",
-"common heath",
-"fringe-toed lizard",
-"Kentucky yellowwood",
-"lithosphere",
-"cramp",
-"bulgur",
-"scurvy grass",
-"officer's mess",
-"frigate",
-"electroscope",
-"giant chinkapin",
-"opah",
-"rutabaga",
-"wood hoopoe",
-"Farley maidenhair",
-"shingle tree",
-"argentine",
-"router",
-"palm nut",
-"quillwort",
-"hiba arborvitae",
-"runcible spoon",
-"hireling",
-"sickbay",
-"alpine totara",
-"white lupine",
-"Cotoneaster horizontalis",
-"desert plume",
-"staghound",
-"Sea Scout",
-"opalescence",
-"enophile",
-"Jersey elm",
-"coal house",
-"Helvella acetabulum",
-"selenium cell",
-"white camas",
-"creole-fish",
-"auger",
-"fragrant agrimony",
-"research center",
-"achromia",
-"shank",
-"cottonseed",
-"mod con",
-"extension",
-"sugar beet",
-"winter flounder",
-"silky dogwood",
-"strop",
-"tokamak",
-"rabbit ears",
-"baby farmer",
-"fireman's ax",
-"serration",
-"taproot",
-"socket wrench",
-"action officer",
-"Chilean jasmine",
-"Greek fire",
-"stem-winder",
-"body louse",
-"lumpsucker",
-"stink bomb",
-"American lady crab",
-"dicer",
-"lie detector",
-"maneuverer",
-"black-headed snake",
-"tiger moth",
-"shooting stick",
-"spermatid",
-"babushka",
-"deaconess",
-"home",
-"prior",
-"chanfron",
-"chickasaw plum",
-"big-eared bat",
-"rusty woodsia",
-"tertigravida",
-"miniver",
-"combretum",
-"habit",
-"bluehead",
-"angled loofah",
-"gipsywort",
-"fire-on-the-mountain",
-"purple milk vetch",
-"alpine gold",
-"merozoite",
-"loddon pondweed",
-"Uniat",
-"provost marshal",
-"Gyromitra fastigiata",
-"Coigue",
-"proconsul",
-"oarfish",
-"San Jose scale",
-"filature",
-"chimney plant",
-"spiny softshell",
-"bluecoat",
-"live axle",
-"river limpet",
-"clever Dick",
-"pink bollworm",
-"Japanese plum",
-"roarer",
-"caricature plant",
-"wardroom",
-"Texas chachalaca",
-"Bahia grass",
-"Moreton Bay tulipwood",
-"accessory fruit",
-"pearl barley",
-"ashcake",
-"bunt",
-"Polynesian tattler",
-"pine fern",
-"laughing owl",
-"potato fern",
-"speaking trumpet",
-"adjoining room",
-"bearing rein",
-"banana quit",
-"redbrick university",
-"Scleroderma bovista",
-"magdalen",
-"pressurized water reactor",
-"advisee",
-"NIMBY",
-"poorwill",
-"almond moth",
-"comedian",
-"star tulip",
-"cracked wheat",
-"water pump",
-"guest of honor",
-"yellow-breasted bunting",
-"hire",
-"pedate leaf",
-"augur",
-"purple locoweed",
-"Socinian",
-"upland white aster",
-"guesthouse",
-"double reed",
-"detention basin",
-"rollmops",
-"hitch",
-"bodega",
-"mayeng",
-"sparkplug wrench",
-"attack dog",
-"peach melba",
-"heliozoan",
-"tower mustard",
-"blue mold fungus",
-"lamplighter",
-"banded sand snake",
-"smooth crabgrass",
-"elsholtzia",
-"bodkin",
-"Aegean island",
-"bag lady",
-"alewife",
-"arcella",
-"electrical contact",
-"common ax",
-"animist",
-"concave polyhedron",
-"coalface",
-"climbing perch",
-"yellowtail",
-"hobble skirt",
-"marquee",
-"Russian dandelion",
-"snow mushroom",
-"polo ball",
-"NADA daiquiri",
-"cormous plant",
-"chaparral mallow",
-"inside caliper",
-"milking stool",
-"fallout shelter",
-"sea gooseberry",
-"Danish blue",
-"grissino",
-"chimney breast",
-"mosquito fern",
-"soundbox",
-"spring chicken",
-"epauliere",
-"cape forget-me-not",
-"japan",
-"saddle oyster",
-"white fritillary",
-"push-button radio",
-"bladder senna",
-"bladder stone",
-"macedoine",
-"moire",
-"Shawnee",
-"starnose mole",
-"douroucouli",
-"horseradish sauce",
-"electron gun",
-"cotter",
-"console",
-"park commissioner",
-"free press",
-"lump sugar",
-"western poison oak",
-"apple maggot",
-"keurboom",
-"lisper",
-"griffon",
-"burin",
-"horseshoe whipsnake",
-"Jacobean lily",
-"spinner",
-"cochineal insect",
-"emesis basin",
-"sowbane",
-"humanitarian",
-"uakari",
-"three-dimensional radar",
-"wild hollyhock",
-"heartseed",
-"swinger",
-"two-by-four",
-"mop handle",
-"common amsinckia",
-"traitress",
-"rush aster",
-"fibrous-rooted begonia",
-"violet-flowered petunia",
-"milliammeter",
-"alidade",
-"azure aster",
-"celery seed",
-"snorer",
-"scarlet plume",
-"obtuse leaf",
-"heathen",
-"rose chestnut",
-"headrace",
-"dwarf buckeye",
-"Pacific tripletail",
-"wiggler",
-"bounty hunter",
-"Lowlander",
-"slate pencil",
-"typist",
-"syconium",
-"vaquita",
-"skybox",
-"business lunch",
-"gusher",
-"curacao",
-"palometa",
-"Diapsida",
-"light diet",
-"sourdine",
-"thorny amaranth",
-"potato fern",
-"cartridge extractor",
-"peshmerga",
-"chaffweed",
-"tahoka daisy",
-"hematologist",
-"massage parlor",
-"diverging lens",
-"breadroot",
-"papyrus",
-"amarelle",
-"cover plate",
-"hubbard squash",
-"cryptomonad",
-"whitetail prairie dog",
-"rabbit burrow",
-"orthochromatic film",
-"goncalo alves",
-"Chile bonito",
-"tent-caterpillar moth",
-"Manila grass",
-"buck sergeant",
-"mustard seed",
-"crested wheatgrass",
-"wise guy",
-"asarabacca",
-"field pea",
-"bite plate",
-"barbasco",
-"heart-lung machine",
-"mouse-eared bat",
-"piping guan",
-"gun pendulum",
-"climbing onion",
-"fungus gnat",
-"Livonian",
-"one-hitter",
-"Chilean firebush",
-"Sonoran whipsnake",
-"round scad",
-"myelogram",
-"Rhodes grass",
-"vomitory",
-"roble beech",
-"South-African yellowwood",
-"molasses",
-"Velcro",
-"common calamint",
-"radiation pyrometer",
-"sketcher",
-"chaparral pea",
-"coffee stall",
-"Australian nettle",
-"bilimbi",
-"Khedive",
-"visionary",
-"field spaniel",
-"devilwood",
-"collimator",
-"Siberian spruce",
-"sling",
-"limestone salamander",
-"ribbon worm",
-"hazel",
-"petter",
-"coolant system",
-"artillery plant",
-"bailiff",
-"chameleon tree frog",
-"microsporophyll",
-"maiden blue-eyed Mary",
-"Drosophyllum lusitanicum",
-"cocozelle",
-"king post",
-"nailer",
-"knobkerrie",
-"tovarich",
-"Intelnet",
-"worm lizard",
-"drop forge",
-"wool grass",
-"brown bullhead",
-"anthropoid",
-"vitamin A2",
-"creche",
-"hickory nut",
-"whiffletree",
-"deipnosophist",
-"Muskhogean",
-"masochist",
-"hypsometer",
-"gliricidia",
-"complexifier",
-"wild licorice",
-"reconnaissance vehicle",
-"fives",
-"beefsteak plant",
-"eastern dasyure",
-"bookworm",
-"crested coral root",
-"wire recorder",
-"cinnamon vine",
-"bubble",
-"Newfoundland dwarf birch",
-"spruce bark beetle",
-"teetotaler",
-"fad diet",
-"ascus",
-"spicebush",
-"African coral snake",
-"soft-shell crab",
-"Postum",
-"packhorse",
-"sand cherry",
-"cricket-bat willow",
-"middlebrow",
-"Hungarian sauce",
-"buffalo clover",
-"jimsonweed",
-"latanier",
-"stablemate",
-"jumper",
-"zoospore",
-"smooth woodsia",
-"flowering ash",
-"unilateralist",
-"lomatia",
-"flapper",
-"wild cotton",
-"Siberian wall flower",
-"probe",
-"bankrupt",
-"blockade",
-"lemon geranium",
-"fig leaf",
-"basic point defense missile system",
-"clack valve",
-"buttinsky",
-"ingenue",
-"mountain everlasting",
-"zebra-tailed lizard",
-"shaving-brush tree",
-"evergreen huckleberry",
-"core drill",
-"lugworm",
-"Cashmere goat",
-"doorjamb",
-"minelayer",
-"student center",
-"horsehair",
-"European dewberry",
-"white broom",
-"arenavirus",
-"eastern poison oak",
-"rye ergot",
-"Tupi",
-"tensiometer",
-"fleawort",
-"coquille",
-"icing sugar",
-"junior lightweight",
-"Doppler radar",
-"mahuang",
-"candlepin",
-"chambermaid",
-"evergreen blueberry",
-"Eton jacket",
-"parvis",
-"solleret",
-"molded salad",
-"malvasia",
-"birth-control campaigner",
-"nonagon",
-"backswimmer",
-"ogee",
-"bowstring",
-"salt marsh mallow",
-"trapezohedron",
-"hoary willow",
-"speech therapist",
-"Zinjanthropus",
-"core",
-"red-backed mouse",
-"eptatretus",
-"mossy saxifrage",
-"Aristotelian",
-"Thessalonian",
-"searing iron",
-"bifocals",
-"falangist",
-"field pea",
-"packsaddle",
-"lay reader",
-"hoecake",
-"cuboid",
-"white maire",
-"iceman",
-"lobscouse",
-"neckcloth",
-"color-blind person",
-"Chinese holly",
-"assemblyman",
-"white-lipped peccary",
-"kava",
-"plastron",
-"crab louse",
-"hook wrench",
-"trailing four o'clock",
-"junior",
-"skilly",
-"internet",
-"tonguefish",
-"footman",
-"sub-assembly",
-"evangelist",
-"track",
-"bench lathe",
-"desk clerk",
-"scalded milk",
-"chamois cloth",
-"American marten",
-"chachka",
-"nondescript",
-"pellitory-of-the-wall",
-"swamp candles",
-"procurator",
-"cuddy",
-"farkleberry",
-"mountain male fern",
-"trawl",
-"dual scan display",
-"fish meal",
-"prospector",
-"convener",
-"guano bat",
-"ant shrike",
-"picture rail",
-"sand rat",
-"gynophore",
-"quilting",
-"sleeper",
-"summer savory",
-"Cotoneaster dammeri",
-"smooth sumac",
-"slumgullion",
-"suite",
-"catalufa",
-"spherule",
-"lean-to tent",
-"gryphon",
-"gas shell",
-"short iron",
-"sweet sultan",
-"dewberry",
-"Victoria plum",
-"American water shrew",
-"X-ray tube",
-"macebearer",
-"green arrow arum",
-"abbe",
-"poke milkweed",
-"atheist",
-"Fosbury flop",
-"Ord kangaroo rat",
-"moldboard",
-"wheat germ",
-"explosive trace detection",
-"whippoorwill",
-"examiner",
-"tallyman",
-"Crookes tube",
-"wild peach",
-"fringed grass of Parnassus",
-"Crookes radiometer",
-"Atlantic croaker",
-"lobster stew",
-"spring cress",
-"maggot",
-"pacer",
-"hydra",
-"Zionist",
-"pepper tree",
-"diamante",
-"baize",
-"Rhodesian man",
-"county agent",
-"respecter",
-"Anglican",
-"antimacassar",
-"materialist",
-"Swan River everlasting",
-"cloud grass",
-"toll line",
-"C battery",
-"chinese mustard",
-"grass poly",
-"warming pan",
-"seasonal worker",
-"common sickle pine",
-"bathysphere",
-"elegant Habenaria",
-"card table",
-"Chilean cedar",
-"brocket",
-"collimator",
-"malted milk",
-"avadavat",
-"fire marshall",
-"coloratura",
-"yellow spiny daisy",
-"fingerstall",
-"narrow-leaf penstemon",
-"indigo broom",
-"pillwort",
-"bearberry willow",
-"Etonian",
-"certified milk",
-"climbing bird's nest fern",
-"field coil",
-"wrist pad",
-"parr",
-"kaoliang",
-"engelmannia",
-"stocker",
-"satrap",
-"Nantua",
-"spearfish",
-"caper tree",
-"gold-tail moth",
-"mountain chinchilla",
-"sea milkwort",
-"westerner",
-"army cutworm",
-"leaf-nosed snake",
-"neurobiologist",
-"xeranthemum",
-"Eastern silvery aster",
-"ecclesiastical attire",
-"caper",
-"Ukranian",
-"bight",
-"button fern",
-"peach pit",
-"oligodendrocyte",
-"maar",
-"digitigrade mammal",
-"streptobacillus",
-"sensitometer",
-"preemptor",
-"oat",
-"bell foundry",
-"crown lens",
-"rock purslane",
-"Junior",
-"Brazilian guava",
-"kicksorter",
-"Ohio goldenrod",
-"red mulberry",
-"King's Counsel",
-"mountain four o'clock",
-"fairy shrimp",
-"fell",
-"oca",
-"sycophant",
-"chantry",
-"dermatoglyphic",
-"bomblet",
-"keyhole saw",
-"hangman's rope",
-"little barley",
-"lion-jaw forceps",
-"giant scrambling fern",
-"popper",
-"dulcimer",
-"Espagnole",
-"tardigrade",
-"smooth-haired fox terrier",
-"bullbrier",
-"rewa-rewa",
-"Japanese poinsettia",
-"trunk line",
-"cannery",
-"helminth",
-"American spikenard",
-"prince's-feather",
-"arthroscope",
-"ginger",
-"aphakic",
-"pilot bit",
-"angle of refraction",
-"low-sodium diet",
-"wall creeper",
-"growler",
-"praetorium",
-"Hall of Fame",
-"soupfin shark",
-"Molotov cocktail",
-"kaffir boom",
-"stitcher",
-"sawwort",
-"flagellant",
-"Atlantic herring",
-"Reticulitermes lucifugus",
-"voltaic pile",
-"snowy orchid",
-"southern flounder",
-"skysail",
-"osage orange",
-"white mullein",
-"lined snake",
-"tolu tree",
-"poliovirus",
-"foreman",
-"burette",
-"jackass bat",
-"invigilator",
-"electromyograph",
-"acarus",
-"presence chamber",
-"columbian mammoth",
-"hyacinth bean",
-"pilot",
-"meadow jumping mouse",
-"Maria",
-"outskirts",
-"aftershaft",
-"Queensland nut",
-"schlockmeister",
-"plainsman",
-"afropavo",
-"scarlet musk flower",
-"five spice powder",
-"gunboat",
-"multiplex",
-"Dutch uncle",
-"louvered window",
-"chimney corner",
-"cuscus",
-"psalmist",
-"Vichy water",
-"signer",
-"amphiuma",
-"harmonizer",
-"authorizer",
-"naiad",
-"control rod",
-"stentor",
-"mountain bladder fern",
-"gig",
-"read-only memory chip",
-"assenter",
-"vixen",
-"hermitage",
-"corn dab",
-"locksmith",
-"cockspur thorn",
-"variable-pitch propeller",
-"western red-backed salamander",
-"dolman sleeve",
-"cultist",
-"sweet buckeye",
-"pine vole",
-"Peking man",
-"mountain swamp gum",
-"nimblewill",
-"bethel",
-"aye-aye",
-"lancelet",
-"teff",
-"Alpine celery pine",
-"endive",
-"nipa palm",
-"center of curvature",
-"seeder",
-"Sabahan",
-"sea scallop",
-"social secretary",
-"gorgonzola",
-"western chokecherry",
-"misanthrope",
-"rabbitweed",
-"beggarman",
-"button fern",
-"white mallee",
-"doodia",
-"mastiff bat",
-"roper",
-"prima donna",
-"blanc",
-"holding pen",
-"fingerling",
-"skyhook",
-"flophouse",
-"steam chest",
-"crystallized ginger",
-"acrocarp",
-"horse pistol",
-"true mahogany",
-"costmary",
-"ballistic galvanometer",
-"jaunting car",
-"bartonia",
-"rep",
-"mandibular notch",
-"bubble and squeak",
-"umpire",
-"fringed loosestrife",
-"bear oak",
-"ski jump",
-"staggerbush",
-"plumcot",
-"thermal reactor",
-"field brome",
-"bodkin",
-"jackknife-fish",
-"malope",
-"writing arm",
-"gold fern",
-"Stayman Winesap",
-"merlon",
-"eclectic",
-"fluxmeter",
-"emeritus",
-"imam",
-"drum",
-"pop tent",
-"capital ship",
-"subalpine larch",
-"flail",
-"Lorenzo dressing",
-"tomboy",
-"eastern woodrat",
-"warrantee",
-"Pacific spiny dogfish",
-"sheepshead porgy",
-"farthingale",
-"Cryptoprocta",
-"power loom",
-"communicant",
-"howdah",
-"ectomorph",
-"false foxglove",
-"basset horn",
-"odd-pinnate leaf",
-"Wisconsin weeping willow",
-"Queensland bottletree",
-"dampener",
-"corbel arch",
-"silent butler",
-"Circe",
-"town clerk",
-"Japanese chestnut",
-"bloodwood tree",
-"switcher",
-"cup hook",
-"spreader",
-"rice rat",
-"straightedge",
-"traverser",
-"fluid drive",
-"Spanish paprika",
-"sour milk",
-"poison camas",
-"bean dip",
-"card table",
-"vinegar fly",
-"vizier",
-"electric-discharge lamp",
-"purple rock brake",
-"dynamo",
-"Japanese snowbell",
-"Grindelia robusta",
-"neuroglia",
-"safflower seed",
-"coronet",
-"frown line",
-"Renaissance man",
-"Steller's sea cow",
-"book scorpion",
-"isosceles triangle",
-"arthritic",
-"spherical triangle",
-"kangaroo mouse",
-"garden orache",
-"stemless hymenoxys",
-"titi",
-"out-basket",
-"gent",
-"columnea",
-"mint sauce",
-"mouthbreeder",
-"Liebig condenser",
-"cheerer",
-"assegai",
-"stickler",
-"Merostomata",
-"dimmer",
-"grey poplar",
-"common heath",
-"scorzonera",
-"glory hole",
-"Blackfoot",
-"oil slick",
-"musketeer",
-"apple geranium",
-"daisyleaf grape fern",
-"gas furnace",
-"bijugate leaf",
-"Arabist",
-"star-thistle",
-"hand throttle",
-"huckleberry oak",
-"lift pump",
-"maulstick",
-"Rome Beauty",
-"Newburg sauce",
-"pit",
-"volunteer",
-"Baldwin",
-"ark",
-"Asian horseshoe crab",
-"black calla",
-"marlinespike",
-"Gentianopsid procera",
-"guinea gold vine",
-"tucker-bag",
-"desk sergeant",
-"piezometer",
-"migrator",
-"keelson",
-"executrix",
-"sackcloth",
-"onion smut",
-"buckboard",
-"substitute",
-"pudge",
-"mess",
-"cinchona",
-"intervenor",
-"gravimeter",
-"pederast",
-"censor",
-"gastroenterologist",
-"cutlassfish",
-"launch",
-"demerara",
-"Diegueno",
-"bog bilberry",
-"aglet",
-"soda fountain",
-"crank call",
-"harpoon gun",
-"ribbon fern",
-"Gurkha",
-"output device",
-"epilating wax",
-"greasewood",
-"water horehound",
-"return key",
-"fairy swallow",
-"spatulate leaf",
-"culverin",
-"leptocephalus",
-"kleptomaniac",
-"barley water",
-"bleeding tooth",
-"Cheyenne",
-"maleberry",
-"limber",
-"tapenade",
-"whorled aster",
-"toe",
-"revenant",
-"lap joint",
-"vein",
-"truant",
-"florest's cineraria",
-"morning dress",
-"trichodesmium",
-"nightshirt",
-"element of a cylinder",
-"shopaholic",
-"section hand",
-"electrodynamometer",
-"Guadalupe cypress",
-"rosebud",
-"racist",
-"avaram",
-"keeled garlic",
-"Alaska rein orchid",
-"orange toast",
-"cunner",
-"dipstick",
-"Neolentinus ponderosus",
-"bulbil",
-"charlotte",
-"pull-through",
-"header",
-"Manduca quinquemaculata",
-"persona grata",
-"elegist",
-"cafe royale",
-"scup",
-"semanticist",
-"wood sage",
-"field magnet",
-"tundra",
-"bay myrtle",
-"alluvial flat",
-"arrowleaf groundsel",
-"celtuce",
-"baryon",
-"must",
-"entrant",
-"othonna",
-"pied-a-terre",
-"liza",
-"sticky aster",
-"grasshopper mouse",
-"prison guard",
-"tire iron",
-"bomb rack",
-"Spanish American",
-"sheltered workshop",
-"turfing daisy",
-"backbone",
-"tangle orchid",
-"creeping willow",
-"dumb bomb",
-"horse cassia",
-"barosaur",
-"Yavapai",
-"shrimp Newburg",
-"peanut worm",
-"dwarf chinkapin oak",
-"corchorus",
-"brick cheese",
-"by-catch",
-"stover",
-"Urnula craterium",
-"clasp",
-"Kekchi",
-"alpine coltsfoot",
-"soybean future",
-"altar wine",
-"ripping chisel",
-"encephalogram",
-"mountain spleenwort",
-"transferee",
-"remoulade sauce",
-"American rock brake",
-"stenographer",
-"read/write head",
-"loblolly",
-"ground",
-"powdered mustard",
-"brake band",
-"sea dahlia",
-"freak",
-"proconsul",
-"Coffey still",
-"Sivapithecus",
-"pellitory",
-"palm cat",
-"skew arch",
-"American angelica tree",
-"vigilante",
-"candelilla",
-"andryala",
-"amarelle",
-"swiftlet",
-"petcock",
-"associate professor",
-"sclerite",
-"open circuit",
-"Virginia crownbeard",
-"Last Supper",
-"button tree",
-"scyphozoan",
-"margate",
-"mercury cell",
-"horsewhip",
-"water scorpion",
-"companionway",
-"drop cloth",
-"Amhara",
-"miraculous food",
-"pro-lifer",
-"embryologist",
-"Creole",
-"bombazine",
-"Indian blackwood",
-"cubeb",
-"trace detector",
-"gros point",
-"main-topsail",
-"meringue kiss",
-"spree killer",
-"capstone",
-"specimen bottle",
-"woolly apple aphid",
-"silverweed",
-"American barberry",
-"gallfly",
-"European bog asphodel",
-"northern flying squirrel",
-"alliterator",
-"Old Catholic",
-"heliograph",
-"Pteris cretica",
-"tippler",
-"pump well",
-"allspice",
-"balancer",
-"scarlet bugler",
-"lantern fly",
-"white prairie aster",
-"krummhorn",
-"robin's plantain",
-"Pacific sardine",
-"patty-pan",
-"decaffeinated coffee",
-"western saxifrage",
-"warrantee",
-"colorimeter",
-"ball bearing",
-"makomako",
-"foot",
-"troika",
-"apricot sauce",
-"data multiplexer",
-"rose-root",
-"sound film",
-"Northern dewberry",
-"water hickory",
-"swing door",
-"spastic",
-"Oligoporus leucospongia",
-"botulinus",
-"tamale pie",
-"Sagittarius",
-"muff",
-"spicebush",
-"petiolule",
-"pump action",
-"Parry's pinyon",
-"split-pea",
-"rudder blade",
-"princess royal",
-"wormseed mustard",
-"honey guide",
-"pip-squeak",
-"fin keel",
-"foretop",
-"cyrilla",
-"Navaho",
-"melanocyte",
-"deist",
-"silver tree",
-"citrus whitefly",
-"Morrow's honeysuckle",
-"green peach aphid",
-"longanberry",
-"call-board",
-"wild yam",
-"novelist",
-"toothed spurge",
-"alienee",
-"pond apple",
-"allspice",
-"Carolina lupine",
-"Jack of all trades",
-"white false indigo",
-"boiled dinner",
-"princewood",
-"sailor's-choice",
-"false bracken",
-"microbrewery",
-"black grama",
-"tutee",
-"brickkiln",
-"sea raven",
-"guesser",
-"wirework",
-"European lemming",
-"thyrse",
-"plains lemon monarda",
-"milo",
-"shunt",
-"spotted cowbane",
-"anchovy sauce",
-"grande dame",
-"Maryland golden aster",
-"Chinese puzzle",
-"boarfish",
-"burweed marsh elder",
-"defense contractor",
-"nitric bacteria",
-"Belgian hare",
-"beach plum",
-"conformal projection",
-"sand fly",
-"steering linkage",
-"quickset",
-"Mahayanist",
-"Geiger tube",
-"loudmouth",
-"Lancastrian",
-"brownie mix",
-"ex-spouse",
-"deltoid leaf",
-"Shasta salamander",
-"rabbet joint",
-"purple anise",
-"garibaldi",
-"gebang palm",
-"bladderpod",
-"Host",
-"great bowerbird",
-"string cheese",
-"spinning jenny",
-"drift net",
-"matriarch",
-"guar",
-"bitter betch",
-"panda car",
-"mess",
-"plains pocket mouse",
-"scarlet wisteria tree",
-"deerberry",
-"reamer",
-"homing torpedo",
-"molehill",
-"stockyard",
-"reniform leaf",
-"rag",
-"symmetry",
-"Texas star",
-"lerot",
-"pickle relish",
-"three-seeded mercury",
-"cotter pin",
-"ice-cream bean",
-"farmyard",
-"bar magnet",
-"hansom",
-"prickle cell",
-"renal cortex",
-"pest",
-"Ultrasuede",
-"sailing master",
-"brougham",
-"wastrel",
-"amboina pine",
-"Canary Island hare's foot fern",
-"ninepin ball",
-"southwestern lip fern",
-"usherette",
-"lemon drop",
-"star begonia",
-"weeds",
-"saltworks",
-"Persian melon",
-"corbina",
-"medusa",
-"bucksaw",
-"Gibson girl",
-"diameter",
-"American twinflower",
-"kino",
-"clear liquid diet",
-"angiocardiogram",
-"wetter",
-"oyster cracker",
-"yellowfin mojarra",
-"wild parsley",
-"life tenant",
-"broom closet",
-"Corynebacterium diphtheriae",
-"square shooter",
-"bedwetter",
-"ball-and-socket joint",
-"nonsolid color",
-"Salmonella typhimurium",
-"buffel grass",
-"hip pad",
-"subaltern",
-"heliothis moth",
-"trail boss",
-"hayloft",
-"Francisella",
-"primordial dwarf",
-"cock-a-leekie",
-"sugarplum",
-"propulsion system",
-"tyrolean",
-"Carib",
-"salai",
-"ketembilla",
-"ironclad",
-"cornhusk",
-"heckler",
-"multistage rocket",
-"north island edelweiss",
-"Chaldean",
-"twenty-two pistol",
-"Francophobe",
-"scofflaw",
-"sickle feather",
-"screw bean",
-"sea squill",
-"Scopolia carniolica",
-"agglomerator",
-"western holly fern",
-"presenter",
-"straight pin",
-"Myxine glutinosa",
-"Colbert",
-"clover-leaf roll",
-"war paint",
-"bird's-eye bush",
-"longfin mako",
-"running suit",
-"arrow wood",
-"margrave",
-"blue fleabane",
-"dracontium",
-"plastron",
-"chimney swift",
-"child prodigy",
-"commissar",
-"turtle soup",
-"postulant",
-"archaebacteria",
-"snakefly",
-"Pitot tube",
-"chap",
-"smilo",
-"Malthusian",
-"French roof",
-"worm wheel",
-"gulag",
-"pointed-leaf maple",
-"pull-off",
-"Cathaya",
-"American green toad",
-"ball cartridge",
-"infiltrator",
-"snowfield",
-"crotchet",
-"auxiliary pump",
-"bearnaise",
-"galax",
-"chaenactis",
-"olympic salamander",
-"sundowner",
-"cows' milk",
-"beach plum",
-"moss-trooper",
-"Arabidopsis thaliana",
-"cat's-claw",
-"bog rosemary",
-"ribier",
-"book agent",
-"bumper jack",
-"beefwood",
-"monk's cloth",
-"alpine bearberry",
-"climbing fumitory",
-"cucking stool",
-"puka",
-"Piltdown man",
-"property man",
-"discharge lamp",
-"X chromosome",
-"knobble",
-"lobster Newburg",
-"herbalist",
-"sunray",
-"golden saxifrage",
-"leopard cat",
-"muffle",
-"stonewort",
-"blancmange",
-"intraocular lens",
-"trepan",
-"desert mariposa tulip",
-"plume poppy",
-"Dane",
-"martynia",
-"shaver",
-"white milkweed",
-"napu",
-"tansy-leaved rocket",
-"abortus",
-"telemeter",
-"tansy mustard",
-"harpy",
-"honeysuckle",
-"ironworks",
-"testacean",
-"Tartuffe",
-"silvervine",
-"Sihasapa",
-"surface gauge",
-"western blind snake",
-"paramyxovirus",
-"Icelander",
-"bird louse",
-"stockbroker belt",
-"test-tube baby",
-"ague root",
-"little golden zinnia",
-"dietician",
-"elephant's-foot",
-"dirty bomb",
-"sailing warship",
-"brier",
-"tinter",
-"Connemara heath",
-"potato fungus",
-"bait casting",
-"decagon",
-"rosefish",
-"die",
-"high-pass filter",
-"solitaire",
-"widow's walk",
-"goldthread",
-"Tudor",
-"trews",
-"orange pekoe",
-"ninon",
-"soda jerk",
-"sump",
-"flying carpet",
-"burial garment",
-"oblanceolate leaf",
-"press gallery",
-"Shintoist",
-"three-centered arch",
-"spreading pogonia",
-"Moro",
-"foxtail orchid",
-"Ghanian",
-"dry kiln",
-"thane",
-"naranjilla",
-"bitter pea",
-"American bugbane",
-"apron string",
-"oyster fish",
-"Port Jackson fig",
-"prize winner",
-"high-water mark",
-"Oneida",
-"smoking room",
-"potato skin",
-"charge d'affaires",
-"gantlet",
-"amyloid plaque",
-"barmbrack",
-"mate",
-"arrow leaved aster",
-"handbarrow",
-"horned screamer",
-"virago",
-"linoleum knife",
-"rattlesnake root",
-"K ration",
-"reset",
-"foot brake",
-"red coral",
-"good guy",
-"aberrant",
-"lavalava",
-"poleax",
-"garden webworm",
-"sneezer",
-"mountain heath",
-"American dog violet",
-"eolith",
-"chimneysweeper",
-"matriarch",
-"smalltooth sawfish",
-"sea mouse",
-"tubercle bacillus",
-"superconducting supercollider",
-"Abney level",
-"darnel",
-"gherkin",
-"celery salt",
-"Tungus",
-"pulasan",
-"oriflamme",
-"death camp",
-"redhorse",
-"apprehender",
-"scion",
-"selectwoman",
-"pentahedron",
-"principal",
-"old school tie",
-"slice bar",
-"chanar",
-"pimento butter",
-"wailer",
-"zero",
-"mescal",
-"rosebud orchid",
-"stone bramble",
-"Jarvik heart",
-"NOC",
-"pitchman",
-"rat cheese",
-"strawberry tomato",
-"dwarf golden chinkapin",
-"landau",
-"tocsin",
-"ampulla",
-"scratcher",
-"crab Louis",
-"ginseng",
-"ripcord",
-"polluter",
-"tensiometer",
-"eyewitness",
-"aalii",
-"Oregon crab apple",
-"conservator",
-"day jessamine",
-"hexahedron",
-"suture",
-"tippet",
-"linsey-woolsey",
-"vernal witch hazel",
-"stainer",
-"egocentric",
-"canistel",
-"nudger",
-"shipping agent",
-"shortleaf pine",
-"battle sight",
-"cheese spread",
-"weeder",
-"incendiary bomb",
-"honeyflower",
-"stovepipe iron",
-"stepper",
-"hellgrammiate",
-"votary",
-"aflatoxin",
-"arquebus",
-"impulse turbine",
-"pipewort",
-"garrote",
-"glow lamp",
-"pigsticking",
-"blood clam",
-"surface search radar",
-"Bolshevik",
-"platen",
-"chariot",
-"Gentianopsis thermalis",
-"water level",
-"quandong",
-"catalytic cracker",
-"giant foxtail",
-"nut butter",
-"drainplug",
-"holdover",
-"coastguardsman",
-"Secretary of Health and Human Services",
-"Seeing Eye dog",
-"American plaice",
-"coquilles Saint-Jacques",
-"christella",
-"medium",
-"clingfish",
-"lally",
-"light-o'-love",
-"Gentianopsis detonsa",
-"taper file",
-"signal detection",
-"trip wire",
-"lignosae",
-"receiver",
-"sedan",
-"mud puppy",
-"corn sugar",
-"Philippine mahogany",
-"magnetic pole",
-"jointed rush",
-"trapper's tea",
-"Dorking",
-"welcome wagon",
-"clammyweed",
-"guard",
-"false azalea",
-"convalescent",
-"babassu",
-"dedicated file server",
-"colossus",
-"air search radar",
-"marquess",
-"straight flute",
-"sand stargazer",
-"sea catfish",
-"rosilla",
-"ripsaw",
-"Bermuda onion",
-"peach sauce",
-"sagebrush mariposa tulip",
-"yashmak",
-"Virginia mallow",
-"erose leaf",
-"sand blackberry",
-"boulevardier",
-"forester",
-"choragus",
-"onion mildew",
-"threadfin",
-"winged pea",
-"sugar daddy",
-"rotary press",
-"styracosaur",
-"rathskeller",
-"Japanese millet",
-"anchorite",
-"coral drops",
-"false gavial",
-"eastern pipistrel",
-"cheese press",
-"Chinese primrose",
-"pamperer",
-"real estate broker",
-"power worker",
-"breeder reactor",
-"nutcracker",
-"piano wire",
-"cushaw",
-"Sinanthropus",
-"firebreak",
-"kelp greenling",
-"herba impia",
-"toll call",
-"yoke",
-"bird fancier",
-"evening-snow",
-"fever tree",
-"reed meadow grass",
-"flanker back",
-"toggle bolt",
-"Santa Cruz cypress",
-"carbonnade flamande",
-"northern dune tansy",
-"mikado",
-"millettia",
-"forty-five",
-"court",
-"icepick",
-"holm oak",
-"Japanese angelica tree",
-"Pacific cod",
-"cant hook",
-"urologist",
-"spelt",
-"lekvar",
-"enologist",
-"Mediterranean flour moth",
-"prickly-edged leaf",
-"Spanish grunt",
-"dune cycling",
-"frostweed",
-"whisperer",
-"tucker",
-"Roman wormwood",
-"counterterrorist",
-"woolly alder aphid",
-"Nuttall oak",
-"snail butter",
-"threshing floor",
-"motley",
-"forge",
-"water mold",
-"mummichog",
-"sulfur paintbrush",
-"head",
-"walking delegate",
-"jujube",
-"peachleaf willow",
-"Christmas bells",
-"valley pocket gopher",
-"bear's-paw fern",
-"Lanthanotus borneensis",
-"pearl hominy",
-"placeman",
-"swage block",
-"offerer",
-"stargazer",
-"jeweler's glass",
-"male chauvinist",
-"crossbar",
-"Oktoberfest",
-"tamarau",
-"micronutrient",
-"large-leaved aster",
-"tasset",
-"tepary bean",
-"sausage curl",
-"ivy",
-"snob",
-"roller towel",
-"wood meadowgrass",
-"archil",
-"padrone",
-"prairie rocket",
-"tongueflower",
-"kidney fern",
-"Carolina buckthorn",
-"sea island cotton",
-"landscape architect",
-"realist",
-"oyabun",
-"mother hen",
-"ostracoderm",
-"esker",
-"heliophila",
-"nympholept",
-"shining clubmoss",
-"press agent",
-"clam dip",
-"Djiboutian",
-"white currant",
-"codfish ball",
-"hand cheese",
-"kraal",
-"trident",
-"conventicle",
-"bacteroid",
-"Indian plantain",
-"quandong",
-"kola nut",
-"signor",
-"theater light",
-"musk clover",
-"canistel",
-"silent partner",
-"steel-wool pad",
-"diggings",
-"affluent",
-"sightreader",
-"John Doe",
-"arrowworm",
-"goatsfoot",
-"guardroom",
-"wild cinnamon",
-"kaffir boom",
-"ink eraser",
-"yardie",
-"industrialist",
-"sea lily",
-"polarimeter",
-"Polistes annularis",
-"western big-eared bat",
-"omnivore",
-"Ted",
-"horsecloth",
-"crab cocktail",
-"vacuum chamber",
-"flower-of-an-hour",
-"bilge",
-"poleax",
-"neolith",
-"Montezuma",
-"plum-yew",
-"welfare case",
-"trave",
-"pipe bomb",
-"shading",
-"Centigrade thermometer",
-"bangalore torpedo",
-"celery top pine",
-"nuclear rocket",
-"fowling piece",
-"anti-Semite",
-"landscape",
-"derris",
-"bush honeysuckle",
-"Mediterranean water shrew",
-"ticket collector",
-"masked shrew",
-"white dipladenia",
-"Savoyard",
-"bondman",
-"tempter",
-"pygmy cypress",
-"pentathlete",
-"thruster",
-"usurper",
-"Arminian",
-"yerba buena",
-"ice field",
-"ichthyosaurus",
-"sackcloth",
-"bean tostada",
-"Oxbridge",
-"Pteropus hypomelanus",
-"thinker",
-"bank robber",
-"ape-man",
-"thurifer",
-"knawel",
-"mule fat",
-"hot spot",
-"hairy-legged vampire bat",
-"night raven",
-"hook and eye",
-"crocodile bird",
-"skunkweed",
-"beaver rat",
-"cypress sedge",
-"florida selaginella",
-"April fool",
-"Jonah crab",
-"glass wool",
-"corkwood",
-"dwarf elder",
-"hinging post",
-"gentile",
-"Brazilian trumpeter",
-"witch doctor",
-"thermograph",
-"pink shower",
-"Mao jacket",
-"capelin",
-"parang",
-"bradawl",
-"stooper",
-"jewel orchid",
-"citrange",
-"oarswoman",
-"Macedonian",
-"particolored buckeye",
-"pachycephalosaur",
-"satinwood",
-"Chinese brown sauce",
-"peep sight",
-"straight man",
-"quandong",
-"chamois cress",
-"nonfat dry milk",
-"rosin bag",
-"Leiden jar",
-"Grimes' golden",
-"spirillum",
-"grass vetch",
-"carillonneur",
-"downy wood mint",
-"melon ball",
-"sweet calabash",
-"chlamydospore",
-"bombshell",
-"sidewall",
-"sprig",
-"Indian button fern",
-"globe pepper",
-"rough-stemmed goldenrod",
-"bocconia",
-"bubble chamber",
-"sand dab",
-"plum-fruited yew",
-"aecium",
-"marrowfat pea",
-"hobbyist",
-"whipper-in",
-"salad burnet",
-"neckband",
-"Tangier pea",
-"sauce Louis",
-"salad burnet",
-"artist's loft",
-"koumiss",
-"Nazarene",
-"cutter",
-"scrim",
-"drape",
-"crab-eating dog",
-"deckhand",
-"bedroll",
-"gaff",
-"stifler",
-"pink lady",
-"great plains paintbrush",
-"patternmaker",
-"yoke",
-"caryophyllaceous plant",
-"angrecum",
-"quadriplegic",
-"grid",
-"genlisea",
-"aspic",
-"water table",
-"junket",
-"signore",
-"Mutillidae",
-"proprioceptor",
-"pivoting window",
-"Indian poke",
-"synchroscope",
-"trichion",
-"tarahumara frog",
-"proctoscope",
-"abomination",
-"purslane speedwell",
-"breast drill",
-"Japanese barberry",
-"mandrake root",
-"breakable",
-"salon",
-"American watercress",
-"take-up",
-"entrenchment",
-"cocktail sauce",
-"Scotch asphodel",
-"borough",
-"matchmaker",
-"Seneca snakeroot",
-"pointsman",
-"psephologist",
-"clustered poppy mallow",
-"onion thrips",
-"nuclear-powered ship",
-"organizer",
-"deciduous holly",
-"balsam willow",
-"enzymologist",
-"caraway",
-"drip loop",
-"dog laurel",
-"Orangeman",
-"sapsago",
-"polymath",
-"backplate",
-"leathery grape fern",
-"modillion",
-"two-timer",
-"handhold",
-"consignee",
-"white stringybark",
-"nettle-leaved goosefoot",
-"bookmaker",
-"disk drive",
-"doliolum",
-"palmist",
-"packinghouse",
-"Spandau",
-"Whipple's penstemon",
-"sword grass",
-"ribbon development",
-"pearly-shelled mussel",
-"winter heliotrope",
-"rogue elephant",
-"deck tennis",
-"Venus's flower basket",
-"football",
-"shim",
-"boatswain",
-"blinks",
-"armored catfish",
-"hooded seal",
-"outdoorswoman",
-"water starwort",
-"upholstery needle",
-"pleurodont",
-"silky anteater",
-"cornmeal",
-"lead-in",
-"redfin pickerel",
-"horse balm",
-"Rydberg's penstemon",
-"cascade transformer",
-"fly poison",
-"Volvaria bombycina",
-"broad-leaved twayblade",
-"pastry cart",
-"body plethysmograph",
-"waverer",
-"hardware store",
-"Parry's penstemon",
-"European sanicle",
-"strawberry geranium",
-"cross-examiner",
-"head gate",
-"devil's tongue",
-"hemiepiphyte",
-"pine hyacinth",
-"machmeter",
-"spirit lamp",
-"field judge",
-"Rock Cornish",
-"mayhaw",
-"Sassenach",
-"bog pimpernel",
-"parallel interface",
-"crowberry",
-"roach",
-"Aegyptopithecus",
-"cajan pea",
-"lapboard",
-"cryostat",
-"magnetic storage medium",
-"white yam",
-"Lombard",
-"rhymer",
-"bed and breakfast",
-"bunya bunya",
-"rifle grenade",
-"caterer",
-"collared pika",
-"anti-submarine rocket",
-"bookkeeper",
-"Western mountain ash",
-"profit taker",
-"fruitlet",
-"Knowlton's cactus",
-"infernal",
-"beefsteak begonia",
-"lunula",
-"emulsion",
-"intermediate wheatgrass",
-"titfer",
-"European sea bream",
-"bigeye scad",
-"yak butter",
-"kola",
-"cone pepper",
-"plesiosaur",
-"ragwort",
-"penal colony",
-"black carpet beetle",
-"lubber's hole",
-"Stapelias asterias",
-"yard marker",
-"balloon bomb",
-"Scythian lamb",
-"armory",
-"selsyn",
-"marblewood",
-"spirula",
-"fatalist",
-"hash head",
-"armiger",
-"Dom Pedro",
-"white-chinned petrel",
-"ballast",
-"orthopter",
-"greater water parsnip",
-"clutch",
-"largeleaf holly",
-"Evangelist",
-"king whiting",
-"tuna fish salad",
-"Muscadet",
-"surpriser",
-"jumping bristletail",
-"proportional counter tube",
-"Hamburg parsley",
-"obstructionist",
-"pus-forming bacteria",
-"creep feed",
-"stepbrother",
-"janissary",
-"control freak",
-"trusty",
-"trepan",
-"King William pine",
-"orthicon",
-"geological horizon",
-"molecular biologist",
-"violator",
-"pariah dog",
-"Austrian",
-"conciliator",
-"Fauntleroy",
-"packing needle",
-"mazer",
-"Saturday night special",
-"leucocytozoan",
-"coastal rein orchid",
-"whirligig beetle",
-"capitalist",
-"breeches buoy",
-"clubroot fungus",
-"meadow spikemoss",
-"Kichai",
-"Spanish lime",
-"land office",
-"camera obscura",
-"strafer",
-"purple-stemmed aster",
-"lusterware",
-"valve",
-"Roman nettle",
-"isthmus",
-"breadstuff",
-"sealskin",
-"maleo",
-"bilge keel",
-"carissa plum",
-"fish fly",
-"kolkhoznik",
-"heath pea",
-"cowage",
-"hog sucker",
-"Sam Browne belt",
-"inductor",
-"wild licorice",
-"Socotra begonia",
-"supernumerary",
-"Angle",
-"red shrubby penstemon",
-"toilet kit",
-"tawse",
-"sweet bells",
-"kawaka",
-"brown soft scale",
-"lyssavirus",
-"betting shop",
-"double-crosser",
-"macrotus",
-"climbing hempweed",
-"poi",
-"strip mall",
-"deadhead",
-"petit juror",
-"tract housing",
-"American mistletoe",
-"lace-flower vine",
-"precipitator",
-"endoparasite",
-"hairy wood mint",
-"red snapper",
-"Victorian",
-"hog peanut",
-"line of heart",
-"opossum shrimp",
-"plumcot",
-"Bavarian blue",
-"slops",
-"light flyweight",
-"oregano",
-"sand myrtle",
-"pocket battleship",
-"curator",
-"narc",
-"hydraulic cement",
-"plains pocket gopher",
-"closed loop",
-"pluralist",
-"molter",
-"Christmas bush",
-"snuffers",
-"slender knapweed",
-"footwall",
-"plage",
-"caper tree",
-"red siskin",
-"tender",
-"boat train",
-"tipster",
-"low-pass filter",
-"student lamp",
-"morosoph",
-"japonica",
-"bellows",
-"herald",
-"oyster plant",
-"savory",
-"mail",
-"computational linguist",
-"blade",
-"winter crookneck squash",
-"zoomastigote",
-"blackmailer",
-"richweed",
-"dialectician",
-"genip",
-"plumed scorpionfish",
-"jet bridge",
-"thermopile",
-"billy buttons",
-"Brule",
-"millwright",
-"Arenaviridae",
-"Jones' penstemon",
-"monastic habit",
-"genipap fruit",
-"burnous",
-"dairyman",
-"top",
-"crab-eating raccoon",
-"quadrangular prism",
-"pilot burner",
-"weeder",
-"trireme",
-"boy wonder",
-"man of letters",
-"Catawba",
-"high-muck-a-muck",
-"light circuit",
-"bloodworm",
-"lappet caterpillar",
-"half-and-half",
-"office boy",
-"saddle stitch",
-"mistletoe cactus",
-"false chamomile",
-"Catalina cherry",
-"workhouse",
-"Jamaica quassia",
-"britches",
-"tooth shell",
-"reduction gear",
-"carrot pudding",
-"balsam woolly aphid",
-"handspike",
-"aioli",
-"silver hake",
-"flour bin",
-"wireman",
-"gas-cooled reactor",
-"aficionado",
-"plus fours",
-"gitano",
-"gene chip",
-"oilfish",
-"ingenue",
-"tulip orchid",
-"late purple aster",
-"pork and beans",
-"envoy",
-"lemon extract",
-"milk bar",
-"black huckleberry",
-"ground roller",
-"Connecticuter",
-"siderocyte",
-"Jacquard loom",
-"chub",
-"meat safe",
-"stock cube",
-"Australian sumac",
-"purple sanicle",
-"tailless tenrec",
-"dog wrench",
-"rainbow cactus",
-"castor bean",
-"scintillation counter",
-"eohippus",
-"pawnbroker",
-"gauge boson",
-"front man",
-"early warning radar",
-"bearing wall",
-"Bourbon",
-"sandwichman",
-"sild",
-"gravelweed",
-"perishable",
-"cembra nut",
-"riflebird",
-"quicksand",
-"slate",
-"sweeper",
-"ship-towed long-range acoustic detection system",
-"defamer",
-"president",
-"vitamin K3",
-"challis",
-"tanekaha",
-"bloodwort",
-"grenadier",
-"quietist",
-"Zairese",
-"fucker",
-"foremother",
-"gesneria",
-"print buffer",
-"salsilla",
-"fissiped mammal",
-"fender",
-"consulate",
-"acidophilus milk",
-"Southern dewberry",
-"snail darter",
-"Panama redwood tree",
-"dehydrated food",
-"bush willow",
-"coffee fungus",
-"Sinologist",
-"Mesoamerican",
-"hood",
-"large civet",
-"deck-house",
-"cyborg",
-"smuggler",
-"pepper sauce",
-"cyberpunk",
-"Grand Inquisitor",
-"persona non grata",
-"haggis",
-"weeping tree broom",
-"stop bath",
-"modifier",
-"coyol",
-"conodont",
-"yellow giant hyssop",
-"optical pyrometer",
-"Carolina moonseed",
-"marinade",
-"aspartame",
-"false wintergreen",
-"cityscape",
-"philter",
-"turnery",
-"hemiplegic",
-"chuck-will's-widow",
-"vower",
-"track star",
-"myrtaceous tree",
-"small civet",
-"intelligence analyst",
-"dogcart",
-"yardman",
-"cross bit",
-"holometabola",
-"platen",
-"sweet cassava",
-"Comstock mealybug",
-"acute angle",
-"Communist",
-"alcohol thermometer",
-"mountain hollyhock",
-"Mead's milkweed",
-"highjacker",
-"Townes",
-"congou",
-"Astrophyton muricatum",
-"lazybones",
-"roughcast",
-"pressure cabin",
-"clinch",
-"cinnamon",
-"smoke bomb",
-"quandong",
-"tout",
-"office-bearer",
-"punctum",
-"efficiency apartment",
-"Queensland hemp",
-"Ceylon bowstring hemp",
-"newswoman",
-"vermin",
-"fetid bugbane",
-"grantee",
-"sanitary landfill",
-"gluten-free diet",
-"clabber",
-"shillelagh",
-"white lettuce",
-"sweet coltsfoot",
-"beggar's lice",
-"samite",
-"loser",
-"flasher",
-"water star grass",
-"banana passion fruit",
-"translator",
-"artificial kidney",
-"Virginia creeper",
-"American crab apple",
-"cactus mouse",
-"nebbish",
-"Ligustrum obtusifolium",
-"vox angelica",
-"stringer",
-"hunter",
-"know-it-all",
-"scene painter",
-"invalidator",
-"jungle cock",
-"basilica",
-"coriander",
-"California single-leaf pinyon",
-"miles gloriosus",
-"pina cloth",
-"law agent",
-"scarlet fritillary",
-"keurboom",
-"bailor",
-"ramjet",
-"seedling",
-"rib joint pliers",
-"ways",
-"picket ship",
-"Surgeon General",
-"wasabi",
-"marquis",
-"clostridium perfringens",
-"Helvella sulcata",
-"furnace lining",
-"kingwood",
-"painted sandgrouse",
-"plain wanderer",
-"Indian madder",
-"silver screen",
-"bailey",
-"dwarf spurge",
-"Serbian",
-"ball-buster",
-"shaheed",
-"Platte River penstemon",
-"tensiometer",
-"mute",
-"nymphomaniac",
-"Yokuts",
-"arroyo willow",
-"whipping post",
-"class act",
-"load",
-"winged everlasting",
-"periodontist",
-"diarist",
-"robber frog",
-"diestock",
-"curry powder",
-"ratchet wheel",
-"store detective",
-"hog plum",
-"prune whip",
-"shortwave diathermy machine",
-"Anabaptist",
-"post chaise",
-"Kennan",
-"bean caper",
-"delegate",
-"orderly sergeant",
-"celtuce",
-"jumping bean",
-"gowen cypress",
-"puddingwife",
-"registered nurse",
-"West Saxon",
-"rosita",
-"gun room",
-"nasotracheal tube",
-"matchboard",
-"flagship",
-"Boswellia carteri",
-"Canadian pondweed",
-"wonder boy",
-"sewer rat",
-"dimetrodon",
-"pantograph",
-"marsh bellflower",
-"angoumois moth",
-"slippery dick",
-"woolly indris",
-"creme de cacao",
-"dulciana",
-"Jewess",
-"Macadamia integrifolia",
-"least shrew",
-"don",
-"diffuser",
-"black-stem spleenwort",
-"grouseberry",
-"goniometer",
-"annotator",
-"sticktight",
-"gossip columnist",
-"speechwriter",
-"capon",
-"rock hind",
-"Liederkranz",
-"chandler",
-"echocardiograph",
-"sidelight",
-"fisher",
-"brocket",
-"New Zealand daisybush",
-"northern sea robin",
-"roller bandage",
-"peachick",
-"pellet",
-"pichi",
-"plug fuse",
-"spark coil",
-"buckwheat",
-"brood bitch",
-"wedgie",
-"dwarf bilberry",
-"filigree",
-"bull",
-"queen",
-"dodo",
-"Salish",
-"denticulate leaf",
-"Western silvery aster",
-"Prima",
-"magnetic bottle",
-"fetterbush",
-"process-server",
-"nainsook",
-"mythologist",
-"Piedmont glacier",
-"hammerhead",
-"niggard",
-"Mound Builder",
-"Kui",
-"Nootka",
-"highbinder",
-"passenger pigeon",
-"oblong",
-"tickler coil",
-"agnostic",
-"succorer",
-"esophagogastric junction",
-"dressmaker's model",
-"bombshell",
-"social anthropologist",
-"gildhall",
-"orpine",
-"pterodactyl",
-"bristly sarsaparilla",
-"Lane's Prince Albert",
-"hognose bat",
-"salesgirl",
-"lubricating system",
-"electric catfish",
-"wrap",
-"Jacksonian",
-"chard",
-"cherry laurel",
-"foreground",
-"beadsman",
-"Kolam",
-"amniote",
-"frozen pudding",
-"acid head",
-"poor box",
-"depositor",
-"coattail",
-"pallas's sandgrouse",
-"mason's level",
-"English lady crab",
-"skeg",
-"cruel plant",
-"petrolatum gauze",
-"tuna",
-"swivel",
-"stock-in-trade",
-"perisperm",
-"civies",
-"Phyllostomus hastatus",
-"alienor",
-"Verdicchio",
-"guard's van",
-"onion butter",
-"moviegoer",
-"planter",
-"citrange",
-"box huckleberry",
-"iconoscope",
-"familiar",
-"helmsman",
-"baby boomer",
-"constructivist",
-"American bog asphodel",
-"whorled caraway",
-"simple pendulum",
-"viviparous eelpout",
-"Job's tears",
-"holdout",
-"sour salt",
-"poison bush",
-"dusky-footed woodrat",
-"golden algae",
-"granadilla tree",
-"telethermometer",
-"crossbar",
-"thrift",
-"African bowstring hemp",
-"dog in the manger",
-"hayrack",
-"gold-crowned kinglet",
-"prolonge",
-"doge",
-"pencil",
-"discount house",
-"mulligan stew",
-"Nonconformist",
-"virologist",
-"gregarine",
-"facula",
-"rocket scientist",
-"thin-shelled mussel",
-"oospore",
-"annual salt-marsh aster",
-"Afrikaner",
-"metallic",
-"julienne",
-"culverin",
-"cleavers",
-"Berliner",
-"mudhif",
-"thorny skate",
-"brown lemming",
-"yellow colicroot",
-"cooling system",
-"large-leaved magnolia",
-"free-reed",
-"canyonside",
-"preemptor",
-"stake",
-"Brucella",
-"anti-G suit",
-"pleximeter",
-"squire",
-"salsilla",
-"write-in candidate",
-"lowland burrowing treefrog",
-"flare star",
-"dwarf hulsea",
-"jobber",
-"mangel-wurzel",
-"quagga",
-"red-skinned onion",
-"positive pole",
-"Pteropus capestratus",
-"jug wine",
-"stomacher",
-"standee",
-"bladder worm",
-"hakim",
-"house of correction",
-"pelisse",
-"golden mole",
-"temporizer",
-"rose apple",
-"drove",
-"umbrellawort",
-"holy of holies",
-"lawyer cane",
-"smooth lip fern",
-"anode",
-"astatic coils",
-"zip gun",
-"feverroot",
-"self-heal",
-"expansion bit",
-"salt reed grass",
-"field pussytoes",
-"nutmeg hickory",
-"cryptic coloration",
-"Venus's girdle",
-"Hunkpapa",
-"Calostoma cinnabarina",
-"raft foundation",
-"May apple",
-"pygmy mouse",
-"prokaryote",
-"yellow-green algae",
-"Bermuda maidenhair",
-"withdrawer",
-"coelacanth",
-"Elliott's goldenrod",
-"driftfish",
-"epicyclic train",
-"bowl",
-"swamp dewberry",
-"corbel step",
-"sadist",
-"party line",
-"anti-American",
-"mining engineer",
-"Amur privet",
-"conidium",
-"Gastrocybe lateritia",
-"lithia water",
-"chaulmoogra",
-"Rough Rider",
-"Guinea pepper",
-"glade mallow",
-"pitcher sage",
-"whitecup",
-"shanghaier",
-"low St Andrew's cross",
-"phonologist",
-"cocobolo",
-"perfumery",
-"visor",
-"prison chaplain",
-"belt",
-"ingesta",
-"literary critic",
-"industrial watercourse",
-"reckoner",
-"pursuer",
-"Kinetoscope",
-"Kuiper belt",
-"hyperope",
-"raw recruit",
-"Galiella rufa",
-"Prince Albert yew",
-"slit trench",
-"usher",
-"tenderfoot",
-"white-rayed mule's ears",
-"browser",
-"piccalilli",
-"bran",
-"giant buttercup",
-"water lobelia",
-"arborescent plant",
-"echinus",
-"dryland blueberry",
-"struggler",
-"platyctenean",
-"Geordie",
-"domatium",
-"twenty-two rifle",
-"keteleeria",
-"sports editor",
-"chorus girl",
-"Hakham",
-"dry-bulb thermometer",
-"onomancer",
-"double-bitted ax",
-"Girondist",
-"bottle bank",
-"thyrsopteris",
-"bandwagon",
-"star anise",
-"armored car",
-"dhawa",
-"Bessemer converter",
-"mutineer",
-"paradise tree",
-"tupik",
-"centurion",
-"mending",
-"chowchow",
-"margrave",
-"International Grandmaster",
-"African hemp",
-"catafalque",
-"leptodactylid frog",
-"forcemeat",
-"tank shell",
-"pill",
-"barbecue pit",
-"worthy",
-"lady's maid",
-"evergreen",
-"Jesuit",
-"South American staghorn",
-"rigger",
-"suffragan",
-"imperialist",
-"spherical angle",
-"grey lemming",
-"kitchen police",
-"tree swift",
-"coliphage",
-"archaist",
-"Conservative",
-"rib",
-"exegete",
-"Mendelian",
-"tragedian",
-"steerage",
-"Paleo-American",
-"obeche",
-"garlic",
-"grapefruit peel",
-"accommodating lens implant",
-"half blood",
-"barrelfish",
-"catgut",
-"lanceolate spleenwort",
-"hardliner",
-"frieze",
-"name dropper",
-"carrack",
-"huckster",
-"onion bread",
-"magnetic head",
-"pease pudding",
-"raisin moth",
-"negative magnetic pole",
-"electroencephalograph",
-"bunji-bunji",
-"synchroflash",
-"Mornay sauce",
-"stencil",
-"winged pigweed",
-"Nesselrode",
-"MEDLINE",
-"licorice",
-"mainspring",
-"melilotus",
-"duke",
-"experimenter",
-"Napier's bones",
-"four-minute man",
-"pin-tailed sandgrouse",
-"toolmaker",
-"pogge",
-"rootstock",
-"baton",
-"pricket",
-"creeping snowberry",
-"anomalops",
-"nester",
-"devourer",
-"apolemia",
-"Maricopa",
-"pine-barren sandwort",
-"larvacean",
-"American dewberry",
-"escalope de veau Orloff",
-"gig",
-"myrtle",
-"pitsaw",
-"Lutheran",
-"fish house punch",
-"gnathostome",
-"intake valve",
-"molasses taffy",
-"clammy locust",
-"vandyke beard",
-"Atlantic tripletail",
-"planktonic algae",
-"estradiol patch",
-"flummery",
-"cytologist",
-"sectarian",
-"oil meal",
-"tomtate",
-"mediterranean anchovy",
-"aspersorium",
-"argonaut",
-"porkholt",
-"sheep ked",
-"algometer",
-"Adventist",
-"false goatsbeard",
-"snake polypody",
-"streetwalker",
-"shelver",
-"adoptee",
-"highflier",
-"pitch apple",
-"prairie rocket",
-"fish mousse",
-"viroid",
-"deckle",
-"manila tamarind",
-"observer's meridian",
-"pincurl clip",
-"hardstem bulrush",
-"gossamer",
-"brookweed",
-"Druze",
-"hug-me-tight",
-"accessory before the fact",
-"oilman",
-"Comanche",
-"Marine",
-"bedlamite",
-"Chinese cork oak",
-"squawbush",
-"false miterwort",
-"walk-on",
-"Cynopterus sphinx",
-"brandyball",
-"landlubber",
-"arrowroot",
-"cape forget-me-not",
-"galoot",
-"tabor pipe",
-"checker",
-"Levant cotton",
-"paddle box",
-"murderess",
-"smirker",
-"fuddy-duddy",
-"withdrawer",
-"newel",
-"shade",
-"pink disease fungus",
-"tipu",
-"sweet sultan",
-"aeronautical engineer",
-"tall gallberry holly",
-"acarid",
-"conqueror",
-"cucumber",
-"film director",
-"ordinary",
-"salon",
-"closet queen",
-"allegorizer",
-"tonka bean",
-"flax rust",
-"negative pole",
-"dagame",
-"dentist's drill",
-"mock privet",
-"micropyle",
-"contributor",
-"dark horse",
-"climbing corydalis",
-"cosmotron",
-"land agent",
-"Big Blue",
-"Cynic",
-"tassel flower",
-"lyrate leaf",
-"Minuteman",
-"Dutch-elm beetle",
-"Hessian fly",
-"flower girl",
-"West-sider",
-"window dresser",
-"skinny-dipper",
-"whitebait",
-"out-and-outer",
-"hooker",
-"amicus curiae",
-"jack",
-"camwood",
-"stockist",
-"black root rot fungus",
-"Jamaica dogwood",
-"diaphragm",
-"Holocentrus ascensionis",
-"roselle",
-"black maire",
-"Pygmy",
-"fumigator",
-"lame duck",
-"mudder",
-"hydraulic transmission",
-"conning tower",
-"phoronid",
-"batfish",
-"hearing dog",
-"monohybrid",
-"whaling gun",
-"Cockcroft and Walton accelerator",
-"allemande",
-"seasoner",
-"epileptic",
-"ammonia clock",
-"Young Turk",
-"lanseh tree",
-"urceole",
-"cafe noir",
-"poster girl",
-"Oglala",
-"deadeye",
-"manna lichen",
-"positive pole",
-"cinch",
-"lyricist",
-"hermaphrodite",
-"kidney stone",
-"dilator",
-"number one",
-"frotteur",
-"kaffir bread",
-"fish knife",
-"tarragon",
-"adjuster",
-"potato wart fungus",
-"Florida pompano",
-"conductor",
-"corbie gable",
-"rounders",
-"Catha edulis",
-"bender",
-"recruit",
-"Uruguayan",
-"subject",
-"bunghole",
-"day boarder",
-"pocketed bat",
-"Oxonian",
-"owner-occupier",
-"yellow-leaf sickle pine",
-"devisor",
-"exhibitor",
-"looking glass",
-"shipowner",
-"crooked-stemmed aster",
-"calico",
-"dash-pot",
-"defilade",
-"Confucian",
-"egg-and-dart",
-"irreligionist",
-"lepton",
-"self-rising flour",
-"diving bell",
-"Brahui",
-"shop girl",
-"maximum and minimum thermometer",
-"Dalmatian laburnum",
-"correspondent",
-"subduer",
-"nonperson",
-"Reaumur thermometer",
-"rough-leaved aster",
-"jacksmelt",
-"pinfold",
-"magneto",
-"ex-wife",
-"round-leaved rein orchid",
-"purloo",
-"American shrew mole",
-"sweet sand verbena",
-"polymastigote",
-"outfitter",
-"curled leaf pondweed",
-"Italian dressing",
-"borderer",
-"ambusher",
-"geebung",
-"four-stroke engine",
-"small ship",
-"homeopath",
-"gynostegium",
-"political prisoner",
-"Radiigera fuscogleba",
-"ensiform leaf",
-"rhizoctinia",
-"satyr orchid",
-"rue",
-"bouillon cube",
-"flip",
-"prophyll",
-"tilefish",
-"periselene",
-"prima donna",
-"choker",
-"laminar flow clean room",
-"Hooker's orchid",
-"fish joint",
-"mombin",
-"remover",
-"array",
-"coelostat",
-"autophyte",
-"consigner",
-"Damaraland mole rat",
-"gasman",
-"public works",
-"lye hominy",
-"pearlfish",
-"piassava palm",
-"Georgian",
-"uxoricide",
-"confessor",
-"community center",
-"epigone",
-"tagger",
-"abrading stone",
-"cryoscope",
-"nautch girl",
-"reliever",
-"Cartesian",
-"Indian beech",
-"protoplasmic astrocyte",
-"fundamentalist",
-"mustard sauce",
-"crank",
-"houselights",
-"five-point bishop's cap",
-"comedienne",
-"triangle",
-"presentist",
-"beaugregory",
-"dreamer",
-"Wave",
-"blue mockingbird",
-"Barbados gooseberry",
-"ten-spined stickleback",
-"papoose",
-"silky pocket mouse",
-"holdup man",
-"agent-in-place",
-"suspensory",
-"emigrant",
-"ropemaker",
-"bookbinder",
-"jumby bead",
-"undershrub",
-"Killarney fern",
-"sheep bell",
-"city slicker",
-"equerry",
-"pea crab",
-"down-and-out",
-"blackmouth bass",
-"shirtmaker",
-"lister",
-"UNIX guru",
-"snipefish",
-"gimbal",
-"maisonette",
-"haircloth",
-"Ranvier's nodes",
-"pigmy talinum",
-"tribute album",
-"msasa",
-"hydroxide ion",
-"madame",
-"four-pounder",
-"prophet",
-"sloganeer",
-"field-effect transistor",
-"nude mouse",
-"canteen",
-"Calostoma lutescens",
-"buteonine",
-"sunlamp",
-"Uruguay potato",
-"Spanish tamarind",
-"Prince-of-Wales'-heath",
-"kishke",
-"caprifig",
-"chincapin",
-"hegari",
-"alarmist",
-"bathtub gin",
-"astatic galvanometer",
-"Calostoma ravenelii",
-"marang",
-"tussah",
-"coin box",
-"bugleweed",
-"hacker",
-"frontal eminence",
-"timekeeper",
-"shunt",
-"bicycle clip",
-"mustang mint",
-"caesium clock",
-"hospice",
-"glenoid fossa",
-"archpriest",
-"ex-gambler",
-"incrustation",
-"salvager",
-"Donatist",
-"violator",
-"lamb succory",
-"hygroscope",
-"oilbird",
-"sharptail mola",
-"showplace",
-"corn syrup",
-"flashlight fish",
-"pulse timing circuit",
-"anchovy paste",
-"fascista",
-"chigoe",
-"divan",
-"Druid",
-"squad room",
-"Huntingdon elm",
-"buffalo carpet beetle",
-"carper",
-"corn lily",
-"goats' milk",
-"assault gun",
-"cockpit",
-"Lochaber ax",
-"Visigoth",
-"occupier",
-"Basotho",
-"criminologist",
-"spindle",
-"Rosicrucian",
-"Cornishwoman",
-"musk kangaroo",
-"artificial skin",
-"pandurate leaf",
-"Parkia javanica",
-"roundhead",
-"tea-like drink",
-"basidiolichen",
-"unguiculate",
-"stepmother",
-"Nauruan",
-"gutta-percha tree",
-"bloodberry",
-"scarlet haw",
-"marupa",
-"censor",
-"algebraist",
-"pelvimeter",
-"whaler",
-"cowhide",
-"paparazzo",
-"biochip",
-"internationalist",
-"Yukon white birch",
-"hangar queen",
-"chlamydia",
-"puttee",
-"Pipturus albidus",
-"pearly razorfish",
-"sea moss",
-"burglar",
-"hoary golden bush",
-"colter",
-"drey",
-"bushman's poison",
-"maxillaria",
-"gnetum",
-"deadeye",
-"shittah",
-"swamp oak",
-"damper block",
-"deepwater squirrelfish",
-"truffle",
-"cangue",
-"paleolith",
-"lawyerbush",
-"sorehead",
-"Texas snowbell",
-"Tremella reticulata",
-"quarter",
-"keelboat",
-"dimity",
-"whiner",
-"Wagnerian",
-"myrmecophyte",
-"frontierswoman",
-"pyrometric cone",
-"big-tree plum",
-"puppy",
-"galbulus",
-"hod",
-"winceyette",
-"carriage wrench",
-"dictostylium",
-"farmland",
-"infanticide",
-"Jacob's rod",
-"threadfish",
-"monocline",
-"inamorato",
-"leaf miner",
-"purple cress",
-"passer",
-"black-fronted bush shrike",
-"silverrod",
-"bootmaker",
-"segregate",
-"captive",
-"Edmontonia",
-"spherometer",
-"television transmitter",
-"bladder",
-"Saratoga spittlebug",
-"dynamometer",
-"lodge",
-"smooth darling pea",
-"Cossack",
-"wake-up call",
-"Olmec",
-"sutler",
-"molasses kiss",
-"corner post",
-"rattlesnake weed",
-"yardmaster",
-"adder",
-"rhinoscope",
-"referral",
-"ulster",
-"pantaloon",
-"counterspy",
-"gadgeteer",
-"heart cherry",
-"hospital chaplain",
-"Clydesdale terrier",
-"plank-bed",
-"Russian thistle",
-"actinometer",
-"dyspeptic",
-"common wolffia",
-"firewall",
-"seidel",
-"potato moth",
-"soapweed",
-"seif dune",
-"thill",
-"cosmographer",
-"absolver",
-"halberdier",
-"fire control system",
-"kai apple",
-"bastard pennyroyal",
-"Big Brother",
-"broadcast journalist",
-"Albatrellus dispansus",
-"citrophilous mealybug",
-"split end",
-"nickel-iron battery",
-"Newtonian",
-"gas maser",
-"thumbstall",
-"anaspid",
-"dusky-footed wood rat",
-"latitudinarian",
-"flatbrod",
-"schizocarp",
-"niqaabi",
-"flight surgeon",
-"gyrocompass",
-"Polyporus tenuiculus",
-"Utopian",
-"mailboat",
-"spellbinder",
-"undercoat",
-"cassareep",
-"typical jerboa",
-"photocathode",
-"katharometer",
-"bight",
-"fur-piece",
-"penetration bomb",
-"malik",
-"Siberian millet",
-"nanomia",
-"Wykehamist",
-"tosser",
-"gyrostabilizer",
-"microwave diathermy machine",
-"crystal set",
-"wall",
-"legatee",
-"alfalfa",
-"angwantibo",
-"charioteer",
-"piano maker",
-"African mahogany",
-"Morlett's crocodile",
-"taro",
-"parallel circuit",
-"cush-cush",
-"etymologist",
-"matriculate",
-"neem seed",
-"cornerback",
-"kingfisher daisy",
-"redoubt",
-"blastomycete",
-"peplos",
-"costumier",
-"publican",
-"tobogganist",
-"semolina",
-"myrmidon",
-"parricide",
-"gymslip",
-"whoremaster",
-"cryptocoryne",
-"header",
-"platitudinarian",
-"barleycorn",
-"spiral bandage",
-"reciter",
-"abecedarian",
-"dance",
-"wrymouth",
-"bilberry",
-"Liopelma hamiltoni",
-"streamliner",
-"Fordhooks",
-"fixed phagocyte",
-"radiobiologist",
-"neurologist",
-"Selkup",
-"dollarfish",
-"cascade everlasting",
-"acrodont",
-"boarhound",
-"midstream",
-"theatrical producer",
-"abhorrer",
-"goldsmith",
-"photometrist",
-"Anglo-Saxon",
-"rugel's plantain",
-"sable",
-"workmate",
-"ferule",
-"ankus",
-"earleaved umbrella tree",
-"Passamaquody",
-"timucu",
-"Mexican pocket mouse",
-"yerba santa",
-"Rochon prism",
-"apomict",
-"monocarp",
-"sweet unicorn plant",
-"common winterberry holly",
-"archivist",
-"drypis",
-"paretic",
-"fly-by-night",
-"white-berry yew",
-"Schoolman",
-"blue cheese dressing",
-"vintager",
-"squatter",
-"Euphausia pacifica",
-"corrugated fastener",
-"yellow henbane",
-"Croesus",
-"almoner",
-"analphabet",
-"acoustic delay line",
-"sheep frog",
-"workhouse",
-"horseleech",
-"venturer",
-"pond-scum parasite",
-"Pyrenees daisy",
-"plagiarist",
-"Truncocolumella citrina",
-"rerebrace",
-"group captain",
-"caddis fly",
-"hot-rock penstemon",
-"kanzu",
-"stylopodium",
-"slopseller",
-"rauli beech",
-"starter",
-"ootid",
-"statesman",
-"distributor cam",
-"ascot",
-"falcon-gentle",
-"Duplicidentata",
-"spotted antbird",
-"heliometer",
-"false buckthorn",
-"Allegheny spurge",
-"Cavalier",
-"dart",
-"photocoagulator",
-"master-at-arms",
-"kei apple",
-"baldachin",
-"crapshooter",
-"gametangium",
-"white hope",
-"chipotle",
-"spike heath",
-"Scotch woodcock",
-"Florentine",
-"differential analyzer",
-"Mitrula elegans",
-"wet cell",
-"basil balm",
-"Circassian",
-"corn cake",
-"bouncing betty",
-"vice-regent",
-"lagerphone",
-"ketembilla",
-"whoremaster",
-"fork",
-"tetrasporangium",
-"trifler",
-"pill head",
-"life-support system",
-"quartermaster general",
-"tobacco thrips",
-"officeholder",
-"teredo",
-"toyon",
-"Sundacarpus amara",
-"Phytophthora citrophthora",
-"naif",
-"lobbyist",
-"alligator wrench",
-"bully",
-"heavy",
-"toxicologist",
-"radio chassis",
-"waterdog",
-"drive line",
-"kaffir cat",
-"foster-brother",
-"breakax",
-"curette",
-"traditionalist",
-"pipe vise",
-"striped button quail",
-"gawker",
-"homeotherm",
-"schoolyard",
-"battue",
-"kalansuwa",
-"deviationist",
-"Bolshevik",
-"transponder",
-"pungapung",
-"iron",
-"Eyeish",
-"roccella",
-"manglietia",
-"Tory",
-"print seller",
-"Texas Ranger",
-"otter shrew",
-"seconder",
-"shellflower",
-"outlier",
-"party man",
-"wold",
-"hayfork",
-"oncologist",
-"framer",
-"co-beneficiary",
-"ocean pout",
-"Chinese angelica",
-"scrimshaw",
-"air attache",
-"false gromwell",
-"standing press",
-"fringepod",
-"specifier",
-"automatic choke",
-"durum",
-"yenta",
-"wassailer",
-"reeler",
-"signora",
-"beach pancake",
-"common booklouse",
-"pellicle",
-"backroom boy",
-"den mother",
-"associate",
-"Unitarian",
-"gambist",
-"brookweed",
-"clubroom",
-"cat's-tail",
-"playboy",
-"self-registering thermometer",
-"doorstop",
-"bennet",
-"yak's milk",
-"escapee",
-"quail bush",
-"sparge pipe",
-"coast boykinia",
-"screw key",
-"half gainer",
-"aggravator",
-"cotton mill",
-"tailor's chalk",
-"free agent",
-"cotton mouse",
-"deadhead",
-"bunny",
-"turpentine camphor weed",
-"amaranth",
-"ceratodus",
-"red lauan",
-"beam-ends",
-"thermograph",
-"wally",
-"Toda",
-"handrest",
-"commissary",
-"oak-leaved goosefoot",
-"manufacturer",
-"voicer",
-"Jafnea semitosta",
-"bench hook",
-"finder",
-"abyssal zone",
-"rabbitwood",
-"Hercules'-club",
-"epicarp",
-"declinometer",
-"camp follower",
-"signaler",
-"Australian pea",
-"putz",
-"qadi",
-"banded palm civet",
-"egg timer",
-"regnellidium",
-"calisaya",
-"harvestfish",
-"sound spectrograph",
-"side-wheeler",
-"glomerule",
-"woolly rhinoceros",
-"Black Muslim",
-"horticulturist",
-"ornithomimid",
-"cryometer",
-"battlefront",
-"gametophyte",
-"airmailer",
-"cuisse",
-"nakedwood",
-"baseball club",
-"slasher",
-"anise",
-"leatherleaf",
-"leatherjacket",
-"horned pondweed",
-"gofer",
-"Saigon cinnamon",
-"barong",
-"blazer",
-"twinkler",
-"skeleton shrimp",
-"dial",
-"floorwalker",
-"case shot",
-"flannelbush",
-"cultivated parsnip",
-"Jane Doe",
-"few-flowered leek",
-"nogging",
-"placer miner",
-"muzzler",
-"serge",
-"lion-hunter",
-"capulin",
-"Wandering Jew",
-"ascidian tadpole",
-"hispid pocket mouse",
-"southern spatterdock",
-"milk wagon",
-"junior middleweight",
-"duck sauce",
-"promycelium",
-"protozoologist",
-"cascade liquefier",
-"tout",
-"longheaded thimbleweed",
-"charcoal burner",
-"footage",
-"slop",
-"bridge agent",
-"miller's-thumb",
-"Job's comforter",
-"marocain",
-"tanker plane",
-"lancetfish",
-"knocker",
-"toque",
-"ordinand",
-"umbrella bird",
-"favorite son",
-"hare's-foot bristle fern",
-"business traveler",
-"plotter",
-"Asiatic shrew mole",
-"tallyman",
-"stump",
-"Paleacrita vernata",
-"index register",
-"mortgagee",
-"accuser",
-"codger",
-"sand rat",
-"seaside centaury",
-"chiropractor",
-"Florida smoothhound",
-"dwarf sperm whale",
-"T-man",
-"sannup",
-"dragonhead",
-"numdah",
-"alkali grass",
-"gynobase",
-"kymograph",
-"ascolichen",
-"steward",
-"waterline",
-"Nazarene",
-"filer",
-"lapidary",
-"muncher",
-"wincey",
-"scyphus",
-"question master",
-"besieger",
-"worldling",
-"docent",
-"facing",
-"atmometer",
-"quern",
-"puerpera",
-"three-decker",
-"calliope",
-"wild red oat",
-"bailee",
-"flame pea",
-"cattle cake",
-"theist",
-"yellowtail flounder",
-"cosmopolitan",
-"rocket engineer",
-"vouchee",
-"Turkoman",
-"hard sauce",
-"Thousand Island dressing",
-"assayer",
-"messmate",
-"mutilator",
-"oyster bar",
-"flame tokay",
-"countess",
-"prairie mimosa",
-"microsporangium",
-"cotter",
-"townsman",
-"paring",
-"fundraiser",
-"simperer",
-"Comrade",
-"orlop deck",
-"power takeoff",
-"cattleship",
-"prime meridian",
-"Javanthropus",
-"scriptorium",
-"curandera",
-"long-clawed prawn",
-"maestro",
-"paster",
-"potato tuberworm",
-"chachka",
-"junkyard",
-"cape yellowwood",
-"reentrant polygon",
-"Liberian coffee",
-"restaurateur",
-"Alsophila pometaria",
-"Jekyll and Hyde",
-"electrophorus",
-"Scomberomorus maculatus",
-"manipulator",
-"gromwell",
-"chicken provencale",
-"ashram",
-"mangel-wurzel",
-"shamrock pea",
-"dossal",
-"adducer",
-"erection",
-"Mysore thorn",
-"smoothie",
-"chufa",
-"brace wrench",
-"victualer",
-"litterer",
-"linstock",
-"Protium guianense",
-"palfrey",
-"banyan",
-"klieg light",
-"dangleberry",
-"trooper",
-"yaupon holly",
-"quitter",
-"tradescant's aster",
-"nullipara",
-"melter",
-"devil's urn",
-"ghostwriter",
-"mouth",
-"analogist",
-"Creek",
-"sonic depth finder",
-"fucker",
-"locus of infection",
-"mortician",
-"esophageal smear",
-"locum tenens",
-"conic projection",
-"aroeira blanca",
-"bellarmine",
-"night porter",
-"automobile mechanic",
-"codpiece",
-"Munro",
-"cottonweed",
-"scoinson arch",
-"tinderbox",
-"frozen food",
-"waterproofing",
-"Egyptian henbane",
-"lash",
-"transactor",
-"American smooth dogfish",
-"existentialist",
-"grabber",
-"Sonoran lyre snake",
-"Rufous rubber cup",
-"colors",
-"weekend warrior",
-"power user",
-"perennial salt marsh aster",
-"Puritan",
-"Apalachicola rosemary",
-"anecdotist",
-"tosser",
-"moth bean",
-"agnostic",
-"stretcher-bearer",
-"browntail",
-"optimist",
-"brewer's mole",
-"astronomy satellite",
-"flat file",
-"rust mite",
-"tuberous plant",
-"day laborer",
-"buster",
-"trapezoid",
-"bevatron",
-"nonresident",
-"Streptomyces griseus",
-"mangosteen",
-"customer agent",
-"hero worshiper",
-"suicide bomber",
-"procellariiform seabird",
-"archiannelid",
-"reaction turbine",
-"distortionist",
-"bulldog wrench",
-"grainy club",
-"scalp",
-"Aztec",
-"scow",
-"globigerina",
-"pedant",
-"heartleaf manzanita",
-"kanchil",
-"low gallberry holly",
-"containment",
-"scandalmonger",
-"rose-colored starling",
-"Powhatan",
-"addle-head",
-"Chilean rimu",
-"Atlantic sea bream",
-"arthrospore",
-"ramrod",
-"root climber",
-"Kalapooia",
-"roach clip",
-"Schreiber's aster",
-"horseradish",
-"albino",
-"Kshatriya",
-"trombidiid",
-"blasting cap",
-"body pad",
-"brachium",
-"shallu",
-"Wynnea americana",
-"slender centaury",
-"munj",
-"upset",
-"wind tunnel",
-"cottonwick",
-"airing cupboard",
-"pepper shrub",
-"ambrosia",
-"languisher",
-"chosen",
-"rose globe lily",
-"purple apricot",
-"costia",
-"sloop of war",
-"sultana",
-"frontlet",
-"booster",
-"sargassum fish",
-"broad-leaved montia",
-"rifleman bird",
-"stillroom",
-"amoralist",
-"enginery",
-"meter maid",
-"fitment",
-"southern bog lemming",
-"Athenian",
-"clincher",
-"cusk-eel",
-"mackintosh",
-"diaphone",
-"corozo",
-"Australian reed grass",
-"czar",
-"spongioblast",
-"Eurafrican",
-"airhead",
-"Shahaptian",
-"Roman",
-"pollinium",
-"tourist class",
-"halogeton",
-"stamper",
-"emperor",
-"malingerer",
-"tramp steamer",
-"Peziza domicilina",
-"pilot cloth",
-"stenopterygius",
-"cost accountant",
-"Queen's Counsel",
-"wine-maker's yeast",
-"poppet",
-"cage",
-"rowlock arch",
-"landgrave",
-"bearded wheatgrass",
-"stink bell",
-"quaker",
-"undesirable",
-"algarroba",
-"resistance pyrometer",
-"exorcist",
-"carib wood",
-"guvnor",
-"border patrolman",
-"bathhouse",
-"licenser",
-"headman",
-"rentier",
-"pine spittlebug",
-"nut-leaved screw tree",
-"paraduodenal smear",
-"apron",
-"necker",
-"smilax",
-"Alpine besseya",
-"creeper",
-"castle",
-"ground bait",
-"Queensland grass-cloth plant",
-"sclerotium",
-"great yellowcress",
-"fat farm",
-"Stoker",
-"hoop snake",
-"elixir of life",
-"Trotskyite",
-"home buyer",
-"wheat berry",
-"Tutelo",
-"semi-climber",
-"utahraptor",
-"wet-bulb thermometer",
-"packrat",
-"hygrophyte",
-"darter",
-"sketcher",
-"refiner",
-"camlet",
-"midgrass",
-"compound",
-"tarwood",
-"Colorado River hemp",
-"toiler",
-"abstractor",
-"override",
-"dwarf pipefish",
-"plodder",
-"briefcase computer",
-"trunk hose",
-"brown butter",
-"valve-in-head engine",
-"cymbalist",
-"explosive detection system",
-"horsewoman",
-"boutonniere",
-"chinchilla",
-"venerator",
-"scourer",
-"exarch",
-"cohune nut",
-"ayapana",
-"continental divide",
-"cosigner",
-"stalker",
-"pyxie",
-"Genet",
-"Macowanites americanus",
-"open-hearth furnace",
-"water chestnut",
-"American frogbit",
-"tarwood",
-"cutter",
-"scout",
-"burr",
-"upsetter",
-"grist",
-"tagasaste",
-"mouthpiece",
-"palette",
-"rattan",
-"letterman",
-"Exmoor",
-"Methodist",
-"eelblenny",
-"marasca",
-"slide valve",
-"ventilation",
-"saddle hackle",
-"Yakut",
-"flux applicator",
-"air traveler",
-"murder suspect",
-"Cynocephalus variegatus",
-"idolizer",
-"Surgeon General",
-"nutlet",
-"little-head snakeweed",
-"germ tube",
-"fellow traveler",
-"raceabout",
-"commodore",
-"czar",
-"anamorphosis",
-"treelet",
-"girlfriend",
-"groundnut",
-"sideline",
-"giant star grass",
-"goffer",
-"spark lever",
-"oubliette",
-"processor",
-"tare",
-"plodder",
-"extremist",
-"Kipp's apparatus",
-"gripsack",
-"S wrench",
-"viscountess",
-"bridgehead",
-"cascarilla",
-"Asiatic flying squirrel",
-"protoceratops",
-"equerry",
-"difflugia",
-"princeling",
-"moonlighter",
-"aspergill",
-"common flat pea",
-"Utahan",
-"imperial mammoth",
-"plantain-leaved pussytoes",
-"Boott's goldenrod",
-"bootlegger",
-"reed pipe",
-"runcinate leaf",
-"onion salt",
-"nitrite bacterium",
-"introvert",
-"duck",
-"New World opah",
-"goliath frog",
-"heterostracan",
-"disrupting explosive",
-"haggler",
-"candlenut",
-"false bugbane",
-"returning officer",
-"eudiometer",
-"ship-breaker",
-"metazoan",
-"mandarin",
-"patka",
-"gill net",
-"cavity wall",
-"armilla",
-"rainmaker",
-"dealfish",
-"orderly",
-"gleaner",
-"muffin man",
-"house sitter",
-"alto",
-"sand devil's claw",
-"vulcanizer",
-"appendicularia",
-"boron chamber",
-"chess",
-"bitok",
-"anchovy butter",
-"dropout",
-"flour mill",
-"bishop",
-"escapist",
-"scapegrace",
-"stanhope",
-"smooth winterberry holly",
-"upstager",
-"stalking-horse",
-"pony",
-"prairie gourd",
-"parabolic mirror",
-"Polaroid",
-"slasher",
-"lap",
-"garlic butter",
-"sendee",
-"German millet",
-"hairy honeysuckle",
-"Swiss canton",
-"Scleroderma flavidium",
-"red goatfish",
-"telegraph plant",
-"Jungian",
-"garment cutter",
-"mallee hen",
-"stranger",
-"driveway",
-"schooner",
-"Paiute",
-"cisco",
-"trestlework",
-"sipper",
-"shanny",
-"romanticist",
-"Molly Miller",
-"mountain rimu",
-"odd-leg caliper",
-"bitumastic",
-"Western Australia coral pea",
-"labor coach",
-"latchkey",
-"harpulla",
-"solitary pussytoes",
-"chop-suey greens",
-"coil",
-"guimpe",
-"diapir",
-"Osage",
-"gutta-percha tree",
-"giant eland",
-"reticulation",
-"garden huckleberry",
-"quick study",
-"Hudson bay collared lemming",
-"coreligionist",
-"Lancastrian",
-"stumblebum",
-"omnirange",
-"seersucker",
-"Potemkin village",
-"Rhea Silvia",
-"symphonist",
-"bolti",
-"jaw",
-"jaconet",
-"page",
-"visiting fireman",
-"haulm",
-"p-n junction",
-"landlubber",
-"yellow jack",
-"triclinium",
-"souari",
-"invader",
-"fire walker",
-"Luddite",
-"Plott hound",
-"hemming-stitch",
-"winker",
-"star-duckweed",
-"craniometer",
-"Arabidopsis lyrata",
-"loser",
-"cypripedia",
-"trimmer arch",
-"cookhouse",
-"pink fivecorner",
-"transfer",
-"ringleader",
-"northern pocket gopher",
-"moke",
-"blockade-runner",
-"cyclostome",
-"web-spinning mite",
-"Whig",
-"transcriber",
-"malahini",
-"sawyer",
-"patent log",
-"paca",
-"tragedian",
-"thermojunction",
-"soffit",
-"black buffalo",
-"foreigner",
-"applecart",
-"brit",
-"pole horse",
-"white mullet",
-"argentinosaur",
-"Homo soloensis",
-"bounty hunter",
-"decumary",
-"hand",
-"paperboy",
-"Smitane",
-"windowpane",
-"Java man",
-"Wynnea sparassoides",
-"prune",
-"middy",
-"lilliputian",
-"sorb",
-"pyrostat",
-"guest worker",
-"hold",
-"leaseholder",
-"vegan",
-"humanist",
-"salinometer",
-"piton",
-"zygospore",
-"means",
-"night rider",
-"tetraspore",
-"archipelago",
-"radiomicrometer",
-"nitpicker",
-"spot weld",
-"slicer",
-"girlfriend",
-"round-tailed muskrat",
-"cock's eggs",
-"Shavian",
-"bay",
-"nuclear chemist",
-"planetarium",
-"hiccup nut",
-"Marylander",
-"milling",
-"microsporidian",
-"brown cup",
-"Strophanthus kombe",
-"little skate",
-"emancipator",
-"paperhanger",
-"archaeopteryx",
-"maigre",
-"Mastotermes electrodominicus",
-"procurer",
-"seizure-alert dog",
-"homeboy",
-"cotton strain",
-"mute",
-"siren",
-"spearnose bat",
-"phenacomys",
-"gayal",
-"arsenal",
-"pitchfork",
-"Port Jackson heath",
-"cud",
-"magnetic core memory",
-"interferometer",
-"water jacket",
-"account executive",
-"hodoscope",
-"window oyster",
-"sudatorium",
-"syncopator",
-"loment",
-"hypertensive",
-"smoothbark",
-"Geogia holly",
-"nailhead",
-"African holly",
-"musette",
-"chafeweed",
-"microflora",
-"derrick",
-"strawworm",
-"shogun",
-"queen post",
-"jerboa kangaroo",
-"columbo",
-"royal",
-"sourball",
-"solenogaster",
-"cardsharp",
-"Homo habilis",
-"intaglio",
-"calf's-foot jelly",
-"flotsam",
-"skirret",
-"baronduki",
-"chyme",
-"shovel hat",
-"Welsh",
-"monoplane flying fish",
-"groundfish",
-"tablet-armed chair",
-"swan dive",
-"Indian club",
-"colonial",
-"cassiri",
-"pyramidal tent",
-"praya",
-"silk vine",
-"time clock",
-"button snakeroot",
-"clews",
-"Korean lespedeza",
-"diffuser",
-"ripping bar",
-"puttyroot",
-"nipple shield",
-"headpin",
-"juneberry holly",
-"hub-and-spoke",
-"laver",
-"weldment",
-"plain flour",
-"hoosegow",
-"dudeen",
-"grey skate",
-"line of life",
-"mung",
-"arariba",
-"Newtown Wonder",
-"rock candy",
-"side chapel",
-"castor sugar",
-"narrow-leaved white-topped aster",
-"babassu nut",
-"puka",
-"rings",
-"catchall",
-"heat shield",
-"caroche",
-"oxbow",
-"Australian coral snake",
-"tapper",
-"sporangiophore",
-"fenugreek",
-"spruce gall aphid",
-"gouache",
-"cutoff",
-"private line",
-"pod",
-"cargo hatch",
-"nailhead",
-"penile implant",
-"geophyte",
-"small-leaved linden",
-"deepwater pipefish",
-"paperhanger",
-"hairy spurge",
-"Persian lamb",
-"subtropics",
-"feed grain",
-"clarence",
-"nonparticipant",
-"scorpioid cyme",
-"hand brake",
-"tiller",
-"Geglossaceae",
-"albacore",
-"monochrome",
-"goa bean",
-"bur",
-"tongue worm",
-"psittacosaur",
-"frog's lettuce",
-"pectoral",
-"terreplein",
-"light filter",
-"fishpaste",
-"dry point",
-"grison",
-"feterita",
-"dolichocephalic",
-"oenomel",
-"stretcher",
-"swag",
-"cheval-de-frise",
-"mountain beaver",
-"scammony",
-"discus",
-"leatherleaf saxifrage",
-"wharf rat",
-"Dominique",
-"pelycosaur",
-"depth gauge",
-"bishop",
-"archespore",
-"true anomaly",
-"silver jenny",
-"mercy seat",
-"kelp",
-"oviraptorid",
-"acrylic",
-"Chinese pea tree",
-"meat house",
-"bilge well",
-"Temperate Zone",
-"whale louse",
-"balbriggan",
-"briefcase bomb",
-"pump-type pliers",
-"oil",
-"sour gourd",
-"Jewbush",
-"lunette",
-"Chinese paddlefish",
-"pyxidium",
-"beechnut",
-"calabar bean",
-"grugru nut",
-"gib",
-"blunt file",
-"cataphyll",
-"megasporangium",
-"blockbuster",
-"sliding seat",
-"hogchoker",
-"calceus",
-"Connarus guianensis",
-"honest woman",
-"survivor",
-"second balcony",
-"tempera",
-"Calvary clover",
-"murine",
-"outwork",
-"bogy",
-"elephant's-foot",
-"conning tower",
-"set square",
-"blackfly",
-"stirk",
-"Streptomyces erythreus",
-"blade",
-"goldfield",
-"snowball",
-"mortal enemy",
-"waltzer",
-"shoal",
-"galley",
-"hitchhiker",
-"lithophyte",
-"brisling",
-"scauper",
-"esophagoscope",
-"grab",
-"subtracter",
-"philosopher",
-"duplex apartment",
-"southeastern pocket gopher",
-"bonduc nut",
-"reverberatory furnace",
-"grader",
-"lamp house",
-"northern bog lemming",
-"brotula",
-"ornithopod",
-"ptyalith",
-"obturator",
-"perpetual motion machine",
-"range pole",
-"Africander",
-"curvet",
-"daisy print wheel",
-"floor",
-"collector",
-"mutant",
-"tuck",
-"fore-and-after",
-"senega",
-"buckler mustard",
-"louvar",
-"Tarsius glis",
-"culdoscope",
-"Spanish fly",
-"steering gear",
-"hatchet man",
-"museum",
-"saw set",
-"cambric tea",
-"comber",
-"thermohydrometer",
-"stationer",
-"chalcis fly",
-"bryanthus",
-"whipstitch",
-"harvest mite",
-"rock gunnel",
-"time bomb",
-"rariora",
-"pigfish",
-"apetalous flower",
-"head shop",
-"horned whiff",
-"sandpit",
-"tachistoscope",
-"sundries",
-"taffrail",
-"caller",
-"monofocal lens implant",
-"Dover's powder",
-"souari nut",
-"crowbait",
-"render",
-"Shakespearian",
-"hagberry",
-"megatherian",
-"magus",
-"hatchel",
-"mangabey",
-"garroter",
-"piedmont",
-"cope",
-"barrio",
-"psychodid",
-"rigout",
-"distributor",
-"croupier's rake",
-"sarcenet",
-"narrow-leaved water plantain",
-"treenail",
-"biped",
-"lanternfish",
-"overdrive",
-"barndoor skate",
-"picket boat",
-"amber lily",
-"sawpit",
-"sand lance",
-"bucket shop",
-"common beech",
-"laundry truck",
-"surtout",
-"grogram",
-"tampion",
-"escape hatch",
-"interstice",
-"shop bell",
-"snake mackerel",
-"nakedwood",
-"tumbrel",
-"mericarp",
-"mountain paca",
-"cab",
-"big board",
-"cringle",
-"eusporangium",
-"shipping room",
-"coal chute",
-"dumbwaiter",
-"Smiledon californicus",
-"man-at-arms",
-"cartridge",
-"deinonychus",
-"pigeon pea",
-"screw bean",
-"spectacle",
-"floorboard",
-"cutting room",
-"low-warp-loom",
-"proconsul",
-"sabicu",
-"genipap",
-"clapper",
-"aquifer",
-"archaeornis",
-"belly flop",
-"Protium heptaphyllum",
-"interrupter",
-"high-warp loom",
-"knight",
-"wiper",
-"impression",
-"poker",
-"Pithecanthropus",
-"sable",
-"guardroom",
-"tenter",
-"wellhead",
-"raja",
-"strickle",
-"sodomite",
-"mountebank",
-"sand leek",
-"Barbados gooseberry",
-"shuffler",
-"sensory fiber",
-"crab-eating opossum",
-"etching",
-"rare bird",
-"scup",
-"fagot",
-"negro vine",
-"hutment",
-"droshky",
-"nephoscope",
-"lady chapel",
-"cutty stool",
-"release",
-"vestiture",
-"buff",
-"standard",
-"Tabernacle",
-"vascular ray",
-"snakewood",
-"chlorobenzylidenemalononitrile",
-"limnologist",
-"pouched mole",
-"microwave linear accelerator",
-"Mastotermes darwiniensis",
-"wind tee",
-"orange bat",
-"open sight",
-"carpospore",
-"rampant arch",
-"sabbatia",
-"cursor",
-"post exchange",
-"bellpull",
-"center",
-"cyclostyle",
-"canonist",
-"pygmy sperm whale",
-"moa",
-"king",
-"pass-through",
-"angioscope",
-"marrow",
-"hookup",
-"revetment",
-"acanthocephalan",
-"good Samaritan",
-"apatosaur",
-"web spinner",
-"dixie",
-"ommastrephes",
-"crossbench",
-"candlewick",
-"jack",
-"light arm",
-"caisson",
-"kaki",
-"quandong nut",
-"Meuniere butter",
-"coquilla nut",
-"mast",
-"black",
-"twitterer",
-"bluethroat pikeblenny",
-"shielding",
-"water-shield",
-"urolith",
-"elephant bird",
-"clearway",
-"dark lantern",
-"schizopetalon",
-"press",
-"Nazi",
-"sugarberry",
-"Maltese",
-"stevedore",
-"hair shirt",
-"party wall",
-"gainer",
-"blackheart",
-"nothosaur",
-"cavetto",
-"evergreen bittersweet",
-"chemical bomb",
-"calpac",
-"shingle",
-"turnpike",
-"animator",
-"heaver",
-"isoclinic line",
-"death knell",
-"liner",
-"anathema",
-"aerie",
-"razorback",
-"Ichyostega",
-"pound net",
-"French dressing",
-"mottle",
-"yard",
-"string tie",
-"bell seat",
-"brattice",
-"battering ram",
-"sierra",
-"pompon",
-"vertex",
-"stomach pump",
-"electrolytic cell",
-"escolar",
-"telpher",
-"roadhouse",
-"cerecloth",
-"tartare sauce",
-"letter case",
-"whale sucker",
-"hob",
-"teg",
-"canvas",
-"strickle",
-"hectograph",
-"Cartagena bark",
-"mail car",
-"acinus",
-"freedom rider",
-"bread sauce",
-"picture window",
-"Rhizopogon idahoensis",
-"pinprick",
-"mass spectrograph",
-"ringer",
-"devil's cigar",
-"salad cream",
-"marlberry",
-"airbrake",
-"Clark cell",
-"yellow-throated marten",
-"wire gauge",
-"dinoceras",
-"aba",
-"harpoon log",
-"plate rail",
-"mustard plaster",
-"coelophysis",
-"journal box",
-"puce",
-"ballcock",
-"quartering",
-"izar",
-"clinid",
-"whirler",
-"turnspit",
-"deathbed",
-"pottle",
-"shot",
-"doubler",
-"Coryphaena equisetis",
-"English sole",
-"chicken feed",
-"borrow pit",
-"mylodontid",
-"Chilean nut",
-"Kundt's tube",
-"ling",
-"asthenosphere",
-"reseau",
-"death seat",
-"immovable bandage",
-"peppermint patty",
-"lecturer",
-"electron multiplier",
-"bear claw",
-"hyacinth",
-"beaked salmon",
-"toehold",
-"scull",
-"snowball",
-"gangsaw",
-"fiber",
-"oxeye",
-"lashing",
-"Beckman thermometer",
-"fence",
-"cantilever",
-"dinner theater",
-"Reynard",
-"jag",
-"umbrella plant",
-"camera lucida",
-"beaver",
-"slug",
-"yellowfin croaker",
-"Sibley tent",
-"rat-tail file",
-"anchovy pear",
-"soldier",
-"cackler",
-"chaise",
-"Pitot-static tube",
-"minniebush",
-"Episcopalian",
-"oleaster",
-"ejaculator",
-"wavy-leaved aster",
-"knight",
-"rack",
-"real storage",
-"magnetic mine",
-"cocoa plum",
-"vesiculovirus",
-"birch leaf miner",
-"water chevrotain",
-"rudapithecus",
-"torpedo tube",
-"itch mite",
-"warren",
-"loft",
-"washerman",
-"terrace",
-"nonstarter",
-"shit",
-"platform",
-"caudex",
-"ground control",
-"Ostariophysi",
-"slopshop",
-"Peruvian cotton",
-"crystal oscillator",
-"plastic bomb",
-"bar bit",
-"watering cart",
-"Asiatic sweetleaf",
-"artificial joint",
-"chariot",
-"casern",
-"charge-exchange accelerator",
-"display adapter",
-"hornpipe",
-"honey bell",
-"planula",
-"Nephthytis afzelii",
-"hame",
-"ranter",
-"trachodon",
-"synchrocyclotron",
-"splasher",
-"heterotroph",
-"Nicol prism",
-"Himalayan rhubarb",
-"headfast",
-"put-put",
-"bitter almond",
-"parr",
-"scantling",
-"power breakfast",
-"madder",
-"Catalpa bignioides",
-"rose of Jericho",
-"spark chamber",
-"rhizome",
-"beard worm",
-"supper club",
-"negro peach",
-"keratoscope",
-"wain",
-"apple aphid",
-"planking",
-"time-delay measuring instrument",
-"sternpost",
-"sicklepod",
-"lake bed",
-"gatherer",
-"monotype",
-"dead-man's float",
-"poison gas",
-"dicynodont",
-"organism",
-"cell",
-"person",
-"animal",
-"plant",
-"food",
-"artifact",
-"dressage",
-"contact sport",
-"outdoor sport",
-"gymnastics",
-"track and field",
-"jumping",
-"high jump",
-"skiing",
-"water sport",
-"swimming",
-"dive",
-"floating",
-"skin diving",
-"rowing",
-"boxing",
-"sledding",
-"tobogganing",
-"wrestling",
-"skating",
-"ice skating",
-"roller skating",
-"racing",
-"boat racing",
-"riding",
-"equestrian sport",
-"cycling",
-"blood sport",
-"hunt",
-"fishing",
-"angling",
-"casting",
-"athletic game",
-"outdoor game",
-"golf",
-"field game",
-"field hockey",
-"football",
-"American football",
-"ball game",
-"baseball",
-"court game",
-"badminton",
-"basketball",
-"tennis",
-"sport",
-"Seder",
-"scavenger",
-"bottom-feeder",
-"work animal",
-"beast of burden",
-"pack animal",
-"domestic animal",
-"marine animal",
-"female",
-"male",
-"young",
-"young mammal",
-"pup",
-"cub",
-"lion cub",
-"tiger cub",
-"microorganism",
-"arbovirus",
-"herpes",
-"herpes zoster",
-"reovirus",
-"moneran",
-"cyanobacteria",
-"enteric bacteria",
-"actinomycete",
-"streptomyces",
-"diplococcus",
-"parasite",
-"ectoparasite",
-"protoctist",
-"protozoan",
-"sarcodinian",
-"ameba",
-"ciliate",
-"alga",
-"brown algae",
-"green algae",
-"sporozoan",
-"cypriniform fish",
-"cyprinid",
-"carp",
-"domestic carp",
-"shiner",
-"catostomid",
-"buffalo fish",
-"cyprinodont",
-"killifish",
-"topminnow",
-"squirrelfish",
-"stickleback",
-"pipefish",
-"embryo",
-"fetus",
-"blastula",
-"chordate",
-"cephalochordate",
-"tunicate",
-"ascidian",
-"vertebrate",
-"aquatic vertebrate",
-"jawless vertebrate",
-"lamprey",
-"hagfish",
-"cartilaginous fish",
-"holocephalan",
-"chimaera",
-"elasmobranch",
-"shark",
-"mackerel shark",
-"mako",
-"requiem shark",
-"dogfish",
-"smooth dogfish",
-"spiny dogfish",
-"smooth hammerhead",
-"smalleye hammerhead",
-"shovelhead",
-"ray",
-"sawfish",
-"roughtail stingray",
-"butterfly ray",
-"eagle ray",
-"manta",
-"skate",
-"bird",
-"gamecock",
-"night bird",
-"ratite",
-"passerine",
-"oscine",
-"accentor",
-"lark",
-"pipit",
-"finch",
-"canary",
-"dark-eyed junco",
-"New World sparrow",
-"bunting",
-"honeycreeper",
-"sparrow",
-"grosbeak",
-"towhee",
-"weaver",
-"grassfinch",
-"tyrannid",
-"New World flycatcher",
-"kingbird",
-"pewee",
-"cotinga",
-"antbird",
-"Old World flycatcher",
-"thrush",
-"nightingale",
-"Old World chat",
-"warbler",
-"kinglet",
-"Old World warbler",
-"New World warbler",
-"flycatching warbler",
-"New World chat",
-"yellowthroat",
-"New World oriole",
-"northern oriole",
-"meadowlark",
-"New World blackbird",
-"grackle",
-"Old World oriole",
-"starling",
-"myna",
-"corvine bird",
-"crow",
-"Old World jay",
-"common European jay",
-"New World jay",
-"blue jay",
-"Canada jay",
-"Rocky Mountain jay",
-"nutcracker",
-"European magpie",
-"American magpie",
-"Australian magpie",
-"wren",
-"marsh wren",
-"thrasher",
-"New Zealand wren",
-"creeper",
-"titmouse",
-"black-capped chickadee",
-"Carolina chickadee",
-"swallow",
-"martin",
-"tanager",
-"shrike",
-"butcherbird",
-"bush shrike",
-"bowerbird",
-"European water ouzel",
-"American water ouzel",
-"vireo",
-"waxwing",
-"bird of prey",
-"hawk",
-"black kite",
-"swallow-tailed kite",
-"white-tailed kite",
-"harrier",
-"falcon",
-"peregrine",
-"caracara",
-"eagle",
-"young bird",
-"sea eagle",
-"Aegypiidae",
-"Old World vulture",
-"griffon vulture",
-"bearded vulture",
-"Egyptian vulture",
-"black vulture",
-"New World vulture",
-"buzzard",
-"condor",
-"Andean condor",
-"California condor",
-"black vulture",
-"king vulture",
-"owl",
-"horned owl",
-"scops owl",
-"amphibian",
-"salamander",
-"newt",
-"Pacific newt",
-"ambystomid",
-"climbing salamander",
-"web-toed salamander",
-"frog",
-"true frog",
-"true toad",
-"spadefoot",
-"tree toad",
-"cricket frog",
-"tongueless frog",
-"reptile",
-"anapsid",
-"diapsid",
-"chelonian",
-"turtle",
-"sea turtle",
-"ridley",
-"snapping turtle",
-"musk turtle",
-"diamondback terrapin",
-"Western box turtle",
-"tortoise",
-"soft-shelled turtle",
-"saurian",
-"lizard",
-"gecko",
-"iguanid",
-"spiny lizard",
-"fence lizard",
-"horned lizard",
-"skink",
-"teiid lizard",
-"racerunner",
-"plateau striped whiptail",
-"Chihuahuan spotted whiptail",
-"western whiptail",
-"checkered whiptail",
-"agamid",
-"moloch",
-"anguid lizard",
-"venomous lizard",
-"lacertid lizard",
-"chameleon",
-"monitor",
-"crocodilian reptile",
-"crocodile",
-"alligator",
-"caiman",
-"armored dinosaur",
-"ankylosaur",
-"bone-headed dinosaur",
-"ceratopsian",
-"hadrosaur",
-"saurischian",
-"sauropod",
-"theropod",
-"ceratosaur",
-"maniraptor",
-"synapsid",
-"pterosaur",
-"ichthyosaur",
-"snake",
-"colubrid snake",
-"smooth green snake",
-"rough green snake",
-"racer",
-"blacksnake",
-"whip-snake",
-"rat snake",
-"bull snake",
-"common kingsnake",
-"milk snake",
-"common garter snake",
-"ribbon snake",
-"Western ribbon snake",
-"common water snake",
-"water moccasin",
-"grass snake",
-"viperine grass snake",
-"sand snake",
-"lyre snake",
-"blind snake",
-"indigo snake",
-"constrictor",
-"boa",
-"python",
-"elapid",
-"coral snake",
-"coral snake",
-"cobra",
-"mamba",
-"black mamba",
-"krait",
-"viper",
-"pit viper",
-"rattlesnake",
-"timber rattlesnake",
-"arthropod",
-"arachnid",
-"false scorpion",
-"whip-scorpion",
-"spider",
-"European wolf spider",
-"acarine",
-"hard tick",
-"Ixodes dammini",
-"Ixodes neotomae",
-"Ixodes pacificus",
-"Ixodes scapularis",
-"sheep-tick",
-"Ixodes persulcatus",
-"Ixodes dentatus",
-"Ixodes spinipalpis",
-"wood tick",
-"soft tick",
-"mite",
-"trombiculid",
-"spider mite",
-"house centipede",
-"gallinaceous bird",
-"domestic fowl",
-"jungle fowl",
-"chicken",
-"cock",
-"hen",
-"turkey",
-"grouse",
-"European black grouse",
-"Asian black grouse",
-"blackcock",
-"greyhen",
-"red grouse",
-"moorhen",
-"greater prairie chicken",
-"lesser prairie chicken",
-"heath hen",
-"guan",
-"chachalaca",
-"megapode",
-"mallee fowl",
-"phasianid",
-"pheasant",
-"bobwhite",
-"northern bobwhite",
-"Old World quail",
-"migratory quail",
-"peafowl",
-"California quail",
-"Hungarian partridge",
-"red-legged partridge",
-"Greek partridge",
-"mountain quail",
-"guinea fowl",
-"columbiform bird",
-"pigeon",
-"dove",
-"turtledove",
-"domestic pigeon",
-"homing pigeon",
-"sandgrouse",
-"parrot",
-"cockatoo",
-"lory",
-"varied Lorikeet",
-"rainbow lorikeet",
-"parakeet",
-"cuculiform bird",
-"cuckoo",
-"crow pheasant",
-"coraciiform bird",
-"roller",
-"kingfisher",
-"hoopoe",
-"apodiform bird",
-"swift",
-"Archilochus colubris",
-"thornbill",
-"goatsucker",
-"piciform bird",
-"woodpecker",
-"flicker",
-"sapsucker",
-"toucanet",
-"trogon",
-"quetzal",
-"aquatic bird",
-"waterfowl",
-"anseriform bird",
-"duck",
-"teal",
-"widgeon",
-"sheldrake",
-"goldeneye",
-"scaup",
-"wood duck",
-"sea duck",
-"scoter",
-"merganser",
-"gosling",
-"gander",
-"Chinese goose",
-"greylag",
-"blue goose",
-"snow goose",
-"brant",
-"common brant goose",
-"honker",
-"barnacle goose",
-"swan",
-"tundra swan",
-"screamer",
-"crested screamer",
-"mammal",
-"prototherian",
-"monotreme",
-"marsupial",
-"opossum",
-"bandicoot",
-"kangaroo",
-"common wallaby",
-"hare wallaby",
-"nail-tailed wallaby",
-"rock wallaby",
-"pademelon",
-"tree wallaby",
-"rat kangaroo",
-"phalanger",
-"dasyurid marsupial",
-"dasyure",
-"placental",
-"calf",
-"buck",
-"insectivore",
-"mole",
-"shrew mole",
-"shrew",
-"water shrew",
-"tenrec",
-"invertebrate",
-"sponge",
-"glass sponge",
-"coelenterate",
-"Chrysaora quinquecirrha",
-"hydrozoan",
-"siphonophore",
-"anthozoan",
-"actinia",
-"coral",
-"gorgonian",
-"stony coral",
-"ctenophore",
-"worm",
-"planarian",
-"fluke",
-"liver fluke",
-"Fasciolopsis buski",
-"schistosome",
-"tapeworm",
-"echinococcus",
-"taenia",
-"common roundworm",
-"chicken roundworm",
-"pinworm",
-"eelworm",
-"vinegar eel",
-"trichina",
-"hookworm",
-"filaria",
-"Guinea worm",
-"annelid",
-"oligochaete",
-"polychaete",
-"leech",
-"mollusk",
-"scaphopod",
-"gastropod",
-"abalone",
-"scorpion shell",
-"giant conch",
-"edible snail",
-"garden snail",
-"brown snail",
-"Helix hortensis",
-"seasnail",
-"neritid",
-"limpet",
-"Hermissenda crassicornis",
-"cowrie",
-"bivalve",
-"clam",
-"quahog",
-"cockle",
-"oyster",
-"mussel",
-"marine mussel",
-"freshwater mussel",
-"scallop",
-"shipworm",
-"cephalopod",
-"octopod",
-"decapod",
-"squid",
-"crustacean",
-"malacostracan crustacean",
-"decapod crustacean",
-"crab",
-"swimming crab",
-"spider crab",
-"lobster",
-"true lobster",
-"Old World crayfish",
-"American crayfish",
-"shrimp",
-"prawn",
-"krill",
-"stomatopod",
-"mantis shrimp",
-"woodlouse",
-"pill bug",
-"sow bug",
-"sea louse",
-"amphipod",
-"copepod",
-"barnacle",
-"wading bird",
-"stork",
-"ibis",
-"common spoonbill",
-"roseate spoonbill",
-"heron",
-"egret",
-"night heron",
-"American bittern",
-"European bittern",
-"least bittern",
-"whooping crane",
-"rail",
-"crake",
-"gallinule",
-"purple gallinule",
-"coot",
-"great bustard",
-"plain turkey",
-"button quail",
-"trumpeter",
-"seabird",
-"shorebird",
-"plover",
-"turnstone",
-"sandpiper",
-"yellowlegs",
-"ruff",
-"tattler",
-"woodcock",
-"snipe",
-"greyback",
-"red-breasted snipe",
-"curlew",
-"godwit",
-"stilt",
-"stilt",
-"phalarope",
-"courser",
-"coastal diving bird",
-"larid",
-"gull",
-"tern",
-"jaeger",
-"skua",
-"auk",
-"guillemot",
-"murre",
-"puffin",
-"gaviiform seabird",
-"podicipitiform seabird",
-"grebe",
-"pelecaniform seabird",
-"white pelican",
-"Old world white pelican",
-"gannet",
-"snakebird",
-"sphenisciform seabird",
-"penguin",
-"pelagic bird",
-"wandering albatross",
-"black-footed albatross",
-"petrel",
-"shearwater",
-"storm petrel",
-"aquatic mammal",
-"cetacean",
-"whale",
-"baleen whale",
-"rorqual",
-"toothed whale",
-"beaked whale",
-"dolphin",
-"bottlenose dolphin",
-"porpoise",
-"sea cow",
-"carnivore",
-"pinniped mammal",
-"seal",
-"eared seal",
-"fur seal",
-"fur seal",
-"South American sea lion",
-"California sea lion",
-"Australian sea lion",
-"Steller sea lion",
-"earless seal",
-"walrus",
-"canine",
-"bitch",
-"dog",
-"cur",
-"toy dog",
-"toy spaniel",
-"English toy spaniel",
-"hunting dog",
-"hound",
-"coonhound",
-"dachshund",
-"foxhound",
-"wolfhound",
-"greyhound",
-"terrier",
-"bullterrier",
-"rat terrier",
-"Manchester terrier",
-"fox terrier",
-"wirehair",
-"Welsh terrier",
-"schnauzer",
-"Skye terrier",
-"sporting dog",
-"retriever",
-"pointer",
-"setter",
-"spaniel",
-"springer spaniel",
-"water spaniel",
-"working dog",
-"watchdog",
-"shepherd dog",
-"Belgian sheepdog",
-"pinscher",
-"Sennenhunde",
-"mastiff",
-"bulldog",
-"guide dog",
-"sled dog",
-"liver-spotted dalmatian",
-"spitz",
-"griffon",
-"corgi",
-"poodle",
-"wolf",
-"coydog",
-"wild dog",
-"striped hyena",
-"brown hyena",
-"spotted hyena",
-"aardwolf",
-"fox",
-"black fox",
-"silver fox",
-"blue fox",
-"feline",
-"cat",
-"domestic cat",
-"tom",
-"blue point Siamese",
-"wildcat",
-"common lynx",
-"Canada lynx",
-"bobcat",
-"spotted lynx",
-"caracal",
-"big cat",
-"leopardess",
-"panther",
-"lioness",
-"lionet",
-"Bengal tiger",
-"tigress",
-"saber-toothed tiger",
-"bear",
-"Syrian bear",
-"grizzly",
-"Alaskan brown bear",
-"cinnamon bear",
-"viverrine",
-"civet",
-"Indian mongoose",
-"ichneumon",
-"slender-tailed meerkat",
-"suricate",
-"bat",
-"fruit bat",
-"carnivorous bat",
-"leafnose bat",
-"false vampire",
-"vespertilian bat",
-"long-eared bat",
-"freetail",
-"vampire bat",
-"predator",
-"game",
-"game bird",
-"fossorial mammal",
-"tetrapod",
-"insect",
-"beetle",
-"two-spotted ladybug",
-"Mexican bean beetle",
-"Hippodamia convergens",
-"vedalia",
-"bombardier beetle",
-"calosoma",
-"searcher",
-"firefly",
-"sawyer",
-"pine sawyer",
-"flea beetle",
-"Colorado potato beetle",
-"carpet beetle",
-"clerid beetle",
-"lamellicorn beetle",
-"scarabaeid beetle",
-"scarab",
-"tumblebug",
-"dorbeetle",
-"June beetle",
-"melolonthid beetle",
-"elaterid beetle",
-"snout beetle",
-"boll weevil",
-"blister beetle",
-"bark beetle",
-"darkling beetle",
-"flour beetle",
-"seed beetle",
-"pea weevil",
-"bean weevil",
-"rice weevil",
-"louse",
-"flea",
-"dipterous insect",
-"gall midge",
-"housefly",
-"tsetse fly",
-"blowfly",
-"bluebottle",
-"greenbottle",
-"flesh fly",
-"tachina fly",
-"gadfly",
-"botfly",
-"human botfly",
-"sheep botfly",
-"warble fly",
-"horsefly",
-"bee fly",
-"fruit fly",
-"louse fly",
-"horn fly",
-"mosquito",
-"gnat",
-"fungus gnat",
-"hymenopterous insect",
-"drone",
-"worker",
-"honeybee",
-"Africanized bee",
-"black bee",
-"Carniolan bee",
-"Italian bee",
-"carpenter bee",
-"bumblebee",
-"cuckoo-bumblebee",
-"andrena",
-"Nomia melanderi",
-"leaf-cutting bee",
-"mason bee",
-"potter bee",
-"wasp",
-"vespid",
-"paper wasp",
-"hornet",
-"sphecoid wasp",
-"digger wasp",
-"chalcid fly",
-"sawfly",
-"pharaoh ant",
-"little black ant",
-"army ant",
-"carpenter ant",
-"fire ant",
-"wood ant",
-"slave ant",
-"Formica fusca",
-"slave-making ant",
-"sanguinary ant",
-"bulldog ant",
-"Amazon ant",
-"termite",
-"dry-wood termite",
-"orthopterous insect",
-"short-horned grasshopper",
-"locust",
-"migratory locust",
-"migratory grasshopper",
-"long-horned grasshopper",
-"katydid",
-"mormon cricket",
-"sand cricket",
-"mole cricket",
-"European house cricket",
-"field cricket",
-"tree cricket",
-"snowy tree cricket",
-"phasmid",
-"diapheromera",
-"oriental cockroach",
-"American cockroach",
-"Australian cockroach",
-"German cockroach",
-"giant cockroach",
-"praying mantis",
-"hemipterous insect",
-"leaf bug",
-"mirid bug",
-"lygus bug",
-"lygaeid",
-"coreid bug",
-"heteropterous insect",
-"water bug",
-"water strider",
-"assassin bug",
-"homopterous insect",
-"whitefly",
-"sweet-potato whitefly",
-"coccid insect",
-"scale insect",
-"soft scale",
-"armored scale",
-"mealybug",
-"plant louse",
-"aphid",
-"greenfly",
-"woolly aphid",
-"adelgid",
-"dog-day cicada",
-"seventeen-year locust",
-"spittle insect",
-"plant hopper",
-"psocopterous insect",
-"psocid",
-"booklouse",
-"ephemerid",
-"neuropteron",
-"green lacewing",
-"brown lacewing",
-"odonate",
-"trichopterous insect",
-"caseworm",
-"thysanuran insect",
-"bristletail",
-"thysanopter",
-"thrips",
-"earwig",
-"lepidopterous insect",
-"butterfly",
-"nymphalid",
-"fritillary",
-"emperor butterfly",
-"danaid",
-"pierid",
-"small white",
-"large white",
-"southern cabbage butterfly",
-"blue",
-"copper",
-"American copper",
-"hairstreak",
-"Strymon melinus",
-"moth",
-"tortricid",
-"lymantriid",
-"geometrid",
-"cankerworm",
-"pyralid",
-"tineoid",
-"tineid",
-"clothes moth",
-"gelechiid",
-"grain moth",
-"noctuid moth",
-"cutworm",
-"underwing",
-"hawkmoth",
-"bombycid",
-"saturniid",
-"giant silkworm moth",
-"silkworm",
-"arctiid",
-"lasiocampid",
-"tent caterpillar",
-"webworm",
-"webworm moth",
-"caterpillar",
-"bollworm",
-"woolly bear",
-"larva",
-"grub",
-"pupa",
-"queen",
-"echinoderm",
-"basket star",
-"edible sea urchin",
-"sand dollar",
-"heart urchin",
-"crinoid",
-"trepang",
-"lagomorph",
-"leporid",
-"rabbit",
-"eastern cottontail",
-"swamp rabbit",
-"marsh hare",
-"leveret",
-"European hare",
-"jackrabbit",
-"white-tailed jackrabbit",
-"blacktail jackrabbit",
-"polar hare",
-"snowshoe hare",
-"pika",
-"rodent",
-"mouse",
-"rat",
-"pocket rat",
-"field mouse",
-"brown rat",
-"jerboa rat",
-"water rat",
-"New World mouse",
-"wood mouse",
-"wood rat",
-"vole",
-"packrat",
-"Eurasian hamster",
-"golden hamster",
-"gerbil",
-"lemming",
-"pied lemming",
-"Old World porcupine",
-"brush-tailed porcupine",
-"long-tailed porcupine",
-"New World porcupine",
-"Canada porcupine",
-"pocket mouse",
-"kangaroo rat",
-"jumping mouse",
-"jerboa",
-"dormouse",
-"gopher",
-"squirrel",
-"tree squirrel",
-"ground squirrel",
-"prairie dog",
-"American flying squirrel",
-"groundhog",
-"hoary marmot",
-"yellowbelly marmot",
-"Old World beaver",
-"New World beaver",
-"cavy",
-"naked mole rat",
-"ungulate",
-"hyrax",
-"odd-toed ungulate",
-"equine",
-"horse",
-"foal",
-"colt",
-"male horse",
-"stallion",
-"mare",
-"saddle horse",
-"warhorse",
-"pony",
-"mustang",
-"bronco",
-"wild horse",
-"pony",
-"racehorse",
-"racer",
-"harness horse",
-"workhorse",
-"draft horse",
-"trotting horse",
-"ass",
-"domestic ass",
-"wild ass",
-"onager",
-"common zebra",
-"mountain zebra",
-"grevy's zebra",
-"rhinoceros",
-"tapir",
-"even-toed ungulate",
-"swine",
-"piglet",
-"porker",
-"peccary",
-"ruminant",
-"bovid",
-"bovine",
-"ox",
-"cattle",
-"bull",
-"cow",
-"beef",
-"Brahman",
-"dairy cattle",
-"Old World buffalo",
-"Indian buffalo",
-"carabao",
-"Asian wild ox",
-"American bison",
-"wisent",
-"sheep",
-"lamb",
-"domestic sheep",
-"wild sheep",
-"mountain sheep",
-"goat",
-"domestic goat",
-"wild goat",
-"goat antelope",
-"antelope",
-"Thomson's gazelle",
-"Gazella subgutturosa",
-"springbok",
-"kudu",
-"harnessed antelope",
-"eland",
-"waterbuck",
-"oryx",
-"deer",
-"stag",
-"red deer",
-"mule deer",
-"roe deer",
-"caribou",
-"chevrotain",
-"camel",
-"domestic llama",
-"guanaco",
-"alpaca",
-"giraffe",
-"musteline mammal",
-"ermine",
-"stoat",
-"New World least weasel",
-"Old World least weasel",
-"longtail weasel",
-"American mink",
-"ferret",
-"muishond",
-"snake muishond",
-"striped muishond",
-"river otter",
-"Eurasian otter",
-"striped skunk",
-"hooded skunk",
-"hog-nosed skunk",
-"spotted skunk",
-"American badger",
-"Eurasian badger",
-"ferret badger",
-"hog badger",
-"marten",
-"pachyderm",
-"edentate",
-"peba",
-"apar",
-"tatouay",
-"peludo",
-"giant armadillo",
-"pichiciago",
-"sloth",
-"anteater",
-"primate",
-"ape",
-"anthropoid ape",
-"hominoid",
-"hominid",
-"homo",
-"Homo erectus",
-"Homo sapiens",
-"australopithecine",
-"great ape",
-"western lowland gorilla",
-"eastern lowland gorilla",
-"mountain gorilla",
-"silverback",
-"western chimpanzee",
-"eastern chimpanzee",
-"central chimpanzee",
-"pygmy chimpanzee",
-"lesser ape",
-"monkey",
-"Old World monkey",
-"talapoin",
-"grivet",
-"vervet",
-"green monkey",
-"chacma",
-"mandrill",
-"drill",
-"rhesus",
-"bonnet macaque",
-"Barbary ape",
-"crab-eating macaque",
-"entellus",
-"guereza",
-"New World monkey",
-"true marmoset",
-"pygmy marmoset",
-"tamarin",
-"silky tamarin",
-"pinche",
-"lemur",
-"tarsier",
-"flying lemur",
-"proboscidean",
-"elephant",
-"mammoth",
-"procyonid",
-"raccoon",
-"fish",
-"food fish",
-"young fish",
-"crossopterygian",
-"lungfish",
-"catfish",
-"silurid",
-"bullhead",
-"channel catfish",
-"gadoid",
-"cod",
-"hake",
-"elver",
-"common eel",
-"tuna",
-"moray",
-"conger",
-"teleost fish",
-"clupeid fish",
-"shad",
-"herring",
-"sardine",
-"pilchard",
-"anchovy",
-"salmonid",
-"salmon",
-"Atlantic salmon",
-"trout",
-"brown trout",
-"char",
-"whitefish",
-"smelt",
-"tarpon",
-"ribbonfish",
-"toadfish",
-"needlefish",
-"flying fish",
-"spiny-finned fish",
-"percoid fish",
-"perch",
-"pike-perch",
-"walleye",
-"robalo",
-"pike",
-"pickerel",
-"sunfish",
-"crappie",
-"freshwater bream",
-"black bass",
-"bass",
-"serranid fish",
-"grouper",
-"hind",
-"surfperch",
-"cardinalfish",
-"remora",
-"carangid fish",
-"jack",
-"moonfish",
-"pompano",
-"scad",
-"dolphinfish",
-"characin",
-"cichlid",
-"snapper",
-"grunt",
-"sparid",
-"sea bream",
-"porgy",
-"sciaenid fish",
-"croaker",
-"whiting",
-"sea trout",
-"mullet",
-"goatfish",
-"mullet",
-"silversides",
-"barracuda",
-"sea chub",
-"butterfly fish",
-"damselfish",
-"clown anemone fish",
-"wrasse",
-"blenny",
-"pikeblenny",
-"gunnel",
-"goby",
-"gempylid",
-"scombroid",
-"mackerel",
-"Spanish mackerel",
-"tuna",
-"bonito",
-"sailfish",
-"billfish",
-"marlin",
-"tripletail",
-"mojarra",
-"ganoid",
-"Pacific sturgeon",
-"beluga",
-"scorpaenoid",
-"scorpaenid",
-"scorpionfish",
-"rockfish",
-"lumpfish",
-"greenling",
-"gurnard",
-"sea robin",
-"plectognath",
-"triggerfish",
-"filefish",
-"boxfish",
-"spiny puffer",
-"ocean sunfish",
-"flatfish",
-"righteye flounder",
-"lefteye flounder",
-"whiff",
-"sole",
-"abbey",
-"abbey",
-"abrader",
-"accelerator",
-"accessory",
-"accommodation",
-"acoustic device",
-"acoustic modem",
-"acrylic",
-"action",
-"actuator",
-"adhesive bandage",
-"adjustable wrench",
-"aeolian harp",
-"aerosol",
-"after-shave",
-"airbus",
-"aircraft",
-"airfield",
-"airfoil",
-"air gun",
-"airplane",
-"air pump",
-"air-to-air missile",
-"air-to-ground missile",
-"alarm",
-"alb",
-"alcazar",
-"Allen screw",
-"alms dish",
-"altimeter",
-"Amati",
-"ammeter",
-"ammunition",
-"amplifier",
-"analog computer",
-"analytical balance",
-"anchor",
-"anchor chain",
-"aneroid barometer",
-"angledozer",
-"anklet",
-"antenna",
-"anteroom",
-"antiaircraft",
-"antiballistic missile",
-"apartment",
-"apartment building",
-"aperture",
-"apparatus",
-"apparel",
-"appliance",
-"appliance",
-"applicator",
-"aquarium",
-"arbor",
-"arcade",
-"arch",
-"arc lamp",
-"area",
-"argyle",
-"arm",
-"armament",
-"armature",
-"armchair",
-"armoire",
-"armor",
-"armored vehicle",
-"armor plate",
-"armrest",
-"array",
-"arrow",
-"artificial heart",
-"artillery",
-"assembly",
-"assembly plant",
-"astrodome",
-"astronomical telescope",
-"athletic sock",
-"atom bomb",
-"atomic clock",
-"atomizer",
-"attachment",
-"attack submarine",
-"attire",
-"audiocassette",
-"audio system",
-"audiotape",
-"auditorium",
-"autoclave",
-"autoinjector",
-"autoloader",
-"automat",
-"automat",
-"automatic firearm",
-"automatic rifle",
-"automaton",
-"auxiliary research submarine",
-"awl",
-"ax",
-"axis",
-"axle",
-"axletree",
-"baby bed",
-"baby buggy",
-"baby grand",
-"back",
-"background",
-"backseat",
-"badminton equipment",
-"badminton racket",
-"bag",
-"bag",
-"bag",
-"baggage",
-"bagpipe",
-"bait",
-"balance",
-"balcony",
-"balcony",
-"bale",
-"ball",
-"ball gown",
-"ballistic missile",
-"ballistic pendulum",
-"ball-peen hammer",
-"ballroom",
-"band",
-"bandage",
-"bandanna",
-"banderilla",
-"bar",
-"bar",
-"barbed wire",
-"barge",
-"barge pole",
-"barn door",
-"barograph",
-"barrack",
-"barrage balloon",
-"barrel knot",
-"barrel vault",
-"barrier",
-"barroom",
-"base",
-"base",
-"baseball equipment",
-"basilica",
-"basin",
-"basket",
-"basketball equipment",
-"bass",
-"bass drum",
-"bass horn",
-"bastion",
-"bat",
-"bathhouse",
-"battery",
-"battle-ax",
-"battle dress",
-"battleship",
-"bay rum",
-"bay window",
-"beading plane",
-"beam",
-"beam balance",
-"bearing",
-"beater",
-"beating-reed instrument",
-"bed",
-"bed",
-"bedclothes",
-"bedroom",
-"bedroom furniture",
-"bedspread",
-"bedspring",
-"beehive",
-"beer barrel",
-"bell",
-"bell push",
-"bell tower",
-"belt",
-"belt buckle",
-"bench",
-"berlin",
-"berth",
-"besom",
-"bevel gear",
-"bicycle",
-"bicycle chain",
-"bier",
-"billiard ball",
-"bin",
-"binding",
-"bin liner",
-"binocular microscope",
-"bioscope",
-"birchbark canoe",
-"bird shot",
-"bistro",
-"bit",
-"bit",
-"black tie",
-"blade",
-"blade",
-"blanket",
-"blimp",
-"blind",
-"block",
-"block plane",
-"blouse",
-"blower",
-"blowtorch",
-"bludgeon",
-"boarding",
-"boarding house",
-"boardroom",
-"boat",
-"bobbin",
-"body",
-"body armor",
-"body lotion",
-"boiler",
-"bolt",
-"bolt",
-"bomb",
-"bomber",
-"bongo",
-"boom",
-"boom",
-"boomerang",
-"boot",
-"booth",
-"booth",
-"bore bit",
-"Boston rocker",
-"bota",
-"bottle",
-"bottle opener",
-"bow",
-"bow",
-"bowed stringed instrument",
-"bowl",
-"bowl",
-"bowline",
-"bowling equipment",
-"bowling pin",
-"bowsprit",
-"box",
-"box",
-"boxcar",
-"boxing equipment",
-"brace",
-"brace",
-"bracelet",
-"bracket",
-"brake",
-"brake system",
-"brass",
-"brasserie",
-"brazier",
-"breechcloth",
-"breeches",
-"brewpub",
-"brick",
-"bricklayer's hammer",
-"brickwork",
-"bridal gown",
-"bridge",
-"briefcase",
-"brigandine",
-"brilliant pebble",
-"brim",
-"broad arrow",
-"broadax",
-"broad hatchet",
-"broadsword",
-"brush",
-"bubble jet printer",
-"buffer",
-"buffet",
-"building",
-"building complex",
-"bulldozer",
-"bullet",
-"bullhorn",
-"bullnose",
-"bundle",
-"bunker",
-"burial chamber",
-"burner",
-"bus",
-"business suit",
-"butt joint",
-"button",
-"buttress",
-"butt shaft",
-"buzz bomb",
-"cabaret",
-"caber",
-"cabin",
-"cabin",
-"cabinet",
-"cabinet",
-"cabin liner",
-"cable",
-"cable",
-"cafe",
-"cafeteria",
-"cafeteria tray",
-"caff",
-"cage",
-"calculator",
-"caliper",
-"calorimeter",
-"camera",
-"camera lens",
-"camera tripod",
-"camp",
-"camp",
-"camp chair",
-"camper",
-"can",
-"canal",
-"candelabrum",
-"candlestick",
-"cane",
-"cannikin",
-"cannon",
-"cannon",
-"cannonball",
-"canopy",
-"canteen",
-"canteen",
-"canvas",
-"canvas tent",
-"cap",
-"cap",
-"cap",
-"capacitor",
-"caparison",
-"cape",
-"cap screw",
-"capsule",
-"car",
-"car",
-"carbine",
-"carbon arc lamp",
-"card index",
-"cardioid microphone",
-"car door",
-"cargo liner",
-"cargo ship",
-"carillon",
-"carpenter's hammer",
-"carpenter's level",
-"carpenter's mallet",
-"carpenter's rule",
-"carpet tack",
-"carriage",
-"carriage",
-"carriage bolt",
-"carrick bend",
-"carrier",
-"car seat",
-"cart",
-"cartridge",
-"cartridge belt",
-"cartridge holder",
-"case",
-"case",
-"cashbox",
-"casque",
-"casserole",
-"cassock",
-"catch",
-"catcher's mask",
-"cathedra",
-"cathedral",
-"cathedral",
-"catheter",
-"cathode",
-"cathode-ray tube",
-"cat's-paw",
-"cattle car",
-"cautery",
-"cavalry sword",
-"cedar chest",
-"cell",
-"cell",
-"cellblock",
-"center",
-"centrifuge",
-"ceramic",
-"ceramic ware",
-"chain tongs",
-"chair",
-"chair of state",
-"chalk",
-"chamfer plane",
-"chandlery",
-"chapel",
-"character printer",
-"chassis",
-"chasuble",
-"chatelaine",
-"checker",
-"cheeseboard",
-"chemical reactor",
-"chessman",
-"chest of drawers",
-"child's room",
-"china",
-"chip",
-"chip",
-"chisel",
-"choke",
-"chokey",
-"chordophone",
-"chronoscope",
-"chuck",
-"church key",
-"cigar lighter",
-"circle",
-"circuit",
-"circuit board",
-"circular plane",
-"circular saw",
-"cistern",
-"civilian clothing",
-"clamp",
-"clamshell",
-"clarinet",
-"classroom",
-"clavier",
-"cleaning implement",
-"cleaning pad",
-"clean room",
-"clinic",
-"clip",
-"cloak",
-"clock",
-"closed circuit",
-"closed-circuit television",
-"closet",
-"cloth covering",
-"clothes closet",
-"clothes dryer",
-"clothes hamper",
-"clothes tree",
-"clothing",
-"clothing store",
-"clout nail",
-"clove hitch",
-"clutch",
-"coach",
-"coal car",
-"coal shovel",
-"coat",
-"coat closet",
-"coating",
-"coating",
-"coat of paint",
-"coaxial cable",
-"cocked hat",
-"coffee cup",
-"coffee maker",
-"coffer",
-"coffin",
-"coil",
-"colander",
-"collider",
-"cologne",
-"colonnade",
-"color television",
-"Colt",
-"column",
-"column",
-"comb",
-"comb",
-"combination plane",
-"combine",
-"commissary",
-"commodity",
-"communication system",
-"commutator",
-"compact disk",
-"compartment",
-"compass",
-"compass card",
-"compound lens",
-"compound lever",
-"compressor",
-"computer",
-"computer circuit",
-"computer network",
-"computer screen",
-"computer system",
-"concentration camp",
-"concert grand",
-"concertina",
-"condenser",
-"condenser",
-"condenser microphone",
-"conductor",
-"connecting rod",
-"connection",
-"conservatory",
-"conservatory",
-"contact",
-"container",
-"contrabassoon",
-"control",
-"control panel",
-"control system",
-"convent",
-"converging lens",
-"converter",
-"convertible",
-"conveyance",
-"cooker",
-"cooking utensil",
-"cooler",
-"cooling system",
-"cord",
-"cord",
-"cordage",
-"corner",
-"correctional institution",
-"corset",
-"cosmetic",
-"costume",
-"costume",
-"cotter",
-"cotton",
-"counter",
-"counter",
-"counter",
-"counter tube",
-"country house",
-"coupling",
-"court",
-"court",
-"coverall",
-"covering",
-"cowbarn",
-"craft",
-"cravat",
-"crazy quilt",
-"cream",
-"cream pitcher",
-"crematory",
-"crepe",
-"crib",
-"cricket equipment",
-"croquet equipment",
-"crossbar",
-"crossbow",
-"crosspiece",
-"crown jewels",
-"cruiser",
-"cruiser",
-"cruise ship",
-"crystal microphone",
-"cudgel",
-"cuff",
-"cultivator",
-"cup",
-"cupboard",
-"cupola",
-"curb roof",
-"curtain",
-"cutout",
-"cutter",
-"cutting implement",
-"cybercafe",
-"cyclotron",
-"cylinder",
-"cymbal",
-"dado plane",
-"dagger",
-"damper",
-"dart",
-"data converter",
-"data input device",
-"davenport",
-"davenport",
-"davit",
-"dead axle",
-"deck",
-"deck",
-"deck chair",
-"deep-freeze",
-"defensive structure",
-"delay line",
-"delicatessen",
-"dental appliance",
-"denture",
-"depilatory",
-"depressor",
-"depth finder",
-"derrick",
-"destroyer",
-"detector",
-"detector",
-"detonating fuse",
-"detonator",
-"developer",
-"device",
-"dial",
-"dialyzer",
-"diathermy machine",
-"diesel locomotive",
-"digital camera",
-"digital computer",
-"digital display",
-"diner",
-"dinghy",
-"dining car",
-"dining-hall",
-"dining room",
-"dining-room furniture",
-"dining-room table",
-"dinner dress",
-"dinner pail",
-"dinner table",
-"diode",
-"dip",
-"diplomatic building",
-"dipper",
-"DIP switch",
-"directional antenna",
-"directional microphone",
-"direction finder",
-"disguise",
-"dish",
-"dish",
-"disk",
-"dispenser",
-"display",
-"display panel",
-"distillery",
-"ditch",
-"ditch spade",
-"dive bomber",
-"doll",
-"dolmen",
-"domino",
-"door",
-"doorbell",
-"doorlock",
-"doornail",
-"dormer window",
-"dormitory",
-"dot matrix printer",
-"double-breasted suit",
-"double-reed instrument",
-"douche",
-"dovecote",
-"dovetail plane",
-"downstage",
-"drafting instrument",
-"Dragunov",
-"drawstring bag",
-"dray",
-"dredging bucket",
-"dress",
-"dress blues",
-"dressing",
-"dress uniform",
-"drill",
-"electric drill",
-"drill rig",
-"drinking fountain",
-"drinking vessel",
-"drip mat",
-"drip pot",
-"drive",
-"drive",
-"drogue",
-"drogue parachute",
-"drop-leaf table",
-"dry battery",
-"dry dock",
-"dryer",
-"dry masonry",
-"dry wall",
-"dugout canoe",
-"dumdum",
-"dumpcart",
-"dune buggy",
-"dungeon",
-"duplicator",
-"dustmop",
-"dwelling",
-"earphone",
-"earthenware",
-"easel",
-"easy chair",
-"edge tool",
-"eiderdown",
-"elastic bandage",
-"electrical converter",
-"electrical device",
-"electric bell",
-"electric frying pan",
-"electric furnace",
-"electric heater",
-"electric lamp",
-"electric motor",
-"electric refrigerator",
-"electro-acoustic transducer",
-"electrode",
-"electromagnet",
-"electronic balance",
-"electronic device",
-"electronic equipment",
-"electronic instrument",
-"electronic voltmeter",
-"electron microscope",
-"electrostatic generator",
-"electrostatic printer",
-"elevator",
-"embankment",
-"embellishment",
-"enamel",
-"enamelware",
-"enclosure",
-"endoscope",
-"engine",
-"engine",
-"ensemble",
-"entrenching tool",
-"epidiascope",
-"equipment",
-"eraser",
-"escutcheon",
-"espadrille",
-"espresso shop",
-"establishment",
-"estaminet",
-"exercise device",
-"exhaust fan",
-"exhibition hall",
-"Exocet",
-"expansion bolt",
-"explosive device",
-"external-combustion engine",
-"extractor",
-"fabric",
-"face mask",
-"face veil",
-"facing",
-"factory",
-"fairlead",
-"false face",
-"fan",
-"farm building",
-"farm machine",
-"fastener",
-"fatigues",
-"faucet",
-"feedback circuit",
-"fence",
-"fencing sword",
-"fender",
-"ferry",
-"fetoscope",
-"field-sequential color television",
-"fife",
-"fifth wheel",
-"fighter",
-"figure eight",
-"file",
-"file server",
-"filling",
-"film",
-"film",
-"filter",
-"filter",
-"finery",
-"finisher",
-"fipple flute",
-"fire",
-"firearm",
-"fire iron",
-"fireplace",
-"firkin",
-"fisherman's bend",
-"fisherman's knot",
-"fisherman's lure",
-"fishing boat",
-"fishing rod",
-"fishnet",
-"flag",
-"flageolet",
-"flambeau",
-"flannelette",
-"flap",
-"flashlight",
-"flask",
-"flatcar",
-"flat tip screwdriver",
-"fleet ballistic missile submarine",
-"flight simulator",
-"flip-flop",
-"floating dock",
-"floor",
-"floor",
-"floor cover",
-"fly",
-"flywheel",
-"fob",
-"foghorn",
-"folder",
-"food hamper",
-"footbath",
-"footbridge",
-"foothold",
-"foot rule",
-"footwear",
-"footwear",
-"forceps",
-"fore-and-aft sail",
-"foremast",
-"fore plane",
-"fore-topmast",
-"fork",
-"formalwear",
-"fortification",
-"fortress",
-"foundation garment",
-"foundry",
-"fragmentation bomb",
-"framework",
-"free-reed instrument",
-"freight train",
-"French door",
-"friary",
-"friction clutch",
-"frigate",
-"frill",
-"frock coat",
-"front projector",
-"fruit machine",
-"full-dress uniform",
-"full metal jacket",
-"funny wagon",
-"fur hat",
-"furnace",
-"furnishing",
-"furniture",
-"fuse",
-"gable",
-"gable roof",
-"gaff",
-"galleon",
-"gallery",
-"galley",
-"galley",
-"gallows",
-"galvanometer",
-"gambling house",
-"game",
-"game equipment",
-"gamp",
-"garage",
-"Garand rifle",
-"garden",
-"garden spade",
-"garden tool",
-"garment",
-"gas burner",
-"gas-discharge tube",
-"gasket",
-"gasoline engine",
-"gate",
-"gatehouse",
-"gatepost",
-"gathered skirt",
-"gauge",
-"gauze",
-"gauze",
-"gavel",
-"gear",
-"gear",
-"gear",
-"gearing",
-"general-purpose bomb",
-"generator",
-"generator",
-"Geneva gown",
-"geodesic dome",
-"girder",
-"glass",
-"glider",
-"glove",
-"glyptic art",
-"goal",
-"golf club",
-"golf equipment",
-"Gordian knot",
-"Gothic arch",
-"government building",
-"government office",
-"gown",
-"gramophone",
-"granary",
-"granny knot",
-"grapnel",
-"grapnel",
-"grate",
-"graver",
-"greasy spoon",
-"greatcoat",
-"great hall",
-"greengrocery",
-"grenade",
-"grillroom",
-"groined vault",
-"Guarnerius",
-"guidance system",
-"guided missile",
-"guildhall",
-"guitar",
-"guitar pick",
-"gun",
-"gun carriage",
-"gunlock",
-"gunsight",
-"gun trigger",
-"gurney",
-"gymnastic apparatus",
-"gym shoe",
-"gypsy cab",
-"habergeon",
-"habit",
-"hairdressing",
-"hairpiece",
-"hairpin",
-"half hatchet",
-"half hitch",
-"hall",
-"hall",
-"hammer",
-"hand",
-"handbell",
-"handbow",
-"handcart",
-"hand glass",
-"handloom",
-"hand lotion",
-"hand mower",
-"handsaw",
-"hand shovel",
-"hand tool",
-"handwear",
-"handwheel",
-"hanger",
-"hank",
-"harpsichord",
-"harrow",
-"hash house",
-"hat",
-"hatch",
-"hauberk",
-"hawser bend",
-"hazard",
-"head",
-"head",
-"head covering",
-"headdress",
-"header",
-"headgear",
-"headlight",
-"headsail",
-"headscarf",
-"health spa",
-"heat engine",
-"heater",
-"heat lamp",
-"heat-seeking missile",
-"heavier-than-air craft",
-"heckelphone",
-"hedge",
-"helicopter",
-"helm",
-"helmet",
-"helmet",
-"heraldry",
-"high altar",
-"high-angle gun",
-"high gear",
-"high table",
-"hinge",
-"hip boot",
-"hitch",
-"hoe",
-"hogshead",
-"hoist",
-"holder",
-"holding device",
-"home appliance",
-"homespun",
-"hood",
-"hood",
-"hood",
-"hook",
-"Hoover",
-"hope chest",
-"horn",
-"horn button",
-"horse",
-"horsecar",
-"horse-drawn vehicle",
-"horsehair wig",
-"hosiery",
-"hospital",
-"hospital room",
-"hostel",
-"hot-air balloon",
-"hotel",
-"hotel room",
-"hot tub",
-"house",
-"house",
-"housing",
-"hovel",
-"huarache",
-"humeral veil",
-"hut",
-"hutch",
-"hydraulic brake",
-"hydraulic system",
-"hydroelectric turbine",
-"hydrofoil",
-"hydrometer",
-"hygrometer",
-"hypermarket",
-"hypodermic syringe",
-"ice machine",
-"ice rink",
-"ice skate",
-"icetray",
-"ignition switch",
-"impact printer",
-"implant",
-"implement",
-"imprint",
-"improvised explosive device",
-"inclined plane",
-"indicator",
-"induction coil",
-"ink-jet printer",
-"inkstand",
-"institution",
-"instrument",
-"instrument of punishment",
-"instrument of torture",
-"interceptor",
-"interchange",
-"intercommunication system",
-"intercontinental ballistic missile",
-"interface",
-"interior door",
-"internal-combustion engine",
-"ionization chamber",
-"video iPod",
-"iron",
-"jack",
-"jack",
-"jacket",
-"jacket",
-"jack plane",
-"jail",
-"jamb",
-"jar",
-"jeroboam",
-"jet",
-"jet engine",
-"jewelled headdress",
-"jib",
-"jibboom",
-"jiggermast",
-"joint",
-"jointer",
-"joist",
-"jolly boat",
-"jug",
-"jumper",
-"jumper cable",
-"junction",
-"junction",
-"jury mast",
-"kayak",
-"keel",
-"keg",
-"kerchief",
-"kettle",
-"key",
-"key",
-"keyboard",
-"keyboard instrument",
-"khakis",
-"kiln",
-"kinescope",
-"kingbolt",
-"kirk",
-"kit",
-"kit",
-"kitbag",
-"kitchen",
-"kitchen appliance",
-"kitchen utensil",
-"kite balloon",
-"knee-high",
-"knife",
-"knife",
-"knit",
-"knob",
-"lace",
-"lacquer",
-"ladder truck",
-"lag screw",
-"lamasery",
-"laminate",
-"lamination",
-"lamp",
-"lamp",
-"landing gear",
-"land mine",
-"lantern",
-"lapel",
-"lathe",
-"lattice",
-"launcher",
-"lead-acid battery",
-"leather strip",
-"Leclanche cell",
-"leg",
-"legging",
-"lens",
-"lens implant",
-"level",
-"lever",
-"Levi's",
-"lid",
-"life buoy",
-"life jacket",
-"life preserver",
-"lifting device",
-"ligament",
-"light",
-"light-emitting diode",
-"lighter-than-air craft",
-"lighting",
-"light microscope",
-"linear accelerator",
-"line printer",
-"lingerie",
-"lining",
-"liquid crystal display",
-"lister",
-"living quarters",
-"living room",
-"local area network",
-"lock",
-"locomotive",
-"lodge",
-"lodging house",
-"loft",
-"loft",
-"longbow",
-"lookout",
-"loom",
-"loop knot",
-"lota",
-"lounge",
-"loungewear",
-"love knot",
-"lunchroom",
-"luxury liner",
-"lyre",
-"machine",
-"machine",
-"machine bolt",
-"machine gun",
-"machinery",
-"machine screw",
-"machine tool",
-"magic lantern",
-"magnet",
-"magnetic disk",
-"magnetic recorder",
-"magnetic tape",
-"magnifier",
-"magnum",
-"magnus hitch",
-"mailer",
-"mainframe",
-"mainmast",
-"main-topmast",
-"main yard",
-"makeup",
-"mallet",
-"mallet",
-"mallet",
-"mandolin",
-"manger",
-"man-of-war",
-"manometer",
-"MANPAD",
-"mansard",
-"mansion",
-"marina",
-"marker",
-"marketplace",
-"maser",
-"mask",
-"masonry",
-"mass spectrometer",
-"mast",
-"mast",
-"mat",
-"mat",
-"match",
-"match",
-"match plane",
-"material",
-"materiel",
-"Matthew Walker",
-"maul",
-"measure",
-"measuring instrument",
-"measuring stick",
-"mechanical device",
-"mechanical system",
-"mechanism",
-"medical building",
-"medical instrument",
-"memorial",
-"memory",
-"memory chip",
-"memory device",
-"menhir",
-"man's clothing",
-"mercantile establishment",
-"mercury barometer",
-"mercury thermometer",
-"mercury-vapor lamp",
-"mess",
-"metal screw",
-"meteorological balloon",
-"meter",
-"meterstick",
-"microbalance",
-"microfilm",
-"microscope",
-"military hospital",
-"military quarters",
-"military vehicle",
-"mill",
-"milldam",
-"millinery",
-"mine",
-"minibike",
-"mink",
-"minster",
-"Minuteman",
-"mirror",
-"mixer",
-"mizzenmast",
-"module",
-"mold",
-"moldboard plow",
-"monitor",
-"monitor",
-"morgue",
-"mortise joint",
-"motion-picture camera",
-"motion-picture film",
-"motor",
-"motorboat",
-"motorcycle",
-"motor hotel",
-"motor vehicle",
-"mound",
-"mount",
-"mouse button",
-"movie projector",
-"moving-coil galvanometer",
-"mug",
-"multiplex",
-"multiplexer",
-"musette pipe",
-"mushroom anchor",
-"musical instrument",
-"musket",
-"musket ball",
-"muslin",
-"muzzle loader",
-"narrowbody aircraft",
-"nautilus",
-"navigational system",
-"naval equipment",
-"naval gun",
-"naval radar",
-"naval weaponry",
-"navigational instrument",
-"nebuchadnezzar",
-"neckline",
-"neckpiece",
-"necktie",
-"neckwear",
-"needle",
-"needlework",
-"negligee",
-"net",
-"net",
-"net",
-"net",
-"network",
-"network",
-"night bell",
-"nightwear",
-"noisemaker",
-"nonsmoker",
-"non-volatile storage",
-"nose flute",
-"nuclear reactor",
-"nuclear weapon",
-"nursery",
-"oar",
-"oblique bandage",
-"oboe da caccia",
-"oboe d'amore",
-"obstacle",
-"office",
-"office furniture",
-"oil lamp",
-"oil paint",
-"oil tanker",
-"olive drab",
-"omnidirectional antenna",
-"onion dome",
-"open-air market",
-"open-end wrench",
-"opener",
-"openside plane",
-"ophthalmoscope",
-"optical device",
-"optical disk",
-"optical instrument",
-"optical telescope",
-"organ pipe",
-"outbuilding",
-"outerwear",
-"outfit",
-"outrigger canoe",
-"outside mirror",
-"oven",
-"overgarment",
-"overhand knot",
-"overhang",
-"overhead projector",
-"overnighter",
-"overshoe",
-"oxford",
-"package",
-"packaging",
-"packing box",
-"paddle",
-"paddle steamer",
-"page printer",
-"paint",
-"pallium",
-"pan",
-"pan",
-"panic button",
-"panopticon",
-"panopticon",
-"pantechnicon",
-"pantry",
-"pants suit",
-"panzer",
-"paper chain",
-"paper fastener",
-"parabolic reflector",
-"parapet",
-"parasail",
-"parka",
-"parsonage",
-"particle detector",
-"partition",
-"passenger ship",
-"passenger train",
-"passenger van",
-"passive matrix display",
-"passkey",
-"patch",
-"patchouli",
-"patchwork",
-"patina",
-"patisserie",
-"pavis",
-"peavey",
-"pedal",
-"pedestal table",
-"pedestrian crossing",
-"pedicab",
-"peg",
-"pen",
-"penal institution",
-"pencil",
-"pendulum",
-"pendulum clock",
-"percolator",
-"percussion instrument",
-"perfumery",
-"peripheral",
-"periwig",
-"personal computer",
-"petticoat",
-"Phillips screw",
-"Phillips screwdriver",
-"phonograph record",
-"photographic equipment",
-"photographic paper",
-"photometer",
-"physical pendulum",
-"piano",
-"piccolo",
-"pick",
-"pick",
-"pickle barrel",
-"piece of cloth",
-"pile",
-"pillow lace",
-"pilothouse",
-"pin",
-"pincer",
-"pinstripe",
-"pipe",
-"pipet",
-"pipe wrench",
-"pistol",
-"pivot",
-"place of business",
-"place of worship",
-"planetarium",
-"planner",
-"plant",
-"planter",
-"plasterboard",
-"plastic laminate",
-"plastic wrap",
-"plastron",
-"plate",
-"platform",
-"platform",
-"platform rocker",
-"plating",
-"pleat",
-"plethysmograph",
-"plexor",
-"pliers",
-"plug",
-"plug",
-"pneumatic drill",
-"pocket",
-"pocket-handkerchief",
-"pocketknife",
-"pointed arch",
-"polyester",
-"polygraph",
-"pomade",
-"pontifical",
-"pool ball",
-"poorhouse",
-"porcelain",
-"porch",
-"portable computer",
-"portico",
-"post",
-"posthole digger",
-"pot",
-"potential divider",
-"potpourri",
-"pottery",
-"pouch",
-"poultice",
-"powder",
-"powder keg",
-"power brake",
-"power mower",
-"power saw",
-"power shovel",
-"power tool",
-"press",
-"press",
-"pressure dome",
-"pressure gauge",
-"pressure suit",
-"printed circuit",
-"printer",
-"prison camp",
-"prod",
-"prolonge knot",
-"prompter",
-"prong",
-"propeller",
-"propeller plane",
-"prosthesis",
-"protective covering",
-"protective garment",
-"pruning saw",
-"pruning shears",
-"public house",
-"public toilet",
-"public transport",
-"pull",
-"pull chain",
-"pulley",
-"Pullman",
-"pullover",
-"pulse counter",
-"pump",
-"pump",
-"pump house",
-"punch",
-"punch press",
-"purifier",
-"push broom",
-"push button",
-"pusher",
-"puzzle",
-"pyrometer",
-"pyx",
-"QWERTY keyboard",
-"racing boat",
-"rack",
-"rack",
-"radar",
-"radiogram",
-"radio interferometer",
-"radio link",
-"radiometer",
-"radio receiver",
-"radiotelegraph",
-"radiotelephone",
-"radio transmitter",
-"raft",
-"rail",
-"rail fence",
-"railing",
-"raincoat",
-"rake",
-"ramp",
-"rampart",
-"random-access memory",
-"rayon",
-"razor",
-"reaction-propulsion engine",
-"reactor",
-"reading lamp",
-"reading room",
-"read-only memory",
-"rearview mirror",
-"receiver",
-"receptacle",
-"reception room",
-"recess",
-"reconnaissance plane",
-"recorder",
-"recording",
-"record player",
-"recreation room",
-"recycling bin",
-"reed stop",
-"reef knot",
-"refectory table",
-"refinery",
-"reflecting telescope",
-"reflector",
-"reformatory",
-"refracting telescope",
-"refrigerator car",
-"refuge",
-"regalia",
-"regimentals",
-"regulator",
-"rein",
-"religious residence",
-"removable disk",
-"repair shop",
-"repeating firearm",
-"reproducer",
-"rescue equipment",
-"reservoir",
-"reset button",
-"residence",
-"resistor",
-"resonator",
-"respirator",
-"restraint",
-"retort",
-"rheostat",
-"rib",
-"ribbed vault",
-"riddle",
-"ride",
-"riding boot",
-"riding mower",
-"rifle ball",
-"rig",
-"rink",
-"river boat",
-"road",
-"roadway",
-"robe",
-"rocket",
-"rocket",
-"rod",
-"roller",
-"roller",
-"in-line skate",
-"roller blind",
-"roller coaster",
-"rolling hitch",
-"Rolodex",
-"Roman building",
-"roof",
-"roof",
-"room",
-"roost",
-"rope",
-"rose water",
-"rotary engine",
-"rotating mechanism",
-"rotating shaft",
-"rotisserie",
-"rotor",
-"round arch",
-"router plane",
-"row house",
-"royal mast",
-"rubber bullet",
-"rug",
-"rushlight",
-"sable",
-"sable coat",
-"sack",
-"sackbut",
-"sacking",
-"saddle",
-"safe",
-"safety belt",
-"safety curtain",
-"safety fuse",
-"safety match",
-"sail",
-"sailboat",
-"sailing vessel",
-"salver",
-"sandglass",
-"sash",
-"satellite",
-"satellite television",
-"saucepan",
-"savings bank",
-"saw",
-"sawhorse",
-"scale",
-"scarf",
-"school",
-"scientific instrument",
-"scissors",
-"scoop",
-"scratcher",
-"screen",
-"screen",
-"screen",
-"screw eye",
-"scrub plane",
-"scuffer",
-"sculpture",
-"sea boat",
-"sea chest",
-"seam",
-"seaplane",
-"seat",
-"seat",
-"second hand",
-"secretary",
-"security system",
-"seeker",
-"selector",
-"self-propelled vehicle",
-"semiautomatic firearm",
-"semiautomatic pistol",
-"semiconductor device",
-"serger",
-"serpent",
-"serving cart",
-"serving dish",
-"set",
-"setscrew",
-"setscrew",
-"sewing needle",
-"sextant",
-"shackle",
-"shade",
-"shaft",
-"shag rug",
-"shaker",
-"shaper",
-"shaping tool",
-"sharpener",
-"shaving cream",
-"shaving foam",
-"shawl",
-"shawm",
-"shears",
-"sheath",
-"shed",
-"sheepshank",
-"sheet bend",
-"shelf",
-"shell",
-"shell",
-"shell",
-"shellac",
-"shelter",
-"shelter",
-"shelter",
-"shield",
-"ship",
-"shipboard system",
-"shirt",
-"shirtfront",
-"shock absorber",
-"shoe",
-"shooting brake",
-"shop",
-"short pants",
-"shotgun",
-"shoulder holster",
-"shrine",
-"shutter",
-"shuttle",
-"sidewinder",
-"sieve",
-"sifter",
-"sights",
-"signaling device",
-"signboard",
-"silk",
-"simulator",
-"single bed",
-"single-breasted suit",
-"single-reed instrument",
-"sitz bath",
-"six-pack",
-"skate",
-"skein",
-"skeleton",
-"skewer",
-"skidder",
-"skid lid",
-"skiff",
-"ski pole",
-"skirt",
-"ski tow",
-"skullcap",
-"slack suit",
-"slat",
-"sled",
-"sleeper",
-"sleeping car",
-"sleeve",
-"sleeve",
-"slide projector",
-"slipknot",
-"slipper",
-"sloop",
-"slop pail",
-"slot machine",
-"small boat",
-"smart bomb",
-"smoker",
-"smooth plane",
-"snack bar",
-"snap-brim hat",
-"snare drum",
-"sniper rifle",
-"Sno-cat",
-"soapbox",
-"socle",
-"sofa",
-"sonograph",
-"sorter",
-"sound recording",
-"soup ladle",
-"source of illumination",
-"soutane",
-"spacecraft",
-"spade",
-"spar",
-"spatula",
-"spear",
-"spear",
-"spectacles",
-"spectrograph",
-"spectroscope",
-"speedometer",
-"spider",
-"spike",
-"spike",
-"spinet",
-"spinning machine",
-"spiral ratchet screwdriver",
-"spiral spring",
-"spit",
-"spokeshave",
-"sponge mop",
-"spoon",
-"sports equipment",
-"sports implement",
-"sportswear",
-"spot",
-"spring",
-"spring balance",
-"springboard",
-"sprit",
-"square",
-"square knot",
-"squash racket",
-"squawk box",
-"squeezer",
-"squinch",
-"stabilizer",
-"stabilizer",
-"stable gear",
-"stadium",
-"stall",
-"stamp mill",
-"stand",
-"standard cell",
-"staple",
-"starter",
-"state prison",
-"station",
-"statue",
-"stay",
-"steakhouse",
-"stealth aircraft",
-"stealth bomber",
-"stealth fighter",
-"steam bath",
-"steamboat",
-"steamer",
-"steam iron",
-"steam whistle",
-"steel mill",
-"steelyard",
-"steeple",
-"steering system",
-"step",
-"step-up transformer",
-"stereo",
-"stick",
-"stick",
-"still",
-"stilt",
-"Stinger",
-"stock",
-"stockcar",
-"stock car",
-"stocking",
-"stonework",
-"stool",
-"stopper knot",
-"storage battery",
-"storage space",
-"storeroom",
-"stove",
-"stove bolt",
-"Stradavarius",
-"straight chair",
-"strap",
-"strap",
-"stringed instrument",
-"strip",
-"strongbox",
-"stronghold",
-"strongroom",
-"structural member",
-"structure",
-"stylus",
-"submachine gun",
-"submersible",
-"submersible",
-"subwoofer",
-"suction pump",
-"suede cloth",
-"sunbonnet",
-"sunhat",
-"supermarket",
-"superstructure",
-"supply chamber",
-"support",
-"support",
-"support column",
-"supporting structure",
-"supporting tower",
-"surface lift",
-"surface-to-air missile",
-"surgeon's knot",
-"surgical instrument",
-"surgical knife",
-"surplice",
-"surveillance system",
-"surveying instrument",
-"surveyor's level",
-"swamp buggy",
-"sweater",
-"swimsuit",
-"sword",
-"synchrotron",
-"system",
-"tabi",
-"table",
-"table",
-"table knife",
-"tableware",
-"tabor",
-"tachometer",
-"tack",
-"tack hammer",
-"talaria",
-"tambour",
-"tambourine",
-"tampon",
-"tank",
-"tank car",
-"tannoy",
-"tape",
-"tape deck",
-"tape recorder",
-"target",
-"tavern",
-"tea chest",
-"teaching aid",
-"tea gown",
-"teashop",
-"teaspoon",
-"tea-strainer",
-"tea tray",
-"telecommunication system",
-"telephone",
-"telephone line",
-"telephone receiver",
-"telephone system",
-"telephone wire",
-"telescope",
-"television antenna",
-"television camera",
-"television equipment",
-"television monitor",
-"temple",
-"temple",
-"tender",
-"tennis racket",
-"tenor drum",
-"tenoroon",
-"tenpenny nail",
-"tent",
-"tenterhook",
-"terminal",
-"terminal",
-"test rocket",
-"tetraskelion",
-"textile machine",
-"textile mill",
-"theater",
-"theodolite",
-"thermometer",
-"thermostat",
-"three-piece suit",
-"three-way switch",
-"thumbscrew",
-"thumbtack",
-"tights",
-"tile",
-"timber",
-"timber hitch",
-"timbrel",
-"time-fuse",
-"timepiece",
-"timer",
-"time-switch",
-"tire chain",
-"tithe barn",
-"toecap",
-"toga",
-"toggle switch",
-"toilet",
-"toilet powder",
-"toiletry",
-"toilet water",
-"token",
-"tomograph",
-"toner",
-"tongs",
-"tool",
-"toolbox",
-"tooth",
-"toothbrush",
-"top",
-"top",
-"topgallant",
-"topmast",
-"topsail",
-"torpedo",
-"torpedo boat",
-"touch screen",
-"towel",
-"toweling",
-"tower",
-"toy box",
-"track",
-"tracked vehicle",
-"trailer",
-"trailer",
-"train",
-"trammel",
-"transdermal patch",
-"transformer",
-"transistor",
-"transmission",
-"transmitter",
-"transporter",
-"trap",
-"trapeze",
-"travel iron",
-"treasure chest",
-"trellis",
-"trench",
-"trial balloon",
-"triclinium",
-"troop carrier",
-"trough",
-"trouser",
-"trowel",
-"truck",
-"trunk",
-"try square",
-"tube",
-"tuck shop",
-"tun",
-"tunic",
-"turbine",
-"Turkish towel",
-"Turk's head",
-"turner",
-"turntable",
-"turtleneck",
-"tweed",
-"tweeter",
-"twenty-two",
-"two-piece",
-"typesetting machine",
-"typewriter",
-"ultraviolet lamp",
-"undercarriage",
-"undergarment",
-"underpants",
-"underwear",
-"uneven parallel bars",
-"uniform",
-"university",
-"uplift",
-"urn",
-"urn",
-"utensil",
-"vacuum flask",
-"valve",
-"van",
-"van",
-"varnish",
-"vehicle",
-"veranda",
-"vertical file",
-"vessel",
-"vessel",
-"vest",
-"vibrator",
-"vibrator",
-"videocassette",
-"video recording",
-"vigil light",
-"viol",
-"vise",
-"vivarium",
-"voltaic cell",
-"voltmeter",
-"wagon",
-"waist pack",
-"walking stick",
-"wall",
-"wall",
-"wall unit",
-"ward",
-"warehouse",
-"warship",
-"wash",
-"washer",
-"washtub",
-"watch",
-"watchtower",
-"water-base paint",
-"water butt",
-"water cart",
-"watercolor",
-"water-cooled reactor",
-"water gauge",
-"water ski",
-"waterwheel",
-"weapon",
-"weaponry",
-"weatherglass",
-"weathervane",
-"web",
-"wedge",
-"wedge",
-"weighbridge",
-"weight",
-"weir",
-"weld",
-"well",
-"whaler",
-"wheel",
-"wheelchair",
-"wheeled vehicle",
-"wheelwork",
-"whetstone",
-"whip",
-"whisk",
-"whispering gallery",
-"white goods",
-"whorehouse",
-"wicker basket",
-"widebody aircraft",
-"winch",
-"Winchester",
-"wind instrument",
-"window",
-"window",
-"window blind",
-"window envelope",
-"Windsor knot",
-"wine bucket",
-"wine cask",
-"wineglass",
-"wire",
-"wire",
-"wire matrix printer",
-"wiring",
-"woman's clothing",
-"wood",
-"woodenware",
-"woodscrew",
-"woodwind",
-"woofer",
-"workbasket",
-"workbench",
-"work-clothing",
-"worktable",
-"workwear",
-"wrapping",
-"wrench",
-"writing desk",
-"writing implement",
-"X-ray film",
-"X-ray machine",
-"yacht chair",
-"yard",
-"yard",
-"yardstick",
-"yoke",
-"zither",
-"zoot suit",
-"grain",
-"light",
-"colorlessness",
-"chromatic color",
-"black",
-"gray",
-"dark red",
-"orange",
-"yellow",
-"green",
-"blue",
-"purple",
-"reddish purple",
-"pink",
-"light brown",
-"reddish brown",
-"complexion",
-"skin",
-"epidermal cell",
-"columnar cell",
-"macule",
-"specimen",
-"milk",
-"embryonic cell",
-"leukocyte",
-"neutrophil",
-"astrocyte",
-"exoskeleton",
-"medium",
-"film",
-"press",
-"print media",
-"storage medium",
-"journalism",
-"photojournalism",
-"newspaper",
-"telecommunication",
-"telephone",
-"call",
-"long distance",
-"wireless",
-"broadcasting",
-"television",
-"reception",
-"chat room",
-"portal site",
-"wordbook",
-"album",
-"concept album",
-"magazine",
-"movie",
-"sign",
-"comestible",
-"course",
-"dainty",
-"dish",
-"fare",
-"diet",
-"dietary supplement",
-"liquid diet",
-"reducing diet",
-"vegetarianism",
-"ration",
-"field ration",
-"foodstuff",
-"starches",
-"concentrate",
-"meal",
-"roughage",
-"flour",
-"wheat flour",
-"nutriment",
-"commissariat",
-"canned food",
-"canned meat",
-"meal",
-"breakfast",
-"lunch",
-"dinner",
-"supper",
-"buffet",
-"picnic",
-"cookout",
-"bite",
-"entree",
-"side dish",
-"casserole",
-"chicken casserole",
-"appetizer",
-"cocktail",
-"hors d'oeuvre",
-"relish",
-"dip",
-"soup",
-"madrilene",
-"broth",
-"broth",
-"chowder",
-"clam chowder",
-"stew",
-"goulash",
-"fish stew",
-"fricassee",
-"ragout",
-"ready-mix",
-"powdered sugar",
-"granulated sugar",
-"brown sugar",
-"sweet",
-"confiture",
-"candy",
-"hard candy",
-"patty",
-"brittle",
-"chewing gum",
-"candied fruit",
-"candied citrus peel",
-"fudge",
-"gumdrop",
-"mint",
-"kiss",
-"lozenge",
-"taffy",
-"dessert",
-"dumpling",
-"frozen dessert",
-"mousse",
-"mousse",
-"whip",
-"pudding",
-"pudding",
-"tipsy cake",
-"ice",
-"chocolate ice cream",
-"Neapolitan ice cream",
-"peach ice cream",
-"strawberry ice cream",
-"tutti-frutti",
-"vanilla ice cream",
-"split",
-"pudding",
-"custard",
-"pastry",
-"turnover",
-"puff paste",
-"phyllo",
-"fish cake",
-"conserve",
-"jam",
-"jelly",
-"apple jelly",
-"marmalade",
-"gelatin",
-"gelatin dessert",
-"patty",
-"stuffing",
-"bread",
-"breadstick",
-"bun",
-"cracker",
-"dark bread",
-"flatbread",
-"loaf of bread",
-"quick bread",
-"rye bread",
-"toast",
-"white bread",
-"French bread",
-"cornbread",
-"johnnycake",
-"muffin",
-"scone",
-"onion roll",
-"sweet roll",
-"onion bagel",
-"biscuit",
-"baking-powder biscuit",
-"soft pretzel",
-"sandwich",
-"hamburger",
-"gruel",
-"edible fruit",
-"vegetable",
-"crudites",
-"legume",
-"greens",
-"solanaceous vegetable",
-"root vegetable",
-"potato",
-"baked potato",
-"sweet potato",
-"snack food",
-"corn chip",
-"tortilla chip",
-"cruciferous vegetable",
-"cabbage",
-"kale",
-"red cabbage",
-"savoy cabbage",
-"squash",
-"summer squash",
-"yellow squash",
-"winter squash",
-"turban squash",
-"gherkin",
-"sprout",
-"beet",
-"pepper",
-"sweet pepper",
-"hot pepper",
-"chili",
-"jalapeno",
-"onion",
-"Spanish onion",
-"salad green",
-"lettuce",
-"butterhead lettuce",
-"bean",
-"pea",
-"green pea",
-"common bean",
-"fresh bean",
-"green bean",
-"shell bean",
-"lima bean",
-"soy",
-"celery",
-"chicory",
-"coffee substitute",
-"chicory escarole",
-"corn",
-"hominy",
-"cress",
-"tomato",
-"cherry tomato",
-"salsify",
-"turnip",
-"edible nut",
-"apple",
-"eating apple",
-"Delicious",
-"McIntosh",
-"Pippin",
-"cooking apple",
-"berry",
-"currant",
-"citrus",
-"temple orange",
-"mandarin",
-"bitter orange",
-"sweet orange",
-"Jaffa orange",
-"navel orange",
-"Valencia orange",
-"lime",
-"almond",
-"plum",
-"dried fruit",
-"raisin",
-"passion fruit",
-"cocoa",
-"melon",
-"muskmelon",
-"winter melon",
-"cherry",
-"sweet cherry",
-"heart cherry",
-"sour cherry",
-"grape",
-"fox grape",
-"muscadine",
-"slipskin grape",
-"vinifera grape",
-"Tokay",
-"cherimoya",
-"soursop",
-"sweetsop",
-"ilama",
-"pond apple",
-"olive",
-"pear",
-"edible seed",
-"walnut",
-"feed",
-"fodder",
-"oil cake",
-"timothy",
-"grain",
-"barley",
-"wheat",
-"rice",
-"mash",
-"bird feed",
-"petfood",
-"salad",
-"tossed salad",
-"combination salad",
-"pasta salad",
-"fruit salad",
-"ingredient",
-"flavorer",
-"condiment",
-"herb",
-"spice",
-"cinnamon",
-"pepper",
-"garlic",
-"mustard",
-"sage",
-"savory",
-"curry",
-"paprika",
-"pickle",
-"sweet pickle",
-"vinegar",
-"sauce",
-"hot sauce",
-"dressing",
-"mayonnaise",
-"cheese sauce",
-"hot-fudge sauce",
-"white sauce",
-"spaghetti sauce",
-"boiled egg",
-"hard-boiled egg",
-"Easter egg",
-"omelet",
-"firm omelet",
-"souffle",
-"dairy product",
-"milk",
-"milk",
-"powdered milk",
-"cream",
-"butter",
-"clarified butter",
-"yogurt",
-"curd",
-"cheese",
-"cream cheese",
-"bleu",
-"cheddar",
-"Swiss cheese",
-"spread",
-"pate",
-"sweetening",
-"sugar",
-"syrup",
-"batter",
-"bread dough",
-"chicken and rice",
-"pasta",
-"Tetrazzini",
-"chili dog",
-"fondue",
-"fondue",
-"hash",
-"kabob",
-"seafood Newburg",
-"meatball",
-"pilaf",
-"sausage pizza",
-"pepperoni pizza",
-"cheese pizza",
-"anchovy pizza",
-"Sicilian pizza",
-"porridge",
-"fish loaf",
-"salmon loaf",
-"scallopine",
-"taco",
-"beef burrito",
-"quesadilla",
-"tostada",
-"beverage",
-"concoction",
-"mix",
-"filling",
-"potion",
-"elixir",
-"alcohol",
-"brew",
-"beer",
-"lager",
-"Weissbier",
-"malt",
-"ale",
-"stout",
-"mead",
-"wine",
-"white wine",
-"sparkling wine",
-"Burgundy",
-"Beaujolais",
-"Medoc",
-"Pinot noir",
-"Bordeaux",
-"claret",
-"Chianti",
-"Cabernet",
-"Merlot",
-"dessert wine",
-"Rhine wine",
-"Rioja",
-"Saint Emilion",
-"zinfandel",
-"table wine",
-"vermouth",
-"fortified wine",
-"Madeira",
-"liquor",
-"brandy",
-"gin",
-"rum",
-"whiskey",
-"corn whiskey",
-"Irish",
-"Scotch",
-"liqueur",
-"coffee liqueur",
-"orange liqueur",
-"mixed drink",
-"cocktail",
-"highball",
-"Bloody Mary",
-"daiquiri",
-"manhattan",
-"martini",
-"sling",
-"sour",
-"caffe latte",
-"cider",
-"sweet cider",
-"juice",
-"fruit juice",
-"grape juice",
-"orange juice",
-"fruit drink",
-"mulled wine",
-"soft drink",
-"cola",
-"coffee",
-"punch",
-"champagne cup",
-"claret cup",
-"rickey",
-"tea",
-"tea",
-"herb tea",
-"tisane",
-"black tea",
-"green tea",
-"water",
-"drinking water",
-"mineral water",
-"vitamin pill",
-"collection",
-"suburb",
-"residence",
-"littoral",
-"grassland",
-"pasture",
-"resort",
-"field",
-"air bubble",
-"arroyo",
-"ascent",
-"atoll",
-"bank",
-"bank",
-"bar",
-"barrier reef",
-"basin",
-"beach",
-"burrow",
-"canyon",
-"cave",
-"continental glacier",
-"crag",
-"crater",
-"dale",
-"descent",
-"draw",
-"dune",
-"geological formation",
-"glacier",
-"glen",
-"gorge",
-"gulch",
-"gully",
-"highland",
-"hill",
-"hillside",
-"hole",
-"hollow",
-"iceberg",
-"ice mass",
-"ion",
-"knoll",
-"landfall",
-"landfill",
-"lather",
-"ledge",
-"lowland",
-"meteorite",
-"mountain",
-"mull",
-"natural depression",
-"natural elevation",
-"nullah",
-"ocean floor",
-"outcrop",
-"plain",
-"point",
-"precipice",
-"ravine",
-"reef",
-"ridge",
-"ridge",
-"rift valley",
-"rock",
-"sandbank",
-"seaside",
-"shiner",
-"shore",
-"slope",
-"soapsuds",
-"spume",
-"tableland",
-"tideland",
-"volcanic crater",
-"wadi",
-"spiritual leader",
-"adventurer",
-"anomaly",
-"benefactor",
-"commoner",
-"contestant",
-"discussant",
-"entertainer",
-"female",
-"finisher",
-"inhabitant",
-"native",
-"juvenile",
-"lover",
-"male",
-"mediator",
-"national",
-"peer",
-"recipient",
-"sensualist",
-"traveler",
-"unwelcome person",
-"unskilled person",
-"worker",
-"wrongdoer",
-"Black",
-"White",
-"Semite",
-"white man",
-"Mongol",
-"Nahuatl",
-"Caddo",
-"Penutian",
-"Teton",
-"Taracahitian",
-"Slav",
-"Catholic",
-"Altaic",
-"Bornean",
-"Canadian",
-"Central American",
-"Britisher",
-"English person",
-"Englishwoman",
-"Ethiopian",
-"Parisian",
-"Greek",
-"Italian",
-"Japanese",
-"Mexican",
-"Nigerian",
-"North American",
-"Pakistani",
-"South American Indian",
-"Filipino",
-"Polynesian",
-"Scandinavian",
-"South African",
-"South American",
-"Turki",
-"American",
-"New Yorker",
-"abbess",
-"abstainer",
-"academic administrator",
-"accomplice",
-"acquaintance",
-"acquirer",
-"aerialist",
-"actor",
-"actor",
-"addict",
-"adjutant",
-"admirer",
-"adulterer",
-"advertiser",
-"advocate",
-"analyst",
-"ancestor",
-"announcer",
-"announcer",
-"appointee",
-"appreciator",
-"appropriator",
-"archbishop",
-"architect",
-"army engineer",
-"army officer",
-"arrival",
-"articulator",
-"asserter",
-"assistant",
-"associate",
-"astronaut",
-"athlete",
-"attendant",
-"aunt",
-"authoritarian",
-"authority",
-"aviator",
-"back",
-"bad person",
-"ballet dancer",
-"bullfighter",
-"baron",
-"bartender",
-"baseball coach",
-"base runner",
-"basketball player",
-"believer",
-"betrothed",
-"bigot",
-"big shot",
-"biochemist",
-"bisexual",
-"boatman",
-"bond servant",
-"botanist",
-"Boy Scout",
-"buddy",
-"campaigner",
-"captain",
-"card player",
-"careerist",
-"caretaker",
-"cavalryman",
-"celebrity",
-"charmer",
-"child",
-"child",
-"cipher",
-"citizen",
-"civil rights leader",
-"cleaner",
-"clergyman",
-"cleric",
-"clerk",
-"climber",
-"closer",
-"clown",
-"coach",
-"cobbler",
-"collaborator",
-"college student",
-"collegian",
-"commanding officer",
-"commissioned officer",
-"commissioned military officer",
-"commissioner",
-"committee member",
-"communist",
-"compulsive",
-"computer scientist",
-"computer user",
-"contractor",
-"convict",
-"copycat",
-"counselor",
-"craftsman",
-"creditor",
-"critic",
-"curate",
-"dancer",
-"dancer",
-"darling",
-"date",
-"daughter",
-"dawdler",
-"deacon",
-"deaf person",
-"debtor",
-"deliveryman",
-"descender",
-"designated hitter",
-"detective",
-"detractor",
-"director",
-"disbeliever",
-"dispatcher",
-"distributor",
-"doctor",
-"domestic partner",
-"draftsman",
-"drinker",
-"drinker",
-"drug addict",
-"drug user",
-"drummer",
-"drunkard",
-"eager beaver",
-"earner",
-"eavesdropper",
-"economist",
-"editor",
-"egotist",
-"elder",
-"elected official",
-"emissary",
-"employee",
-"employer",
-"endomorph",
-"enemy",
-"entrant",
-"examiner",
-"exhibitionist",
-"fan",
-"fancier",
-"farmer",
-"farmhand",
-"fascist",
-"father",
-"female aristocrat",
-"female offspring",
-"female child",
-"fielder",
-"fireman",
-"first baseman",
-"first sergeant",
-"flag officer",
-"flatterer",
-"foe",
-"folk dancer",
-"follower",
-"football player",
-"forefather",
-"forger",
-"founder",
-"free agent",
-"friar",
-"monk",
-"gambler",
-"generator",
-"geneticist",
-"genitor",
-"geologist",
-"girl",
-"godchild",
-"godparent",
-"golfer",
-"grandma",
-"grandmaster",
-"grandparent",
-"granter",
-"great grandchild",
-"great grandparent",
-"grouch",
-"guard",
-"guest",
-"guide",
-"gymnast",
-"Gypsy",
-"hack",
-"hairdresser",
-"hater",
-"headmaster",
-"hearer",
-"hedonist",
-"heir",
-"herder",
-"homeless",
-"horseman",
-"host",
-"host",
-"hypocrite",
-"important person",
-"incumbent",
-"infielder",
-"informer",
-"in-law",
-"insurgent",
-"investigator",
-"investor",
-"journalist",
-"judge",
-"juror",
-"Counsel to the Crown",
-"kinswoman",
-"laborer",
-"lama",
-"landowner",
-"lawgiver",
-"lawman",
-"lawyer",
-"liberator",
-"lieutenant",
-"lineman",
-"literate",
-"litigant",
-"Lord",
-"failure",
-"lowerclassman",
-"lumberman",
-"maid",
-"maker",
-"malcontent",
-"martinet",
-"master of ceremonies",
-"masturbator",
-"medical officer",
-"medical practitioner",
-"medical scientist",
-"mender",
-"meteorologist",
-"middle-aged man",
-"miler",
-"military attache",
-"military officer",
-"military policeman",
-"minister",
-"minor leaguer",
-"misfit",
-"mixed-blood",
-"model",
-"moneymaker",
-"mother",
-"mourner",
-"mover",
-"musician",
-"Muslimah",
-"mystic",
-"nanny",
-"neonate",
-"nephew",
-"neutral",
-"newcomer",
-"newcomer",
-"newspaper editor",
-"niece",
-"noncommissioned officer",
-"nurse",
-"observer",
-"occultist",
-"oldster",
-"old woman",
-"opportunist",
-"orator",
-"originator",
-"outfielder",
-"right fielder",
-"right-handed pitcher",
-"painter",
-"panelist",
-"pardoner",
-"parodist",
-"party",
-"passenger",
-"patient",
-"patron",
-"payer",
-"peddler",
-"percussionist",
-"personal representative",
-"personification",
-"pervert",
-"petitioner",
-"Pharaoh",
-"phonetician",
-"physical therapist",
-"physicist",
-"pimp",
-"pisser",
-"pitcher",
-"planner",
-"player",
-"poet",
-"politician",
-"practitioner",
-"prayer",
-"preserver",
-"president",
-"priest",
-"princess",
-"principal",
-"proctor",
-"programmer",
-"promiser",
-"propagandist",
-"prosecutor",
-"psychic",
-"pusher",
-"queen",
-"queen",
-"ranch hand",
-"reader",
-"recruit",
-"recruiter",
-"religious leader",
-"repairman",
-"reporter",
-"representative",
-"reprobate",
-"rescuer",
-"reservist",
-"restrainer",
-"retailer",
-"retiree",
-"revolutionist",
-"rich person",
-"civil authority",
-"runner",
-"running back",
-"rustic",
-"saboteur",
-"sailor",
-"salesman",
-"salesperson",
-"scalper",
-"schemer",
-"scholar",
-"schoolchild",
-"scientist",
-"second baseman",
-"secretary",
-"seeker",
-"selfish person",
-"seller",
-"serf",
-"serviceman",
-"settler",
-"shrew",
-"sibling",
-"sick person",
-"singer",
-"sister",
-"skeptic",
-"skier",
-"sleeper",
-"slob",
-"smith",
-"snoop",
-"social climber",
-"socialist",
-"social scientist",
-"sociologist",
-"soldier",
-"son",
-"songster",
-"sorcerer",
-"sovereign",
-"speaker",
-"specialist",
-"spectator",
-"stand-in",
-"star",
-"stepparent",
-"stock trader",
-"stranger",
-"strategist",
-"student",
-"subordinate",
-"suitor",
-"superior",
-"surgeon",
-"sweetheart",
-"sympathizer",
-"tax assessor",
-"taxonomist",
-"teacher",
-"television reporter",
-"tenant",
-"tenant",
-"tennis player",
-"testator",
-"testee",
-"theologian",
-"therapist",
-"thinker",
-"thrower",
-"toastmaster",
-"trader",
-"traffic cop",
-"trainer",
-"traitor",
-"traveling salesman",
-"tyrant",
-"upstart",
-"upstart",
-"utility man",
-"vacationer",
-"vegetarian",
-"vice president",
-"victim",
-"volunteer",
-"votary",
-"waiter",
-"waitress",
-"wanderer",
-"wanton",
-"washer",
-"white supremacist",
-"wife",
-"winner",
-"winner",
-"woman",
-"workman",
-"worshiper",
-"wright",
-"writer",
-"wilding",
-"bryophyte",
-"liverwort",
-"pteridophyte",
-"fern",
-"fern ally",
-"spore",
-"spermatophyte",
-"perennial",
-"gymnosperm",
-"ephedra",
-"cycad",
-"sago palm",
-"zamia",
-"pine",
-"pinon",
-"nut pine",
-"white pine",
-"yellow pine",
-"larch",
-"fir",
-"silver fir",
-"cedar",
-"spruce",
-"hemlock",
-"douglas fir",
-"cedar",
-"cypress",
-"arborvitae",
-"araucaria",
-"kauri pine",
-"celery pine",
-"yellowwood",
-"gymnospermous yellowwood",
-"yew",
-"angiosperm",
-"dicot",
-"flower",
-"wildflower",
-"inflorescence",
-"pistil",
-"pericarp",
-"oilseed",
-"custard apple",
-"barberry",
-"allspice",
-"laurel",
-"anise tree",
-"magnolia",
-"moonseed",
-"buttercup",
-"aconite",
-"baneberry",
-"anemone",
-"thimbleweed",
-"columbine",
-"clematis",
-"delphinium",
-"nigella",
-"wax myrtle",
-"zebrawood",
-"legume",
-"legume",
-"darling pea",
-"clover",
-"acacia",
-"wattle",
-"albizzia",
-"nitta tree",
-"dogbane",
-"allamanda",
-"carissa",
-"frangipani",
-"rauwolfia",
-"arum",
-"alocasia",
-"anthurium",
-"caladium",
-"monstera",
-"nephthytis",
-"arrow arum",
-"calla lily",
-"duckweed",
-"watermeal",
-"birthwort",
-"sandwort",
-"mouse-ear chickweed",
-"pink",
-"china pink",
-"lychnis",
-"silene",
-"chickweed",
-"fig marigold",
-"amaranth",
-"orach",
-"saltbush",
-"beet",
-"sand verbena",
-"four o'clock",
-"echinocactus",
-"prickly pear",
-"pokeweed",
-"portulaca",
-"flame flower",
-"caper",
-"spiderflower",
-"crucifer",
-"cress",
-"watercress",
-"rock cress",
-"cabbage",
-"head cabbage",
-"turnip plant",
-"mustard",
-"wallflower",
-"woad",
-"stock",
-"radish plant",
-"pennycress",
-"poppy",
-"prickly poppy",
-"composite",
-"compass plant",
-"everlasting",
-"achillea",
-"ageratum",
-"ragweed",
-"ammobium",
-"burdock",
-"artemisia",
-"mugwort",
-"aster",
-"wood aster",
-"common daisy",
-"bur marigold",
-"calendula",
-"thistle",
-"carline thistle",
-"catananche",
-"centaury",
-"knapweed",
-"chrysanthemum",
-"golden aster",
-"goldenbush",
-"plume thistle",
-"woolly thistle",
-"coreopsis",
-"fleabane",
-"woolly sunflower",
-"cotton rose",
-"gazania",
-"African daisy",
-"cudweed",
-"gumweed",
-"goldenbush",
-"sneezeweed",
-"sunflower",
-"hawkweed",
-"marsh elder",
-"krigia",
-"hawkbit",
-"blazing star",
-"rattlesnake root",
-"daisybush",
-"coneflower",
-"coneflower",
-"cutleaved coneflower",
-"golden thistle",
-"white-topped aster",
-"goldenrod",
-"sow thistle",
-"marigold",
-"dandelion",
-"crownbeard",
-"zinnia",
-"achene",
-"campanula",
-"orchid",
-"orchis",
-"arethusa",
-"helleborine",
-"coral root",
-"lady's slipper",
-"large yellow lady's slipper",
-"helleborine",
-"fringed orchis",
-"rein orchid",
-"spider orchid",
-"moth orchid",
-"butterfly orchid",
-"ladies' tresses",
-"vanda",
-"vanilla",
-"yam",
-"primrose",
-"pimpernel",
-"featherfoil",
-"loosestrife",
-"water pimpernel",
-"gramineous plant",
-"grass",
-"wheatgrass",
-"foxtail",
-"broom grass",
-"oat",
-"brome",
-"grama",
-"reed grass",
-"burgrass",
-"crabgrass",
-"lyme grass",
-"wild rye",
-"plume grass",
-"rye grass",
-"ricegrass",
-"meadowgrass",
-"millet",
-"reed",
-"sorghum",
-"grain sorghum",
-"cordgrass",
-"cereal",
-"wheat",
-"corn",
-"mealie",
-"zoysia",
-"bamboo",
-"cotton grass",
-"spike rush",
-"pandanus",
-"cattail",
-"grain",
-"kernel",
-"gourd",
-"gourd",
-"squash",
-"summer squash",
-"marrow",
-"winter squash",
-"turban squash",
-"bryony",
-"sweet melon",
-"luffa",
-"lobelia",
-"mallow",
-"hollyhock",
-"althea",
-"poppy mallow",
-"seashore mallow",
-"globe mallow",
-"tulipwood tree",
-"sterculia",
-"bottle-tree",
-"screw tree",
-"cacao",
-"linden",
-"herb",
-"protea",
-"banksia",
-"grevillea",
-"macadamia",
-"casuarina",
-"beefwood",
-"heath",
-"bearberry",
-"huckleberry",
-"kalmia",
-"rhododendron",
-"cranberry",
-"blueberry",
-"shortia",
-"Australian heath",
-"epacris",
-"wintergreen",
-"pipsissewa",
-"beech",
-"chestnut",
-"tanbark oak",
-"southern beech",
-"New Zealand beech",
-"oak",
-"live oak",
-"white oak",
-"red oak",
-"scrub oak",
-"chestnut oak",
-"birch",
-"alder",
-"hornbeam",
-"hop hornbeam",
-"hazelnut",
-"centaury",
-"gentian",
-"fringed gentian",
-"olive tree",
-"fringe tree",
-"ash",
-"red ash",
-"jasmine",
-"privet",
-"lilac",
-"liquidambar",
-"walnut",
-"hickory",
-"wing nut",
-"loosestrife",
-"myrtle",
-"gum tree",
-"eucalyptus",
-"flooded gum",
-"mallee",
-"stringybark",
-"tupelo",
-"enchanter's nightshade",
-"willowherb",
-"fuchsia",
-"evening primrose",
-"daphne",
-"canna",
-"banana",
-"ginger",
-"begonia",
-"tuberous begonia",
-"poon",
-"St John's wort",
-"rockrose",
-"dipterocarp",
-"candlewood",
-"reseda",
-"viola",
-"violet",
-"nettle",
-"cannabis",
-"mulberry",
-"fig tree",
-"fig",
-"elm",
-"hackberry",
-"iridaceous plant",
-"bearded iris",
-"beardless iris",
-"crocus",
-"amaryllis",
-"blood lily",
-"narcissus",
-"daffodil",
-"liliaceous plant",
-"colicroot",
-"alliaceous plant",
-"kniphofia",
-"poker plant",
-"asphodel",
-"mariposa",
-"globe lily",
-"camas",
-"dogtooth violet",
-"fritillary",
-"tulip",
-"star-of-Bethlehem",
-"grape hyacinth",
-"scilla",
-"false asphodel",
-"bog asphodel",
-"hellebore",
-"death camas",
-"sarsaparilla",
-"Solomon's-seal",
-"bellwort",
-"agave",
-"sansevieria",
-"cassia",
-"locust tree",
-"senna",
-"angelim",
-"milk vetch",
-"wild indigo",
-"pea tree",
-"glory pea",
-"rosewood",
-"blackwood",
-"tick trefoil",
-"coral tree",
-"vetchling",
-"wild pea",
-"lupine",
-"medic",
-"mucuna",
-"locoweed",
-"pole bean",
-"pea",
-"edible-pod pea",
-"quira",
-"hoary pea",
-"bush pea",
-"vetch",
-"palm",
-"sago palm",
-"feather palm",
-"fan palm",
-"palmetto",
-"areca",
-"calamus",
-"oil palm",
-"raffia palm",
-"lady palm",
-"eriogonum",
-"rhubarb",
-"water plantain",
-"waterweed",
-"pondweed",
-"rose",
-"agrimonia",
-"flowering quince",
-"cotoneaster",
-"avens",
-"apple tree",
-"wild apple",
-"crab apple",
-"Iowa crab",
-"cinquefoil",
-"plum",
-"wild plum",
-"bullace",
-"apricot",
-"cherry",
-"wild cherry",
-"sweet cherry",
-"sour cherry",
-"almond tree",
-"almond",
-"bird cherry",
-"flowering cherry",
-"chokecherry",
-"fruit tree",
-"bramble bush",
-"raspberry",
-"mountain ash",
-"service tree",
-"spirea",
-"madderwort",
-"coffee",
-"cinchona",
-"bedstraw",
-"genipa",
-"hamelia",
-"honeysuckle",
-"American fly honeysuckle",
-"teasel",
-"scabious",
-"geranium",
-"cranesbill",
-"storksbill",
-"incense tree",
-"mahogany",
-"silver ash",
-"milkwort",
-"citrus",
-"orange",
-"mandarin",
-"lemon",
-"kumquat",
-"prickly ash",
-"bitterwood tree",
-"ailanthus",
-"nasturtium",
-"willow",
-"osier",
-"sallow",
-"poplar",
-"black poplar",
-"cottonwood",
-"aspen",
-"soapberry",
-"soapberry vine",
-"harpullia",
-"pachysandra",
-"spindle tree",
-"maple",
-"box elder",
-"holly",
-"sumac",
-"horse chestnut",
-"persimmon",
-"buckthorn",
-"styrax",
-"carnivorous plant",
-"pitcher plant",
-"sedum",
-"philadelphus",
-"saxifrage",
-"astilbe",
-"alumroot",
-"miterwort",
-"parnassia",
-"currant",
-"plane tree",
-"phlox",
-"acanthus",
-"catalpa",
-"anchusa",
-"comfrey",
-"convolvulus",
-"bindweed",
-"gloxinia",
-"streptocarpus",
-"waterleaf",
-"nemophila",
-"scorpionweed",
-"giant hyssop",
-"bugle",
-"wood mint",
-"calamint",
-"coleus",
-"dead nettle",
-"origanum",
-"horehound",
-"monarda",
-"savory",
-"germander",
-"thyme",
-"blue curls",
-"snapdragon",
-"kitten-tails",
-"Indian paintbrush",
-"foxglove",
-"toadflax",
-"veronica",
-"nightshade",
-"thorn apple",
-"matrimony vine",
-"cupflower",
-"petunia",
-"salpiglossis",
-"spurge",
-"croton",
-"cassava",
-"slipper spurge",
-"camellia",
-"umbellifer",
-"angelica",
-"astrantia",
-"caraway",
-"fennel",
-"parsnip",
-"parsley",
-"sanicle",
-"dogwood",
-"valerian",
-"bristle fern",
-"flowering fern",
-"climbing fern",
-"clover fern",
-"adder's tongue",
-"grape fern",
-"ergot",
-"sclerotinia",
-"earthball",
-"Podaxaceae",
-"false truffle",
-"rhizopus",
-"slime mold",
-"cellular slime mold",
-"downy mildew",
-"pythium",
-"Sarcosomataceae",
-"club fungus",
-"lichen",
-"lecanora",
-"fungus",
-"basidiomycete",
-"mushroom",
-"mushroom",
-"mushroom",
-"toadstool",
-"horse mushroom",
-"meadow mushroom",
-"royal agaric",
-"false deathcap",
-"fly agaric",
-"death cap",
-"blushing mushroom",
-"destroying angel",
-"chanterelle",
-"floccose chanterelle",
-"pig's ears",
-"cinnabar chanterelle",
-"jack-o-lantern fungus",
-"inky cap",
-"shaggymane",
-"milkcap",
-"fairy-ring mushroom",
-"oyster mushroom",
-"olive-tree agaric",
-"Pholiota astragalina",
-"Pholiota aurea",
-"Pholiota destruens",
-"Pholiota flammans",
-"Pholiota flavida",
-"nameko",
-"Pholiota squarrosa-adiposa",
-"Pholiota squarrosa",
-"Pholiota squarrosoides",
-"Stropharia ambigua",
-"Stropharia hornemannii",
-"Stropharia rugoso-annulata",
-"Entoloma lividum",
-"Entoloma aprile",
-"Chlorophyllum molybdites",
-"lepiota",
-"parasol mushroom",
-"poisonous parasol",
-"Lepiota naucina",
-"Lepiota rhacodes",
-"American parasol",
-"Lepiota rubrotincta",
-"Lepiota clypeolaria",
-"onion stem",
-"blewits",
-"sandy mushroom",
-"Tricholoma pessundatum",
-"Tricholoma sejunctum",
-"man-on-a-horse",
-"Tricholoma venenata",
-"Tricholoma pardinum",
-"Tricholoma vaccinum",
-"Tricholoma aurantium",
-"Pluteus aurantiorugosus",
-"Pluteus magnus",
-"deer mushroom",
-"straw mushroom",
-"Volvariella bombycina",
-"Clitocybe clavipes",
-"Clitocybe dealbata",
-"Clitocybe inornata",
-"Clitocybe robusta",
-"Clitocybe irina",
-"Clitocybe subconnexa",
-"winter mushroom",
-"mycelium",
-"ascomycete",
-"Clavicipitaceae",
-"yeast",
-"discomycete",
-"morel",
-"Verpa",
-"false morel",
-"lorchel",
-"helvella",
-"Gyromitra californica",
-"Gyromitra sphaerospora",
-"Gyromitra esculenta",
-"Gyromitra infula",
-"Gyromitra gigas",
-"gasteromycete",
-"common stinkhorn",
-"Phallus ravenelii",
-"dog stinkhorn",
-"stinky squid",
-"puffball",
-"Geastrum coronatum",
-"Astreus pteridis",
-"Astreus hygrometricus",
-"polypore",
-"Boletus chrysenteron",
-"Boletus edulis",
-"Frost's bolete",
-"Boletus luridus",
-"Boletus mirabilis",
-"Boletus pallidus",
-"Boletus pulcherrimus",
-"Boletus pulverulentus",
-"Boletus roxanae",
-"Boletus subvelutipes",
-"Boletus variipes",
-"Boletus zelleri",
-"Fuscoboletinus paluster",
-"Fuscoboletinus serotinus",
-"Leccinum fibrillosum",
-"Suillus albivelatus",
-"old-man-of-the-woods",
-"Boletellus russellii",
-"jelly fungus",
-"rust",
-"smut",
-"cornsmut",
-"flag smut fungus",
-"waxycap",
-"Hygrocybe acutoconica",
-"Hygrophorus borealis",
-"Hygrophorus caeruleus",
-"Hygrophorus inocybiformis",
-"Hygrophorus kauffmanii",
-"Hygrophorus marzuolus",
-"Hygrophorus purpurascens",
-"Hygrophorus russula",
-"Hygrophorus sordidus",
-"Hygrophorus tennesseensis",
-"Hygrophorus turundus",
-"Neohygrophorus angelesianus",
-"Cortinarius armillatus",
-"Cortinarius atkinsonianus",
-"Cortinarius corrugatus",
-"Cortinarius gentilis",
-"Cortinarius mutabilis",
-"Cortinarius semisanguineus",
-"Cortinarius subfoetidus",
-"Cortinarius violaceus",
-"Gymnopilus spectabilis",
-"Gymnopilus validipes",
-"Gymnopilus ventricosus",
-"mold",
-"mildew",
-"candida",
-"houseplant",
-"succulent",
-"weed",
-"sporophyll",
-"sporangium",
-"poisonous plant",
-"vine",
-"tree",
-"bean tree",
-"gymnospermous tree",
-"conifer",
-"angiospermous tree",
-"nut tree",
-"spice tree",
-"bonsai",
-"subshrub",
-"bramble",
-"liana",
-"desert plant",
-"marsh plant",
-"strangler",
-"root",
-"receptacle",
-"scape",
-"peduncle",
-"flower cluster",
-"raceme",
-"cyme",
-"bulbous plant",
-"fruit",
-"seed",
-"bean",
-"nut",
-"berry",
-"aggregate fruit",
-"drupe",
-"drupelet",
-"pome",
-"pod",
-"husk",
-"buckthorn",
-"vinifera",
-"true pepper",
-"peperomia",
-"bract",
-"palmate leaf",
-"pinnate leaf",
-"dentate leaf",
-"branchlet",
-"polypody",
-"strap fern",
-"staghorn fern",
-"spleenwort",
-"chain fern",
-"davallia",
-"hare's-foot fern",
-"shield fern",
-"wood fern",
-"lady fern",
-"bladder fern",
-"holly fern",
-"woodsia",
-"maidenhair",
-"brittle maidenhair",
-"lip fern",
-"cliff brake",
-"horsetail",
-"club moss",
-"spikemoss",
-"beech fern",
-"shoestring fungus",
-"Armillaria caligata",
-"Armillaria ponderosa",
-"Armillaria zelleri",
-"honey mushroom",
-"milkweed",
-"stapelia",
-"stephanotis",
-"orangery",
-"figure",
-"plane figure",
-"solid figure",
-"line",
-"convex shape",
-"concave shape",
-"cylinder",
-"round shape",
-"polygon",
-"concave polygon",
-"amorphous shape",
-"closed curve",
-"simple closed curve",
-"cone",
-"circle",
-"ring",
-"loop",
-"ellipse",
-"triangle",
-"spherical polygon",
-"angular distance",
-"groove",
-"bulge",
-"bow",
-"balance",
-"toroid",
-"boundary",
-"incisure",
-"notch",
-"wrinkle",
-"tree",
-"regular polyhedron",
-"carbon",
-"rock",
-"soil",
-"high explosive",
-"culture medium",
-"agar",
-"paper",
-"paving",
-"plaster",
-"stucco",
-"tear gas",
-"vitamin",
-"fat-soluble vitamin",
-"water-soluble vitamin",
-"vitamin A",
-"B-complex vitamin",
-"vitamin E",
-"vitamin K"};
-
-#ifdef __cplusplus
-}
-#endif
-#endif
@@ -1,15 +1,17 @@
 #include "convolutional_layer.h"
 #include "utils.h"
+#include "tensor_alloc.h"
 #include "im2col.h"
 #include "blas.h"
 #include "gemm.h"
+#include "trace.h"
+#include "network.h"
 #include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
 #include <time.h>
 
-#ifdef AI2
-#include "xnor_layer.h"
-#endif
-
 #ifdef __cplusplus
 #define PUT_IN_REGISTER
 #else
@@ -38,12 +40,16 @@ size_t get_workspace_size16(layer l) {
 }
 
 size_t get_convolutional_workspace_size(layer l) {
+    if (l.xnor) return (size_t)l.out_h*l.out_w*l.lda_align*sizeof(uint64_t);
+    if (l.algorithm != CONV_IM2COL_GEMM || l.channel_block || l.input_channel_block) return 0;
     size_t workspace_size = get_workspace_size32(l);
     size_t workspace_size16 = get_workspace_size16(l);
     if (workspace_size16 > workspace_size) workspace_size = workspace_size16;
     return workspace_size;
 }
 
+int convolutional_layer_banner = 1;
+
 convolutional_layer make_convolutional_layer(int batch, int h, int w, int c, int n, int groups, int size, int stride, int padding, ACTIVATION activation, int batch_normalize)
 {
     int total_batch = batch;
@@ -66,7 +72,7 @@ convolutional_layer make_convolutional_layer(int batch, int h, int w, int c, int
     l.nweights = (c / groups) * n * size * size;
 
 
-    l.weights = (float*)xcalloc(l.nweights, sizeof(float));
+    l.weights = (float*)tensor_calloc(l.nweights, sizeof(float));
     l.biases = (float*)xcalloc(n, sizeof(float));
 
     // float scale = 1./sqrt(size*size*c);
@@ -81,7 +87,7 @@ convolutional_layer make_convolutional_layer(int batch, int h, int w, int c, int
     l.inputs = l.w * l.h * l.c;
     l.activation = activation;
 
-    l.output = (float*)xcalloc(total_batch*l.outputs, sizeof(float));
+    l.output = (float*)tensor_calloc(total_batch*l.outputs, sizeof(float));
 
     l.forward = forward_convolutional_layer;
 
@@ -95,9 +101,14 @@ convolutional_layer make_convolutional_layer(int batch, int h, int w, int c, int
     }
 
 
+    // input layers with a few channels get their own kernel, GEMM with K = 27 barely vectorizes
+    if (conv_algorithm_supported(l, CONV_DIRECT_RGB)) set_convolutional_algorithm(&l, CONV_DIRECT_RGB);
+    // and depthwise layers would otherwise be c GEMMs with a single row
+    else if (conv_algorithm_supported(l, CONV_DEPTHWISE)) set_convolutional_algorithm(&l, CONV_DEPTHWISE);
     l.workspace_size = get_convolutional_workspace_size(l);
 
     l.bflops = (2.0 * l.nweights * l.out_h*l.out_w) / 1000000000.;
+    if (!convolutional_layer_banner) return l;
 
     fprintf(stderr, "conv  ");
 
@@ -111,6 +122,25 @@ convolutional_layer make_convolutional_layer(int batch, int h, int w, int c, int
     return l;
 }
 
+// New input size, the weights and the algorithm are kept; the caller resizes the network workspace
+void resize_convolutional_layer(convolutional_layer *l, int w, int h)
+{
+    l->w = w;
+    l->h = h;
+    l->out_w = convolutional_out_width(*l);
+    l->out_h = convolutional_out_height(*l);
+    l->outputs = l->out_h * l->out_w * l->out_c;
+    l->inputs = l->w * l->h * l->c;
+    l->output = (float*)tensor_realloc(l->output, (size_t)l->batch*l->outputs*sizeof(float));
+    // the algorithm is checked against the new shape, falling back to im2col_gemm; the packed
+    // weights of a blocked layer don't depend on the size
+    if (!l->packed_weights) set_convolutional_algorithm(l, l->algorithm);
+    l->workspace_size = get_convolutional_workspace_size(*l);
+    // tuned for the old size, see autotune_network()
+    l->threads = 0;
+    l->bflops = (2.0 * l->nweights * l->out_h*l->out_w) / 1000000000.;
+}
+
 void add_bias(float *output, float *biases, int batch, int n, int size)
 {
     int i,j,b;
@@ -128,29 +158,747 @@ void forward_convolutional_layer(convolutional_layer l, network_state state)
 {
     int out_h = convolutional_out_height(l);
     int out_w = convolutional_out_width(l);
+    int i, j;
+
+    fill_cpu(l.outputs*l.batch, 0, l.output, 1);
+
+    // one GEMM per group: n/groups filters over the c/groups channels of their group
+    int m = l.n / l.groups;
+    int k = l.size*l.size*l.c / l.groups;
+    int n = out_h*out_w;
+
+    for(i = 0; i < l.batch; ++i){
+        for(j = 0; j < l.groups; ++j){
+            float *a = l.weights + j*l.nweights / l.groups;
+            float *b = state.workspace;
+            float *c = l.output + (i*l.groups + j)*n*m;
+            float *im = state.input + (i*l.groups + j)*(l.c / l.groups)*l.h*l.w;
+
+            trace_begin("im2col", i);
+            im2col_cpu(im, l.c / l.groups, l.h, l.w,
+                    l.size, l.stride, l.pad, b);
+            trace_end("im2col", i);
+            trace_begin("gemm", i);
+            gemm(0,0,m,n,k,1,a,k,b,n,1,c,n);
+            trace_end("gemm", i);
+        }
+    }
+
+    trace_begin("add_bias", l.n);
+    add_bias(l.output, l.biases, l.batch, l.n, out_h*out_w);
+    trace_end("add_bias", l.n);
+
+    trace_begin("activate_array", l.activation);
+    activate_array(l.output, l.n*n*l.batch, l.activation);
+    trace_end("activate_array", l.activation);
+}
+
+// 1x1 kernels with stride 1 and no padding: the input planes already are the im2col matrix
+void forward_convolutional_layer_1x1(convolutional_layer l, network_state state)
+{
     int i;
+    int m = l.n;
+    int k = l.c;
+    int n = l.out_h*l.out_w;
+
+    fill_cpu(l.outputs*l.batch, 0, l.output, 1);
+    for(i = 0; i < l.batch; ++i){
+        trace_begin("gemm", i);
+        gemm(0,0,m,n,k,1,l.weights,k,state.input + i*l.inputs,n,1,l.output + i*l.outputs,n);
+        trace_end("gemm", i);
+    }
 
+    add_bias(l.output, l.biases, l.batch, l.n, n);
+    activate_array(l.output, l.outputs*l.batch, l.activation);
+}
+
+// Each kernel tap is applied to a whole output plane, so the inner loop runs over contiguous
+// input rows without bounds checks and without any workspace.
+void forward_convolutional_layer_direct(convolutional_layer l, network_state state)
+{
+    int b, f;
     fill_cpu(l.outputs*l.batch, 0, l.output, 1);
 
+    for(b = 0; b < l.batch; ++b){
+        float *input = state.input + b*l.inputs;
+        #pragma omp parallel for
+        for(f = 0; f < l.n; ++f){
+            float *out = l.output + b*l.outputs + f*l.out_h*l.out_w;
+            int cg = l.c / l.groups;
+            int k, y, x, i, j;
+            for(k = 0; k < cg; ++k){
+                float *in = input + (f / (l.n / l.groups)*cg + k)*l.h*l.w;
+                for(y = 0; y < l.size; ++y){
+                    int i0, i1;
+                    conv_output_range(y, l.pad, l.stride, l.h, l.out_h, &i0, &i1);
+                    for(x = 0; x < l.size; ++x){
+                        int j0, j1;
+                        conv_output_range(x, l.pad, l.stride, l.w, l.out_w, &j0, &j1);
+                        float w = l.weights[((f*cg + k)*l.size + y)*l.size + x];
+                        for(i = i0; i < i1; ++i){
+                            float *row = in + (i*l.stride + y - l.pad)*l.w + x - l.pad;
+                            float *o = out + i*l.out_w;
+                            if (l.stride == 1) {
+                                for(j = j0; j < j1; ++j) o[j] += w*row[j];
+                            }
+                            else {
+                                for(j = j0; j < j1; ++j) o[j] += w*row[j*l.stride];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    add_bias(l.output, l.biases, l.batch, l.n, l.out_h*l.out_w);
+    activate_array(l.output, l.outputs*l.batch, l.activation);
+}
+
+#define IMPLICIT_GEMM_TILE_N 256   // output pixels per tile
+#define IMPLICIT_GEMM_TILE_K 64    // patch rows per packed panel
+
+// Gathers rows k0..k0+kb of the im2col matrix, restricted to output pixels n0..n0+nb, into panel
+// (row stride IMPLICIT_GEMM_TILE_N). Pixels are walked one output row segment at a time so the
+// interior is a straight or strided copy and only the border is zero-filled.
+static void pack_implicit_gemm_panel(convolutional_layer l, const float *input, int k0, int kb, int n0, int nb, float *panel)
+{
+    int r;
+    for (r = 0; r < kb; ++r) {
+        int row = k0 + r;
+        int kx = row % l.size;
+        int ky = (row / l.size) % l.size;
+        const float *im = input + (row / l.size / l.size)*l.h*l.w;
+        int j0, j1;
+        conv_output_range(kx, l.pad, l.stride, l.w, l.out_w, &j0, &j1);
+
+        float *dst = panel + r*IMPLICIT_GEMM_TILE_N;
+        int oy = n0 / l.out_w;
+        int ox = n0 % l.out_w;
+        int p = 0;
+        while (p < nb) {
+            int seg = nb - p < l.out_w - ox ? nb - p : l.out_w - ox;
+            int iy = oy*l.stride + ky - l.pad;
+            float *out = dst + p - ox;      // indexed by output column
+            int j;
+            if (iy < 0 || iy >= l.h) {
+                for (j = ox; j < ox + seg; ++j) out[j] = 0;
+            }
+            else {
+                const float *src = im + iy*l.w + kx - l.pad;
+                // both clamped to the segment, a tile can end before the valid columns start
+                int end = ox + seg;
+                int lo = j0 > ox ? j0 : ox;
+                int hi = j1 < end ? j1 : end;
+                if (lo > end) lo = end;
+                if (hi < lo) hi = lo;
+                for (j = ox; j < lo; ++j) out[j] = 0;
+                if (l.stride == 1) memcpy(out + lo, src + lo, (hi - lo)*sizeof(float));
+                else {
+                    for (j = lo; j < hi; ++j) out[j] = src[j*l.stride];
+                }
+                for (j = hi; j < ox + seg; ++j) out[j] = 0;
+            }
+            p += seg;
+            ++oy;
+            ox = 0;
+        }
+    }
+}
+
+// Same math as im2col + GEMM, but each thread packs only the patch panel of the output tile it is
+// computing into a small stack buffer, so the full im2col matrix is never written or read back.
+void forward_convolutional_layer_implicit_gemm(convolutional_layer l, network_state state)
+{
+    int b, t;
     int m = l.n;
     int k = l.size*l.size*l.c;
-    int n = out_h*out_w;
+    int n = l.out_h*l.out_w;
+    int tiles = (n + IMPLICIT_GEMM_TILE_N - 1) / IMPLICIT_GEMM_TILE_N;
 
+    fill_cpu(l.outputs*l.batch, 0, l.output, 1);
+    for(b = 0; b < l.batch; ++b){
+        float *input = state.input + b*l.inputs;
+        float *output = l.output + b*l.outputs;
+        trace_begin("implicit gemm", b);
+        #pragma omp parallel for
+        for(t = 0; t < tiles; ++t){
+            float panel[IMPLICIT_GEMM_TILE_K*IMPLICIT_GEMM_TILE_N];
+            int n0 = t*IMPLICIT_GEMM_TILE_N;
+            int nb = n - n0 < IMPLICIT_GEMM_TILE_N ? n - n0 : IMPLICIT_GEMM_TILE_N;
+            int k0;
+            for(k0 = 0; k0 < k; k0 += IMPLICIT_GEMM_TILE_K){
+                int kb = k - k0 < IMPLICIT_GEMM_TILE_K ? k - k0 : IMPLICIT_GEMM_TILE_K;
+                pack_implicit_gemm_panel(l, input, k0, kb, n0, nb, panel);
+                gemm_nn(m, nb, kb, 1, l.weights + k0, k, panel, IMPLICIT_GEMM_TILE_N, output + n0, n);
+            }
+        }
+        trace_end("implicit gemm", b);
+    }
 
-    float *a = l.weights;
-    float *b = state.workspace;
-    float *c = l.output;
+    trace_begin("add_bias", l.n);
+    add_bias(l.output, l.biases, l.batch, l.n, n);
+    trace_end("add_bias", l.n);
 
-    for(i = 0; i < l.batch; ++i){
-        im2col_cpu(state.input, l.c, l.h, l.w, 
-                l.size, l.stride, l.pad, b);
-        gemm(0,0,m,n,k,1,a,k,b,n,1,c,n);
-        c += n*m;
-        state.input += l.c*l.h*l.w;
+    trace_begin("activate_array", l.activation);
+    activate_array(l.output, l.outputs*l.batch, l.activation);
+    trace_end("activate_array", l.activation);
+}
+
+#define NCHWC_LANES 8       // output channels accumulated together, one AVX register
+#define NCHWC_TILE_W 4      // output pixels accumulated together
+
+// Output channels lane0..lane0+NCHWC_LANES-1 of output block ob for pixels x0..x0+nx-1 of output
+// row oy. Every weight load is a contiguous vector of lanes and every input value is broadcast,
+// so the inner loop needs no gathers. Interior tiles, where all taps fall inside the image, skip
+// the bounds checks.
+static void conv_nchwc_tile(const convolutional_layer *l, const float *input, float *output, int block,
+    int ob, int lane0, int oy, int x0, int nx, int interior)
+{
+    float acc[NCHWC_TILE_W][NCHWC_LANES];
+    const int in_block = l->input_channel_block;
+    const int sx = in_block ? in_block : 1;
+    const size_t plane = (size_t)l->h*l->w;
+    const int k0 = ob*block + lane0;
+    int ic, ky, kx, t, q;
+
+    for (t = 0; t < NCHWC_TILE_W; ++t) {
+        for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] = k0 + q < l->n ? l->biases[k0 + q] : 0;
+    }
+    const float *w = l->packed_weights + (size_t)ob*l->c*l->size*l->size*block + lane0;
+    for (ic = 0; ic < l->c; ++ic) {
+        const float *im = in_block ? input + (ic/in_block)*plane*in_block + ic%in_block : input + ic*plane;
+        for (ky = 0; ky < l->size; ++ky) {
+            int iy = oy*l->stride + ky - l->pad;
+            if (iy < 0 || iy >= l->h) continue;
+            const float *row = im + (size_t)iy*l->w*sx;
+            const float *wk = w + ((size_t)ic*l->size + ky)*l->size*block;
+            for (kx = 0; kx < l->size; ++kx) {
+                const float *wv = wk + kx*block;
+                if (interior) {
+                    const float *px = row + (ptrdiff_t)(x0*l->stride + kx - l->pad)*sx;
+                    for (t = 0; t < NCHWC_TILE_W; ++t) {
+                        float v = px[t*l->stride*sx];
+                        for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] += v*wv[q];
+                    }
+                }
+                else {
+                    for (t = 0; t < nx; ++t) {
+                        int ix = (x0 + t)*l->stride + kx - l->pad;
+                        if (ix < 0 || ix >= l->w) continue;
+                        float v = row[ix*sx];
+                        for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] += v*wv[q];
+                    }
+                }
+            }
+        }
     }
 
-    add_bias(l.output, l.biases, l.batch, l.n, out_h*out_w);
+    if (l->channel_block) {
+        float *o = output + (((size_t)ob*l->out_h + oy)*l->out_w + x0)*block + lane0;
+        for (t = 0; t < nx; ++t) {
+            for (q = 0; q < NCHWC_LANES; ++q) o[t*block + q] = acc[t][q];
+        }
+    }
+    else {
+        for (q = 0; q < NCHWC_LANES && k0 + q < l->n; ++q) {
+            float *o = output + ((size_t)(k0 + q)*l->out_h + oy)*l->out_w + x0;
+            for (t = 0; t < nx; ++t) o[t] = acc[t][q];
+        }
+    }
+}
+
+// Direct convolution on blocked activations, see set_convolutional_channel_block(). Reading an
+// NCHW input or writing an NCHW output is folded into the kernel, which is how the network
+// converts at its input and its head without extra passes.
+void forward_convolutional_layer_nchwc(convolutional_layer l, network_state state)
+{
+    int block = l.channel_block ? l.channel_block : l.input_channel_block;
+    int blocks = channel_blocks(l.n, block);
+    int x_lo, x_hi, unused;
+    int b, r;
+    conv_output_range(0, l.pad, l.stride, l.w, l.out_w, &x_lo, &unused);
+    conv_output_range(l.size - 1, l.pad, l.stride, l.w, l.out_w, &unused, &x_hi);
+
+    for(b = 0; b < l.batch; ++b){
+        const float *input = state.input + (size_t)b*l.inputs;
+        float *output = l.output + (size_t)b*l.outputs;
+        trace_begin("direct nchwc", b);
+        #pragma omp parallel for
+        for(r = 0; r < blocks*l.out_h; ++r){
+            int ob = r / l.out_h;
+            int oy = r % l.out_h;
+            int lane0, x0;
+            for(lane0 = 0; lane0 < block; lane0 += NCHWC_LANES){
+                for(x0 = 0; x0 < l.out_w; x0 += NCHWC_TILE_W){
+                    int nx = l.out_w - x0 < NCHWC_TILE_W ? l.out_w - x0 : NCHWC_TILE_W;
+                    int interior = nx == NCHWC_TILE_W && x0 >= x_lo && x0 + nx <= x_hi;
+                    conv_nchwc_tile(&l, input, output, block, ob, lane0, oy, x0, nx, interior);
+                }
+            }
+        }
+        trace_end("direct nchwc", b);
+    }
 
-    activate_array(l.output, m*n*l.batch, l.activation);
+    trace_begin("activate_array", l.activation);
+    activate_array(l.output, l.outputs*l.batch, l.activation);
+    trace_end("activate_array", l.activation);
 }
 
+#define DEPTHWISE_TILE_W 16  // output pixels of a plane accumulated together
+
+// One channel of a depthwise convolution. Output pixels are accumulated DEPTHWISE_TILE_W at a time
+// in registers over all the taps, then activated and stored once; only the tiles that touch the
+// padding check bounds.
+static void depthwise_plane(const convolutional_layer *l, const float *in, const float *w, float bias, float *out)
+{
+    float acc[DEPTHWISE_TILE_W];
+    int x_lo, x_hi, unused;
+    int i, x0, ky, kx, t;
+    conv_output_range(0, l->pad, l->stride, l->w, l->out_w, &x_lo, &unused);
+    conv_output_range(l->size - 1, l->pad, l->stride, l->w, l->out_w, &unused, &x_hi);
+
+    for (i = 0; i < l->out_h; ++i) {
+        for (x0 = 0; x0 < l->out_w; x0 += DEPTHWISE_TILE_W) {
+            int nx = l->out_w - x0 < DEPTHWISE_TILE_W ? l->out_w - x0 : DEPTHWISE_TILE_W;
+            int interior = nx == DEPTHWISE_TILE_W && x0 >= x_lo && x0 + nx <= x_hi;
+            for (t = 0; t < DEPTHWISE_TILE_W; ++t) acc[t] = bias;
+            for (ky = 0; ky < l->size; ++ky) {
+                int iy = i*l->stride + ky - l->pad;
+                if (iy < 0 || iy >= l->h) continue;
+                const float *row = in + iy*l->w;
+                for (kx = 0; kx < l->size; ++kx) {
+                    float wv = w[ky*l->size + kx];
+                    if (interior) {
+                        const float *px = row + x0*l->stride + kx - l->pad;
+                        if (l->stride == 1) {
+                            for (t = 0; t < DEPTHWISE_TILE_W; ++t) acc[t] += wv*px[t];
+                        }
+                        else {
+                            for (t = 0; t < DEPTHWISE_TILE_W; ++t) acc[t] += wv*px[t*l->stride];
+                        }
+                    }
+                    else {
+                        for (t = 0; t < nx; ++t) {
+                            int ix = (x0 + t)*l->stride + kx - l->pad;
+                            if (ix >= 0 && ix < l->w) acc[t] += wv*row[ix];
+                        }
+                    }
+                }
+            }
+            // acc stays a register tile as long as its address is not taken
+            float *o = out + i*l->out_w + x0;
+            if (l->activation == LEAKY) {
+                for (t = 0; t < nx; ++t) o[t] = leaky_activate(acc[t]);
+            }
+            else {
+                for (t = 0; t < nx; ++t) o[t] = activate(acc[t], l->activation);
+            }
+        }
+    }
+}
+
+// Channels lane0..lane0+NCHWC_LANES-1 of channel block cb for pixels x0..x0+nx-1 of output row oy.
+// Each channel only reads its own input channel, so a tap is one multiply-add of a vector of
+// inputs by a vector of weights, with no broadcast; with blocked input both are contiguous.
+static void depthwise_nchwc_tile(const convolutional_layer *l, const float *input, float *output, int block,
+    int cb, int lane0, int oy, int x0, int nx, int interior)
+{
+    float acc[NCHWC_TILE_W][NCHWC_LANES];
+    const int in_block = l->input_channel_block;
+    const size_t plane = (size_t)l->h*l->w;
+    const int k0 = cb*block + lane0;
+    // lane q of input pixel p is im[p*sx + q*sq]
+    const int sx = in_block ? in_block : 1;
+    const size_t sq = in_block ? 1 : plane;
+    const float *im = in_block ? input + (size_t)cb*plane*block + lane0 : input + (size_t)k0*plane;
+    const float *w = l->packed_weights + (size_t)cb*l->size*l->size*block + lane0;
+    int ky, kx, t, q;
+
+    for (t = 0; t < NCHWC_TILE_W; ++t) {
+        for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] = l->biases[k0 + q];
+    }
+    for (ky = 0; ky < l->size; ++ky) {
+        int iy = oy*l->stride + ky - l->pad;
+        if (iy < 0 || iy >= l->h) continue;
+        const float *row = im + (size_t)iy*l->w*sx;
+        for (kx = 0; kx < l->size; ++kx) {
+            const float *wv = w + (ky*l->size + kx)*block;
+            if (interior) {
+                const float *px = row + (ptrdiff_t)(x0*l->stride + kx - l->pad)*sx;
+                for (t = 0; t < NCHWC_TILE_W; ++t) {
+                    const float *v = px + t*l->stride*sx;
+                    if (in_block) {
+                        for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] += v[q]*wv[q];
+                    }
+                    else {
+                        for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] += v[q*sq]*wv[q];
+                    }
+                }
+            }
+            else {
+                for (t = 0; t < nx; ++t) {
+                    int ix = (x0 + t)*l->stride + kx - l->pad;
+                    if (ix < 0 || ix >= l->w) continue;
+                    const float *v = row + ix*sx;
+                    for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] += v[q*sq]*wv[q];
+                }
+            }
+        }
+    }
+    for (t = 0; t < nx; ++t) {
+        if (l->activation == LEAKY) {
+            for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] = leaky_activate(acc[t][q]);
+        }
+        else if (l->activation != LINEAR) {
+            for (q = 0; q < NCHWC_LANES; ++q) acc[t][q] = activate(acc[t][q], l->activation);
+        }
+    }
+
+    if (l->channel_block) {
+        float *o = output + (((size_t)cb*l->out_h + oy)*l->out_w + x0)*block + lane0;
+        for (t = 0; t < nx; ++t) {
+            for (q = 0; q < NCHWC_LANES; ++q) o[t*block + q] = acc[t][q];
+        }
+    }
+    else {
+        for (q = 0; q < NCHWC_LANES; ++q) {
+            float *o = output + ((size_t)(k0 + q)*l->out_h + oy)*l->out_w + x0;
+            for (t = 0; t < nx; ++t) o[t] = acc[t][q];
+        }
+    }
+}
+
+// Depthwise convolution, groups == c == n, as in the MobileNet / EfficientNet blocks. Instead of
+// c GEMMs of one row each, NCHW input runs one plane per task and the blocked layout computes a
+// vector of channels per tap, see set_convolutional_channel_block(). Bias and activation are
+// applied before the store.
+void forward_convolutional_layer_depthwise(convolutional_layer l, network_state state)
+{
+    int block = l.channel_block ? l.channel_block : l.input_channel_block;
+    int b, r;
+
+    if (!block) {
+        trace_begin("depthwise", l.batch);
+        #pragma omp parallel for
+        for(r = 0; r < l.batch*l.n; ++r){
+            int f = r % l.n;
+            depthwise_plane(&l, state.input + (size_t)r*l.h*l.w, l.weights + f*l.size*l.size, l.biases[f],
+                l.output + (size_t)r*l.out_h*l.out_w);
+        }
+        trace_end("depthwise", l.batch);
+        return;
+    }
+
+    int blocks = l.n / block;
+    int x_lo, x_hi, unused;
+    conv_output_range(0, l.pad, l.stride, l.w, l.out_w, &x_lo, &unused);
+    conv_output_range(l.size - 1, l.pad, l.stride, l.w, l.out_w, &unused, &x_hi);
+    for(b = 0; b < l.batch; ++b){
+        const float *input = state.input + (size_t)b*l.inputs;
+        float *output = l.output + (size_t)b*l.outputs;
+        trace_begin("depthwise nchwc", b);
+        #pragma omp parallel for
+        for(r = 0; r < blocks*l.out_h; ++r){
+            int cb = r / l.out_h;
+            int oy = r % l.out_h;
+            int lane0, x0;
+            for(lane0 = 0; lane0 < block; lane0 += NCHWC_LANES){
+                for(x0 = 0; x0 < l.out_w; x0 += NCHWC_TILE_W){
+                    int nx = l.out_w - x0 < NCHWC_TILE_W ? l.out_w - x0 : NCHWC_TILE_W;
+                    int interior = nx == NCHWC_TILE_W && x0 >= x_lo && x0 + nx <= x_hi;
+                    depthwise_nchwc_tile(&l, input, output, block, cb, lane0, oy, x0, nx, interior);
+                }
+            }
+        }
+        trace_end("depthwise nchwc", b);
+    }
+}
+
+// Binary convolution, see set_convolutional_xnor(): the patches are bit-packed straight from the
+// input into the workspace, then every filter is matched against them with XOR and POPCNT.
+void forward_convolutional_layer_xnor(convolutional_layer l, network_state state)
+{
+    int b;
+    int k = l.size*l.size*l.c;
+    int n = l.out_h*l.out_w;
+    uint64_t *cols = (uint64_t*)state.workspace;
+
+    for(b = 0; b < l.batch; ++b){
+        trace_begin("im2col bin", b);
+        im2col_cpu_bin(state.input + (size_t)b*l.inputs, l.c, l.h, l.w, l.size, l.stride, l.pad, cols, l.lda_align);
+        trace_end("im2col bin", b);
+        trace_begin("gemm bin", b);
+        gemm_bin(l.n, n, k, l.align_bit_weights, cols, l.lda_align, l.mean_arr, l.output + (size_t)b*l.outputs, n);
+        trace_end("gemm bin", b);
+    }
+
+    trace_begin("add_bias", l.n);
+    add_bias(l.output, l.biases, l.batch, l.n, n);
+    trace_end("add_bias", l.n);
+
+    trace_begin("activate_array", l.activation);
+    activate_array(l.output, l.outputs*l.batch, l.activation);
+    trace_end("activate_array", l.activation);
+}
+
+// Copies the input rows read by output row oy, columns x0..x0+nx-1, into strip as
+// [c][size][strip_w] floats. Taps in the padding and columns past the image read 0, so the kernel
+// needs no bounds checks. Views of any layout are read through their strides, uint8 ones scaled
+// to [0, 1] on the way.
+static void stage_rgb_strip(const convolutional_layer *l, const tensor_view *v, int b,
+    int oy, int x0, int strip_w, float *strip)
+{
+    int ic, ky, i;
+    int ix0 = x0*l->stride - l->pad;
+    for (ic = 0; ic < l->c; ++ic) {
+        for (ky = 0; ky < l->size; ++ky) {
+            float *s = strip + (ic*l->size + ky)*strip_w;
+            int iy = oy*l->stride + ky - l->pad;
+            if (iy < 0 || iy >= l->h) {
+                memset(s, 0, strip_w*sizeof(float));
+                continue;
+            }
+            size_t row = b*v->stride_b + ic*v->stride_c + iy*v->stride_h;
+            if (v->type == TENSOR_UINT8) {
+                const unsigned char *p = (const unsigned char*)v->data + row;
+                for (i = 0; i < strip_w; ++i) {
+                    int ix = ix0 + i;
+                    s[i] = ix < 0 || ix >= l->w ? 0 : p[ix*v->stride_w] / 255.f;
+                }
+            }
+            else {
+                const float *p = (const float*)v->data + row;
+                for (i = 0; i < strip_w; ++i) {
+                    int ix = ix0 + i;
+                    s[i] = ix < 0 || ix >= l->w ? 0 : p[ix*v->stride_w];
+                }
+            }
+        }
+    }
+}
+
+// Convolution for input layers (c <= 4): 16 output channels x 4 pixels are accumulated in
+// registers from a staged strip of input rows, then bias and activation are applied before the
+// single store. Reads the float NCHW input, or the caller's view in place when state.input_view
+// is set, and writes NCHW or NCHW[channel_block]c.
+void forward_convolutional_layer_rgb(convolutional_layer l, network_state state)
+{
+    int b, oy;
+    int taps = l.c*l.size*l.size;
+    int blocks = channel_blocks(l.n, RGB_LANES);
+    tensor_view input = state.input_view ? *state.input_view : make_tensor_view_chw(state.input, l.w, l.h, l.c);
+
+    for(b = 0; b < l.batch; ++b){
+        float *output = l.output + (size_t)b*l.outputs;
+        trace_begin("direct rgb", b);
+        #pragma omp parallel for
+        for(oy = 0; oy < l.out_h; ++oy){
+            float strip[RGB_MAX_C*RGB_MAX_SIZE*((RGB_CHUNK_W - 1)*RGB_MAX_STRIDE + RGB_MAX_SIZE)];
+            float w[RGB_MAX_C*RGB_MAX_SIZE*RGB_MAX_SIZE*RGB_LANES];
+            float acc[RGB_TILE_W][RGB_LANES];
+            int x0, ob, t0, t, q, i;
+            for(x0 = 0; x0 < l.out_w; x0 += RGB_CHUNK_W){
+                int nx = l.out_w - x0 < RGB_CHUNK_W ? l.out_w - x0 : RGB_CHUNK_W;
+                int tiles = (nx + RGB_TILE_W - 1) / RGB_TILE_W;
+                int strip_w = (tiles*RGB_TILE_W - 1)*l.stride + l.size;
+                stage_rgb_strip(&l, &input, b, oy, x0, strip_w, strip);
+
+                for(ob = 0; ob < blocks; ++ob){
+                    int k0 = ob*RGB_LANES;
+                    // [tap][lane], channels past n are zero
+                    for(i = 0; i < taps; ++i){
+                        for(q = 0; q < RGB_LANES; ++q) w[i*RGB_LANES + q] = k0 + q < l.n ? l.weights[(size_t)(k0 + q)*taps + i] : 0;
+                    }
+                    for(t0 = 0; t0 < nx; t0 += RGB_TILE_W){
+                        for(t = 0; t < RGB_TILE_W; ++t){
+                            for(q = 0; q < RGB_LANES; ++q) acc[t][q] = k0 + q < l.n ? l.biases[k0 + q] : 0;
+                        }
+                        for(i = 0; i < taps; ++i){
+                            int kx = i % l.size;
+                            const float *s = strip + (i / l.size)*strip_w + kx + t0*l.stride;
+                            const float *wv = w + i*RGB_LANES;
+                            for(t = 0; t < RGB_TILE_W; ++t){
+                                float v = s[t*l.stride];
+                                for(q = 0; q < RGB_LANES; ++q) acc[t][q] += v*wv[q];
+                            }
+                        }
+                        for(t = 0; t < RGB_TILE_W; ++t){
+                            if (l.activation == LEAKY) {
+                                for(q = 0; q < RGB_LANES; ++q) acc[t][q] = leaky_activate(acc[t][q]);
+                            }
+                            else if (l.activation != LINEAR) {
+                                for(q = 0; q < RGB_LANES; ++q) acc[t][q] = activate(acc[t][q], l.activation);
+                            }
+                        }
+                        int n_t = nx - t0 < RGB_TILE_W ? nx - t0 : RGB_TILE_W;
+                        int x = x0 + t0;
+                        for(q = 0; q < RGB_LANES && k0 + q < l.n; ++q){
+                            int k = k0 + q;
+                            float *o = l.channel_block
+                                ? output + (((size_t)(k/l.channel_block)*l.out_h + oy)*l.out_w + x)*l.channel_block + k%l.channel_block
+                                : output + ((size_t)k*l.out_h + oy)*l.out_w + x;
+                            int ostride = l.channel_block ? l.channel_block : 1;
+                            for(t = 0; t < n_t; ++t) o[t*ostride] = acc[t][q];
+                        }
+                    }
+                }
+            }
+        }
+        trace_end("direct rgb", b);
+    }
+}
+
+char *get_conv_algorithm_string(CONV_ALGORITHM a)
+{
+    switch(a){
+        case CONV_IM2COL_GEMM:
+            return "im2col_gemm";
+        case CONV_GEMM_1X1:
+            return "gemm_1x1";
+        case CONV_DIRECT:
+            return "direct";
+        case CONV_IMPLICIT_GEMM:
+            return "implicit_gemm";
+        case CONV_DIRECT_RGB:
+            return "direct_rgb";
+        case CONV_DEPTHWISE:
+            return "depthwise";
+        default:
+            break;
+    }
+    return "im2col_gemm";
+}
+
+CONV_ALGORITHM get_conv_algorithm(char *s)
+{
+    int a;
+    for (a = 0; a < CONV_ALGORITHMS; ++a) {
+        if (strcmp(s, get_conv_algorithm_string((CONV_ALGORITHM)a)) == 0) return (CONV_ALGORITHM)a;
+    }
+    fprintf(stderr, "Couldn't find convolution algorithm %s, going with im2col_gemm\n", s);
+    return CONV_IM2COL_GEMM;
+}
+
+int conv_algorithm_supported(convolutional_layer l, CONV_ALGORITHM a)
+{
+    switch(a){
+        case CONV_IM2COL_GEMM:
+        case CONV_DIRECT:
+            return 1;
+        case CONV_IMPLICIT_GEMM:
+            return l.groups == 1;
+        case CONV_GEMM_1X1:
+            return l.groups == 1 && l.size == 1 && l.stride == 1 && l.pad == 0;
+        case CONV_DIRECT_RGB:
+            return l.groups == 1 && l.c <= RGB_MAX_C && l.size <= RGB_MAX_SIZE && l.stride <= RGB_MAX_STRIDE;
+        case CONV_DEPTHWISE:
+            return l.groups == l.c && l.n == l.c;
+        default:
+            return 0;
+    }
+}
+
+// Switches the forward function; the caller resizes the network workspace, see recalculate_workspace_size()
+void set_convolutional_algorithm(convolutional_layer *l, CONV_ALGORITHM a)
+{
+    if (!conv_algorithm_supported(*l, a)) a = CONV_IM2COL_GEMM;
+    l->algorithm = a;
+    // binary layers have a single kernel
+    if (l->xnor) {
+        l->forward = forward_convolutional_layer_xnor;
+        l->workspace_size = get_convolutional_workspace_size(*l);
+        return;
+    }
+    switch(a){
+        case CONV_GEMM_1X1:
+            l->forward = forward_convolutional_layer_1x1;
+            break;
+        case CONV_DIRECT:
+            l->forward = forward_convolutional_layer_direct;
+            break;
+        case CONV_IMPLICIT_GEMM:
+            l->forward = forward_convolutional_layer_implicit_gemm;
+            break;
+        case CONV_DIRECT_RGB:
+            l->forward = forward_convolutional_layer_rgb;
+            break;
+        case CONV_DEPTHWISE:
+            l->forward = forward_convolutional_layer_depthwise;
+            break;
+        default:
+            l->forward = forward_convolutional_layer;
+            break;
+    }
+    l->workspace_size = get_convolutional_workspace_size(*l);
+}
+
+
+// input_block and output_block are 0 (NCHW) or the same block size, a multiple of 8; the blocked
+// sides need c (input) or n (output) to be a multiple of it. Both 0 goes back to l->algorithm.
+// Grouped layers are only supported by the depthwise kernel.
+// The weights are packed as [n/block][c/groups][size][size][block] so a block of output channels
+// reads one contiguous vector per tap; call again after the weights change.
+void set_convolutional_channel_block(convolutional_layer *l, int input_block, int output_block)
+{
+    int block = output_block ? output_block : input_block;
+    if ((block % NCHWC_LANES) || (input_block && output_block && input_block != output_block) ||
+        (l->groups != 1 && l->algorithm != CONV_DEPTHWISE) || (block && l->xnor) ||
+        (input_block && l->c % input_block) || (output_block && l->n % output_block)) {
+        error("Blocked channel layout is not supported by this convolutional layer", DARKNET_LOC);
+    }
+    tensor_free(l->packed_weights);
+    l->packed_weights = 0;
+    l->input_channel_block = input_block;
+    l->channel_block = output_block;
+    // the RGB kernel writes either layout itself
+    if (!block || (!input_block && l->algorithm == CONV_DIRECT_RGB)) {
+        set_convolutional_algorithm(l, l->algorithm);
+        return;
+    }
+
+    int f;
+    size_t i, filter_size = (size_t)l->c / l->groups*l->size*l->size;
+    l->packed_weights = (float*)tensor_calloc((size_t)channel_blocks(l->n, block)*block*filter_size, sizeof(float));
+    for (f = 0; f < l->n; ++f) {
+        for (i = 0; i < filter_size; ++i) {
+            l->packed_weights[((f/block)*filter_size + i)*block + f%block] = l->weights[f*filter_size + i];
+        }
+    }
+    l->forward = l->algorithm == CONV_DEPTHWISE ? forward_convolutional_layer_depthwise : forward_convolutional_layer_nchwc;
+    l->workspace_size = 0;
+}
+
+// XNOR-Net style binarization: the input is taken as sign(x) (+1 when > 0, else -1) and the weights
+// of filter f as sign(w)*mean_arr[f], mean_arr[f] being the mean |w| of the filter. Only the sign
+// bits of the weights are kept for the forward pass, 32x less than the floats; biases and the
+// activation stay in float. Needs groups == 1 and the NCHW layout. The float weights are freed
+// once the bits and means are computed, so this is one way: load the weights again to go back.
+void set_convolutional_xnor(convolutional_layer *l)
+{
+    if (l->xnor) return;
+    if (l->groups != 1 || l->channel_block || l->input_channel_block) {
+        error("Binary convolution needs groups == 1 and the NCHW layout", DARKNET_LOC);
+    }
+    int k = l->size*l->size*l->c;
+    int f, i;
+    tensor_free(l->align_bit_weights);
+    if (l->mean_arr) xfree(l->mean_arr);
+    l->lda_align = (k + 63) / 64;
+    l->align_bit_weights = (uint64_t*)tensor_calloc((size_t)l->n*l->lda_align, sizeof(uint64_t));
+    l->mean_arr = (float*)xcalloc(l->n, sizeof(float));
+    for (f = 0; f < l->n; ++f) {
+        const float *w = l->weights + (size_t)f*k;
+        uint64_t *bits = l->align_bit_weights + (size_t)f*l->lda_align;
+        double sum = 0;
+        for (i = 0; i < k; ++i) {
+            sum += fabs(w[i]);
+            if (w[i] > 0) bits[i >> 6] |= (uint64_t)1 << (i & 63);
+        }
+        l->mean_arr[f] = sum / k;
+    }
+    tensor_free(l->weights);
+    l->weights = 0;
+    l->xnor = 1;
+    set_convolutional_algorithm(l, l->algorithm);
+}
@@ -8,13 +8,39 @@
 
 typedef layer convolutional_layer;
 
+// limits of the input layer kernel, forward_convolutional_layer_rgb()
+#define RGB_MAX_C 4
+#define RGB_MAX_SIZE 7
+#define RGB_MAX_STRIDE 4
+#define RGB_LANES 16        // output channels accumulated together
+#define RGB_TILE_W 4        // output pixels accumulated together
+#define RGB_CHUNK_W 64      // output pixels per staged input strip
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// make_convolutional_layer() prints a line per layer unless this is 0
+extern int convolutional_layer_banner;
+
 size_t get_convolutional_workspace_size(layer l);
 convolutional_layer make_convolutional_layer(int batch, int h, int w, int c, int n, int groups, int size, int stride, int padding, ACTIVATION activation, int batch_normalize);
+void resize_convolutional_layer(convolutional_layer *l, int w, int h);
 void forward_convolutional_layer(const convolutional_layer layer, network_state state);
+void forward_convolutional_layer_1x1(const convolutional_layer layer, network_state state);
+void forward_convolutional_layer_direct(const convolutional_layer layer, network_state state);
+void forward_convolutional_layer_implicit_gemm(const convolutional_layer layer, network_state state);
+void forward_convolutional_layer_nchwc(const convolutional_layer layer, network_state state);
+void forward_convolutional_layer_rgb(const convolutional_layer layer, network_state state);
+void forward_convolutional_layer_depthwise(const convolutional_layer layer, network_state state);
+void forward_convolutional_layer_xnor(const convolutional_layer layer, network_state state);
+
+char *get_conv_algorithm_string(CONV_ALGORITHM a);
+CONV_ALGORITHM get_conv_algorithm(char *s);
+int conv_algorithm_supported(convolutional_layer l, CONV_ALGORITHM a);
+void set_convolutional_algorithm(convolutional_layer *l, CONV_ALGORITHM a);
+void set_convolutional_channel_block(convolutional_layer *l, int input_block, int output_block);
+void set_convolutional_xnor(convolutional_layer *l);
 
 void add_bias(float *output, float *biases, int batch, int n, int size);
 
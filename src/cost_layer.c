@@ -1,5 +1,6 @@
 #include "cost_layer.h"
 #include "utils.h"
+#include "tensor_alloc.h"
 #include "blas.h"
 #include <math.h>
 #include <string.h>
@@ -26,7 +27,7 @@ cost_layer make_cost_layer(int batch, int inputs, COST_TYPE cost_type)
     l.outputs = inputs;
     l.cost_type = cost_type;
     l.delta = (float*)xcalloc(inputs * batch, sizeof(float));
-    l.output = (float*)xcalloc(inputs * batch, sizeof(float));
+    l.output = (float*)tensor_calloc(inputs * batch, sizeof(float));
     l.cost = (float*)xcalloc(1, sizeof(float));
 
     l.forward = forward_cost_layer;
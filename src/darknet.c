@@ -11,14 +11,27 @@
 #include "blas.h"
 
 
-extern void predict_classifier(char *filename, int top);
+extern void predict_classifier(int top);
+extern void run_classifier(int argc, char **argv);
+extern void run_bench(int argc, char **argv);
+extern int run_verify(int argc, char **argv);
 
 int main(int argc, char **argv)
 {
 
     init_cpu();
 
-    predict_classifier("data/dog.jpg", 5);
+    if (argc < 2) {
+        predict_classifier(5);
+    } else if (0 == strcmp(argv[1], "classifier")) {
+        run_classifier(argc, argv);
+    } else if (0 == strcmp(argv[1], "bench")) {
+        run_bench(argc, argv);
+    } else if (0 == strcmp(argv[1], "verify")) {
+        return run_verify(argc, argv);
+    } else {
+        fprintf(stderr, "Not an option: %s\n", argv[1]);
+    }
 
     return 0;
 }
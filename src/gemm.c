@@ -1,6 +1,7 @@
 #include "gemm.h"
 #include "utils.h"
 #include "im2col.h"
+#include "trace.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
@@ -10,6 +11,9 @@
 #if defined(_OPENMP)
 #include <omp.h>
 #endif
+#if defined(__AVX2__) || defined(__AVX512VPOPCNTDQ__)
+#include <immintrin.h>
+#endif
 
 #if defined(_MSC_VER)
 #if defined(_M_ARM) || defined(_M_ARM64)
@@ -119,6 +123,107 @@ void forward_maxpool_layer_avx(float *src, float *dst, int *indexes, int size, i
     }
 }
 
+// out[j] = max of r0[2j], r0[2j+1], r1[2j], r1[2j+1]
+static void max_pairs(const float *r0, const float *r1, float *out, int n)
+{
+    int j = 0;
+#if defined(__AVX2__)
+    for (; j + 8 <= n; j += 8) {
+        __m256 a = _mm256_max_ps(_mm256_loadu_ps(r0 + 2*j), _mm256_loadu_ps(r1 + 2*j));
+        __m256 b = _mm256_max_ps(_mm256_loadu_ps(r0 + 2*j + 8), _mm256_loadu_ps(r1 + 2*j + 8));
+        // even and odd columns, pair results come out as 0 1 4 5 | 2 3 6 7
+        __m256 m = _mm256_max_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                                 _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        m = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(m), _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm256_storeu_ps(out + j, m);
+    }
+#endif
+    for (; j < n; ++j) {
+        float a = r0[2*j] > r1[2*j] ? r0[2*j] : r1[2*j];
+        float b = r0[2*j + 1] > r1[2*j + 1] ? r0[2*j + 1] : r1[2*j + 1];
+        out[j] = a > b ? a : b;
+    }
+}
+
+// columns x and x + 1, either may be outside the image
+static float max_border_pair(const float *r0, const float *r1, int x, int w)
+{
+    float max = -FLT_MAX;
+    int i;
+    for (i = x; i < x + 2; ++i) {
+        if (i < 0 || i >= w) continue;
+        if (r0[i] > max) max = r0[i];
+        if (r1[i] > max) max = r1[i];
+    }
+    return max;
+}
+
+void forward_maxpool_2x2_s2(const float *src, float *dst, int w, int h, int out_w, int out_h, int c,
+    int pad, int batch)
+{
+    const int offset = -pad / 2;
+    // columns whose two taps are both inside the image
+    int j_lo = (1 - offset) / 2;
+    int j_hi = w - 2 - offset >= 0 ? (w - 2 - offset) / 2 + 1 : 0;
+    int k;
+    if (j_hi > out_w) j_hi = out_w;
+    if (j_lo > j_hi) j_lo = j_hi;
+
+    #pragma omp parallel for
+    for (k = 0; k < batch*c; ++k) {
+        const float *in = src + (size_t)k*h*w;
+        float *out = dst + (size_t)k*out_h*out_w;
+        int i, j;
+        for (i = 0; i < out_h; ++i) {
+            float *o = out + i*out_w;
+            int y0 = 2*i + offset, y1 = y0 + 1;
+            if (y0 < 0) y0 = y1;
+            if (y1 >= h) y1 = y0;
+            if (y0 < 0 || y0 >= h) {
+                for (j = 0; j < out_w; ++j) o[j] = -FLT_MAX;
+                continue;
+            }
+            // a window with one row inside takes that row twice
+            const float *r0 = in + y0*w;
+            const float *r1 = in + y1*w;
+            for (j = 0; j < j_lo; ++j) o[j] = max_border_pair(r0, r1, 2*j + offset, w);
+            max_pairs(r0 + 2*j_lo + offset, r1 + 2*j_lo + offset, o + j_lo, j_hi - j_lo);
+            for (j = j_hi; j < out_w; ++j) o[j] = max_border_pair(r0, r1, 2*j + offset, w);
+        }
+    }
+}
+
+void forward_maxpool_inference(const float *src, float *dst, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch)
+{
+    const int w_offset = -pad / 2;
+    const int h_offset = -pad / 2;
+    int k;
+
+    #pragma omp parallel for
+    for (k = 0; k < batch*c; ++k) {
+        const float *in = src + (size_t)k*h*w;
+        float *out = dst + (size_t)k*out_h*out_w;
+        int i, j, n, m;
+        for (i = 0; i < out_h; ++i) {
+            int y = h_offset + i*stride;
+            int n_lo = y < 0 ? -y : 0;
+            int n_hi = y + size > h ? h - y : size;
+            for (j = 0; j < out_w; ++j) {
+                int x = w_offset + j*stride;
+                // the tap range is clipped once per window instead of testing every tap
+                int m_lo = x < 0 ? -x : 0;
+                int m_hi = x + size > w ? w - x : size;
+                float max = -FLT_MAX;
+                for (n = n_lo; n < n_hi; ++n) {
+                    const float *row = in + (y + n)*w + x;
+                    for (m = m_lo; m < m_hi; ++m) max = row[m] > max ? row[m] : max;
+                }
+                out[i*out_w + j] = max;
+            }
+        }
+    }
+}
 
 // 32 channels -> 1 channel (with 32 floats)
 // 256 channels -> 8 channels (with 32 floats)
@@ -192,17 +297,59 @@ void gemm_cpu(int TA, int TB, int M, int N, int K, float ALPHA,
 
     is_avx();   // initialize static variable
 
-    int t;
+    // each thread traces the rows it was handed; nowait keeps the barrier out of the tile
+    #pragma omp parallel
+    {
+        int t;
+        trace_begin("gemm tile", M);
+        #pragma omp for nowait
+        for (t = 0; t < M; ++t) {
+            if (!TA && !TB)
+                gemm_nn(1, N, K, ALPHA, A + t*lda, lda, B, ldb, C + t*ldc, ldc);
+            else if (TA && !TB)
+                gemm_tn(1, N, K, ALPHA, A + t, lda, B, ldb, C + t*ldc, ldc);
+            else if (!TA && TB)
+                gemm_nt(1, N, K, ALPHA, A + t*lda, lda, B, ldb, C + t*ldc, ldc);
+            else
+                gemm_tt(1, N, K, ALPHA, A + t, lda, B, ldb, C + t*ldc, ldc);
+        }
+        trace_end("gemm tile", M);
+    }
+}
+
+#define GEMM_BIN_TILE_M 4 // filters sharing each load of a patch row
+
+// Mismatching bits of a and b over n words
+static inline int xor_popcount(const uint64_t *a, const uint64_t *b, int n)
+{
+    int w = 0, count = 0;
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    __m512i sum = _mm512_setzero_si512();
+    for (; w + 8 <= n; w += 8) {
+        __m512i x = _mm512_xor_si512(_mm512_loadu_si512(a + w), _mm512_loadu_si512(b + w));
+        sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(x));
+    }
+    count = (int)_mm512_reduce_add_epi64(sum);
+#endif
+    for (; w < n; ++w) count += (int)POPCNT64(a[w] ^ b[w]);
+    return count;
+}
+
+void gemm_bin(int M, int N, int K, const uint64_t *A, const uint64_t *B, int ldw, const float *mean, float *C, int ldc)
+{
+    int i0;
     #pragma omp parallel for
-    for (t = 0; t < M; ++t) {
-        if (!TA && !TB)
-            gemm_nn(1, N, K, ALPHA, A + t*lda, lda, B, ldb, C + t*ldc, ldc);
-        else if (TA && !TB)
-            gemm_tn(1, N, K, ALPHA, A + t, lda, B, ldb, C + t*ldc, ldc);
-        else if (!TA && TB)
-            gemm_nt(1, N, K, ALPHA, A + t*lda, lda, B, ldb, C + t*ldc, ldc);
-        else
-            gemm_tt(1, N, K, ALPHA, A + t, lda, B, ldb, C + t*ldc, ldc);
+    for (i0 = 0; i0 < M; i0 += GEMM_BIN_TILE_M) {
+        int mb = M - i0 < GEMM_BIN_TILE_M ? M - i0 : GEMM_BIN_TILE_M;
+        int i, j;
+        for (j = 0; j < N; ++j) {
+            const uint64_t *b = B + (size_t)j*ldw;
+            for (i = 0; i < mb; ++i) {
+                // matches - mismatches of the K +-1 values, the padding bits match
+                int dot = K - 2*xor_popcount(A + (size_t)(i0 + i)*ldw, b, ldw);
+                C[(size_t)(i0 + i)*ldc + j] = mean[i0 + i]*dot;
+            }
+        }
     }
 }
 
@@ -11,8 +11,14 @@ extern "C" {
 int is_avx();
 int is_fma_avx2();
 
+// Any window, also records the argmax in indexes when they are given
 void forward_maxpool_layer_avx(float *src, float *dst, int *indexes, int size, int w, int h, int out_w, int out_h, int c,
     int pad, int stride, int batch);
+// Inference only, no argmax: the 2x2 stride 2 kernel (AVX2 when built with it) and any other window
+void forward_maxpool_2x2_s2(const float *src, float *dst, int w, int h, int out_w, int out_h, int c,
+    int pad, int batch);
+void forward_maxpool_inference(const float *src, float *dst, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch);
 
 
 void gemm(int TA, int TB, int M, int N, int K, float ALPHA,
@@ -27,6 +33,17 @@ void gemm_cpu(int TA, int TB, int M, int N, int K, float ALPHA,
         float BETA,
         float *C, int ldc);
 
+// C += ALPHA*A*B, single threaded
+void gemm_nn(int M, int N, int K, float ALPHA,
+        float *A, int lda,
+        float *B, int ldb,
+        float *C, int ldc);
+
+// Binary GEMM: C[i][j] = mean[i] * (row i of A . row j of B), rows being K values of +-1 packed
+// as bits (1 for +1) into ldw 64-bit words with zero padding. XOR + POPCNT, 8 words at a time
+// with AVX-512 VPOPCNTDQ when built with it.
+void gemm_bin(int M, int N, int K, const uint64_t *A, const uint64_t *B, int ldw, const float *mean, float *C, int ldc);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,107 @@
+#include "histogram.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static int highest_bit(uint64_t v)
+{
+    int b = -1;
+    while (v) {
+        v >>= 1;
+        ++b;
+    }
+    return b;
+}
+
+static int counts_index(hdr_histogram *h, int64_t value)
+{
+    if (value < h->sub_bucket_count) return (int)value;
+    int bucket = highest_bit(value) - h->sub_bucket_bits + 1;
+    int half = h->sub_bucket_count / 2;
+    int sub = (int)(value >> bucket);
+    return h->sub_bucket_count + (bucket - 1)*half + (sub - half);
+}
+
+// highest value that maps to the same counter as index
+static int64_t highest_equivalent(hdr_histogram *h, int index)
+{
+    if (index < h->sub_bucket_count) return index;
+    int half = h->sub_bucket_count / 2;
+    int bucket = (index - h->sub_bucket_count) / half + 1;
+    int64_t sub = (index - h->sub_bucket_count) % half + half;
+    return ((sub + 1) << bucket) - 1;
+}
+
+hdr_histogram *make_hdr_histogram(int64_t highest_value, int sub_bucket_bits)
+{
+    if (sub_bucket_bits < 2) sub_bucket_bits = 2;
+    if (highest_value < 1) highest_value = 1;
+    hdr_histogram *h = (hdr_histogram*)xcalloc(1, sizeof(hdr_histogram));
+    h->sub_bucket_bits = sub_bucket_bits;
+    h->sub_bucket_count = 1 << sub_bucket_bits;
+    h->counts_len = counts_index(h, highest_value) + 1;
+    h->counts = (int64_t*)xcalloc(h->counts_len, sizeof(int64_t));
+    reset_hdr_histogram(h);
+    return h;
+}
+
+void free_hdr_histogram(hdr_histogram *h)
+{
+    xfree(h->counts);
+    xfree(h);
+}
+
+void reset_hdr_histogram(hdr_histogram *h)
+{
+    memset(h->counts, 0, h->counts_len*sizeof(int64_t));
+    h->total = 0;
+    h->min = INT64_MAX;
+    h->max = 0;
+    h->sum = 0;
+}
+
+void hdr_record(hdr_histogram *h, int64_t value)
+{
+    if (value < 0) value = 0;
+    int i = counts_index(h, value);
+    if (i >= h->counts_len) i = h->counts_len - 1;   // saturate instead of dropping the sample
+    h->counts[i]++;
+    h->total++;
+    h->sum += value;
+    if (value < h->min) h->min = value;
+    if (value > h->max) h->max = value;
+}
+
+int64_t hdr_value_at_percentile(hdr_histogram *h, double percentile)
+{
+    if (!h->total) return 0;
+    int64_t rank = (int64_t)(percentile / 100 * h->total + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > h->total) rank = h->total;
+
+    int64_t seen = 0;
+    int i;
+    for (i = 0; i < h->counts_len; ++i) {
+        seen += h->counts[i];
+        if (seen >= rank) {
+            int64_t v = highest_equivalent(h, i);
+            return v > h->max ? h->max : v;
+        }
+    }
+    return h->max;
+}
+
+double hdr_mean(hdr_histogram *h)
+{
+    return h->total ? h->sum / h->total : 0;
+}
+
+void print_hdr_json(FILE *fp, hdr_histogram *h)
+{
+    fprintf(fp, "{\"count\": %lld, \"min\": %lld, \"mean\": %.1f, \"p50\": %lld, \"p90\": %lld, \"p99\": %lld, \"p99.9\": %lld, \"max\": %lld}",
+        (long long)h->total, (long long)(h->total ? h->min : 0), hdr_mean(h),
+        (long long)hdr_value_at_percentile(h, 50), (long long)hdr_value_at_percentile(h, 90),
+        (long long)hdr_value_at_percentile(h, 99), (long long)hdr_value_at_percentile(h, 99.9),
+        (long long)h->max);
+}
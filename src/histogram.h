@@ -0,0 +1,37 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+#include "darknet.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// HDR-style log-linear histogram: values below 2^sub_bucket_bits are counted exactly, larger values
+// land in power-of-two buckets split into 2^(sub_bucket_bits-1) linear sub-buckets, so every recorded
+// value keeps a relative precision of 2^-(sub_bucket_bits-1) at a fixed memory cost.
+typedef struct hdr_histogram {
+    int sub_bucket_bits;
+    int sub_bucket_count;
+    int counts_len;
+    int64_t *counts;
+    int64_t total;
+    int64_t min;
+    int64_t max;
+    double sum;
+} hdr_histogram;
+
+hdr_histogram *make_hdr_histogram(int64_t highest_value, int sub_bucket_bits);
+void free_hdr_histogram(hdr_histogram *h);
+void reset_hdr_histogram(hdr_histogram *h);
+void hdr_record(hdr_histogram *h, int64_t value);
+int64_t hdr_value_at_percentile(hdr_histogram *h, double percentile);
+double hdr_mean(hdr_histogram *h);
+void print_hdr_json(FILE *fp, hdr_histogram *h);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
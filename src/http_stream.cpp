@@ -3,6 +3,29 @@
 
 #include <chrono>
 #include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#include "network.h"
+#include "image.h"
+#include "utils.h"
+#include "trace.h"
+#include "labels.h"
 
 static std::chrono::steady_clock::time_point steady_start, steady_end;
 static double total_time;
@@ -12,6 +35,445 @@ double get_time_point() {
     return std::chrono::duration_cast<std::chrono::microseconds>(current_time.time_since_epoch()).count();
 }
 
+#ifdef __linux__
+
+static const size_t MAX_HEADER_SIZE = 16 * 1024;
+static const size_t MAX_BODY_SIZE = 64 * 1024 * 1024;
+// reading stops here, a request that doesn't fit is rejected by its header or body limit
+static const size_t MAX_REQUEST_SIZE = MAX_HEADER_SIZE + 4 + MAX_BODY_SIZE;
+static const int MAX_TOP = 1000;
+
+struct http_connection {
+    int fd;
+    std::string in;
+    std::string out;
+    size_t out_sent;
+    bool close_after_write;
+    bool sent_continue;
+
+    http_connection() : fd(-1), out_sent(0), close_after_write(false), sent_continue(false) {}
+};
+
+struct http_request {
+    std::string method;
+    std::string path;
+    std::string query;
+    std::string version;
+    std::map<std::string, std::string> headers;
+    std::string body;
+};
+
+static std::string to_lower(std::string s)
+{
+    std::transform(s.begin(), s.end(), s.begin(), ::tolower);
+    return s;
+}
+
+static std::string trim(const std::string &s)
+{
+    size_t b = s.find_first_not_of(" \t");
+    size_t e = s.find_last_not_of(" \t\r");
+    if (b == std::string::npos) return std::string();
+    return s.substr(b, e - b + 1);
+}
+
+static std::string json_escape(const char *s, size_t len)
+{
+    std::string out;
+    for (const char *end = s + len; s < end; ++s) {
+        unsigned char ch = (unsigned char)*s;
+        if (ch == '"' || ch == '\\') { out += '\\'; out += (char)ch; }
+        else if (ch < 0x20) {
+            char buf[8];
+            sprintf(buf, "\\u%04x", ch);
+            out += buf;
+        }
+        else out += (char)ch;
+    }
+    return out;
+}
+
+static int query_int(const std::string &query, const char *key, int def)
+{
+    std::string k = std::string(key) + "=";
+    size_t pos = 0;
+    while (pos < query.size()) {
+        size_t end = query.find('&', pos);
+        if (end == std::string::npos) end = query.size();
+        if (query.compare(pos, k.size(), k) == 0) return atoi(query.substr(pos + k.size(), end - pos - k.size()).c_str());
+        pos = end + 1;
+    }
+    return def;
+}
+
+class classifier_server {
+public:
+    classifier_server(network net, label_table *labels, int top)
+        : net(net), labels(labels), top(top), listen_fd(-1), epoll_fd(-1) {}
+
+    ~classifier_server()
+    {
+        for (auto &c : connections) close(c.first);
+        if (listen_fd >= 0) close(listen_fd);
+        if (epoll_fd >= 0) close(epoll_fd);
+    }
+
+    int open_port(int port)
+    {
+        listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listen_fd < 0) { perror("socket"); return -1; }
+        int reuse = 1;
+        setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port);
+        if (bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) { perror("bind"); return -1; }
+        if (listen(listen_fd, SOMAXCONN) < 0) { perror("listen"); return -1; }
+
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0) { perror("epoll_create1"); return -1; }
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.fd = listen_fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &ev);
+        return 0;
+    }
+
+    int run()
+    {
+        std::vector<struct epoll_event> events(64);
+        while (1) {
+            int n = epoll_wait(epoll_fd, events.data(), events.size(), -1);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                perror("epoll_wait");
+                return -1;
+            }
+            for (int i = 0; i < n; ++i) {
+                int fd = events[i].data.fd;
+                if (fd == listen_fd) {
+                    accept_all();
+                    continue;
+                }
+                auto it = connections.find(fd);
+                if (it == connections.end()) continue;
+                http_connection &c = it->second;
+                if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                    close_connection(fd);
+                    continue;
+                }
+                if ((events[i].events & EPOLLOUT) && !flush(c)) continue;
+                if ((events[i].events & EPOLLIN) && !read_from(c)) continue;
+            }
+        }
+    }
+
+private:
+    network net;
+    label_table *labels;
+    int top;
+    int listen_fd;
+    int epoll_fd;
+    std::map<int, http_connection> connections;
+
+    void accept_all()
+    {
+        while (1) {
+            int fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) {
+                if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) perror("accept4");
+                return;
+            }
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+            struct epoll_event ev;
+            memset(&ev, 0, sizeof(ev));
+            ev.events = EPOLLIN;
+            ev.data.fd = fd;
+            epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+            connections[fd].fd = fd;
+        }
+    }
+
+    void close_connection(int fd)
+    {
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+        close(fd);
+        connections.erase(fd);
+    }
 
+    void watch_output(http_connection &c, bool enable)
+    {
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = enable ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+        ev.data.fd = c.fd;
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, c.fd, &ev);
+    }
 
+    // returns false if the connection was closed
+    bool flush(http_connection &c)
+    {
+        while (c.out_sent < c.out.size()) {
+            ssize_t s = send(c.fd, c.out.data() + c.out_sent, c.out.size() - c.out_sent, MSG_NOSIGNAL);
+            if (s < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    watch_output(c, true);
+                    return true;
+                }
+                close_connection(c.fd);
+                return false;
+            }
+            c.out_sent += s;
+        }
+        c.out.clear();
+        c.out_sent = 0;
+        if (c.close_after_write) {
+            close_connection(c.fd);
+            return false;
+        }
+        watch_output(c, false);
+        return true;
+    }
+
+    // returns false if the connection was closed
+    bool read_from(http_connection &c)
+    {
+        char buf[64 * 1024];
+        // the rest stays in the socket, epoll reports it again once the buffer is handled
+        while (c.in.size() < MAX_REQUEST_SIZE) {
+            size_t want = MAX_REQUEST_SIZE - c.in.size();
+            ssize_t r = recv(c.fd, buf, want < sizeof(buf) ? want : sizeof(buf), 0);
+            if (r > 0) {
+                c.in.append(buf, r);
+                continue;
+            }
+            if (r == 0) {
+                close_connection(c.fd);
+                return false;
+            }
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            close_connection(c.fd);
+            return false;
+        }
+
+        // handle every complete (possibly pipelined) request in the buffer
+        while (!c.close_after_write) {
+            http_request req;
+            int status = parse_request(c, req);
+            if (status == 0) break;
+            if (status > 0) {
+                respond(c, status, error_body(status), true);
+                break;
+            }
+            bool keep_alive = req.version == "HTTP/1.1";
+            std::string conn = to_lower(req.headers["connection"]);
+            if (conn == "close") keep_alive = false;
+            else if (conn == "keep-alive") keep_alive = true;
+
+            int code = 200;
+            std::string body = handle(req, code);
+            respond(c, code, body, !keep_alive);
+        }
+        return flush(c);
+    }
+
+    // returns 0 if more data is needed, -1 if req was filled, or an HTTP error status
+    int parse_request(http_connection &c, http_request &req)
+    {
+        size_t header_end = c.in.find("\r\n\r\n");
+        if (header_end == std::string::npos) {
+            return c.in.size() > MAX_HEADER_SIZE ? 431 : 0;
+        }
+        if (header_end > MAX_HEADER_SIZE) return 431;
+
+        size_t line_end = c.in.find("\r\n");
+        std::string request_line = c.in.substr(0, line_end);
+        size_t sp1 = request_line.find(' ');
+        size_t sp2 = request_line.rfind(' ');
+        if (sp1 == std::string::npos || sp2 == sp1) return 400;
+        req.method = request_line.substr(0, sp1);
+        std::string target = request_line.substr(sp1 + 1, sp2 - sp1 - 1);
+        req.version = request_line.substr(sp2 + 1);
+        size_t q = target.find('?');
+        req.path = target.substr(0, q);
+        if (q != std::string::npos) req.query = target.substr(q + 1);
+
+        size_t pos = line_end + 2;
+        while (pos < header_end) {
+            size_t end = c.in.find("\r\n", pos);
+            std::string line = c.in.substr(pos, end - pos);
+            size_t colon = line.find(':');
+            if (colon != std::string::npos) {
+                req.headers[to_lower(trim(line.substr(0, colon)))] = trim(line.substr(colon + 1));
+            }
+            pos = end + 2;
+        }
+
+        // bodies are only framed by Content-Length, a chunked one would be read as the next request
+        if (req.headers.count("transfer-encoding") && to_lower(req.headers["transfer-encoding"]) != "identity") return 501;
+
+        size_t content_length = 0;
+        if (req.headers.count("content-length")) {
+            content_length = strtoull(req.headers["content-length"].c_str(), NULL, 10);
+        }
+        if (content_length > MAX_BODY_SIZE) return 413;
+
+        size_t total = header_end + 4 + content_length;
+        if (c.in.size() < total) {
+            if (!c.sent_continue && to_lower(req.headers["expect"]) == "100-continue") {
+                c.out += "HTTP/1.1 100 Continue\r\n\r\n";
+                c.sent_continue = true;
+            }
+            return 0;
+        }
+        req.body = c.in.substr(header_end + 4, content_length);
+        c.in.erase(0, total);
+        c.sent_continue = false;
+        return -1;
+    }
+
+    static const char *error_body(int status)
+    {
+        switch (status) {
+        case 413: return "{\"error\":\"request body is larger than 64 MB\"}";
+        case 431: return "{\"error\":\"request headers are larger than 16 KB\"}";
+        case 501: return "{\"error\":\"chunked transfer encoding is not supported, send a Content-Length\"}";
+        }
+        return "{\"error\":\"malformed request line\"}";
+    }
+
+    void respond(http_connection &c, int code, const std::string &body, bool close)
+    {
+        const char *reason = "OK";
+        switch (code) {
+        case 400: reason = "Bad Request"; break;
+        case 404: reason = "Not Found"; break;
+        case 413: reason = "Payload Too Large"; break;
+        case 415: reason = "Unsupported Media Type"; break;
+        case 431: reason = "Request Header Fields Too Large"; break;
+        case 501: reason = "Not Implemented"; break;
+        }
+        char header[256];
+        sprintf(header, "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %zu\r\nConnection: %s\r\n\r\n",
+            code, reason, body.size(), close ? "close" : "keep-alive");
+        c.out += header;
+        c.out += body;
+        if (close) c.close_after_write = true;
+    }
+
+    std::string handle(const http_request &req, int &code)
+    {
+        if (req.method == "GET" && req.path == "/health") {
+            return "{\"status\":\"ok\"}";
+        }
+        if (req.method == "GET" && req.path == "/trace") {
+            if (!trace_enabled) {
+                code = 404;
+                return "{\"error\":\"tracing is disabled, the server was started with -no_trace\"}";
+            }
+            char *json = NULL;
+            size_t len = 0;
+            FILE *fp = open_memstream(&json, &len);
+            write_trace_json(fp, 0, 0);
+            fclose(fp);
+            std::string out(json, len);
+            free(json);
+            return out;
+        }
+        if (req.method != "POST" || (req.path != "/predict" && req.path != "/classify")) {
+            code = 404;
+            return "{\"error\":\"not found\"}";
+        }
+
+        int k = query_int(req.query, "top", top);
+        k = constrain_int(k, 1, std::min(net.outputs, MAX_TOP));
+
+        auto ct = req.headers.find("content-type");
+        std::string content_type = ct == req.headers.end() ? std::string() : to_lower(ct->second);
+
+        double start = get_time_point();
+        trace_begin("preprocess", 0);
+        image cropped = make_empty_image(0, 0, 0);
+        float *X = NULL;
+        if (content_type == "application/octet-stream" || content_type == "application/x-float32") {
+            if (req.body.size() != (size_t)net.inputs * sizeof(float)) {
+                trace_end("preprocess", 0);
+                code = 400;
+                char err[128];
+                sprintf(err, "{\"error\":\"tensor must be %d float32 values (CHW %dx%dx%d)\"}", net.inputs, net.c, net.h, net.w);
+                return err;
+            }
+            cropped = make_image(net.w, net.h, net.c);
+            memcpy(cropped.data, req.body.data(), req.body.size());
+        }
+        else {
+            image im = load_image_from_memory((const unsigned char *)req.body.data(), req.body.size(), net.c);
+            if (!im.data) {
+                trace_end("preprocess", 0);
+                code = 415;
+                return "{\"error\":\"cannot decode image\"}";
+            }
+            image resized = resize_min(im, net.w);
+            cropped = crop_image(resized, (resized.w - net.w)/2, (resized.h - net.h)/2, net.w, net.h);
+            if (resized.data != im.data) free_image(resized);
+            free_image(im);
+        }
+        X = cropped.data;
+        trace_end("preprocess", 0);
+
+        double infer = get_time_point();
+        trace_begin("inference", k);
+        std::vector<int> indexes(k);
+        std::vector<float> probs(k);
+        network_predict_top_k(net, X, k, indexes.data(), probs.data());
+        trace_end("inference", k);
+        double end = get_time_point();
+        trace_request_done(start, end);
+
+        std::string out = "{\"predictions\":[";
+        char buf[128];
+        for (int i = 0; i < k; ++i) {
+            int index = indexes[i];
+            if (i) out += ",";
+            int len;
+            const char *label = get_label(labels, index, &len);
+            out += "{\"index\":" + std::to_string(index) + ",\"label\":\"";
+            out += label ? json_escape(label, len) : std::to_string(index);
+            out += "\",";
+            sprintf(buf, "\"prob\":%f}", probs[i]);
+            out += buf;
+        }
+        sprintf(buf, "],\"preprocess_ms\":%.3f,\"inference_ms\":%.3f}", (infer - start) / 1000, (end - infer) / 1000);
+        out += buf;
+
+        free_image(cropped);
+        return out;
+    }
+};
+
+int run_classifier_server(network net, label_table *labels, int port, int top)
+{
+    classifier_server server(net, labels, top);
+    if (server.open_port(port) < 0) return -1;
+    fprintf(stderr, "HTTP inference server listening on port %d (POST /predict, GET /health, GET /trace) \n", port);
+    trace_set_thread_name("http server");
+    return server.run();
+}
+
+#else // __linux__
+
+int run_classifier_server(network net, label_table *labels, int port, int top)
+{
+    fprintf(stderr, "The HTTP inference server requires epoll and is only supported on Linux \n");
+    return -1;
+}
 
+#endif // __linux__
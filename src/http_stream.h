@@ -6,6 +6,12 @@
 extern "C" {
 #endif
 
+// Runs an HTTP/1.1 server on the given port until an unrecoverable socket error.
+// POST /predict with an image (JPEG, PNG, ...) or a raw float32 CHW tensor of net.inputs floats
+// (Content-Type: application/octet-stream) returns the top classes as JSON, labelled from
+// labels (class indexes when it is 0).
+int run_classifier_server(network net, label_table *labels, int port, int top);
+
 #ifdef __cplusplus
 }
 #endif
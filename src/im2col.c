@@ -1,5 +1,6 @@
 #include "im2col.h"
 #include <stdio.h>
+#include <string.h>
 float im2col_get_pixel(float *im, int height, int width, int channels,
                         int row, int col, int channel, int pad)
 {
@@ -11,30 +12,123 @@ float im2col_get_pixel(float *im, int height, int width, int channels,
     return im[col + width*(row + height*channel)];
 }
 
-//From Berkeley Vision's Caffe!
-//https://github.com/BVLC/caffe/blob/master/LICENSE
+// One row of the column matrix per (channel, ky, kx). For every output row the padded border is
+// zero-filled and the interior is copied without per-pixel bounds checks: a memcpy for stride 1,
+// a strided gather otherwise. Written as an always-inlined body so the 3x3 variants below get
+// ksize and stride as compile-time constants.
+static inline void im2col_channel(const float *im, int height, int width, int ksize, int stride, int pad,
+    int height_col, int width_col, float *col)
+{
+    int ky, kx, h, j;
+    for (ky = 0; ky < ksize; ++ky) {
+        int h0, h1;
+        conv_output_range(ky, pad, stride, height, height_col, &h0, &h1);
+        for (kx = 0; kx < ksize; ++kx) {
+            int j0, j1;
+            conv_output_range(kx, pad, stride, width, width_col, &j0, &j1);
+            float *dst = col + (ky*ksize + kx)*height_col*width_col;
+
+            if (h0 > 0) memset(dst, 0, (size_t)h0*width_col*sizeof(float));
+            for (h = h0; h < h1; ++h) {
+                float *out = dst + h*width_col;
+                const float *src = im + (h*stride + ky - pad)*width + kx - pad;
+                for (j = 0; j < j0; ++j) out[j] = 0;
+                if (stride == 1) memcpy(out + j0, src + j0, (j1 - j0)*sizeof(float));
+                else {
+                    for (j = j0; j < j1; ++j) out[j] = src[j*stride];
+                }
+                for (j = j1; j < width_col; ++j) out[j] = 0;
+            }
+            if (h1 < height_col) memset(dst + h1*width_col, 0, (size_t)(height_col - h1)*width_col*sizeof(float));
+        }
+    }
+}
+
+void im2col_cpu_generic(float* data_im,
+     int channels,  int height,  int width,
+     int ksize,  int stride, int pad, float* data_col)
+{
+    int c;
+    int height_col = (height + 2*pad - ksize) / stride + 1;
+    int width_col = (width + 2*pad - ksize) / stride + 1;
+    size_t channel_col = (size_t)ksize*ksize*height_col*width_col;
+
+    #pragma omp parallel for
+    for (c = 0; c < channels; ++c) {
+        im2col_channel(data_im + (size_t)c*height*width, height, width, ksize, stride, pad,
+            height_col, width_col, data_col + c*channel_col);
+    }
+}
+
+void im2col_cpu_3x3_s1(float* data_im,
+     int channels,  int height,  int width,
+     int ksize,  int stride, int pad, float* data_col)
+{
+    int c;
+    int height_col = height + 2*pad - 2;
+    int width_col = width + 2*pad - 2;
+    size_t channel_col = (size_t)9*height_col*width_col;
+
+    #pragma omp parallel for
+    for (c = 0; c < channels; ++c) {
+        im2col_channel(data_im + (size_t)c*height*width, height, width, 3, 1, pad,
+            height_col, width_col, data_col + c*channel_col);
+    }
+}
+
+void im2col_cpu_3x3_s2(float* data_im,
+     int channels,  int height,  int width,
+     int ksize,  int stride, int pad, float* data_col)
+{
+    int c;
+    int height_col = (height + 2*pad - 3) / 2 + 1;
+    int width_col = (width + 2*pad - 3) / 2 + 1;
+    size_t channel_col = (size_t)9*height_col*width_col;
+
+    #pragma omp parallel for
+    for (c = 0; c < channels; ++c) {
+        im2col_channel(data_im + (size_t)c*height*width, height, width, 3, 2, pad,
+            height_col, width_col, data_col + c*channel_col);
+    }
+}
+
 void im2col_cpu(float* data_im,
      int channels,  int height,  int width,
      int ksize,  int stride, int pad, float* data_col)
 {
-    int c,h,w;
+    if (ksize == 3 && stride == 1) im2col_cpu_3x3_s1(data_im, channels, height, width, ksize, stride, pad, data_col);
+    else if (ksize == 3 && stride == 2) im2col_cpu_3x3_s2(data_im, channels, height, width, ksize, stride, pad, data_col);
+    else im2col_cpu_generic(data_im, channels, height, width, ksize, stride, pad, data_col);
+}
+
+void im2col_cpu_bin(const float* data_im,
+     int channels,  int height,  int width,
+     int ksize,  int stride, int pad, uint64_t* data_col, int ldb)
+{
     int height_col = (height + 2*pad - ksize) / stride + 1;
     int width_col = (width + 2*pad - ksize) / stride + 1;
+    int p;
 
-    int channels_col = channels * ksize * ksize;
-    for (c = 0; c < channels_col; ++c) {
-        int w_offset = c % ksize;
-        int h_offset = (c / ksize) % ksize;
-        int c_im = c / ksize / ksize;
-        for (h = 0; h < height_col; ++h) {
-            for (w = 0; w < width_col; ++w) {
-                int im_row = h_offset + h * stride;
-                int im_col = w_offset + w * stride;
-                int col_index = (c * height_col + h) * width_col + w;
-                data_col[col_index] = im2col_get_pixel(data_im, height, width, channels,
-                        im_row, im_col, c_im, pad);
+    #pragma omp parallel for
+    for (p = 0; p < height_col*width_col; ++p) {
+        int y0 = (p / width_col)*stride - pad;
+        int x0 = (p % width_col)*stride - pad;
+        uint64_t *row = data_col + (size_t)p*ldb;
+        int c, ky, kx, k = 0;
+        memset(row, 0, ldb*sizeof(uint64_t));
+        for (c = 0; c < channels; ++c) {
+            const float *im = data_im + (size_t)c*height*width;
+            for (ky = 0; ky < ksize; ++ky) {
+                int y = y0 + ky;
+                if (y < 0 || y >= height) {
+                    k += ksize;
+                    continue;
+                }
+                for (kx = 0; kx < ksize; ++kx, ++k) {
+                    int x = x0 + kx;
+                    if (x >= 0 && x < width && im[y*width + x] > 0) row[k >> 6] |= (uint64_t)1 << (k & 63);
+                }
             }
         }
     }
 }
-
@@ -11,6 +11,34 @@ extern "C" {
 void im2col_cpu(float* data_im,
         int channels, int height, int width,
         int ksize, int stride, int pad, float* data_col);
+void im2col_cpu_generic(float* data_im,
+        int channels, int height, int width,
+        int ksize, int stride, int pad, float* data_col);
+// ksize and stride must be 3 and 1 (or 3 and 2), they are only taken for a common signature
+void im2col_cpu_3x3_s1(float* data_im,
+        int channels, int height, int width,
+        int ksize, int stride, int pad, float* data_col);
+void im2col_cpu_3x3_s2(float* data_im,
+        int channels, int height, int width,
+        int ksize, int stride, int pad, float* data_col);
+// Bit-packed im2col for binary convolution, transposed: one row of ldb 64-bit words per output
+// pixel, bit k set when patch value k is > 0. Taps in the zero padding and the bits past
+// channels*ksize*ksize are 0, so padding reads as -1 once binarized, like any value <= 0.
+void im2col_cpu_bin(const float* data_im,
+        int channels, int height, int width,
+        int ksize, int stride, int pad, uint64_t* data_col, int ldb);
+
+// Output positions o in [*start, *end) read input position o*stride + offset - pad inside [0, size),
+// offset being the kernel tap. Positions outside the range fall into the zero padding.
+static inline void conv_output_range(int offset, int pad, int stride, int size, int out_size, int *start, int *end)
+{
+    int lo = pad - offset;
+    int hi = size - 1 + pad - offset;
+    *start = lo > 0 ? (lo + stride - 1) / stride : 0;
+    *end = hi < 0 ? 0 : hi / stride + 1;
+    if (*end > out_size) *end = out_size;
+    if (*start > *end) *start = *end;
+}
 float im2col_get_pixel(float* im, int height, int width, int channels,
     int row, int col, int channel, int pad);
 
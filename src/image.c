@@ -10,6 +10,13 @@
 #endif
 #include <math.h>
 
+// route the decoder's buffers through xmalloc so the allocation tracker sees them
+#define STBI_MALLOC(sz)         xmalloc(sz)
+#define STBI_REALLOC(p, newsz)  xrealloc(p, newsz)
+#define STBI_FREE(p)            xfree(p)
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
 //int windows = 0;
 
 float colors[6][3] = { {1,0,1}, {0,0,1},{0,1,1},{0,1,0},{1,1,0},{1,0,0} };
@@ -178,6 +185,30 @@ image load_image_stb(int channels)
     return im;
 }
 
+image load_image_from_memory(const unsigned char *buf, int len, int channels)
+{
+    int w, h, c;
+    unsigned char *data = stbi_load_from_memory(buf, len, &w, &h, &c, channels);
+    if (!data) {
+        fprintf(stderr, "Cannot decode image from memory, STB Reason: %s\n", stbi_failure_reason());
+        return make_empty_image(0, 0, 0);
+    }
+    if(channels) c = channels;
+    int i,j,k;
+    image im = make_image(w, h, c);
+    for(k = 0; k < c; ++k){
+        for(j = 0; j < h; ++j){
+            for(i = 0; i < w; ++i){
+                int dst_index = i + w*j + w*h*k;
+                int src_index = k + c*i + c*w*j;
+                im.data[dst_index] = (float)data[src_index]/255.;
+            }
+        }
+    }
+    stbi_image_free(data);
+    return im;
+}
+
 image load_image(int w, int h, int c)
 {
 
@@ -200,7 +231,7 @@ image load_image_color(int w, int h)
 void free_image(image m)
 {
     if(m.data){
-        free(m.data);
+        xfree(m.data);
     }
 }
 
@@ -0,0 +1,383 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "ipc_ring.h"
+#include "network.h"
+#include "utils.h"
+#include "trace.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <linux/futex.h>
+
+static void futex_wait(uint32_t *addr, uint32_t val)
+{
+    syscall(SYS_futex, addr, FUTEX_WAIT, val, NULL, NULL, 0);
+}
+
+static void futex_wake(uint32_t *addr, int n)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE, n, NULL, NULL, 0);
+}
+
+static uint32_t load_acquire(uint32_t *addr)
+{
+    return __atomic_load_n(addr, __ATOMIC_ACQUIRE);
+}
+
+static void store_release(uint32_t *addr, uint32_t val)
+{
+    __atomic_store_n(addr, val, __ATOMIC_RELEASE);
+}
+
+static int compare_exchange(uint32_t *addr, uint32_t expected, uint32_t desired)
+{
+    return __atomic_compare_exchange_n(addr, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+ipc_slot *get_ipc_slot(ipc_ring *r, int i)
+{
+    return (ipc_slot*)((char*)r->header + 64 + (size_t)i*r->header->slot_size);
+}
+
+void *get_ipc_slot_data(ipc_ring *r, int i)
+{
+    return (char*)get_ipc_slot(r, i) + IPC_SLOT_HEADER_SIZE;
+}
+
+static ipc_ring *make_ipc_ring(network net, int nslots)
+{
+    size_t payload = (size_t)net.inputs*sizeof(float);
+    size_t slot_size = (IPC_SLOT_HEADER_SIZE + payload + 63) / 64 * 64;
+    size_t size = 64 + nslots*slot_size;
+
+    int fd = memfd_create("darknet_ipc_ring", MFD_CLOEXEC);
+    if (fd < 0) error("memfd_create failed", DARKNET_LOC);
+    if (ftruncate(fd, size) < 0) error("ftruncate failed", DARKNET_LOC);
+    void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) error("mmap failed", DARKNET_LOC);
+
+    ipc_ring *r = (ipc_ring*)xcalloc(1, sizeof(ipc_ring));
+    r->fd = fd;
+    r->size = size;
+    r->header = (ipc_ring_header*)ptr;
+    r->header->nslots = nslots;
+    r->header->slot_size = slot_size;
+    r->header->w = net.w;
+    r->header->h = net.h;
+    r->header->c = net.c;
+    r->header->outputs = net.outputs;
+    store_release(&r->header->magic, IPC_RING_MAGIC);
+    return r;
+}
+
+void close_ipc_ring(ipc_ring *r)
+{
+    munmap(r->header, r->size);
+    close(r->fd);
+    xfree(r);
+}
+
+static int send_fd(int sock, int fd)
+{
+    char dummy = 'D';
+    struct iovec iov = { &dummy, 1 };
+    char control[CMSG_SPACE(sizeof(int))];
+    memset(control, 0, sizeof(control));
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+    return sendmsg(sock, &msg, MSG_NOSIGNAL) < 0 ? -1 : 0;
+}
+
+static int recv_fd(int sock)
+{
+    char dummy;
+    struct iovec iov = { &dummy, 1 };
+    char control[CMSG_SPACE(sizeof(int))];
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    if (recvmsg(sock, &msg, MSG_CMSG_CLOEXEC) <= 0) return -1;
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    if (!cmsg || cmsg->cmsg_type != SCM_RIGHTS) return -1;
+    int fd;
+    memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+    return fd;
+}
+
+typedef struct ipc_acceptor_args {
+    int listen_fd;
+    int ring_fd;
+} ipc_acceptor_args;
+
+// Hands the ring's memfd to every client that connects to the socket.
+static void *ipc_acceptor_thread(void *ptr)
+{
+    ipc_acceptor_args args = *(ipc_acceptor_args*)ptr;
+    while (1) {
+        int client = accept(args.listen_fd, NULL, NULL);
+        if (client < 0) {
+            if (errno == EINTR) continue;
+            // EINVAL: shut down by run_classifier_ipc_until()
+            if (errno != EINVAL) perror("accept");
+            break;
+        }
+        if (send_fd(client, args.ring_fd) < 0) perror("sendmsg");
+        close(client);
+    }
+    return 0;
+}
+
+static void hwc_u8_to_chw(const uint8_t *src, int w, int h, int c, float *dst)
+{
+    int i, k;
+    for (k = 0; k < c; ++k) {
+        for (i = 0; i < w*h; ++i) {
+            dst[k*w*h + i] = src[i*c + k] / 255.f;
+        }
+    }
+}
+
+static void serve_slot(network net, ipc_ring *r, int i, float *scratch)
+{
+    ipc_slot *slot = get_ipc_slot(r, i);
+    void *data = get_ipc_slot_data(r, i);
+    int j, top = slot->top;
+    if (top < 1) top = 1;
+    if (top > IPC_MAX_TOP) top = IPC_MAX_TOP;
+    if (top > net.outputs) top = net.outputs;
+
+    float *X = (float*)data;
+    if (slot->dtype != IPC_UINT8 && slot->dtype != IPC_FLOAT32) {
+        slot->status = -1;
+        return;
+    }
+
+    double start = get_time_point();
+    trace_begin("inference", i);
+    int indexes[IPC_MAX_TOP];
+    float probs[IPC_MAX_TOP];
+    // the first layer reads the frame bytes directly when it can
+    if (slot->dtype != IPC_UINT8 || !network_predict_hwc_u8_top_k(net, (const uint8_t*)data, top, indexes, probs)) {
+        if (slot->dtype == IPC_UINT8) {
+            trace_begin("hwc_u8_to_chw", i);
+            hwc_u8_to_chw((const uint8_t*)data, net.w, net.h, net.c, scratch);
+            trace_end("hwc_u8_to_chw", i);
+            X = scratch;
+        }
+        network_predict_top_k(net, X, top, indexes, probs);
+    }
+    trace_end("inference", i);
+    double end = get_time_point();
+    slot->inference_ms = (end - start) / 1000;
+    trace_request_done(start, end);
+
+    for (j = 0; j < top; ++j) {
+        slot->index[j] = indexes[j];
+        slot->prob[j] = probs[j];
+    }
+    slot->top = top;
+    slot->status = 0;
+}
+
+int run_classifier_ipc_until(network net, const char *socket_path, int nslots, int top, int *stop)
+{
+    if (nslots < 1) nslots = 1;
+    ipc_ring *r = make_ipc_ring(net, nslots);
+    float *scratch = (float*)xcalloc(net.inputs, sizeof(float));
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+    // a stale socket from an earlier run is replaced, anything else at the path is left alone
+    struct stat st;
+    if (lstat(socket_path, &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            fprintf(stderr, "%s exists and is not a socket, not replacing it \n", socket_path);
+            if (listen_fd >= 0) close(listen_fd);
+            xfree(scratch);
+            close_ipc_ring(r);
+            return -1;
+        }
+        unlink(socket_path);
+    }
+    // connect() is refused until listen(), so nobody gets in before the mode is set
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        chmod(socket_path, 0600) < 0 || listen(listen_fd, 16) < 0) {
+        perror(socket_path);
+        if (listen_fd >= 0) close(listen_fd);
+        xfree(scratch);
+        close_ipc_ring(r);
+        return -1;
+    }
+
+    ipc_acceptor_args args = { listen_fd, r->fd };
+    pthread_t acceptor;
+    if (pthread_create(&acceptor, 0, ipc_acceptor_thread, &args)) error("Thread creation failed", DARKNET_LOC);
+
+    fprintf(stderr, "IPC inference ring: %d slots x %u bytes, clients connect to %s \n", nslots, r->header->slot_size, socket_path);
+
+    trace_set_thread_name("ipc server");
+    ipc_ring_header *h = r->header;
+    while (!stop || !__atomic_load_n(stop, __ATOMIC_ACQUIRE)) {
+        uint32_t seen = load_acquire(&h->doorbell);
+        int i, served = 0;
+        for (i = 0; i < nslots; ++i) {
+            ipc_slot *slot = get_ipc_slot(r, i);
+            if (!compare_exchange(&slot->state, IPC_SLOT_READY, IPC_SLOT_BUSY)) continue;
+            if (!slot->top) slot->top = top;
+            serve_slot(net, r, i, scratch);
+            store_release(&slot->state, IPC_SLOT_DONE);
+            futex_wake(&slot->state, INT_MAX);
+            ++served;
+        }
+        if (!served) futex_wait(&h->doorbell, seen);
+    }
+
+    // accept() fails once the socket is shut down, which ends the acceptor
+    shutdown(listen_fd, SHUT_RDWR);
+    pthread_join(acceptor, 0);
+    close(listen_fd);
+    unlink(socket_path);
+    xfree(scratch);
+    close_ipc_ring(r);
+    return 0;
+}
+
+int run_classifier_ipc(network net, const char *socket_path, int nslots, int top)
+{
+    return run_classifier_ipc_until(net, socket_path, nslots, top, 0);
+}
+
+ipc_ring *open_ipc_ring(const char *socket_path)
+{
+    int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+    if (sock < 0 || connect(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        perror(socket_path);
+        if (sock >= 0) close(sock);
+        return 0;
+    }
+    int fd = recv_fd(sock);
+    close(sock);
+    if (fd < 0) return 0;
+
+    ipc_ring_header hdr;
+    if (pread(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr) || hdr.magic != IPC_RING_MAGIC) {
+        close(fd);
+        return 0;
+    }
+    size_t size = 64 + (size_t)hdr.nslots*hdr.slot_size;
+    void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        close(fd);
+        return 0;
+    }
+
+    ipc_ring *r = (ipc_ring*)xcalloc(1, sizeof(ipc_ring));
+    r->fd = fd;
+    r->size = size;
+    r->header = (ipc_ring_header*)ptr;
+    return r;
+}
+
+int ipc_acquire_slot(ipc_ring *r)
+{
+    ipc_ring_header *h = r->header;
+    while (1) {
+        uint32_t seen = load_acquire(&h->released);
+        int i;
+        for (i = 0; i < (int)h->nslots; ++i) {
+            if (compare_exchange(&get_ipc_slot(r, i)->state, IPC_SLOT_FREE, IPC_SLOT_WRITING)) return i;
+        }
+        // the ring is full, sleep until a client releases a slot
+        futex_wait(&h->released, seen);
+    }
+}
+
+void ipc_submit(ipc_ring *r, int i, IPC_DTYPE dtype, int top)
+{
+    ipc_slot *slot = get_ipc_slot(r, i);
+    slot->dtype = dtype;
+    slot->top = top;
+    store_release(&slot->state, IPC_SLOT_READY);
+    ipc_ring_doorbell(r);
+}
+
+void ipc_ring_doorbell(ipc_ring *r)
+{
+    __atomic_add_fetch(&r->header->doorbell, 1, __ATOMIC_RELEASE);
+    futex_wake(&r->header->doorbell, 1);
+}
+
+ipc_slot *ipc_wait(ipc_ring *r, int i)
+{
+    ipc_slot *slot = get_ipc_slot(r, i);
+    uint32_t state;
+    while ((state = load_acquire(&slot->state)) != IPC_SLOT_DONE) futex_wait(&slot->state, state);
+    return slot;
+}
+
+void ipc_release_slot(ipc_ring *r, int i)
+{
+    store_release(&get_ipc_slot(r, i)->state, IPC_SLOT_FREE);
+    __atomic_add_fetch(&r->header->released, 1, __ATOMIC_RELEASE);
+    futex_wake(&r->header->released, 1);
+}
+
+#else // __linux__
+
+int run_classifier_ipc(network net, const char *socket_path, int nslots, int top)
+{
+    fprintf(stderr, "The shared-memory IPC endpoint requires memfd and futexes and is only supported on Linux \n");
+    return -1;
+}
+
+int run_classifier_ipc_until(network net, const char *socket_path, int nslots, int top, int *stop)
+{
+    return run_classifier_ipc(net, socket_path, nslots, top);
+}
+
+ipc_ring *open_ipc_ring(const char *socket_path) { return 0; }
+void close_ipc_ring(ipc_ring *r) {}
+ipc_slot *get_ipc_slot(ipc_ring *r, int i) { return 0; }
+void *get_ipc_slot_data(ipc_ring *r, int i) { return 0; }
+int ipc_acquire_slot(ipc_ring *r) { return -1; }
+void ipc_submit(ipc_ring *r, int i, IPC_DTYPE dtype, int top) {}
+ipc_slot *ipc_wait(ipc_ring *r, int i) { return 0; }
+void ipc_release_slot(ipc_ring *r, int i) {}
+void ipc_ring_doorbell(ipc_ring *r) {}
+
+#endif // __linux__
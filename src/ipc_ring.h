@@ -0,0 +1,83 @@
+#ifndef IPC_RING_H
+#define IPC_RING_H
+#include "darknet.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Shared-memory inference endpoint for producers on the same Linux box.
+//
+// The server owns a memfd split into a ring header and nslots slots. A client connects to the
+// unix socket, receives the memfd over SCM_RIGHTS and maps it. It then writes a frame straight
+// into a free slot's payload and rings the doorbell. The server runs the network with the
+// payload as its input (float frames are not copied) and writes the top classes into the
+// slot header. The doorbell, the release counter and the slot states are futex words.
+// The socket is only accessible to the server's user (mode 0600), whoever can connect can
+// read and write every frame in the ring.
+
+#define IPC_RING_MAGIC 0x474e5244   // "DRNG"
+#define IPC_MAX_TOP 16
+#define IPC_SLOT_HEADER_SIZE 256
+
+enum {
+    IPC_SLOT_FREE,
+    IPC_SLOT_WRITING,
+    IPC_SLOT_READY,
+    IPC_SLOT_BUSY,
+    IPC_SLOT_DONE
+};
+
+typedef enum {
+    IPC_FLOAT32,    // CHW float, exactly what the network takes as input
+    IPC_UINT8       // HWC interleaved bytes as produced by frame grabbers, scaled by 1/255
+} IPC_DTYPE;
+
+typedef struct ipc_ring_header {
+    uint32_t magic;
+    uint32_t nslots;
+    uint32_t slot_size;     // bytes per slot including IPC_SLOT_HEADER_SIZE, multiple of 64
+    uint32_t w, h, c;       // network input size
+    uint32_t outputs;
+    uint32_t doorbell;      // futex, incremented after a slot becomes READY
+    uint32_t released;      // futex, incremented after a slot becomes FREE
+} ipc_ring_header;
+
+typedef struct ipc_slot {
+    uint32_t state;         // futex, IPC_SLOT_*
+    uint32_t dtype;         // IPC_DTYPE
+    uint32_t top;           // requested number of classes, <= IPC_MAX_TOP, 0 for the server default
+    int32_t status;         // 0 on success
+    float inference_ms;
+    int32_t index[IPC_MAX_TOP];
+    float prob[IPC_MAX_TOP];
+} ipc_slot;
+
+typedef struct ipc_ring {
+    int fd;
+    size_t size;
+    ipc_ring_header *header;
+} ipc_ring;
+
+int run_classifier_ipc(network net, const char *socket_path, int nslots, int top);
+// Same, but returns once *stop is set and the doorbell rung, see ipc_ring_doorbell()
+int run_classifier_ipc_until(network net, const char *socket_path, int nslots, int top, int *stop);
+
+// client side
+ipc_ring *open_ipc_ring(const char *socket_path);
+void close_ipc_ring(ipc_ring *r);
+ipc_slot *get_ipc_slot(ipc_ring *r, int i);
+void *get_ipc_slot_data(ipc_ring *r, int i);
+int ipc_acquire_slot(ipc_ring *r);
+void ipc_submit(ipc_ring *r, int i, IPC_DTYPE dtype, int top);
+ipc_slot *ipc_wait(ipc_ring *r, int i);
+void ipc_release_slot(ipc_ring *r, int i);
+// wakes the server without submitting anything
+void ipc_ring_doorbell(ipc_ring *r);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
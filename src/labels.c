@@ -0,0 +1,102 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "labels.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// mmap() where available, a heap copy of the file otherwise (or for files mmap can't map, like pipes)
+static const char *map_file(const char *filename, size_t *size, int *mapped)
+{
+    *size = 0;
+    *mapped = 0;
+#ifndef _WIN32
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        void *ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr != MAP_FAILED) {
+            close(fd);
+            *size = st.st_size;
+            *mapped = 1;
+            return (const char*)ptr;
+        }
+    }
+    close(fd);
+#endif
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) return 0;
+    size_t capacity = 1 << 16, n;
+    char *data = (char*)xmalloc(capacity);
+    while ((n = fread(data + *size, 1, capacity - *size, fp)) > 0) {
+        *size += n;
+        if (*size == capacity) {
+            capacity *= 2;
+            data = (char*)xrealloc(data, capacity);
+        }
+    }
+    fclose(fp);
+    return data;
+}
+
+label_table *load_label_table(const char *filename)
+{
+    size_t size;
+    int mapped;
+    const char *data = map_file(filename, &size, &mapped);
+    if (!data) return 0;
+
+    label_table *t = (label_table*)xcalloc(1, sizeof(label_table));
+    t->data = data;
+    t->size = size;
+    t->mapped = mapped;
+
+    int capacity = 1024;
+    t->offsets = (size_t*)xcalloc(capacity + 1, sizeof(size_t));
+    const char *p = data, *end = data + size;
+    while (p < end) {
+        const char *nl = (const char*)memchr(p, '\n', end - p);
+        const char *next = nl ? nl + 1 : end;
+        if (t->n == capacity) {
+            capacity *= 2;
+            t->offsets = (size_t*)xrealloc(t->offsets, (capacity + 1)*sizeof(size_t));
+        }
+        t->offsets[t->n++] = p - data;
+        p = next;
+    }
+    t->offsets[t->n] = size;
+    return t;
+}
+
+void free_label_table(label_table *t)
+{
+    if (!t) return;
+#ifndef _WIN32
+    if (t->mapped) munmap((void*)t->data, t->size);
+    else
+#endif
+    xfree((void*)t->data);
+    xfree(t->offsets);
+    xfree(t);
+}
+
+const char *get_label(const label_table *t, int i, int *len)
+{
+    if (!t || i < 0 || i >= t->n) return 0;
+    const char *s = t->data + t->offsets[i];
+    const char *e = t->data + t->offsets[i+1];
+    while (e > s && (e[-1] == '\n' || e[-1] == '\r')) --e;
+    if (len) *len = (int)(e - s);
+    return s;
+}
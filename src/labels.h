@@ -0,0 +1,33 @@
+#ifndef LABELS_H
+#define LABELS_H
+#include "darknet.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Class names, one per line, read from a memory-mapped file instead of being compiled in. Only
+// the line offsets are built on load; the text itself is paged in by the OS as labels are
+// looked up, so a 22k-class table costs one pass over the file and n+1 offsets.
+// Labels point into the mapping and are not NUL terminated, print them with "%.*s".
+struct label_table {
+    int n;
+    const char *data;
+    size_t size;
+    size_t *offsets;        // n+1 entries, label i is data[offsets[i]] up to the newline before offsets[i+1]
+    int mapped;             // data is an mmap() of the file rather than a heap copy
+};
+
+// 0 if the file can't be opened
+label_table *load_label_table(const char *filename);
+void free_label_table(label_table *t);
+
+// Label i and its length, or 0 when i is out of range
+const char *get_label(const label_table *t, int i, int *len);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
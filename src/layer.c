@@ -1,11 +1,13 @@
 #include "layer.h"
+#include "utils.h"
+#include "tensor_alloc.h"
 #include <stdlib.h>
 
 void free_sublayer(layer *l)
 {
     if (l) {
         free_layer(*l);
-        free(l);
+        xfree(l);
     }
 }
 
@@ -18,18 +20,21 @@ void free_layer_custom(layer l, int keep_cudnn_desc)
 {
 
     //remove unused part
-    if (l.indexes)            free(l.indexes);
-    if (l.cost)               free(l.cost);
-    if (l.biases)             free(l.biases), l.biases = NULL;
-    if (l.scales)             free(l.scales), l.scales = NULL;
-    if (l.weights)            free(l.weights), l.weights = NULL;
-    if (l.delta)              free(l.delta), l.delta = NULL;
+    if (l.indexes)            xfree(l.indexes);
+    if (l.cost)               xfree(l.cost);
+    if (l.biases)             xfree(l.biases), l.biases = NULL;
+    if (l.scales)             xfree(l.scales), l.scales = NULL;
+    if (l.weights)            tensor_free(l.weights), l.weights = NULL;
+    if (l.packed_weights)     tensor_free(l.packed_weights), l.packed_weights = NULL;
+    if (l.align_bit_weights)  tensor_free(l.align_bit_weights), l.align_bit_weights = NULL;
+    if (l.mean_arr)           xfree(l.mean_arr), l.mean_arr = NULL;
+    if (l.delta)              xfree(l.delta), l.delta = NULL;
 
-    if (l.output)             free(l.output), l.output = NULL;
-    if (l.mean)               free(l.mean), l.mean = NULL;
-    if (l.variance)           free(l.variance), l.variance = NULL;
-    if (l.mean_delta)         free(l.mean_delta), l.mean_delta = NULL;
-    if (l.variance_delta)     free(l.variance_delta), l.variance_delta = NULL;
-    if (l.rolling_mean)       free(l.rolling_mean), l.rolling_mean = NULL;
-    if (l.rolling_variance)   free(l.rolling_variance), l.rolling_variance = NULL;
+    if (l.output)             tensor_free(l.output), l.output = NULL;
+    if (l.mean)               xfree(l.mean), l.mean = NULL;
+    if (l.variance)           xfree(l.variance), l.variance = NULL;
+    if (l.mean_delta)         xfree(l.mean_delta), l.mean_delta = NULL;
+    if (l.variance_delta)     xfree(l.variance_delta), l.variance_delta = NULL;
+    if (l.rolling_mean)       xfree(l.rolling_mean), l.rolling_mean = NULL;
+    if (l.rolling_variance)   xfree(l.rolling_variance), l.rolling_variance = NULL;
 }
@@ -1,8 +1,11 @@
 #include "maxpool_layer.h"
 #include "convolutional_layer.h"
 #include "utils.h"
+#include "tensor_alloc.h"
 #include "gemm.h"
+#include "blas.h"
 #include <stdio.h>
+#include <float.h>
 
 maxpool_layer make_maxpool_layer(int batch, int h, int w, int c, int size, int stride, int padding, int avgpool)
 {
@@ -25,7 +28,7 @@ maxpool_layer make_maxpool_layer(int batch, int h, int w, int c, int size, int s
     l.stride = stride;
     int output_size = l.out_h * l.out_w * l.out_c * batch;
 
-    l.output = (float*)xcalloc(output_size, sizeof(float));
+    l.output = (float*)tensor_calloc(output_size, sizeof(float));
 
     l.forward = forward_maxpool_layer;
 
@@ -36,10 +39,82 @@ maxpool_layer make_maxpool_layer(int batch, int h, int w, int c, int size, int s
     return l;
 }
 
+void resize_maxpool_layer(maxpool_layer *l, int w, int h)
+{
+    l->h = h;
+    l->w = w;
+    l->inputs = h*w*l->c;
+
+    l->out_w = (w + l->pad - l->size) / l->stride + 1;
+    l->out_h = (h + l->pad - l->size) / l->stride + 1;
+    l->outputs = l->out_w * l->out_h * l->out_c;
+    int output_size = l->outputs * l->batch;
+
+    l->output = (float*)tensor_realloc(l->output, output_size * sizeof(float));
+    if (l->indexes) l->indexes = (int*)xrealloc(l->indexes, output_size * sizeof(int));
+    l->bflops = (l->size*l->size*l->c * l->out_h*l->out_w) / 1000000000.;
+}
 
 void forward_maxpool_layer(const maxpool_layer l, network_state state)
 {
+    // argmax indexes are only there for backward
+    if (l.indexes) {
+        forward_maxpool_layer_avx(state.input, l.output, l.indexes, l.size, l.w, l.h, l.out_w, l.out_h, l.c, l.pad, l.stride, l.batch);
+    }
+    else if (l.size == 2 && l.stride == 2) {
+        forward_maxpool_2x2_s2(state.input, l.output, l.w, l.h, l.out_w, l.out_h, l.c, l.pad, l.batch);
+    }
+    else {
+        forward_maxpool_inference(state.input, l.output, l.size, l.w, l.h, l.out_w, l.out_h, l.c, l.pad, l.stride, l.batch);
+    }
+}
 
-    forward_maxpool_layer_avx(state.input, l.output, l.indexes, l.size, l.w, l.h, l.out_w, l.out_h, l.c, l.pad, l.stride, l.batch);
-    
+// Max pooling of an NCHW[block]c input, one vector of block channels per tap. The output is
+// blocked as well, or NCHW when output_block is 0. No argmax indexes, this is inference only.
+void forward_maxpool_nchwc(const float *src, float *dst, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch, int block, int output_block)
+{
+    const int w_offset = -pad / 2;
+    const int h_offset = -pad / 2;
+    const int blocks = channel_blocks(c, block);
+    int b, r;
+
+    for (b = 0; b < batch; ++b) {
+        const float *in = src + (size_t)b*blocks*block*h*w;
+        #pragma omp parallel for
+        for (r = 0; r < blocks*out_h; ++r) {
+            int cb = r / out_h;
+            int i = r % out_h;
+            int j, n, m, q;
+            float max[16];
+            for (j = 0; j < out_w; ++j) {
+                for (q = 0; q < block; ++q) max[q] = -FLT_MAX;
+                for (n = 0; n < size; ++n) {
+                    int cur_h = h_offset + i*stride + n;
+                    if (cur_h < 0 || cur_h >= h) continue;
+                    for (m = 0; m < size; ++m) {
+                        int cur_w = w_offset + j*stride + m;
+                        if (cur_w < 0 || cur_w >= w) continue;
+                        const float *v = in + (((size_t)cb*h + cur_h)*w + cur_w)*block;
+                        for (q = 0; q < block; ++q) max[q] = v[q] > max[q] ? v[q] : max[q];
+                    }
+                }
+                if (output_block) {
+                    float *o = dst + ((((size_t)b*blocks + cb)*out_h + i)*out_w + j)*block;
+                    for (q = 0; q < block; ++q) o[q] = max[q];
+                }
+                else {
+                    for (q = 0; q < block && cb*block + q < c; ++q) {
+                        dst[(((size_t)b*c + cb*block + q)*out_h + i)*out_w + j] = max[q];
+                    }
+                }
+            }
+        }
+    }
+}
+
+void forward_maxpool_layer_nchwc(const maxpool_layer l, network_state state)
+{
+    forward_maxpool_nchwc(state.input, l.output, l.size, l.w, l.h, l.out_w, l.out_h, l.c, l.pad, l.stride, l.batch,
+        l.input_channel_block, l.channel_block);
 }
@@ -11,7 +11,12 @@ typedef layer maxpool_layer;
 extern "C" {
 #endif
 maxpool_layer make_maxpool_layer(int batch, int h, int w, int c, int size, int stride, int padding, int avgpool);
+void resize_maxpool_layer(maxpool_layer *l, int w, int h);
 void forward_maxpool_layer(const maxpool_layer l, network_state state);
+void forward_maxpool_layer_nchwc(const maxpool_layer l, network_state state);
+// block is 8 or 16
+void forward_maxpool_nchwc(const float *src, float *dst, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch, int block, int output_block);
 
 #ifdef __cplusplus
 }
@@ -1,12 +1,15 @@
 #include "darknet.h"
 
 #include <stdio.h>
+#include <string.h>
+#include <math.h>
 #include <time.h>
 #include <assert.h>
 
 #include "network.h"
 #include "image.h"
 #include "utils.h"
+#include "tensor_alloc.h"
 #include "blas.h"
 
 #include "convolutional_layer.h"
@@ -15,6 +18,33 @@
 #include "cost_layer.h"
 #include "softmax_layer.h"
 #include "parser.h"
+#include "profiler.h"
+#include "perf_counters.h"
+#include "alloc_tracker.h"
+#include "trace.h"
+#include "plan.h"
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+char *get_layer_string(LAYER_TYPE a)
+{
+    switch(a){
+        case CONVOLUTIONAL:
+            return "convolutional";
+        case MAXPOOL:
+            return "maxpool";
+        case AVGPOOL:
+            return "avgpool";
+        case SOFTMAX:
+            return "softmax";
+        case COST:
+            return "cost";
+        default:
+            break;
+    }
+    return "none";
+}
 
 int get_current_batch(network net)
 {
@@ -39,13 +69,56 @@ network make_network(int n)
 void forward_network(network net, network_state state)
 {
     state.workspace = net.workspace;
+    // profiled and alloc-tracked runs go layer by layer, traces come from the plan ops
+    if (net.plan && !net.profiler && !net.counters && !alloc_tracking) {
+        int from = 0;
+        trace_begin("forward_network", net.batch);
+        // the plan takes floats, a view is read by the first layer itself
+        if (state.input_view) {
+            trace_begin(get_layer_string(net.layers[0].type), 0);
+            forward_convolutional_layer_rgb(net.layers[0], state);
+            trace_end(get_layer_string(net.layers[0].type), 0);
+            state.input = net.layers[0].output;
+            from = 1;
+        }
+        run_network_plan(net.plan, from, net.n, state.input, state.output);
+        trace_end("forward_network", net.batch);
+        return;
+    }
     int i;
+#if defined(_OPENMP)
+    int default_threads = omp_get_max_threads();
+#endif
+    trace_begin("forward_network", net.batch);
     for(i = 0; i < net.n; ++i){
         state.index = i;
         layer l = net.layers[i];
+        // a view in, whatever algorithm was picked for float input
+        if (state.input_view) l.forward = forward_convolutional_layer_rgb;
+        if (alloc_tracking) alloc_set_context(i);
+        double start = 0;
+        if (net.counters) perf_counters_begin(net.counters);
+        if (net.profiler) start = get_time_point();
+        trace_begin(get_layer_string(l.type), i);
+#if defined(_OPENMP)
+        if (l.threads) omp_set_num_threads(l.threads);
+        l.forward(l, state);
+        if (l.threads) omp_set_num_threads(default_threads);
+#else
         l.forward(l, state);
+#endif
+        trace_end(get_layer_string(l.type), i);
+        if (net.profiler) profile_layer(net.profiler, i, get_time_point() - start);
+        if (net.counters) perf_counters_end(net.counters, i);
         state.input = l.output;
+        state.input_view = 0;
+    }
+    if (state.output) {
+        memcpy(state.output, get_network_output(net), (size_t)get_network_output_size(net)*net.batch*sizeof(float));
     }
+    trace_end("forward_network", net.batch);
+    if (net.profiler) profile_forward_done(net.profiler);
+    if (alloc_tracking) alloc_set_context(ALLOC_CONTEXT_NONE);
 }
 
 float *get_network_output(network net)
@@ -73,8 +146,12 @@ int recalculate_workspace_size(network *net)
     }
 
 
-    free(net->workspace);
-    net->workspace = (float*)xcalloc(1, workspace_size);
+    tensor_free(net->workspace);
+    net->workspace = (float*)tensor_calloc(1, workspace_size);
+    tensor_free(net->input_staging);
+    net->input_staging = (float*)tensor_calloc((size_t)net->batch*net->inputs, sizeof(float));
+    // the plan holds the layer, output and workspace pointers
+    if (net->plan) compile_network(net);
     //fprintf(stderr, " Done!\n");
     return 0;
 }
@@ -89,6 +166,149 @@ void set_batch_network(network *net, int b)
     recalculate_workspace_size(net); // recalculate workspace size
 }
 
+void set_network_active_batch(network *net, int b)
+{
+    int i;
+    net->batch = b;
+    for(i = 0; i < net->n; ++i){
+        net->layers[i].batch = b;
+    }
+    if (net->plan) set_plan_batch(net->plan, b);
+}
+
+size_t network_prefault(network *net, int lock)
+{
+    int i, unlocked = 0;
+    size_t bytes = tensor_size(net->workspace);
+    unlocked += !tensor_prefault(net->workspace, lock);
+    for (i = 0; i < net->n; ++i) {
+        layer l = net->layers[i];
+        void *tensors[] = {l.weights, l.packed_weights, l.align_bit_weights, l.output};
+        int t;
+        for (t = 0; t < (int)(sizeof(tensors)/sizeof(tensors[0])); ++t) {
+            unlocked += !tensor_prefault(tensors[t], lock);
+            bytes += tensor_size(tensors[t]);
+        }
+    }
+    if (unlocked) fprintf(stderr, "network_prefault: couldn't mlock %d tensors (see ulimit -l), they were only pre-faulted\n", unlocked);
+    return bytes;
+}
+
+int resize_network(network *net, int w, int h)
+{
+    int i;
+    int inputs = w*h*net->c;
+    net->w = w;
+    net->h = h;
+    net->inputs = inputs;
+
+    for (i = 0; i < net->n; ++i){
+        layer *l = &net->layers[i];
+        switch(l->type){
+            case CONVOLUTIONAL:
+                resize_convolutional_layer(l, w, h);
+                break;
+            case MAXPOOL:
+                resize_maxpool_layer(l, w, h);
+                break;
+            case AVGPOOL:
+                resize_avgpool_layer(l, w, h);
+                break;
+            case SOFTMAX:
+            case COST:
+                // flat layers, only fine while the input size does not change
+                if (l->inputs != inputs) error("Cannot resize the input of this type of layer", DARKNET_LOC);
+                break;
+            default:
+                error("Cannot resize this type of layer", DARKNET_LOC);
+        }
+        if (l->outputs < 1) error("Network input is too small for this network", DARKNET_LOC);
+        inputs = l->outputs;
+        w = l->out_w;
+        h = l->out_h;
+    }
+
+    net->outputs = get_network_output_size(*net);
+    net->output = get_network_output(*net);
+    recalculate_workspace_size(net);
+    return 0;
+}
+
+// Grouped convolutions only have a blocked kernel when they are depthwise, binary ones have none
+static int conv_blockable(layer l)
+{
+    return !l.xnor && (l.groups == 1 || l.algorithm == CONV_DEPTHWISE);
+}
+
+// Whether layer l can take its input in NCHW[block]c
+static int accepts_channel_block(layer l, int block)
+{
+    switch(l.type){
+        case CONVOLUTIONAL:
+            return conv_blockable(l) && l.c % block == 0;
+        case MAXPOOL:
+        case AVGPOOL:
+            return l.c % block == 0;
+        default:
+            return 0;
+    }
+}
+
+int set_network_channel_block(network *net, int block)
+{
+    int i, blocked = 0;
+    if (block != 0 && block != 8 && block != 16) error("Channel block must be 0, 8 or 16", DARKNET_LOC);
+
+    for(i = 0; i < net->n; ++i){
+        layer *l = &net->layers[i];
+        int input_block = i ? net->layers[i-1].channel_block : 0;
+        // a layer only writes blocked output when the next one reads it, so conversions happen
+        // inside the first blocked layer and the last one (the avgpool at the head, typically)
+        int next = block && i + 1 < net->n && accepts_channel_block(net->layers[i+1], block);
+        switch(l->type){
+            case CONVOLUTIONAL:
+                set_convolutional_channel_block(l, input_block, next && conv_blockable(*l) && l->n % block == 0 ? block : 0);
+                break;
+            case MAXPOOL:
+                l->input_channel_block = input_block;
+                l->channel_block = input_block && next ? block : 0;
+                l->forward = input_block ? forward_maxpool_layer_nchwc : forward_maxpool_layer;
+                break;
+            case AVGPOOL:
+                l->input_channel_block = input_block;
+                l->forward = input_block ? forward_avgpool_layer_nchwc : forward_avgpool_layer;
+                break;
+            default:
+                break;
+        }
+        if (l->input_channel_block || l->channel_block) ++blocked;
+    }
+    recalculate_workspace_size(net);
+    return blocked;
+}
+
+int set_network_xnor(network *net)
+{
+    int i, first = -1, last = -1, binary = 0;
+    size_t bytes = 0;
+    for(i = 0; i < net->n; ++i){
+        if (net->layers[i].type != CONVOLUTIONAL) continue;
+        if (first < 0) first = i;
+        last = i;
+    }
+    for(i = first + 1; i < last; ++i){
+        layer *l = &net->layers[i];
+        if (l->type != CONVOLUTIONAL || l->groups != 1) continue;
+        set_convolutional_xnor(l);
+        bytes += (size_t)l->n*l->lda_align*sizeof(uint64_t);
+        ++binary;
+    }
+    recalculate_workspace_size(net);
+    fprintf(stderr, "xnor: %d binary convolutional layers, %.1f KB of weight bits\n", binary, bytes/1024.);
+    // nothing in the weights file says how they were trained
+    if (binary) fprintf(stderr, "xnor: outputs are only accurate with weights trained binary (*_xnor cfgs), float-trained weights lose most of their accuracy\n");
+    return binary;
+}
 
 int get_network_output_size(network net)
 {
@@ -113,20 +333,193 @@ float *network_predict(network net, float *input)
     return out;
 }
 
+tensor_view make_tensor_view_chw(const float *data, int w, int h, int c)
+{
+    tensor_view v = {0};
+    v.data = data;
+    v.type = TENSOR_FLOAT32;
+    v.w = w;
+    v.h = h;
+    v.c = c;
+    v.stride_w = 1;
+    v.stride_h = w;
+    v.stride_c = (size_t)w*h;
+    v.stride_b = (size_t)w*h*c;
+    return v;
+}
+
+tensor_view make_tensor_view_hwc(const void *data, tensor_type type, int w, int h, int c)
+{
+    tensor_view v = {0};
+    v.data = data;
+    v.type = type;
+    v.w = w;
+    v.h = h;
+    v.c = c;
+    v.stride_c = 1;
+    v.stride_w = c;
+    v.stride_h = (size_t)w*c;
+    v.stride_b = (size_t)w*h*c;
+    return v;
+}
+
+// Only moves the data pointer, the strides still step through the full buffer
+tensor_view crop_tensor_view(tensor_view v, int dx, int dy, int w, int h)
+{
+    size_t element = v.type == TENSOR_UINT8 ? sizeof(unsigned char) : sizeof(float);
+    v.data = (const char*)v.data + (dy*v.stride_h + dx*v.stride_w)*element;
+    v.w = w;
+    v.h = h;
+    return v;
+}
+
+static int is_planar_view(tensor_view v)
+{
+    return v.type == TENSOR_FLOAT32 && v.stride_w == 1 && v.stride_h == (size_t)v.w &&
+        v.stride_c == (size_t)v.w*v.h && v.stride_b == (size_t)v.w*v.h*v.c;
+}
+
+void gather_tensor_view(tensor_view v, int batch, float *dst)
+{
+    int b, k, y, x;
+    for (b = 0; b < batch; ++b) {
+        for (k = 0; k < v.c; ++k) {
+            for (y = 0; y < v.h; ++y) {
+                size_t src = b*v.stride_b + k*v.stride_c + y*v.stride_h;
+                float *d = dst + (((size_t)b*v.c + k)*v.h + y)*v.w;
+                if (v.type == TENSOR_UINT8) {
+                    const unsigned char *p = (const unsigned char*)v.data + src;
+                    for (x = 0; x < v.w; ++x) d[x] = p[x*v.stride_w] / 255.f;
+                }
+                else {
+                    const float *p = (const float*)v.data + src;
+                    for (x = 0; x < v.w; ++x) d[x] = p[x*v.stride_w];
+                }
+            }
+        }
+    }
+}
+
+// The direct RGB kernel of a first layer reads the view in place, other first layers get a
+// planar float view as it is, or a CHW copy of anything else. With a plan the last layer
+// writes straight into output.
+int network_predict_into(network net, tensor_view input, float *output)
+{
+    if (input.w != net.w || input.h != net.h || input.c != net.c) return 0;
+    layer l = net.layers[0];
+    network_state state = {0};
+    state.net = net;
+    state.output = output;
+    if (l.type == CONVOLUTIONAL && conv_algorithm_supported(l, CONV_DIRECT_RGB)) {
+        state.input_view = &input;
+    }
+    else if (is_planar_view(input)) {
+        state.input = (float*)input.data;
+    }
+    else {
+        gather_tensor_view(input, net.batch, net.input_staging);
+        state.input = net.input_staging;
+    }
+    forward_network(net, state);
+    return 1;
+}
+
+// The first layer reads the bytes itself, which saves converting the frame to floats first.
+// Returns 0 when the first layer can't, the caller converts then.
+float *network_predict_hwc_u8(network net, const unsigned char *input)
+{
+    layer l = net.layers[0];
+    if (l.type != CONVOLUTIONAL || !conv_algorithm_supported(l, CONV_DIRECT_RGB)) return 0;
+    tensor_view view = make_tensor_view_hwc(input, TENSOR_UINT8, net.w, net.h, net.c);
+    network_state state = {0};
+    state.net = net;
+    state.input_view = &view;
+    forward_network(net, state);
+    return get_network_output(net);
+}
+
+// Index of a final softmax that can be skipped by network_predict_top_k(), -1 if there is none
+static int get_softmax_head(network net)
+{
+    int i = net.n - 1;
+    while (i > 0 && net.layers[i].type == COST) --i;
+    if (i > 0 && net.layers[i].type == SOFTMAX && net.layers[i].groups == 1) return i;
+    return -1;
+}
+
+// The k best classes of every image in the batch, indexes and probs hold net.batch*k entries.
+// Softmax is monotonic, so when the network ends in one the classes are picked on the logits and
+// only their k probabilities are computed, from the log-sum-exp; the softmax layer does not run
+// and its output is left stale.
+static void predict_top_k(network net, network_state state, int k, int *indexes, float *probs)
+{
+    int b, j;
+    int s = get_softmax_head(net);
+
+    if (s < 0) {
+        forward_network(net, state);
+        float *out = get_network_output(net);
+        int n = get_network_output_size(net);
+        if (k > n) k = n;
+        top_k_batch(out, n, net.batch, k, indexes);
+        for (b = 0; b < net.batch; ++b) {
+            for (j = 0; j < k; ++j) probs[b*k + j] = out[b*n + indexes[b*k + j]];
+        }
+        return;
+    }
+
+    network head = net;
+    head.n = s;
+    forward_network(head, state);
+    float *logits = net.layers[s-1].output;
+    int n = net.layers[s].inputs;
+    if (k > n) k = n;
+    trace_begin("top_k logits", k);
+    top_k_batch(logits, n, net.batch, k, indexes);
+    for (b = 0; b < net.batch; ++b) {
+        float *x = logits + b*n;
+        float lse = log_sum_exp(x, n);
+        for (j = 0; j < k; ++j) probs[b*k + j] = expf(x[indexes[b*k + j]] - lse);
+    }
+    trace_end("top_k logits", k);
+}
+
+void network_predict_top_k(network net, float *input, int k, int *indexes, float *probs)
+{
+    network_state state = {0};
+    state.net = net;
+    state.input = input;
+    predict_top_k(net, state, k, indexes, probs);
+}
+
+int network_predict_hwc_u8_top_k(network net, const unsigned char *input, int k, int *indexes, float *probs)
+{
+    layer l = net.layers[0];
+    if (l.type != CONVOLUTIONAL || !conv_algorithm_supported(l, CONV_DIRECT_RGB)) return 0;
+    tensor_view view = make_tensor_view_hwc(input, TENSOR_UINT8, net.w, net.h, net.c);
+    network_state state = {0};
+    state.net = net;
+    state.input_view = &view;
+    predict_top_k(net, state, k, indexes, probs);
+    return 1;
+}
+
 void free_network(network net)
 {
     int i;
     for (i = 0; i < net.n; ++i) {
         free_layer(net.layers[i]);
     }
-    free(net.layers);
+    xfree(net.layers);
 
-    free(net.seen);
-    free(net.cur_iteration);
-    free(net.total_bbox);
-    free(net.rewritten_bbox);
+    xfree(net.seen);
+    xfree(net.cur_iteration);
+    xfree(net.total_bbox);
+    xfree(net.rewritten_bbox);
 
-    free(net.workspace);
+    tensor_free(net.workspace);
+    tensor_free(net.input_staging);
+    free_network_plan(net.plan);
 }
 
 void fuse_conv_batchnorm(network net)
@@ -24,6 +24,45 @@ float *get_network_output(network net);
 float *get_network_output_layer(network net, int i);
 int get_network_output_size(network net);
 void set_batch_network(network *net, int b);
+// Runs the next calls on b images without reallocating anything or recompiling the plan, cheap
+// enough to do per request. The network must have been built for at least b images (layer
+// outputs are sized when the layers are made); the workspace does not depend on the batch.
+void set_network_active_batch(network *net, int b);
+// Changes the network input to w x h: every layer gets its new geometry and reallocated output,
+// the workspace is resized, weights, algorithms and layouts are kept. The outputs of the layers
+// move, so pointers from get_network_output() or network_predict() have to be fetched again, and
+// nothing may run on the network meanwhile. An avgpool removed by optimize_network() for having
+// a 1x1 input is not brought back.
+int resize_network(network *net, int w, int h);
+int recalculate_workspace_size(network *net);
+// Runs the network on net.batch images in caller memory and writes net.batch*net.outputs floats
+// to output, which the caller owns; nothing is returned that the next call overwrites. The view
+// can be CHW or HWC, float or uint8, and cropped, see tensor_view. Returns 0 when its dims are
+// not the network input dims. Views the first layer can't read in place are gathered into
+// net.input_staging, which the workspace updates keep sized, so calls don't allocate.
+int network_predict_into(network net, tensor_view input, float *output);
+tensor_view make_tensor_view_chw(const float *data, int w, int h, int c);
+tensor_view make_tensor_view_hwc(const void *data, tensor_type type, int w, int h, int c);
+// the w x h window at dx, dy of v, same buffer
+tensor_view crop_tensor_view(tensor_view v, int dx, int dy, int w, int h);
+// batch planar CHW float images from any view, uint8 scaled to [0, 1]; dst holds batch*w*h*c
+void gather_tensor_view(tensor_view v, int batch, float *dst);
+// Faults in the weights, layer outputs and workspace (see tensor_prefault()) so the first
+// inference doesn't pay for page faults; with lock they are also mlock()ed. Call once the network
+// is in its final shape and layout, the buffers those steps allocate are new. Returns the bytes
+// touched.
+size_t network_prefault(network *net, int lock);
+// Switches convolutional, maxpool and avgpool layers to the NCHW[block]c activation layout
+// (block 8 or 16, see blas.h) where channel counts allow, 0 goes back to NCHW. The network input
+// and output stay NCHW. Call after autotune_network() and again after the weights change.
+// Returns the number of layers that read or write blocked activations.
+int set_network_channel_block(network *net, int block);
+// Binarizes every convolutional layer but the first and the last, which stay in float as in
+// XNOR-Net, see set_convolutional_xnor(). Only meaningful with weights trained for it, like those
+// of the *_xnor cfgs, a warning is printed since the weights file can't tell. The float weights
+// of the binary layers are freed. Call before set_network_channel_block(); returns the number of
+// binary layers.
+int set_network_xnor(network *net);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,90 @@
+#include "optimize.h"
+#include "convolutional_layer.h"
+#include "avgpool_layer.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Every rule looks at layer i (and the ones after it) and returns 1 when it changed the list.
+typedef int (*rewrite_rule)(network *net, int i);
+
+static void remove_layer(network *net, int i)
+{
+    free_layer(net->layers[i]);
+    memmove(net->layers + i, net->layers + i + 1, (net->n - i - 1)*sizeof(layer));
+    --net->n;
+}
+
+// Both are linear, so averaging first and running the convolution on one pixel gives the same
+// result with out_h*out_w times fewer FLOPs: W*avg(x) + b = avg(W*x + b).
+static int commute_linear_conv_avgpool(network *net, int i)
+{
+    if (i + 1 >= net->n) return 0;
+    layer conv = net->layers[i];
+    layer pool = net->layers[i+1];
+    if (conv.type != CONVOLUTIONAL || pool.type != AVGPOOL) return 0;
+    if (conv.activation != LINEAR || conv.batch_normalize || conv.groups != 1 || conv.xnor) return 0;
+    if (conv.size != 1 || conv.stride != 1 || conv.pad != 0 || conv.out_h*conv.out_w == 1) return 0;
+
+    fprintf(stderr, "optimize: layers %d-%d, avgpool moved ahead of the 1x1 linear convolution\n", i, i + 1);
+    layer avg = make_avgpool_layer(conv.batch, conv.w, conv.h, conv.c);
+    layer lin = make_convolutional_layer(conv.batch, 1, 1, conv.c, conv.n, 1, 1, 1, 0, LINEAR, 0);
+    memcpy(lin.weights, conv.weights, conv.nweights*sizeof(float));
+    memcpy(lin.biases, conv.biases, conv.n*sizeof(float));
+    // one pixel: a plain matrix-vector product, no im2col copy
+    set_convolutional_algorithm(&lin, CONV_GEMM_1X1);
+    free_layer(conv);
+    free_layer(pool);
+    net->layers[i] = avg;
+    net->layers[i+1] = lin;
+    return 1;
+}
+
+static int drop_identity(network *net, int i)
+{
+    layer l = net->layers[i];
+    int identity = (l.type == MAXPOOL && l.size == 1 && l.stride == 1 && l.pad == 0) ||
+                   (l.type == AVGPOOL && l.h == 1 && l.w == 1);
+    if (!identity || i == 0 || net->n < 2) return 0;
+    fprintf(stderr, "optimize: layer %d, %s on a 1x1 window dropped\n", i, get_layer_string(l.type));
+    remove_layer(net, i);
+    return 1;
+}
+
+// the cost layer only does something when there is a truth to compare with
+static int drop_trailing_cost(network *net, int i)
+{
+    if (i != net->n - 1 || net->layers[i].type != COST || net->n < 2) return 0;
+    fprintf(stderr, "optimize: layer %d, trailing cost layer dropped\n", i);
+    remove_layer(net, i);
+    return 1;
+}
+
+static const rewrite_rule rules[] = {
+    commute_linear_conv_avgpool,
+    drop_identity,
+    drop_trailing_cost,
+};
+
+int optimize_network(network *net)
+{
+    int rewrites = 0;
+    int changed = 1;
+    while (changed) {
+        int i, r;
+        changed = 0;
+        for (i = 0; i < net->n && !changed; ++i) {
+            for (r = 0; r < (int)(sizeof(rules)/sizeof(rules[0])) && !changed; ++r) {
+                changed = rules[r](net, i);
+            }
+        }
+        rewrites += changed;
+    }
+    if (rewrites) {
+        net->outputs = get_network_output_size(*net);
+        net->output = get_network_output(*net);
+        recalculate_workspace_size(net);
+    }
+    return rewrites;
+}
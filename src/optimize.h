@@ -0,0 +1,22 @@
+#ifndef OPTIMIZE_H
+#define OPTIMIZE_H
+#include "darknet.h"
+#include "network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Inference-only rewrites of the layer list that keep the network output, applied until none
+// matches:
+//   1x1 LINEAR convolution -> global avgpool   becomes   global avgpool -> 1x1 convolution
+//   maxpool 1x1/1 and avgpool of a 1x1 input   are dropped (identity)
+//   a trailing COST layer                      is dropped
+// Run after load_weights() and fuse_conv_batchnorm(), before autotune_network() and
+// set_network_channel_block(). Reallocates the workspace. Returns the number of rewrites.
+int optimize_network(network *net);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
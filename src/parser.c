@@ -13,6 +13,8 @@
 #include "parser.h"
 #include "softmax_layer.h"
 #include "utils.h"
+#include "tensor_alloc.h"
+#include "alloc_tracker.h"
 
 typedef struct size_params{
     int batch;
@@ -26,10 +28,9 @@ typedef struct size_params{
     network net;
 } size_params;
 
-convolutional_layer parse_convolutional(int batch_normalize, int filter, int size, int stride, int pad, char* activation_s, size_params params)
+convolutional_layer parse_convolutional(int batch_normalize, int filter, int groups, int size, int stride, int pad, char* activation_s, size_params params)
 {
     int n = filter;
-    int groups = 1;
 
     int dilation = 1;
     if (size == 1) dilation = 1;
@@ -45,6 +46,7 @@ convolutional_layer parse_convolutional(int batch_normalize, int filter, int siz
     batch=params.batch;
 
     if(!(h && w && c)) error("Layer before convolutional layer must output image.", DARKNET_LOC);
+    if (groups < 1 || c % groups || n % groups) error("Convolutional groups must divide both the input channels and the filters.", DARKNET_LOC);
 
     convolutional_layer layer = make_convolutional_layer(batch,h,w,c,n,groups,size,stride,padding,activation, batch_normalize);
     //fprintf(stderr, "batch: %d, h: %d, w: %d, c: %d, n: %d, groups: %d, size: %d, stride: %d, padding: %d, activation: %s, batch_normalize: %d, \n", batch, h, w, c, n, groups, size, stride, padding, activation, batch_normalize);
@@ -168,11 +170,13 @@ network parse_network_cfg_custom(int batch, int time_steps)
     fprintf(stderr, "   layer   filters  size/strd(dil)      input                output\n");
     
     int batch_normalize, filter, size, stride, pad;
+    int groups = 1;
     char* activation_s;
     activation_s = (char*)xmalloc(sizeof(char)*512);
 
     while(count < 23){
         params.index = count;
+        if (alloc_tracking) alloc_set_context(count);
         fprintf(stderr, "%4d ", count);
         layer l = { (LAYER_TYPE)0 };
         switch(count){
@@ -183,7 +187,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);
             break;
             case 1:
                 l = parse_maxpool(params);
@@ -195,7 +199,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);
             break;
             case 3:
                 l = parse_maxpool(params);
@@ -207,7 +211,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);
             break;
             case 5:
                 batch_normalize = 1;
@@ -216,7 +220,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);
             break;
             case 6:
                 batch_normalize = 1;
@@ -225,7 +229,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);
             break;
             case 7:
                 batch_normalize = 1;
@@ -234,7 +238,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);
             break;
             case 8:
                 l = parse_maxpool(params);
@@ -246,7 +250,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 10:
                 batch_normalize = 1;
@@ -255,7 +259,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 11:
                 batch_normalize = 1;
@@ -264,7 +268,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 12:
                 batch_normalize = 1;
@@ -273,7 +277,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 13:
                 l = parse_maxpool(params);
@@ -285,7 +289,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 15:
                 batch_normalize = 1;
@@ -294,7 +298,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 16:
                 batch_normalize = 1;
@@ -303,7 +307,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 17:
                 batch_normalize = 1;
@@ -312,7 +316,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 18:
                 batch_normalize = 1;
@@ -321,7 +325,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "leaky");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 19:
                 batch_normalize = 0;
@@ -330,7 +334,7 @@ network parse_network_cfg_custom(int batch, int time_steps)
                 stride = 1;
                 pad = 1;
                 strcpy(activation_s, "linear");
-                l = parse_convolutional(batch_normalize, filter, size, stride, pad, activation_s, params);            
+                l = parse_convolutional(batch_normalize, filter, groups, size, stride, pad, activation_s, params);            
             break;
             case 20:
                 l = parse_avgpool(params);
@@ -365,6 +369,8 @@ network parse_network_cfg_custom(int batch, int time_steps)
             avg_counter++;
         }
     }
+    if (alloc_tracking) alloc_set_context(ALLOC_CONTEXT_NONE);
+    xfree(activation_s);
 
     net.outputs = get_network_output_size(net);
     net.output = get_network_output(net);
@@ -372,8 +378,9 @@ network parse_network_cfg_custom(int batch, int time_steps)
     fprintf(stderr, "Total BFLOPS %5.3f \n", bflops);
     fprintf(stderr, "avg_outputs = %d \n", avg_outputs);
     if (workspace_size) {
-        net.workspace = (float*)xcalloc(1, workspace_size);
+        net.workspace = (float*)tensor_calloc(1, workspace_size);
     }
+    net.input_staging = (float*)tensor_calloc((size_t)net.batch*net.inputs, sizeof(float));
 
     return net;
 }
@@ -0,0 +1,193 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "perf_counters.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+enum { PERF_CYCLES, PERF_INSTRUCTIONS, PERF_L1D_MISSES, PERF_LLC_MISSES, PERF_FP_OPS };
+
+static int open_event(uint32_t type, uint64_t config, int group_fd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.disabled = group_fd < 0;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+static int read_paranoid()
+{
+    int level = -100;
+    FILE *fp = fopen("/proc/sys/kernel/perf_event_paranoid", "r");
+    if (fp) {
+        if (fscanf(fp, "%d", &level) != 1) level = -100;
+        fclose(fp);
+    }
+    return level;
+}
+
+perf_counters *make_perf_counters(int n, uint64_t fp_raw_event)
+{
+    int leader = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (leader < 0) {
+        int err = errno;
+        fprintf(stderr, "Hardware performance counters are not available: %s", strerror(err));
+        if (err == EACCES || err == EPERM) {
+            fprintf(stderr, " (kernel.perf_event_paranoid = %d, needs <= 2 or CAP_PERFMON)", read_paranoid());
+        }
+        fprintf(stderr, ", continuing without them \n");
+        return 0;
+    }
+
+    perf_counters *p = (perf_counters*)xcalloc(1, sizeof(perf_counters));
+    p->n = n;
+    p->totals = (uint64_t*)xcalloc((size_t)n*PERF_MAX_EVENTS, sizeof(uint64_t));
+    p->enabled = (uint64_t*)xcalloc(n, sizeof(uint64_t));
+    p->running = (uint64_t*)xcalloc(n, sizeof(uint64_t));
+    p->calls = (uint64_t*)xcalloc(n, sizeof(uint64_t));
+    int i;
+    for (i = 0; i < PERF_MAX_EVENTS; ++i) p->fds[i] = -1;
+    p->fds[PERF_CYCLES] = leader;
+    p->names[PERF_CYCLES] = "cycles";
+
+    p->fds[PERF_INSTRUCTIONS] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, leader);
+    p->names[PERF_INSTRUCTIONS] = "instructions";
+    p->fds[PERF_L1D_MISSES] = open_event(PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), leader);
+    p->names[PERF_L1D_MISSES] = "L1D misses";
+    p->fds[PERF_LLC_MISSES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, leader);
+    p->names[PERF_LLC_MISSES] = "LLC misses";
+    if (fp_raw_event) p->fds[PERF_FP_OPS] = open_event(PERF_TYPE_RAW, fp_raw_event, leader);
+    p->names[PERF_FP_OPS] = "FP ops";
+
+    p->nevents = 0;
+    for (i = 0; i < PERF_MAX_EVENTS; ++i) {
+        if (p->fds[i] >= 0) p->nevents++;
+        else if (i != PERF_FP_OPS || fp_raw_event) fprintf(stderr, "perf counter '%s' is not supported here, skipping it \n", p->names[i]);
+    }
+
+    ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return p;
+}
+
+void free_perf_counters(perf_counters *p)
+{
+    int i;
+    for (i = PERF_MAX_EVENTS - 1; i >= 0; --i) {
+        if (p->fds[i] >= 0) close(p->fds[i]);
+    }
+    xfree(p->totals);
+    xfree(p->enabled);
+    xfree(p->running);
+    xfree(p->calls);
+    xfree(p);
+}
+
+// Reads the whole group with one syscall: { nr, time_enabled, time_running, { value, id } x nr },
+// values in the order the events were opened.
+static void read_group(perf_counters *p, uint64_t *values, uint64_t *enabled, uint64_t *running)
+{
+    uint64_t buf[3 + 2*PERF_MAX_EVENTS];
+    memset(values, 0, PERF_MAX_EVENTS*sizeof(uint64_t));
+    *enabled = *running = 0;
+    if (read(p->fds[PERF_CYCLES], buf, sizeof(buf)) <= 0) return;
+    *enabled = buf[1];
+    *running = buf[2];
+    int i, j = 0;
+    for (i = 0; i < PERF_MAX_EVENTS; ++i) {
+        if (p->fds[i] < 0) continue;
+        if (j >= (int)buf[0]) break;
+        values[i] = buf[3 + 2*j];
+        ++j;
+    }
+}
+
+void perf_counters_begin(perf_counters *p)
+{
+    read_group(p, p->start, &p->start_enabled, &p->start_running);
+}
+
+void perf_counters_end(perf_counters *p, int layer)
+{
+    uint64_t end[PERF_MAX_EVENTS], enabled, running;
+    read_group(p, end, &enabled, &running);
+    int i;
+    for (i = 0; i < PERF_MAX_EVENTS; ++i) p->totals[layer*PERF_MAX_EVENTS + i] += end[i] - p->start[i];
+    p->enabled[layer] += enabled - p->start_enabled;
+    p->running[layer] += running - p->start_running;
+    p->calls[layer]++;
+}
+
+void print_perf_counters(network net, perf_counters *p)
+{
+    int i;
+    // miss rates are normalized per thousand instructions
+    int has_instr = p->fds[PERF_INSTRUCTIONS] >= 0;
+    int has_l1 = has_instr && p->fds[PERF_L1D_MISSES] >= 0;
+    int has_llc = has_instr && p->fds[PERF_LLC_MISSES] >= 0;
+    int has_fp = p->fds[PERF_FP_OPS] >= 0;
+
+    int multiplexed = 0;
+
+    fprintf(stderr, "\n Hardware counters per layer call (user space, calling thread) \n");
+    fprintf(stderr, " layer  type            Mcycles   Minstr    IPC  L1D miss/Kinstr  LLC miss/Kinstr  FP ops/cycle\n");
+    for (i = 0; i < p->n; ++i) {
+        if (!p->calls[i]) continue;
+        uint64_t *t = p->totals + i*PERF_MAX_EVENTS;
+        // a group that shared the PMU only counted while running; extrapolate to the enabled time
+        double scale = 1;
+        int partial = p->running[i] < p->enabled[i];
+        if (partial) {
+            multiplexed = 1;
+            scale = p->running[i] ? (double)p->enabled[i] / p->running[i] : 0;
+        }
+        double per_call = scale / p->calls[i];
+        double cycles = t[PERF_CYCLES] * per_call;
+        double instr = t[PERF_INSTRUCTIONS] * per_call;
+        double kinstr = instr > 0 ? instr / 1000 : 1;
+
+        fprintf(stderr, " %5d  %-13s %9.3f", i, get_layer_string(net.layers[i].type), cycles / 1e6);
+        if (has_instr) fprintf(stderr, " %8.3f %6.2f", instr / 1e6, cycles > 0 ? instr / cycles : 0);
+        else fprintf(stderr, " %8s %6s", "n/a", "n/a");
+        if (has_l1) fprintf(stderr, " %16.2f", t[PERF_L1D_MISSES] * per_call / kinstr);
+        else fprintf(stderr, " %16s", "n/a");
+        if (has_llc) fprintf(stderr, " %16.2f", t[PERF_LLC_MISSES] * per_call / kinstr);
+        else fprintf(stderr, " %16s", "n/a");
+        if (has_fp) fprintf(stderr, " %13.2f", cycles > 0 ? t[PERF_FP_OPS] * per_call / cycles : 0);
+        else fprintf(stderr, " %13s", "n/a");
+        if (partial) fprintf(stderr, " * %.0f%%", 100.0 * p->running[i] / p->enabled[i]);
+        fprintf(stderr, "\n");
+    }
+    if (multiplexed) fprintf(stderr, " * the counter group was multiplexed, counts are scaled from the percentage of time it was counting \n");
+}
+
+#else // __linux__
+
+perf_counters *make_perf_counters(int n, uint64_t fp_raw_event)
+{
+    fprintf(stderr, "Hardware performance counters require perf_event_open and are only supported on Linux \n");
+    return 0;
+}
+
+void free_perf_counters(perf_counters *p) {}
+void perf_counters_begin(perf_counters *p) {}
+void perf_counters_end(perf_counters *p, int layer) {}
+void print_perf_counters(network net, perf_counters *p) {}
+
+#endif // __linux__
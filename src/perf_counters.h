@@ -0,0 +1,44 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+#include "darknet.h"
+#include "network.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PERF_MAX_EVENTS 5
+
+// Hardware counters read around every l.forward() call in forward_network(), attached with
+// net.counters. The events form one perf_event_open group so they are scheduled together.
+// They count the thread that runs forward_network(); OpenMP worker threads are not included,
+// so the perf mode of the classifier runs single threaded.
+// If the group does not fit on the PMU the kernel multiplexes it; the counts are then scaled
+// by time enabled / time running and the row is flagged.
+struct perf_counters {
+    int n;                                  // number of layers
+    int nevents;
+    int fds[PERF_MAX_EVENTS];               // fds[0] is the group leader (cycles)
+    const char *names[PERF_MAX_EVENTS];
+    uint64_t start[PERF_MAX_EVENTS];
+    uint64_t start_enabled, start_running;
+    uint64_t *totals;                       // [n * PERF_MAX_EVENTS]
+    uint64_t *enabled;                      // [n] ns the group was enabled
+    uint64_t *running;                      // [n] ns the group was on the PMU
+    uint64_t *calls;                        // [n]
+};
+
+// Returns NULL, after explaining why, if counters are not permitted or not supported.
+// fp_raw_event is an optional model-specific PERF_TYPE_RAW config counting FP operations, 0 to skip.
+perf_counters *make_perf_counters(int n, uint64_t fp_raw_event);
+void free_perf_counters(perf_counters *p);
+void perf_counters_begin(perf_counters *p);
+void perf_counters_end(perf_counters *p, int layer);
+void print_perf_counters(network net, perf_counters *p);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,184 @@
+#include "plan.h"
+#include "network.h"
+#include "convolutional_layer.h"
+#include "maxpool_layer.h"
+#include "softmax_layer.h"
+#include "cost_layer.h"
+#include "im2col.h"
+#include "gemm.h"
+#include "blas.h"
+#include "activations.h"
+#include "utils.h"
+#include "trace.h"
+
+#include <string.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+// Everything else: the layer's own forward
+static void run_layer(const plan_op *op, const float *input)
+{
+    network_state state = {0};
+    state.input = (float*)input;
+    state.workspace = op->workspace;
+    state.index = op->index;
+    op->l->forward(*op->l, state);
+}
+
+static void run_conv_im2col(const plan_op *op, const float *input)
+{
+    const layer *l = op->l;
+    int i, j;
+    fill_cpu(op->outputs*op->batch, 0, op->output, 1);
+    for (i = 0; i < op->batch; ++i) {
+        for (j = 0; j < op->groups; ++j) {
+            const float *im = input + (size_t)i*op->inputs + (size_t)j*op->inputs/op->groups;
+            trace_begin("im2col", i);
+            op->im2col((float*)im, l->c/op->groups, l->h, l->w, l->size, l->stride, l->pad, op->workspace);
+            trace_end("im2col", i);
+            trace_begin("gemm", i);
+            gemm(0, 0, op->m, op->n, op->k, 1, op->weights + (size_t)j*op->m*op->k, op->k, op->workspace, op->n,
+                1, op->output + (size_t)i*op->outputs + (size_t)j*op->m*op->n, op->n);
+            trace_end("gemm", i);
+        }
+    }
+    add_bias(op->output, op->biases, op->batch, op->m*op->groups, op->n);
+    activate_array(op->output, op->outputs*op->batch, op->activation);
+}
+
+static void run_conv_1x1(const plan_op *op, const float *input)
+{
+    int i;
+    fill_cpu(op->outputs*op->batch, 0, op->output, 1);
+    for (i = 0; i < op->batch; ++i) {
+        gemm(0, 0, op->m, op->n, op->k, 1, op->weights, op->k, (float*)input + (size_t)i*op->inputs, op->n,
+            1, op->output + (size_t)i*op->outputs, op->n);
+    }
+    add_bias(op->output, op->biases, op->batch, op->m, op->n);
+    activate_array(op->output, op->outputs*op->batch, op->activation);
+}
+
+static void run_maxpool_2x2_s2(const plan_op *op, const float *input)
+{
+    const layer *l = op->l;
+    forward_maxpool_2x2_s2(input, op->output, l->w, l->h, l->out_w, l->out_h, l->c, l->pad, op->batch);
+}
+
+static void run_maxpool(const plan_op *op, const float *input)
+{
+    const layer *l = op->l;
+    forward_maxpool_inference(input, op->output, l->size, l->w, l->h, l->out_w, l->out_h, l->c, l->pad, l->stride, op->batch);
+}
+
+static void run_softmax(const plan_op *op, const float *input)
+{
+    int n = op->inputs/op->groups;
+    softmax_cpu((float*)input, n, op->batch, op->inputs, op->groups, n, 1, op->output);
+}
+
+static void compile_op(plan_op *op, const network *net, int i)
+{
+    const layer *l = &net->layers[i];
+    memset(op, 0, sizeof(*op));
+    op->run = run_layer;
+    op->index = i;
+    op->name = get_layer_string(l->type);
+    op->l = l;
+    op->threads = l->threads;
+    op->output = l->output;
+    op->workspace = net->workspace;
+    op->weights = l->weights;
+    op->biases = l->biases;
+    op->activation = l->activation;
+    op->batch = l->batch;
+    op->inputs = l->inputs;
+    op->outputs = l->outputs;
+    op->groups = l->groups ? l->groups : 1;
+
+    if (l->type == CONVOLUTIONAL && l->forward == forward_convolutional_layer) {
+        op->run = run_conv_im2col;
+        op->m = l->n/op->groups;
+        op->n = l->out_h*l->out_w;
+        op->k = l->size*l->size*l->c/op->groups;
+        if (l->size == 3 && l->stride == 1) op->im2col = im2col_cpu_3x3_s1;
+        else if (l->size == 3 && l->stride == 2) op->im2col = im2col_cpu_3x3_s2;
+        else op->im2col = im2col_cpu_generic;
+    }
+    else if (l->type == CONVOLUTIONAL && l->forward == forward_convolutional_layer_1x1) {
+        op->run = run_conv_1x1;
+        op->m = l->n;
+        op->n = l->out_h*l->out_w;
+        op->k = l->c;
+    }
+    else if (l->type == MAXPOOL && l->forward == forward_maxpool_layer && !l->indexes) {
+        op->run = l->size == 2 && l->stride == 2 ? run_maxpool_2x2_s2 : run_maxpool;
+    }
+    else if (l->type == SOFTMAX && l->forward == forward_softmax_layer) {
+        op->run = run_softmax;
+    }
+}
+
+int compile_network(network *net)
+{
+    int i, n = 0;
+    network_plan *plan = net->plan;
+    if (!plan) plan = (network_plan*)xcalloc(1, sizeof(network_plan));
+    xfree(plan->ops);
+    plan->ops = (plan_op*)xcalloc(net->n, sizeof(plan_op));
+    plan->native = 0;
+    for (i = 0; i < net->n; ++i) {
+        if (net->layers[i].type == COST) continue;
+        plan_op *op = &plan->ops[n++];
+        compile_op(op, net, i);
+        if (op->run != run_layer) ++plan->native;
+    }
+    plan->n = n;
+    net->plan = plan;
+    return n;
+}
+
+void free_network_plan(network_plan *plan)
+{
+    if (!plan) return;
+    xfree(plan->ops);
+    xfree(plan);
+}
+
+void set_plan_batch(network_plan *plan, int batch)
+{
+    int i;
+    for (i = 0; i < plan->n; ++i) plan->ops[i].batch = batch;
+}
+
+void run_network_plan(const network_plan *plan, int from, int to, const float *input, float *output)
+{
+    int i;
+#if defined(_OPENMP)
+    int default_threads = omp_get_max_threads();
+#endif
+    for (i = 0; i < plan->n && plan->ops[i].index < to; ++i) {
+        const plan_op *op = &plan->ops[i];
+        if (op->index < from) continue;
+        int last = i + 1 == plan->n || plan->ops[i+1].index >= to;
+        plan_op redirected;
+        if (last && output && op->run != run_layer) {
+            redirected = *op;
+            redirected.output = output;
+            op = &redirected;
+        }
+        trace_begin(op->name, op->index);
+#if defined(_OPENMP)
+        if (op->threads) omp_set_num_threads(op->threads);
+        op->run(op, input);
+        if (op->threads) omp_set_num_threads(default_threads);
+#else
+        op->run(op, input);
+#endif
+        trace_end(op->name, op->index);
+        if (last && output && op->output != output) {
+            memcpy(output, op->output, (size_t)op->outputs*op->batch*sizeof(float));
+        }
+        input = op->output;
+    }
+}
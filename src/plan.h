@@ -0,0 +1,57 @@
+#ifndef PLAN_H
+#define PLAN_H
+#include "darknet.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct plan_op plan_op;
+typedef void (*plan_kernel)(const plan_op *op, const float *input);
+
+// One step of a compiled network. The kernel is picked once from the layer's algorithm and
+// shape, everything it reads per call is resolved into the op, so running it touches this and
+// the tensors rather than a layer and network_state copied by value.
+struct plan_op {
+    plan_kernel run;
+    int index;              // layer in net->layers
+    const char *name;       // trace span, the layer type
+    const layer *l;         // for the kernels that go through l->forward()
+    int threads;            // OpenMP threads for this op, 0 keeps the default
+    float *output;
+    float *workspace;
+    float *weights;
+    float *biases;
+    ACTIVATION activation;
+    int batch;
+    int inputs, outputs;    // per image
+    int groups;
+    int m, n, k;            // GEMM shape per group: filters, output pixels, filter size
+    // im2col picked for the kernel size and stride
+    void (*im2col)(float *data_im, int channels, int height, int width, int ksize, int stride, int pad, float *data_col);
+};
+
+struct network_plan {
+    int n;
+    plan_op *ops;
+    int native;             // ops with their own kernel rather than l->forward()
+};
+
+// Compiles the network into net->plan, which network_predict() and the other inference entry
+// points run from then on. Call after the last change to the network; set_batch_network(),
+// resize_network(), optimize_network() and the other calls that go through
+// recalculate_workspace_size() recompile it themselves. Cost layers are left out, they only
+// compute a loss against a truth. Returns the number of ops.
+int compile_network(network *net);
+void free_network_plan(network_plan *plan);
+// the batch of every op, see set_network_active_batch()
+void set_plan_batch(network_plan *plan, int batch);
+
+// Runs the ops of layers [from, to) on input. The result is in the last layer's output, or in
+// output when that is given; a last op with its own kernel then writes there directly.
+void run_network_plan(const network_plan *plan, int from, int to, const float *input, float *output);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,156 @@
+#include "profiler.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+layer_profiler *make_layer_profiler(int n, int iterations)
+{
+    layer_profiler *p = (layer_profiler*)xcalloc(1, sizeof(layer_profiler));
+    p->n = n;
+    p->iterations = iterations;
+    p->times = (double*)xcalloc((size_t)n*iterations, sizeof(double));
+    return p;
+}
+
+void free_layer_profiler(layer_profiler *p)
+{
+    xfree(p->times);
+    xfree(p);
+}
+
+void reset_layer_profiler(layer_profiler *p)
+{
+    p->count = 0;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// nearest-rank percentile of a sorted array
+static double percentile(double *sorted, int n, double p)
+{
+    int i = (int)(p/100. * n + 0.5) - 1;
+    return sorted[constrain_int(i, 0, n - 1)];
+}
+
+#define PEAK_LANES 64
+
+static double measure_peak_gflops()
+{
+    const int iterations = 1 << 20;
+    double best = 0;
+    int rep;
+    for (rep = 0; rep < 3; ++rep) {
+        double flops = 0;
+        double start = get_time_point();
+        #pragma omp parallel reduction(+:flops)
+        {
+            float acc[PEAK_LANES];
+            float a = 0.999999f, b = 1e-7f;
+            int i, j;
+            for (j = 0; j < PEAK_LANES; ++j) acc[j] = (float)j;
+            // PEAK_LANES independent multiply-add chains, vectorized by the compiler
+            for (i = 0; i < iterations; ++i) {
+                for (j = 0; j < PEAK_LANES; ++j) acc[j] = acc[j]*a + b;
+            }
+            float sink = 0;
+            for (j = 0; j < PEAK_LANES; ++j) sink += acc[j];
+            flops += 2.0*PEAK_LANES*iterations + (sink == 12345.f);
+        }
+        double gflops = flops / ((get_time_point() - start) * 1000);
+        if (gflops > best) best = gflops;
+    }
+    return best;
+}
+
+static double measure_bandwidth_gbps()
+{
+    const int n = 16*1024*1024;     // 3 x 64 MB, well beyond the LLC
+    float *a = (float*)xcalloc(n, sizeof(float));
+    float *b = (float*)xcalloc(n, sizeof(float));
+    float *c = (float*)xcalloc(n, sizeof(float));
+    int i, rep;
+    for (i = 0; i < n; ++i) b[i] = c[i] = 1;
+
+    double best = 0;
+    for (rep = 0; rep < 5; ++rep) {
+        double start = get_time_point();
+        // STREAM triad: two streams read, one written
+        #pragma omp parallel for
+        for (i = 0; i < n; ++i) a[i] = b[i] + 3.f*c[i];
+        double gbps = 3.0*n*sizeof(float) / ((get_time_point() - start) * 1000);
+        if (gbps > best) best = gbps;
+    }
+    xfree(a);
+    xfree(b);
+    xfree(c);
+    return best;
+}
+
+roofline measure_roofline()
+{
+    roofline r;
+    r.gflops = measure_peak_gflops();
+    r.gbps = measure_bandwidth_gbps();
+    return r;
+}
+
+// Compulsory traffic of one forward pass: input, output and parameters once,
+// plus the im2col buffer written and read back by the convolution (workspace_size is 0 for the
+// algorithms that never build one).
+size_t layer_bytes_moved(layer l)
+{
+    size_t floats = (size_t)l.batch*(l.inputs + l.outputs);
+    if (l.type == CONVOLUTIONAL) {
+        floats += l.nweights + l.n;
+        floats += 2*(size_t)l.batch*l.workspace_size/sizeof(float);
+    }
+    return floats*sizeof(float);
+}
+
+void print_layer_profile(network net, layer_profiler *p, roofline roof)
+{
+    int i, j;
+    if (!p->count) return;
+    double *sorted = (double*)xcalloc(p->count, sizeof(double));
+    double total_median = 0, total_bflops = 0;
+
+    fprintf(stderr, "\n Layer profile over %d iterations, roofline: peak %.1f GFLOPS, %.1f GB/s, ridge %.2f FLOP/B \n",
+        p->count, roof.gflops, roof.gbps, roof.gflops / roof.gbps);
+    fprintf(stderr, " layer  type            min ms  median ms   p99 ms    BFLOP  GFLOPS    MB moved  FLOP/B  attainable  %%roof bound\n");
+    for (i = 0; i < p->n; ++i) {
+        layer l = net.layers[i];
+        for (j = 0; j < p->count; ++j) sorted[j] = p->times[j*p->n + i];
+        qsort(sorted, p->count, sizeof(double), compare_double);
+        double min = sorted[0];
+        double median = percentile(sorted, p->count, 50);
+        double p99 = percentile(sorted, p->count, 99);
+        total_median += median;
+
+        double flops = (double)l.bflops * l.batch * 1e9;
+        total_bflops += l.bflops * l.batch;
+        double bytes = (double)layer_bytes_moved(l);
+        double gflops = median > 0 ? flops / (median * 1000) : 0;
+        double intensity = bytes > 0 ? flops / bytes : 0;
+        double attainable = intensity * roof.gbps;
+        if (attainable > roof.gflops) attainable = roof.gflops;
+        double efficiency = attainable > 0 ? 100 * gflops / attainable : 0;
+        const char *bound = intensity * roof.gbps < roof.gflops ? "memory" : "compute";
+
+        fprintf(stderr, " %5d  %-13s %8.3f %10.3f %8.3f %8.3f %7.2f %11.2f %7.2f %11.2f %6.1f %s\n",
+            i, get_layer_string(l.type), min / 1000, median / 1000, p99 / 1000, l.bflops * l.batch, gflops,
+            bytes / (1024 * 1024), intensity, attainable, efficiency, flops > 0 ? bound : "-");
+    }
+    fprintf(stderr, " total                %19.3f %17.3f %7.2f \n",
+        total_median / 1000, total_bflops, total_median > 0 ? total_bflops * 1e6 / total_median : 0);
+    xfree(sorted);
+}
@@ -0,0 +1,44 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+#include "darknet.h"
+#include "network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Per-layer wall time recorder, attached with net.profiler and filled by forward_network().
+struct layer_profiler {
+    int n;              // number of layers
+    int iterations;     // samples kept per layer
+    int count;          // forward passes recorded so far, <= iterations
+    double *times;      // [iterations * n] microseconds, one row per forward pass
+};
+
+typedef struct roofline {
+    double gflops;      // peak single precision GFLOPS reached by this build
+    double gbps;        // sustained memory bandwidth, GB/s
+} roofline;
+
+layer_profiler *make_layer_profiler(int n, int iterations);
+void free_layer_profiler(layer_profiler *p);
+void reset_layer_profiler(layer_profiler *p);
+
+static inline void profile_layer(layer_profiler *p, int i, double usec)
+{
+    if (p->count < p->iterations) p->times[p->count*p->n + i] = usec;
+}
+
+static inline void profile_forward_done(layer_profiler *p)
+{
+    if (p->count < p->iterations) p->count++;
+}
+
+roofline measure_roofline();
+size_t layer_bytes_moved(layer l);
+void print_layer_profile(network net, layer_profiler *p, roofline roof);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -1,6 +1,7 @@
 #include "softmax_layer.h"
 #include "blas.h"
 #include "utils.h"
+#include "tensor_alloc.h"
 #include "blas.h"
 
 #include <float.h>
@@ -21,7 +22,7 @@ softmax_layer make_softmax_layer(int batch, int inputs, int groups)
     l.groups = groups;
     l.inputs = inputs;
     l.outputs = inputs;
-    l.output = (float*)xcalloc(inputs * batch, sizeof(float));
+    l.output = (float*)tensor_calloc(inputs * batch, sizeof(float));
     l.cost = (float*)xcalloc(1, sizeof(float));
 
     l.forward = forward_softmax_layer;
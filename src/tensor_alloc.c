@@ -0,0 +1,145 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "tensor_alloc.h"
+#include "alloc_tracker.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+// Kept in the TENSOR_ALIGNMENT bytes in front of every tensor
+typedef struct tensor_header {
+    size_t size;            // bytes requested
+    void *base;             // start of the allocation or mapping
+    size_t map_size;        // length of the mapping, 0 for heap memory
+} tensor_header;
+
+static tensor_header *get_header(void *ptr)
+{
+    return (tensor_header*)((char*)ptr - TENSOR_ALIGNMENT);
+}
+
+static size_t round_up(size_t n, size_t to)
+{
+    return (n + to - 1) / to * to;
+}
+
+int tensor_hugetlb = 0;
+
+#ifndef _WIN32
+// Anonymous memory is zero filled. The mapping is trimmed to start on a huge page boundary,
+// the kernel only uses transparent huge pages for aligned 2 MB ranges.
+static void *map_huge(size_t map_size)
+{
+    void *base;
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    // the page size is explicit: map_size is only 2 MB rounded, a 1 GB default page would
+    // take a whole page and make the munmap() in tensor_free() fail
+    if (tensor_hugetlb) {
+        base = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (21 << MAP_HUGE_SHIFT), -1, 0);
+        if (base != MAP_FAILED) return base;
+    }
+#endif
+    size_t len = map_size + TENSOR_HUGE_PAGE;
+    char *p = (char*)mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) return 0;
+    char *start = (char*)round_up((uintptr_t)p, TENSOR_HUGE_PAGE);
+    if (start > p) munmap(p, start - p);
+    if (p + len > start + map_size) munmap(start + map_size, p + len - (start + map_size));
+#ifdef MADV_HUGEPAGE
+    madvise(start, map_size, MADV_HUGEPAGE);
+#endif
+    return start;
+}
+#endif
+
+void *tensor_calloc_location(const size_t nmemb, const size_t size, const char * const filename, const char * const funcname, const int line)
+{
+    size_t bytes = nmemb*size;
+    if (!bytes) return 0;
+    size_t total = bytes + TENSOR_ALIGNMENT;
+    void *base = 0;
+    size_t map_size = 0;
+
+#ifndef _WIN32
+    if (bytes >= TENSOR_HUGE_PAGE) {
+        map_size = round_up(total, TENSOR_HUGE_PAGE);
+        base = map_huge(map_size);
+        if (!base) map_size = 0;
+    }
+    if (!base) {
+        if (posix_memalign(&base, TENSOR_ALIGNMENT, total)) base = 0;
+        if (base) memset(base, 0, total);
+    }
+#else
+    base = _aligned_malloc(total, TENSOR_ALIGNMENT);
+    if (base) memset(base, 0, total);
+#endif
+    if (!base) error("Failed to allocate tensor memory", filename, funcname, line);
+
+    char *ptr = (char*)base + TENSOR_ALIGNMENT;
+    tensor_header *h = get_header(ptr);
+    h->size = bytes;
+    h->base = base;
+    h->map_size = map_size;
+    if (alloc_tracking) alloc_track(ptr, bytes, filename, funcname, line);
+    return ptr;
+}
+
+void *tensor_realloc_location(void *ptr, const size_t size, const char * const filename, const char * const funcname, const int line)
+{
+    size_t old = tensor_size(ptr);
+    if (ptr && size == old) return ptr;
+    void *p = tensor_calloc_location(1, size, filename, funcname, line);
+    if (p && ptr) memcpy(p, ptr, old < size ? old : size);
+    tensor_free(ptr);
+    return p;
+}
+
+void tensor_free(void *ptr)
+{
+    if (!ptr) return;
+    if (alloc_tracking) alloc_untrack(ptr);
+    tensor_header *h = get_header(ptr);
+#ifndef _WIN32
+    if (h->map_size) munmap(h->base, h->map_size);
+    else free(h->base);
+#else
+    _aligned_free(h->base);
+#endif
+}
+
+size_t tensor_size(void *ptr)
+{
+    return ptr ? get_header(ptr)->size : 0;
+}
+
+int tensor_prefault(void *ptr, int lock)
+{
+    if (!ptr) return 1;
+    tensor_header *h = get_header(ptr);
+    int locked = 1;
+#ifndef _WIN32
+    size_t page = sysconf(_SC_PAGESIZE);
+    if (lock) locked = mlock(ptr, h->size) == 0;
+#else
+    size_t page = 4096;
+    if (lock) locked = 0;
+#endif
+    // a write is what replaces the zero page; the value read back keeps the contents
+    volatile char *p = (volatile char*)ptr;
+    size_t i;
+    for (i = 0; i < h->size; i += page) p[i] = p[i];
+    if (h->size) p[h->size - 1] = p[h->size - 1];
+    return locked;
+}
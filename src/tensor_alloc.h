@@ -0,0 +1,47 @@
+#ifndef TENSOR_ALLOC_H
+#define TENSOR_ALLOC_H
+#include "darknet.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Allocator for weights, layer outputs and the workspace. Memory is zeroed like calloc() and
+// TENSOR_ALIGNMENT aligned, so a full cache line or AVX-512 vector never straddles two lines.
+// Tensors of at least TENSOR_HUGE_PAGE bytes are mmap()ed on their own huge page aligned
+// mapping with madvise(MADV_HUGEPAGE), so the kernel can back them with transparent huge pages,
+// one TLB entry per 2 MB instead of 512. With tensor_hugetlb set they are taken from the
+// reserved 2 MB hugetlbfs pool first (MAP_HUGETLB | MAP_HUGE_2MB, whatever the default huge
+// page size), falling back to transparent huge pages once the pool is empty.
+// Tensors must be released with tensor_free(), never xfree() or free().
+
+#define TENSOR_ALIGNMENT 64
+#define TENSOR_HUGE_PAGE (2 << 20)
+
+// opt-in, the reserved pool is shared with everything else on the host
+extern int tensor_hugetlb;
+
+void *tensor_calloc_location(const size_t nmemb, const size_t size, const char * const filename, const char * const funcname, const int line);
+void *tensor_realloc_location(void *ptr, const size_t size, const char * const filename, const char * const funcname, const int line);
+
+#define tensor_calloc(m, s)   tensor_calloc_location(m, s, DARKNET_LOC)
+// contents are kept up to the smaller size, the rest is zeroed
+#define tensor_realloc(p, s)  tensor_realloc_location(p, s, DARKNET_LOC)
+
+void tensor_free(void *ptr);
+
+// bytes requested for the tensor, 0 for a null pointer
+size_t tensor_size(void *ptr);
+
+// Faults in every page of the tensor now rather than on first use, writing to each so the
+// kernel maps private pages instead of the shared zero page. With lock the pages are also
+// mlock()ed so they can't be swapped out; returns 0 if that failed (the pages are still
+// touched), 1 otherwise.
+int tensor_prefault(void *ptr, int lock);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
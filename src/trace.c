@@ -0,0 +1,175 @@
+#include "trace.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#ifdef _MSC_VER
+#define TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define TRACE_THREAD_LOCAL __thread
+#endif
+
+#ifdef __GNUC__
+#define TRACE_LOAD(p)       __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define TRACE_STORE(p, v)   __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#define TRACE_ACQUIRE_FENCE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#else
+#include <intrin.h>
+#define TRACE_LOAD(p)       (*(volatile size_t*)(p))
+#define TRACE_STORE(p, v)   (*(volatile size_t*)(p) = (v))
+#define TRACE_ACQUIRE_FENCE() _ReadWriteBarrier()   // x86 doesn't reorder loads with loads
+#endif
+
+typedef struct trace_ring {
+    int tid;
+    char name[32];
+    size_t head;                // events written so far, the ring holds the last mask+1 of them
+    size_t mask;
+    trace_event *events;
+    struct trace_ring *next;
+} trace_ring;
+
+int trace_enabled = 0;
+static size_t trace_capacity = 1 << 16;
+static TRACE_THREAD_LOCAL trace_ring *thread_ring;
+static trace_ring *rings;
+static int nrings;
+static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static double slow_threshold;   // microseconds, 0 disables slow request dumps
+static char slow_prefix[256];
+static double last_slow_dump;
+
+void enable_trace(int events_per_thread)
+{
+    size_t capacity = 1024;
+    while (capacity < (size_t)events_per_thread) capacity *= 2;
+    pthread_mutex_lock(&trace_mutex);
+    if (!rings) trace_capacity = capacity;
+    trace_enabled = 1;
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+// Rings are registered once per thread and never freed, so events of finished threads stay
+// available to the dump.
+static trace_ring *get_thread_ring()
+{
+    if (thread_ring) return thread_ring;
+    trace_ring *r = (trace_ring*)xcalloc(1, sizeof(trace_ring));
+    pthread_mutex_lock(&trace_mutex);
+    r->mask = trace_capacity - 1;
+    r->events = (trace_event*)xcalloc(trace_capacity, sizeof(trace_event));
+    r->tid = nrings++;
+    sprintf(r->name, "thread %d", r->tid);
+    r->next = rings;
+    rings = r;
+    pthread_mutex_unlock(&trace_mutex);
+    thread_ring = r;
+    return r;
+}
+
+void trace_record(const char *name, int arg, char phase)
+{
+    trace_ring *r = get_thread_ring();
+    size_t h = r->head;
+    trace_event *e = &r->events[h & r->mask];
+    e->ts = get_time_point();
+    e->name = name;
+    e->arg = arg;
+    e->phase = phase;
+    TRACE_STORE(&r->head, h + 1);
+}
+
+void trace_set_thread_name(const char *name)
+{
+    trace_ring *r = get_thread_ring();
+    strncpy(r->name, name, sizeof(r->name) - 1);
+}
+
+// Copies the events of one ring that were not overwritten while copying. The writer may be
+// filling slot after & mask, unpublished, so event after - size counts as overwritten too.
+static size_t snapshot_ring(trace_ring *r, trace_event *out)
+{
+    size_t size = r->mask + 1;
+    size_t head = TRACE_LOAD(&r->head);
+    size_t first = head > size ? head - size : 0;
+    size_t i;
+    for (i = first; i < head; ++i) out[i - first] = r->events[i & r->mask];
+    // the copies above must not be reordered after the check
+    TRACE_ACQUIRE_FENCE();
+    size_t after = TRACE_LOAD(&r->head);
+    size_t valid = after + 1 > size ? after + 1 - size : 0;
+    if (valid <= first) return head - first;
+    if (valid >= head) return 0;
+    memmove(out, out + (valid - first), (head - valid)*sizeof(trace_event));
+    return head - valid;
+}
+
+int write_trace_json(FILE *fp, double from, double to)
+{
+    int count = 0;
+    pthread_mutex_lock(&trace_mutex);
+    trace_event *events = (trace_event*)xcalloc(trace_capacity, sizeof(trace_event));
+    trace_ring *r;
+
+    fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    for (r = rings; r; r = r->next) {
+        fprintf(fp, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"%s\"}}",
+            count ? ",\n" : "", r->tid, r->name);
+        ++count;
+
+        size_t i, n = snapshot_ring(r, events);
+        for (i = 0; i < n; ++i) {
+            trace_event e = events[i];
+            if (to && (e.ts < from || e.ts > to)) continue;
+            fprintf(fp, ",\n{\"name\": \"%s\", \"ph\": \"%c\", \"ts\": %.0f, \"pid\": 1, \"tid\": %d, \"args\": {\"arg\": %d}}",
+                e.name, e.phase, e.ts, r->tid, e.arg);
+            ++count;
+        }
+    }
+    fprintf(fp, "\n]}\n");
+    xfree(events);
+    pthread_mutex_unlock(&trace_mutex);
+    return count;
+}
+
+int dump_trace(const char *filename)
+{
+    FILE *fp = fopen(filename, "w");
+    if (!fp) {
+        fprintf(stderr, "Couldn't open trace file: %s\n", filename);
+        return 0;
+    }
+    int count = write_trace_json(fp, 0, 0);
+    fclose(fp);
+    fprintf(stderr, "Wrote %d trace events to %s\n", count, filename);
+    return count;
+}
+
+void trace_slow_requests(double threshold_ms, const char *prefix)
+{
+    slow_threshold = threshold_ms * 1000;
+    strncpy(slow_prefix, prefix, sizeof(slow_prefix) - 1);
+}
+
+void trace_request_done(double start, double end)
+{
+    if (!trace_enabled || !slow_threshold || end - start < slow_threshold) return;
+
+    pthread_mutex_lock(&trace_mutex);
+    int skip = end - last_slow_dump < 1000000;
+    if (!skip) last_slow_dump = end;
+    pthread_mutex_unlock(&trace_mutex);
+    if (skip) return;
+
+    char filename[300];
+    snprintf(filename, sizeof(filename), "%s_%.0f.json", slow_prefix, start);
+    FILE *fp = fopen(filename, "w");
+    if (!fp) return;
+    int count = write_trace_json(fp, start, end);
+    fclose(fp);
+    fprintf(stderr, "Slow request (%.1f ms): wrote %d trace events to %s\n", (end - start) / 1000, count, filename);
+}
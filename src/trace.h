@@ -0,0 +1,53 @@
+#ifndef TRACE_H
+#define TRACE_H
+#include "darknet.h"
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Flight recorder of begin/end events (layers, kernels, pipeline stages) in one ring buffer per
+// thread, stamped with get_time_point(). Only the owning thread writes its ring, so recording
+// takes no lock; old events are overwritten once a ring is full. The rings can be written out
+// as Chrome trace-event JSON, viewable in chrome://tracing or https://ui.perfetto.dev.
+// Event names must be string literals (or otherwise outlive the recorder).
+
+typedef struct trace_event {
+    double ts;              // microseconds, get_time_point()
+    const char *name;
+    int arg;                // layer index, rows of a GEMM tile, batch size...
+    char phase;             // 'B' or 'E'
+} trace_event;
+
+extern int trace_enabled;
+
+// events_per_thread is rounded up to a power of two
+void enable_trace(int events_per_thread);
+void trace_record(const char *name, int arg, char phase);
+void trace_set_thread_name(const char *name);
+
+static inline void trace_begin(const char *name, int arg)
+{
+    if (trace_enabled) trace_record(name, arg, 'B');
+}
+
+static inline void trace_end(const char *name, int arg)
+{
+    if (trace_enabled) trace_record(name, arg, 'E');
+}
+
+// Events with from <= ts <= to, or everything when to is 0. Returns the number of events written.
+int write_trace_json(FILE *fp, double from, double to);
+int dump_trace(const char *filename);
+
+// Requests slower than threshold_ms passed to trace_request_done() dump their time window to
+// <prefix>_<start>.json, at most once per second.
+void trace_slow_requests(double threshold_ms, const char *prefix);
+void trace_request_done(double start, double end);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
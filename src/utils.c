@@ -2,6 +2,7 @@
 #define _GNU_SOURCE
 #endif
 #include "utils.h"
+#include "alloc_tracker.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -12,6 +13,9 @@
 #include <assert.h>
 #include <float.h>
 #include <limits.h>
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
 
 #include <sys/time.h>
 #include <sys/stat.h>
@@ -23,33 +27,219 @@
 
 void *xmalloc_location(const size_t size, const char * const filename, const char * const funcname, const int line) {
     void *ptr=malloc(size);
+    if (alloc_tracking) alloc_track(ptr, size, filename, funcname, line);
     return ptr;
 }
 
 void *xcalloc_location(const size_t nmemb, const size_t size, const char * const filename, const char * const funcname, const int line) {
     void *ptr=calloc(nmemb, size);
+    if (alloc_tracking) alloc_track(ptr, nmemb*size, filename, funcname, line);
     return ptr;
 }
 
 void *xrealloc_location(void *ptr, const size_t size, const char * const filename, const char * const funcname, const int line) {
+    if (alloc_tracking) alloc_untrack(ptr);
     ptr=realloc(ptr,size);
+    if (alloc_tracking) alloc_track(ptr, size, filename, funcname, line);
     return ptr;
 }
 
+void xfree(void *ptr) {
+    if (alloc_tracking) alloc_untrack(ptr);
+    free(ptr);
+}
+
+// a[i] ranks above a[j]: larger, or equal at a lower index
+static inline int top_k_above(const float *a, int i, int j)
+{
+    return a[i] > a[j] || (a[i] == a[j] && i < j);
+}
+
+// heap[0] is the lowest ranked of the classes kept so far
+static void top_k_sift_down(const float *a, int *heap, int k, int root)
+{
+    for (;;) {
+        int low = root, left = 2*root + 1, right = left + 1;
+        if (left < k && top_k_above(a, heap[low], heap[left])) low = left;
+        if (right < k && top_k_above(a, heap[low], heap[right])) low = right;
+        if (low == root) return;
+        int swap = heap[root];
+        heap[root] = heap[low];
+        heap[low] = swap;
+        root = low;
+    }
+}
+
+#define TOP_K_BLOCK 8
+
+// any of x[0..TOP_K_BLOCK) > t
+static inline int top_k_block_above(const float *x, float t)
+{
+#if defined(__AVX__)
+    return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(x), _mm256_set1_ps(t), _CMP_GT_OQ));
+#else
+    int j, m = 0;
+    for (j = 0; j < TOP_K_BLOCK; ++j) m |= x[j] > t;
+    return m;
+#endif
+}
+
+// The k largest of a, largest first, -1 past n. The first k indexes seed a heap of the best so far
+// and the rest are compared against its lowest value a block at a time; a later index only enters
+// on a strictly larger value, so most blocks are dismissed by one compare and the heap work is
+// O(hits*log k) instead of the O(n*k) of an insertion sort.
 void top_k(float *a, int n, int k, int *index)
 {
-    int i,j;
-    for(j = 0; j < k; ++j) index[j] = -1;
-    for(i = 0; i < n; ++i){
-        int curr = i;
-        for(j = 0; j < k; ++j){
-            if((index[j] < 0) || a[curr] > a[index[j]]){
-                int swap = curr;
-                curr = index[j];
-                index[j] = swap;
+    int i, j;
+    for (j = n < 0 ? 0 : n; j < k; ++j) index[j] = -1;
+    if (k > n) k = n;
+    if (k <= 0) return;
+
+    for (j = 0; j < k; ++j) index[j] = j;
+    for (j = k/2 - 1; j >= 0; --j) top_k_sift_down(a, index, k, j);
+    float threshold = a[index[0]];
+
+    for (i = k; i < n; ) {
+        if (i + TOP_K_BLOCK <= n && !top_k_block_above(a + i, threshold)) {
+            i += TOP_K_BLOCK;
+            continue;
+        }
+        int end = i + TOP_K_BLOCK < n ? i + TOP_K_BLOCK : n;
+        for (; i < end; ++i) {
+            if (a[i] > threshold) {
+                index[0] = i;
+                top_k_sift_down(a, index, k, 0);
+                threshold = a[index[0]];
             }
         }
     }
+
+    // heap sort, moving the lowest ranked to the back
+    for (j = k - 1; j > 0; --j) {
+        int swap = index[0];
+        index[0] = index[j];
+        index[j] = swap;
+        top_k_sift_down(a, index, j, 0);
+    }
+}
+
+// top_k() of each of batch rows of n values, index holds batch*k entries
+void top_k_batch(float *a, int n, int batch, int k, int *index)
+{
+    int b;
+    #pragma omp parallel for if(batch > 1)
+    for (b = 0; b < batch; ++b) top_k(a + (size_t)b*n, n, k, index + (size_t)b*k);
+}
+
+void del_arg(int argc, char **argv, int index)
+{
+    int i;
+    for(i = index; i < argc-1; ++i) argv[i] = argv[i+1];
+    argv[i] = 0;
+}
+
+int find_arg(int argc, char* argv[], char *arg)
+{
+    int i;
+    for(i = 0; i < argc; ++i) {
+        if(!argv[i]) continue;
+        if(0==strcmp(argv[i], arg)) {
+            del_arg(argc, argv, i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int find_int_arg(int argc, char **argv, char *arg, int def)
+{
+    int i;
+    for(i = 0; i < argc-1; ++i){
+        if(!argv[i]) continue;
+        if(0==strcmp(argv[i], arg)){
+            def = atoi(argv[i+1]);
+            del_arg(argc, argv, i);
+            del_arg(argc, argv, i);
+            break;
+        }
+    }
+    return def;
+}
+
+float find_float_arg(int argc, char **argv, char *arg, float def)
+{
+    int i;
+    for(i = 0; i < argc-1; ++i){
+        if(!argv[i]) continue;
+        if(0==strcmp(argv[i], arg)){
+            def = atof(argv[i+1]);
+            del_arg(argc, argv, i);
+            del_arg(argc, argv, i);
+            break;
+        }
+    }
+    return def;
+}
+
+char *find_char_arg(int argc, char **argv, char *arg, char *def)
+{
+    int i;
+    for(i = 0; i < argc-1; ++i){
+        if(!argv[i]) continue;
+        if(0==strcmp(argv[i], arg)){
+            def = argv[i+1];
+            del_arg(argc, argv, i);
+            del_arg(argc, argv, i);
+            break;
+        }
+    }
+    return def;
+}
+
+int *read_intlist(char *gpu_list, int *ngpus, int d)
+{
+    int *gpus = 0;
+    if(gpu_list){
+        int len = (int)strlen(gpu_list);
+        *ngpus = 1;
+        int i;
+        for(i = 0; i < len; ++i){
+            if (gpu_list[i] == ',') ++*ngpus;
+        }
+        gpus = (int*)xcalloc(*ngpus, sizeof(int));
+        for(i = 0; i < *ngpus; ++i){
+            gpus[i] = atoi(gpu_list);
+            gpu_list = strchr(gpu_list, ',')+1;
+        }
+    } else {
+        gpus = (int*)xcalloc(1, sizeof(int));
+        *gpus = d;
+        *ngpus = 1;
+    }
+    return gpus;
+}
+
+// "model name" from /proc/cpuinfo, or "unknown" where that is not available
+void get_cpu_model(char *buf, size_t len)
+{
+    snprintf(buf, len, "unknown");
+    FILE *fp = fopen("/proc/cpuinfo", "r");
+    if (!fp) return;
+    char *line;
+    while ((line = fgetl(fp)) != 0) {
+        if (strncmp(line, "model name", 10) == 0) {
+            char *value = strchr(line, ':');
+            if (value) {
+                value++;
+                while (*value == ' ' || *value == '\t') value++;
+                snprintf(buf, len, "%s", value);
+            }
+            free(line);
+            break;
+        }
+        free(line);
+    }
+    fclose(fp);
 }
 
 void error(const char * const msg, const char * const filename, const char * const funcname, const int line)
@@ -94,6 +284,13 @@ void strip(char *s)
     s[len-offset] = '\0';
 }
 
+char *copy_string(char *s)
+{
+    char *copy = (char*)xmalloc(strlen(s) + 1);
+    strcpy(copy, s);
+    return copy;
+}
+
 char *fgetl(FILE *fp)
 {
     if(feof(fp)) return 0;
@@ -133,6 +330,16 @@ float sum_array(float *a, int n)
     return sum;
 }
 
+float rand_uniform(float min, float max)
+{
+    if(max < min){
+        float swap = min;
+        min = max;
+        max = swap;
+    }
+    return ((float)rand()/RAND_MAX * (max - min)) + min;
+}
+
 int constrain_int(int a, int min, int max)
 {
     if (a < min) return min;
@@ -17,6 +17,7 @@ extern "C" {
 #define DARKNET_LOC __FILE__, __func__, __LINE__
 
 LIB_API void top_k(float *a, int n, int k, int *index);
+LIB_API void top_k_batch(float *a, int n, int batch, int k, int *index);
 
 /* The "location" is the file, function, and line as defined by the DARKNET_LOC macro.
  * This is then printed when error() is called to terminate the instance of darknet.
@@ -29,12 +30,23 @@ void *xrealloc_location(void *ptr, const size_t size, const char * const filenam
 #define xmalloc(s)      xmalloc_location(s, DARKNET_LOC)
 #define xcalloc(m, s)   xcalloc_location(m, s, DARKNET_LOC)
 #define xrealloc(p, s)  xrealloc_location(p, s, DARKNET_LOC)
+// free() for memory from the functions above, keeps the allocation tracker (alloc_tracker.h) accurate
+void xfree(void *ptr);
 
 void error(const char * const msg, const char * const filename, const char * const funcname, const int line);
 
+void del_arg(int argc, char **argv, int index);
+int find_arg(int argc, char* argv[], char *arg);
+int find_int_arg(int argc, char **argv, char *arg, int def);
+float find_float_arg(int argc, char **argv, char *arg, float def);
+char *find_char_arg(int argc, char **argv, char *arg, char *def);
+int *read_intlist(char *s, int *n, int d);
+void get_cpu_model(char *buf, size_t len);
+
 void file_error(const char * const s);
 void strip(char *s);
 char *fgetl(FILE *fp);
+char *copy_string(char *s);
 int constrain_int(int a, int min, int max);
 float rand_uniform(float min, float max);
 float sum_array(float *a, int n);
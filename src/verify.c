@@ -0,0 +1,1242 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "network.h"
+#include "parser.h"
+#include "utils.h"
+#include "gemm.h"
+#include "im2col.h"
+#include "blas.h"
+#include "activations.h"
+#include "convolutional_layer.h"
+#include "maxpool_layer.h"
+#include "avgpool_layer.h"
+#include "optimize.h"
+#include "plan.h"
+#include "batcher.h"
+#include "ipc_ring.h"
+#include "image.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+// Conformance suite: every optimized kernel is checked against a naive reference on randomly
+// drawn shapes, then network_predict() is compared against a golden output file.
+// New kernel variants are added to the variant tables below.
+
+typedef void (*gemm_fn)(int TA, int TB, int M, int N, int K, float ALPHA, float *A, int lda,
+    float *B, int ldb, float BETA, float *C, int ldc);
+typedef void (*im2col_fn)(float *im, int channels, int height, int width, int ksize, int stride, int pad, float *col);
+typedef void (*maxpool_fn)(float *src, float *dst, int *indexes, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch);
+typedef void (*conv_fn)(layer l, network_state state);
+
+typedef struct gemm_variant { const char *name; gemm_fn fn; } gemm_variant;
+// ksize/stride of 0 accept any value, otherwise the variant only handles that one
+typedef struct im2col_variant { const char *name; im2col_fn fn; int ksize, stride; } im2col_variant;
+typedef struct maxpool_variant { const char *name; maxpool_fn fn; int writes_indexes, size, stride; } maxpool_variant;
+// prepare() sets up a layer from make_convolutional_layer() for the variant, 0 if the shape is not supported;
+// c and n are drawn as multiples of channel_multiple; grouped variants also get grouped and
+// depthwise shapes, depthwise ones only groups == c == n
+typedef struct conv_variant { const char *name; int (*prepare)(layer *l); int channel_multiple, grouped, depthwise; } conv_variant;
+
+static int prepare_conv_algorithm(layer *l, CONV_ALGORITHM a)
+{
+    if (!conv_algorithm_supported(*l, a)) return 0;
+    set_convolutional_algorithm(l, a);
+    return 1;
+}
+
+static int prepare_conv_im2col_gemm(layer *l) { return prepare_conv_algorithm(l, CONV_IM2COL_GEMM); }
+static int prepare_conv_gemm_1x1(layer *l) { return prepare_conv_algorithm(l, CONV_GEMM_1X1); }
+static int prepare_conv_direct(layer *l) { return prepare_conv_algorithm(l, CONV_DIRECT); }
+static int prepare_conv_implicit_gemm(layer *l) { return prepare_conv_algorithm(l, CONV_IMPLICIT_GEMM); }
+static int prepare_conv_depthwise(layer *l) { return prepare_conv_algorithm(l, CONV_DEPTHWISE); }
+static int prepare_conv_rgb(layer *l)
+{
+    if (!prepare_conv_algorithm(l, CONV_DIRECT_RGB)) return 0;
+    // NCHW or blocked output
+    if (rand() % 2 && l->n % 8 == 0) set_convolutional_channel_block(l, 0, 8);
+    return 1;
+}
+
+// blocked input, blocked output or both, block 8 or 16
+static int prepare_conv_nchwc(layer *l)
+{
+    int block = rand() % 2 ? 8 : 16;
+    int sides = 1 + rand() % 3;
+    set_convolutional_channel_block(l, sides & 1 ? block : 0, sides & 2 ? block : 0);
+    return 1;
+}
+
+static int prepare_conv_depthwise_nchwc(layer *l)
+{
+    return prepare_conv_depthwise(l) && prepare_conv_nchwc(l);
+}
+
+static void forward_maxpool_2x2_s2_variant(float *src, float *dst, int *indexes, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch)
+{
+    forward_maxpool_2x2_s2(src, dst, w, h, out_w, out_h, c, pad, batch);
+}
+
+static void forward_maxpool_inference_variant(float *src, float *dst, int *indexes, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch)
+{
+    forward_maxpool_inference(src, dst, size, w, h, out_w, out_h, c, pad, stride, batch);
+}
+
+// NCHW in and out around the blocked kernel; c is padded up to whole blocks
+static void forward_maxpool_nchwc_planar(float *src, float *dst, int *indexes, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch)
+{
+    int block = rand() % 2 ? 8 : 16;
+    int output_block = rand() % 2 ? block : 0;
+    int padded = channel_blocks(c, block)*block;
+    float *in = (float*)xcalloc((size_t)batch*padded*h*w, sizeof(float));
+    float *out = (float*)xcalloc((size_t)batch*padded*out_h*out_w, sizeof(float));
+    nchw_to_nchwc(src, in, batch, c, h, w, block);
+    forward_maxpool_nchwc(in, output_block ? out : dst, size, w, h, out_w, out_h, c, pad, stride, batch, block, output_block);
+    if (output_block) nchwc_to_nchw(out, dst, batch, c, out_h, out_w, block);
+    xfree(in);
+    xfree(out);
+}
+
+static const gemm_variant gemm_variants[] = {
+    {"gemm_cpu", gemm_cpu},
+};
+
+static const im2col_variant im2col_variants[] = {
+    {"im2col_cpu", im2col_cpu, 0, 0},
+    {"im2col_cpu_generic", im2col_cpu_generic, 0, 0},
+    {"im2col_cpu_3x3_s1", im2col_cpu_3x3_s1, 3, 1},
+    {"im2col_cpu_3x3_s2", im2col_cpu_3x3_s2, 3, 2},
+};
+
+static const maxpool_variant maxpool_variants[] = {
+    {"forward_maxpool_layer_avx", forward_maxpool_layer_avx, 1, 0, 0},
+    {"forward_maxpool_2x2_s2", forward_maxpool_2x2_s2_variant, 0, 2, 2},
+    {"forward_maxpool_inference", forward_maxpool_inference_variant, 0, 0, 0},
+    {"forward_maxpool_nchwc", forward_maxpool_nchwc_planar, 0, 0, 0},
+};
+
+static const conv_variant conv_variants[] = {
+    {"im2col_gemm", prepare_conv_im2col_gemm, 1, 1, 0},
+    {"gemm_1x1", prepare_conv_gemm_1x1, 1, 0, 0},
+    {"direct", prepare_conv_direct, 1, 1, 0},
+    {"implicit_gemm", prepare_conv_implicit_gemm, 1, 0, 0},
+    {"direct_nchwc", prepare_conv_nchwc, 16, 0, 0},
+    {"direct_rgb", prepare_conv_rgb, 1, 0, 0},
+    {"depthwise", prepare_conv_depthwise, 1, 0, 1},
+    {"depthwise_nchwc", prepare_conv_depthwise_nchwc, 16, 0, 1},
+};
+
+#define NUM_VARIANTS(a) ((int)(sizeof(a)/sizeof(a[0])))
+
+typedef struct verify_stats {
+    int cases;
+    int failures;
+    double max_error;       // worst error relative to the allowed tolerance, <= 1 passes
+    int64_t max_ulps;
+} verify_stats;
+
+// ---- reference kernels, kept naive on purpose ----
+
+// C = ALPHA*op(A)*op(B) + BETA*C accumulated in double; mag gets sum |ALPHA*a*b| + |BETA*c| for the error bound
+static void gemm_ref(int TA, int TB, int M, int N, int K, float ALPHA, float *A, int lda,
+    float *B, int ldb, float BETA, float *C, int ldc, double *out, double *mag)
+{
+    int i, j, k;
+    for (i = 0; i < M; ++i) {
+        for (j = 0; j < N; ++j) {
+            double sum = (double)BETA * C[i*ldc + j];
+            double m = fabs(sum);
+            for (k = 0; k < K; ++k) {
+                double a = TA ? A[k*lda + i] : A[i*lda + k];
+                double b = TB ? B[j*ldb + k] : B[k*ldb + j];
+                sum += ALPHA*a*b;
+                m += fabs(ALPHA*a*b);
+            }
+            out[i*N + j] = sum;
+            mag[i*N + j] = m;
+        }
+    }
+}
+
+static void im2col_ref(float *im, int channels, int height, int width, int ksize, int stride, int pad, float *col)
+{
+    int c, h, w;
+    int height_col = (height + 2*pad - ksize) / stride + 1;
+    int width_col = (width + 2*pad - ksize) / stride + 1;
+    for (c = 0; c < channels*ksize*ksize; ++c) {
+        int w_offset = c % ksize;
+        int h_offset = (c / ksize) % ksize;
+        int c_im = c / ksize / ksize;
+        for (h = 0; h < height_col; ++h) {
+            for (w = 0; w < width_col; ++w) {
+                int row = h_offset + h*stride - pad;
+                int column = w_offset + w*stride - pad;
+                float v = 0;
+                if (row >= 0 && column >= 0 && row < height && column < width) v = im[column + width*(row + height*c_im)];
+                col[(c*height_col + h)*width_col + w] = v;
+            }
+        }
+    }
+}
+
+static void maxpool_ref(float *src, float *dst, int *indexes, int size, int w, int h, int out_w, int out_h, int c,
+    int pad, int stride, int batch)
+{
+    int b, k, i, j, n, m;
+    for (b = 0; b < batch; ++b) {
+        for (k = 0; k < c; ++k) {
+            for (i = 0; i < out_h; ++i) {
+                for (j = 0; j < out_w; ++j) {
+                    float max = -FLT_MAX;
+                    int max_i = -1;
+                    for (n = 0; n < size; ++n) {
+                        for (m = 0; m < size; ++m) {
+                            int cur_h = -pad/2 + i*stride + n;
+                            int cur_w = -pad/2 + j*stride + m;
+                            if (cur_h < 0 || cur_h >= h || cur_w < 0 || cur_w >= w) continue;
+                            int index = cur_w + w*(cur_h + h*(k + b*c));
+                            if (src[index] > max) {
+                                max = src[index];
+                                max_i = index;
+                            }
+                        }
+                    }
+                    int out_index = j + out_w*(i + out_h*(k + c*b));
+                    dst[out_index] = max;
+                    indexes[out_index] = max_i;
+                }
+            }
+        }
+    }
+}
+
+// direct convolution in double, before the activation
+static void conv_ref(layer l, float *input, double *out, double *mag)
+{
+    int b, f, i, j, k, y, x;
+    int cg = l.c / l.groups;
+    int ng = l.n / l.groups;
+    for (b = 0; b < l.batch; ++b) {
+        for (f = 0; f < l.n; ++f) {
+            int g = f / ng;
+            for (i = 0; i < l.out_h; ++i) {
+                for (j = 0; j < l.out_w; ++j) {
+                    double sum = l.biases[f];
+                    double m = fabs(sum);
+                    for (k = 0; k < cg; ++k) {
+                        for (y = 0; y < l.size; ++y) {
+                            for (x = 0; x < l.size; ++x) {
+                                int row = i*l.stride + y - l.pad;
+                                int col = j*l.stride + x - l.pad;
+                                if (row < 0 || col < 0 || row >= l.h || col >= l.w) continue;
+                                double w = l.weights[((f*cg + k)*l.size + y)*l.size + x];
+                                double v = input[b*l.inputs + ((g*cg + k)*l.h + row)*l.w + col];
+                                sum += w*v;
+                                m += fabs(w*v);
+                            }
+                        }
+                    }
+                    int index = b*l.outputs + (f*l.out_h + i)*l.out_w + j;
+                    out[index] = sum;
+                    mag[index] = m;
+                }
+            }
+        }
+    }
+}
+
+// ---- comparison helpers ----
+
+static int64_t ulp_distance(float a, float b)
+{
+    int32_t ia, ib;
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    if (ia < 0) ia = INT32_MIN - ia;
+    if (ib < 0) ib = INT32_MIN - ib;
+    int64_t d = (int64_t)ia - ib;
+    return d < 0 ? -d : d;
+}
+
+// Error bound of a float dot product of length k: |computed - exact| <= k*eps*sum|a*b|,
+// doubled for blocked or reordered accumulation, plus an absolute floor for tiny magnitudes.
+static double dot_tolerance(int k, double mag)
+{
+    return 2.0*(k + 2)*FLT_EPSILON*mag + 1e-30;
+}
+
+// NaN is worse than any error and stays once seen
+static double worse_error(double max_error, double r)
+{
+    return isnan(r) || r > max_error ? r : max_error;
+}
+
+static void record(verify_stats *s, double error, double tolerance, int64_t ulps)
+{
+    s->max_error = worse_error(s->max_error, error / tolerance);
+    if (ulps > s->max_ulps) s->max_ulps = ulps;
+}
+
+static void fill_random(float *x, size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; ++i) x[i] = rand_uniform(-1, 1);
+}
+
+// sizes around SIMD widths and tile edges are drawn more often than pure random ones
+static int random_dim(int max)
+{
+    static const int edges[] = {1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65};
+    if (rand() % 2) {
+        int d = edges[rand() % (sizeof(edges)/sizeof(edges[0]))];
+        if (d <= max) return d;
+    }
+    return 1 + rand() % max;
+}
+
+static void print_stats(const char *kind, const char *name, verify_stats s)
+{
+    fprintf(stderr, " %-8s %-32s %5d cases  %s  worst error %.3f of tolerance, %lld ulps\n", kind, name, s.cases,
+        s.failures ? "FAILED" : "ok    ", s.max_error, (long long)s.max_ulps);
+}
+
+// ---- kernel checks ----
+
+static int verify_gemm(const gemm_variant *v, int cases)
+{
+    verify_stats s = {0};
+    int t;
+    for (t = 0; t < cases; ++t) {
+        static const float alphas[] = {1, -1, .5f, 2};
+        static const float betas[] = {1, 0, .5f, -1};
+        int TA = rand() % 2, TB = rand() % 2;
+        int M = random_dim(96), N = random_dim(200), K = random_dim(300);
+        int lda = (TA ? M : K) + rand() % 3;
+        int ldb = (TB ? K : N) + rand() % 3;
+        int ldc = N + rand() % 3;
+        float ALPHA = alphas[rand() % 4];
+        float BETA = betas[rand() % 4];
+
+        float *A = (float*)xcalloc((size_t)lda*(TA ? K : M), sizeof(float));
+        float *B = (float*)xcalloc((size_t)ldb*(TB ? N : K), sizeof(float));
+        float *C = (float*)xcalloc((size_t)ldc*M, sizeof(float));
+        double *ref = (double*)xcalloc((size_t)M*N, sizeof(double));
+        double *mag = (double*)xcalloc((size_t)M*N, sizeof(double));
+        fill_random(A, (size_t)lda*(TA ? K : M));
+        fill_random(B, (size_t)ldb*(TB ? N : K));
+        fill_random(C, (size_t)ldc*M);
+
+        gemm_ref(TA, TB, M, N, K, ALPHA, A, lda, B, ldb, BETA, C, ldc, ref, mag);
+        v->fn(TA, TB, M, N, K, ALPHA, A, lda, B, ldb, BETA, C, ldc);
+
+        int i, j, bad = 0;
+        for (i = 0; i < M && !bad; ++i) {
+            for (j = 0; j < N; ++j) {
+                float got = C[i*ldc + j];
+                double err = fabs(got - ref[i*N + j]);
+                double tol = dot_tolerance(K, mag[i*N + j]);
+                record(&s, err, tol, ulp_distance(got, (float)ref[i*N + j]));
+                if (!(err <= tol)) {
+                    fprintf(stderr, "%s: TA=%d TB=%d M=%d N=%d K=%d lda=%d ldb=%d ldc=%d alpha=%g beta=%g: C[%d,%d] = %g, expected %g\n",
+                        v->name, TA, TB, M, N, K, lda, ldb, ldc, ALPHA, BETA, i, j, got, ref[i*N + j]);
+                    bad = 1;
+                    break;
+                }
+            }
+        }
+        s.failures += bad;
+        s.cases++;
+        xfree(A); xfree(B); xfree(C); xfree(ref); xfree(mag);
+    }
+    print_stats("gemm", v->name, s);
+    return s.failures;
+}
+
+static int verify_im2col(const im2col_variant *v, int cases)
+{
+    verify_stats s = {0};
+    int t;
+    for (t = 0; t < cases; ++t) {
+        int ksize = v->ksize ? v->ksize : 1 + rand() % 5;
+        int stride = v->stride ? v->stride : 1 + rand() % 3;
+        int pad = rand() % (ksize/2 + 2);
+        int c = random_dim(17);
+        int h = random_dim(40), w = random_dim(40);
+        if (h + 2*pad < ksize) h = ksize;
+        if (w + 2*pad < ksize) w = ksize;
+        int out_h = (h + 2*pad - ksize) / stride + 1;
+        int out_w = (w + 2*pad - ksize) / stride + 1;
+        size_t ncol = (size_t)c*ksize*ksize*out_h*out_w;
+
+        float *im = (float*)xcalloc((size_t)c*h*w, sizeof(float));
+        float *ref = (float*)xcalloc(ncol, sizeof(float));
+        float *col = (float*)xcalloc(ncol + 1, sizeof(float));
+        fill_random(im, (size_t)c*h*w);
+        col[ncol] = 12345;      // guard against writes past the end
+
+        im2col_ref(im, c, h, w, ksize, stride, pad, ref);
+        v->fn(im, c, h, w, ksize, stride, pad, col);
+
+        size_t i;
+        int bad = col[ncol] != 12345;
+        for (i = 0; i < ncol && !bad; ++i) {
+            if (ref[i] != col[i]) {
+                fprintf(stderr, "%s: c=%d h=%d w=%d size=%d stride=%d pad=%d: col[%zu] = %g, expected %g\n",
+                    v->name, c, h, w, ksize, stride, pad, i, col[i], ref[i]);
+                bad = 1;
+            }
+        }
+        record(&s, bad, 1, 0);
+        s.failures += bad;
+        s.cases++;
+        xfree(im); xfree(ref); xfree(col);
+    }
+    print_stats("im2col", v->name, s);
+    return s.failures;
+}
+
+static int verify_maxpool(const maxpool_variant *v, int cases)
+{
+    verify_stats s = {0};
+    int t;
+    for (t = 0; t < cases; ++t) {
+        int size = v->size ? v->size : 1 + rand() % 3;
+        int stride = v->stride ? v->stride : 1 + rand() % 3;
+        int pad = rand() % 3;
+        int batch = 1 + rand() % 3;
+        int c = random_dim(33);
+        int h = size + rand() % 30, w = size + rand() % 30;
+        int out_h = (h + pad - size) / stride + 1;
+        int out_w = (w + pad - size) / stride + 1;
+        size_t nin = (size_t)batch*c*h*w;
+        size_t nout = (size_t)batch*c*out_h*out_w;
+
+        float *src = (float*)xcalloc(nin, sizeof(float));
+        float *ref = (float*)xcalloc(nout, sizeof(float));
+        float *dst = (float*)xcalloc(nout + 1, sizeof(float));
+        int *ref_indexes = (int*)xcalloc(nout, sizeof(int));
+        int *indexes = (int*)xcalloc(nout, sizeof(int));
+        fill_random(src, nin);
+        dst[nout] = 12345;
+
+        maxpool_ref(src, ref, ref_indexes, size, w, h, out_w, out_h, c, pad, stride, batch);
+        v->fn(src, dst, v->writes_indexes ? indexes : 0, size, w, h, out_w, out_h, c, pad, stride, batch);
+
+        size_t i;
+        int bad = dst[nout] != 12345;
+        for (i = 0; i < nout && !bad; ++i) {
+            if (ref[i] != dst[i] || (v->writes_indexes && ref_indexes[i] != indexes[i])) {
+                fprintf(stderr, "%s: batch=%d c=%d h=%d w=%d size=%d stride=%d pad=%d: dst[%zu] = %g, expected %g\n",
+                    v->name, batch, c, h, w, size, stride, pad, i, dst[i], ref[i]);
+                bad = 1;
+            }
+        }
+        record(&s, bad, 1, 0);
+        s.failures += bad;
+        s.cases++;
+        xfree(src); xfree(ref); xfree(dst); xfree(ref_indexes); xfree(indexes);
+    }
+    print_stats("maxpool", v->name, s);
+    return s.failures;
+}
+
+static int verify_avgpool(int cases)
+{
+    verify_stats s = {0};
+    int t;
+    for (t = 0; t < cases; ++t) {
+        layer l = {(LAYER_TYPE)0};
+        l.batch = 1 + rand() % 3;
+        l.c = random_dim(33);
+        l.h = random_dim(20);
+        l.w = random_dim(20);
+        int size = l.h*l.w;
+        float *input = (float*)xcalloc((size_t)l.batch*l.c*size, sizeof(float));
+        l.output = (float*)xcalloc((size_t)l.batch*l.c, sizeof(float));
+        fill_random(input, (size_t)l.batch*l.c*size);
+
+        network_state state = {0};
+        state.input = input;
+        forward_avgpool_layer(l, state);
+
+        int k, i, bad = 0;
+        for (k = 0; k < l.batch*l.c && !bad; ++k) {
+            double sum = 0, mag = 0;
+            for (i = 0; i < size; ++i) {
+                sum += input[k*size + i];
+                mag += fabs(input[k*size + i]);
+            }
+            float expected = sum / size;
+            double err = fabs(l.output[k] - expected);
+            double tol = dot_tolerance(size, mag) / size;
+            record(&s, err, tol, ulp_distance(l.output[k], expected));
+            if (!(err <= tol)) {
+                fprintf(stderr, "forward_avgpool_layer: batch=%d c=%d h=%d w=%d: output[%d] = %g, expected %g\n",
+                    l.batch, l.c, l.h, l.w, k, l.output[k], expected);
+                bad = 1;
+            }
+        }
+        s.failures += bad;
+        s.cases++;
+        xfree(input);
+        xfree(l.output);
+    }
+    print_stats("avgpool", "forward_avgpool_layer", s);
+    return s.failures;
+}
+
+static const float *top_k_values;
+
+// larger values first, ties by index
+static int top_k_compare(const void *a, const void *b)
+{
+    int i = *(const int*)a, j = *(const int*)b;
+    if (top_k_values[i] != top_k_values[j]) return top_k_values[i] > top_k_values[j] ? -1 : 1;
+    return i - j;
+}
+
+static void top_k_ref(float *a, int n, int k, int *index)
+{
+    int i;
+    int *order = (int*)xcalloc(n, sizeof(int));
+    for (i = 0; i < n; ++i) order[i] = i;
+    top_k_values = a;
+    qsort(order, n, sizeof(int), top_k_compare);
+    for (i = 0; i < k; ++i) index[i] = i < n ? order[i] : -1;
+    xfree(order);
+}
+
+// up to 22k classes and k=100 with many ties, a row of a batch at a time
+static int verify_top_k(int cases)
+{
+    verify_stats s = {0};
+    int t;
+    for (t = 0; t < cases; ++t) {
+        int batch = 1 + rand() % 3;
+        int n = rand() % 4 ? random_dim(65) : 1 + rand() % 22000;
+        int k = rand() % 2 ? random_dim(8) : 1 + rand() % 100;
+        int levels = rand() % 2 ? 16 : 0;
+        float *a = (float*)xcalloc((size_t)batch*n, sizeof(float));
+        int *index = (int*)xcalloc((size_t)batch*k, sizeof(int));
+        int *ref = (int*)xcalloc(k, sizeof(int));
+        fill_random(a, (size_t)batch*n);
+        size_t i;
+        if (levels) for (i = 0; i < (size_t)batch*n; ++i) a[i] = floorf(a[i]*levels);
+
+        top_k_batch(a, n, batch, k, index);
+        int b, j, bad = 0;
+        for (b = 0; b < batch && !bad; ++b) {
+            top_k_ref(a + b*n, n, k, ref);
+            for (j = 0; j < k && !bad; ++j) {
+                if (index[b*k + j] != ref[j]) {
+                    fprintf(stderr, "top_k_batch: batch=%d n=%d k=%d: row %d rank %d is %d, expected %d\n",
+                        batch, n, k, b, j, index[b*k + j], ref[j]);
+                    bad = 1;
+                }
+            }
+        }
+        record(&s, 0, 1, 0);
+        s.failures += bad;
+        s.cases++;
+        xfree(a); xfree(index); xfree(ref);
+    }
+    print_stats("top_k", "top_k_batch", s);
+    return s.failures;
+}
+
+static int verify_conv(const conv_variant *v, int cases)
+{
+    verify_stats s = {0};
+    int t;
+    convolutional_layer_banner = 0;
+    for (t = 0; t < cases; ++t) {
+        int size = rand() % 2 ? 1 + 2*(rand() % 3) : 1 + rand() % 4;
+        int stride = 1 + rand() % 2;
+        int pad = rand() % 2 ? size/2 : rand() % (size/2 + 1);
+        int batch = 1 + rand() % 2;
+        int cm = v->channel_multiple;
+        int c = (random_dim(33) + cm - 1)/cm*cm, n = (random_dim(33) + cm - 1)/cm*cm;
+        int groups = 1;
+        int h = size + rand() % 24, w = size + rand() % 24;
+        ACTIVATION a = rand() % 2 ? LEAKY : LINEAR;
+        int shape = v->depthwise ? 2 : v->grouped ? rand() % 3 : 0;
+        if (shape == 1) {
+            groups = 2 + rand() % 7;
+            c = groups*(1 + rand() % 6);
+            n = groups*(1 + rand() % 6);
+        }
+        else if (shape == 2) {
+            n = groups = c = (random_dim(64) + cm - 1)/cm*cm;
+        }
+        // first a fixed regression shape: 5x5 pad 2 with out_w 17, so a 256 pixel tile ends one
+        // column into an output row, before the columns a kx = 0 tap reaches start
+        if (t == 0) {
+            size = 5; stride = 1; pad = 2; batch = 1;
+            h = w = 17;
+            c = (11 + cm - 1)/cm*cm;
+            n = (4 + cm - 1)/cm*cm;
+            groups = 1;
+            if (shape == 2) n = groups = c;
+        }
+
+        layer l = make_convolutional_layer(batch, h, w, c, n, groups, size, stride, pad, a, 0);
+        float *input = (float*)xcalloc((size_t)batch*l.inputs, sizeof(float));
+        fill_random(input, (size_t)batch*l.inputs);
+        fill_random(l.weights, l.nweights);
+        fill_random(l.biases, l.n);
+        if (!v->prepare(&l)) {
+            xfree(input);
+            free_layer(l);
+            continue;
+        }
+        float *workspace = (float*)xcalloc(l.workspace_size/sizeof(float) + 1, sizeof(float));
+        float *blocked = (float*)xcalloc((size_t)batch*(l.inputs > l.outputs ? l.inputs : l.outputs), sizeof(float));
+        double *ref = (double*)xcalloc((size_t)batch*l.outputs, sizeof(double));
+        double *mag = (double*)xcalloc((size_t)batch*l.outputs, sizeof(double));
+
+        conv_ref(l, input, ref, mag);
+        network_state state = {0};
+        state.input = input;
+        state.workspace = workspace;
+        if (l.input_channel_block) {
+            nchw_to_nchwc(input, blocked, batch, c, h, w, l.input_channel_block);
+            state.input = blocked;
+        }
+        l.forward(l, state);
+        if (l.channel_block) {
+            memcpy(blocked, l.output, (size_t)batch*l.outputs*sizeof(float));
+            nchwc_to_nchw(blocked, l.output, batch, n, l.out_h, l.out_w, l.channel_block);
+        }
+
+        size_t i;
+        int bad = 0;
+        for (i = 0; i < (size_t)batch*l.outputs; ++i) {
+            float expected = activate((float)ref[i], a);
+            double err = fabs(l.output[i] - expected);
+            double tol = dot_tolerance(size*size*c/groups, mag[i]);
+            record(&s, err, tol, ulp_distance(l.output[i], expected));
+            if (!(err <= tol)) {
+                fprintf(stderr, "%s: batch=%d c=%d h=%d w=%d n=%d groups=%d size=%d stride=%d pad=%d: output[%zu] = %g, expected %g\n",
+                    v->name, batch, c, h, w, n, groups, size, stride, pad, i, l.output[i], expected);
+                bad = 1;
+                break;
+            }
+        }
+        s.failures += bad;
+        s.cases++;
+        xfree(input); xfree(workspace); xfree(blocked); xfree(ref); xfree(mag);
+        free_layer(l);
+    }
+    convolutional_layer_banner = 1;
+    print_stats("conv", v->name, s);
+    return s.failures;
+}
+
+// set_convolutional_xnor(): sign(input) with the padding at -1, sign(w)*mean|w| per filter;
+// the +-1 sums are exact, only the scaling by the mean rounds
+static int verify_xnor(int cases)
+{
+    verify_stats s = {0};
+    int t;
+    convolutional_layer_banner = 0;
+    for (t = 0; t < cases; ++t) {
+        int size = rand() % 2 ? 1 + 2*(rand() % 3) : 1 + rand() % 4;
+        int stride = 1 + rand() % 2;
+        int pad = rand() % 2 ? size/2 : rand() % (size/2 + 1);
+        int batch = 1 + rand() % 2;
+        int c = rand() % 4 ? random_dim(33) : 64 + rand() % 200, n = random_dim(33);
+        int h = size + rand() % 16, w = size + rand() % 16;
+        ACTIVATION a = rand() % 2 ? LEAKY : LINEAR;
+
+        layer l = make_convolutional_layer(batch, h, w, c, n, 1, size, stride, pad, a, 0);
+        float *input = (float*)xcalloc((size_t)batch*l.inputs, sizeof(float));
+        fill_random(input, (size_t)batch*l.inputs);
+        fill_random(l.weights, l.nweights);
+        fill_random(l.biases, l.n);
+        // set_convolutional_xnor() frees the float weights
+        float *weights = (float*)xcalloc(l.nweights, sizeof(float));
+        memcpy(weights, l.weights, l.nweights*sizeof(float));
+        set_convolutional_xnor(&l);
+        float *workspace = (float*)xcalloc(l.workspace_size/sizeof(float) + 1, sizeof(float));
+        network_state state = {0};
+        state.input = input;
+        state.workspace = workspace;
+        l.forward(l, state);
+
+        int k = size*size*c;
+        int b, f, i, j, ch, y, x, bad = 0;
+        for (b = 0; b < batch && !bad; ++b) {
+            for (f = 0; f < n && !bad; ++f) {
+                double mean = 0;
+                for (i = 0; i < k; ++i) mean += fabs(weights[f*k + i]);
+                mean /= k;
+                for (i = 0; i < l.out_h && !bad; ++i) {
+                    for (j = 0; j < l.out_w && !bad; ++j) {
+                        int dot = 0;
+                        for (ch = 0; ch < c; ++ch) {
+                            for (y = 0; y < size; ++y) {
+                                for (x = 0; x < size; ++x) {
+                                    int row = i*stride + y - pad, col = j*stride + x - pad;
+                                    float v = row < 0 || col < 0 || row >= h || col >= w ? 0 : input[b*l.inputs + (ch*h + row)*w + col];
+                                    int sw = weights[((f*c + ch)*size + y)*size + x] > 0 ? 1 : -1;
+                                    dot += sw*(v > 0 ? 1 : -1);
+                                }
+                            }
+                        }
+                        double sum = mean*dot + l.biases[f];
+                        float expected = activate((float)sum, a);
+                        float out = l.output[b*l.outputs + (f*l.out_h + i)*l.out_w + j];
+                        double err = fabs(out - expected);
+                        double tol = dot_tolerance(2, fabs(mean*dot) + fabs(l.biases[f]));
+                        record(&s, err, tol, ulp_distance(out, expected));
+                        if (!(err <= tol)) {
+                            fprintf(stderr, "forward_convolutional_layer_xnor: batch=%d c=%d h=%d w=%d n=%d size=%d stride=%d pad=%d: "
+                                "output %d,%d,%d,%d = %g, expected %g\n", batch, c, h, w, n, size, stride, pad, b, f, i, j, out, expected);
+                            bad = 1;
+                        }
+                    }
+                }
+            }
+        }
+        s.failures += bad;
+        s.cases++;
+        xfree(input); xfree(workspace); xfree(weights);
+        free_layer(l);
+    }
+    convolutional_layer_banner = 1;
+    print_stats("conv", "xnor", s);
+    return s.failures;
+}
+
+// ---- end-to-end golden output ----
+
+static image golden_input(network net)
+{
+    image im = load_image_color(0, 0);
+    image resized = resize_min(im, net.w);
+    image cropped = crop_image(resized, (resized.w - net.w)/2, (resized.h - net.h)/2, net.w, net.h);
+    if (resized.data != im.data) free_image(resized);
+    free_image(im);
+    return cropped;
+}
+
+// The built-in reference network with its weights and batch norm folded in, as the checks below start from
+static network load_reference_network(int batch)
+{
+    network net = parse_network_cfg_custom(batch, 0);
+    load_weights(&net);
+    set_batch_network(&net, batch);
+    fuse_conv_batchnorm(net);
+    return net;
+}
+
+static float *predict_golden_input(network net)
+{
+    image cropped = golden_input(net);
+    float *out = (float*)xcalloc(net.outputs, sizeof(float));
+    memcpy(out, network_predict(net, cropped.data), net.outputs*sizeof(float));
+    free_image(cropped);
+    return out;
+}
+
+static int verify_golden(const char *filename, int write)
+{
+    network net = load_reference_network(1);
+    float *out = predict_golden_input(net);
+    int i, failures = 0;
+
+    if (write) {
+        FILE *fp = fopen(filename, "w");
+        if (!fp) file_error(filename);
+        fprintf(fp, "%d\n", net.outputs);
+        for (i = 0; i < net.outputs; ++i) fprintf(fp, "%.9g\n", out[i]);
+        fclose(fp);
+        fprintf(stderr, " golden   wrote %d outputs of network_predict to %s\n", net.outputs, filename);
+    }
+    else {
+        FILE *fp = fopen(filename, "r");
+        if (!fp) file_error(filename);
+        int n = 0;
+        if (fscanf(fp, "%d", &n) != 1 || n != net.outputs) {
+            fprintf(stderr, "%s: expected %d outputs, file has %d\n", filename, net.outputs, n);
+            failures = 1;
+        }
+        double max_error = 0;
+        for (i = 0; i < n && !failures; ++i) {
+            float expected;
+            if (fscanf(fp, "%f", &expected) != 1) {
+                fprintf(stderr, "%s: truncated at output %d\n", filename, i);
+                failures = 1;
+                break;
+            }
+            double err = fabs(out[i] - expected);
+            double tol = 1e-4*fabs(expected) + 1e-6;
+            max_error = worse_error(max_error, err / tol);
+            if (!(err <= tol)) {
+                fprintf(stderr, "network_predict output[%d] = %g, golden %g\n", i, out[i], expected);
+                failures++;
+            }
+        }
+        fclose(fp);
+        fprintf(stderr, " golden   %-32s %5d outputs %s  worst error %.3f of tolerance\n", "network_predict", net.outputs,
+            failures ? "FAILED" : "ok    ", max_error);
+    }
+    xfree(out);
+    free_network(net);
+    return failures;
+}
+
+static int compare_outputs(const char *kind, const char *name, float *out, float *expected, int n)
+{
+    int i, bad = 0;
+    double max_error = 0;
+    for (i = 0; i < n; ++i) {
+        double err = fabs(out[i] - expected[i]);
+        double tol = 1e-4*fabs(expected[i]) + 1e-6;
+        max_error = worse_error(max_error, err / tol);
+        if (!(err <= tol) && !bad) {
+            fprintf(stderr, "%s output[%d] = %g, expected %g\n", name, i, out[i], expected[i]);
+            bad = 1;
+        }
+    }
+    fprintf(stderr, " %-8s %-32s %5d outputs %s  worst error %.3f of tolerance\n", kind, name, n,
+        bad ? "FAILED" : "ok    ", max_error);
+    return bad;
+}
+
+// network_predict_top_k() has to pick the classes of top_k() on the full output, with the same probabilities
+static int verify_predict_top_k(network net, float *expected)
+{
+    int j, k = 100 < net.outputs ? 100 : net.outputs;
+    int *indexes = (int*)xcalloc(k, sizeof(int));
+    int *expected_indexes = (int*)xcalloc(k, sizeof(int));
+    float *probs = (float*)xcalloc(k, sizeof(float));
+    float *expected_probs = (float*)xcalloc(k, sizeof(float));
+    image cropped = golden_input(net);
+
+    network_predict_top_k(net, cropped.data, k, indexes, probs);
+    top_k(expected, net.outputs, k, expected_indexes);
+    int bad = 0;
+    for (j = 0; j < k; ++j) {
+        expected_probs[j] = expected[expected_indexes[j]];
+        if (indexes[j] != expected_indexes[j] && expected[indexes[j]] != expected[expected_indexes[j]]) {
+            fprintf(stderr, "network_predict_top_k: class %d is %d, expected %d\n", j, indexes[j], expected_indexes[j]);
+            bad = 1;
+            break;
+        }
+    }
+    if (!bad) bad = compare_outputs("top_k", "network_predict_top_k, k=100", probs, expected_probs, k);
+    xfree(indexes); xfree(expected_indexes); xfree(probs); xfree(expected_probs);
+    free_image(cropped);
+    return bad;
+}
+
+// network_predict_hwc_u8() has to match network_predict() on the same frame converted to floats
+static int verify_input_u8(network net)
+{
+    int i, j, k;
+    int size = net.w*net.h*net.c;
+    unsigned char *frame = (unsigned char*)xcalloc(size, 1);
+    float *chw = (float*)xcalloc(size, sizeof(float));
+    float *expected = (float*)xcalloc(net.outputs, sizeof(float));
+    for (i = 0; i < size; ++i) frame[i] = rand() % 256;
+    for (k = 0; k < net.c; ++k) {
+        for (j = 0; j < net.w*net.h; ++j) chw[k*net.w*net.h + j] = frame[j*net.c + k] / 255.f;
+    }
+    memcpy(expected, network_predict(net, chw), net.outputs*sizeof(float));
+    // the reference network starts with a 3 channel convolution, which the RGB kernel always reads
+    float *out = network_predict_hwc_u8(net, frame);
+    int bad = 1;
+    if (out) bad = compare_outputs("input", "network_predict_hwc_u8", out, expected, net.outputs);
+    else fprintf(stderr, " %-8s %-32s refused the frame, FAILED\n", "input", "network_predict_hwc_u8");
+    xfree(frame); xfree(chw); xfree(expected);
+    return bad;
+}
+
+// network_predict_into() on a crop of a larger uint8 HWC frame and on a CHW float buffer has to
+// match network_predict() on the same pixels
+static int verify_predict_into(network net, const char *path)
+{
+    int i, k, x, y;
+    int dx = 3, dy = 2;
+    int fw = net.w + 8, fh = net.h + 6;
+    size_t size = (size_t)fw*fh*net.c;
+    unsigned char *frame = (unsigned char*)xcalloc(size, 1);
+    float *chw = (float*)xcalloc(net.inputs, sizeof(float));
+    float *expected = (float*)xcalloc(net.outputs, sizeof(float));
+    float *out = (float*)xcalloc(net.outputs, sizeof(float));
+    for (i = 0; i < size; ++i) frame[i] = rand() % 256;
+    for (k = 0; k < net.c; ++k) {
+        for (y = 0; y < net.h; ++y) {
+            for (x = 0; x < net.w; ++x) chw[(k*net.h + y)*net.w + x] = frame[((size_t)(y + dy)*fw + x + dx)*net.c + k] / 255.f;
+        }
+    }
+    memcpy(expected, network_predict(net, chw), net.outputs*sizeof(float));
+
+    char name[64];
+    tensor_view view = crop_tensor_view(make_tensor_view_hwc(frame, TENSOR_UINT8, fw, fh, net.c), dx, dy, net.w, net.h);
+    sprintf(name, "uint8 HWC crop, %s", path);
+    int bad = network_predict_into(net, view, out) ? compare_outputs("into", name, out, expected, net.outputs) : 1;
+    memset(out, 0, net.outputs*sizeof(float));
+    sprintf(name, "float CHW, %s", path);
+    bad += network_predict_into(net, make_tensor_view_chw(chw, net.w, net.h, net.c), out) ? compare_outputs("into", name, out, expected, net.outputs) : 1;
+    xfree(frame); xfree(chw); xfree(expected); xfree(out);
+    return bad;
+}
+
+// gather_tensor_view() of cropped HWC frames, as network_predict_into() does for a first layer
+// with more channels than the RGB kernel reads, has to match a planar copy of the same pixels
+static int verify_gather()
+{
+    int b, i, k, x, y;
+    int batch = 2, c = RGB_MAX_C + 2, w = 13, h = 7;
+    int dx = 3, dy = 2, fw = w + 5, fh = h + 4;
+    size_t frame = (size_t)fw*fh*c, size = (size_t)batch*w*h*c;
+    unsigned char *bytes = (unsigned char*)xcalloc(batch*frame, 1);
+    float *floats = (float*)xcalloc(batch*frame, sizeof(float));
+    float *expected_u8 = (float*)xcalloc(size, sizeof(float));
+    float *expected_f32 = (float*)xcalloc(size, sizeof(float));
+    float *out = (float*)xcalloc(size, sizeof(float));
+    for (i = 0; i < (int)(batch*frame); ++i) {
+        bytes[i] = rand() % 256;
+        floats[i] = rand_uniform(-1, 1);
+    }
+    for (b = 0; b < batch; ++b) {
+        for (k = 0; k < c; ++k) {
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    size_t src = b*frame + ((size_t)(y + dy)*fw + x + dx)*c + k;
+                    size_t dst = (((size_t)b*c + k)*h + y)*w + x;
+                    expected_u8[dst] = bytes[src] / 255.f;
+                    expected_f32[dst] = floats[src];
+                }
+            }
+        }
+    }
+
+    int bad = 0;
+    gather_tensor_view(crop_tensor_view(make_tensor_view_hwc(bytes, TENSOR_UINT8, fw, fh, c), dx, dy, w, h), batch, out);
+    bad += compare_outputs("gather", "uint8 HWC crop, 2 images", out, expected_u8, size);
+    memset(out, 0, size*sizeof(float));
+    gather_tensor_view(crop_tensor_view(make_tensor_view_hwc(floats, TENSOR_FLOAT32, fw, fh, c), dx, dy, w, h), batch, out);
+    bad += compare_outputs("gather", "float HWC crop, 2 images", out, expected_f32, size);
+    xfree(bytes); xfree(floats); xfree(expected_u8); xfree(expected_f32); xfree(out);
+    return bad;
+}
+
+// network_predict() from uint8 frames, after optimize_network(), from a compiled plan and with
+// blocked activations has to match the NCHW network as parsed
+static int verify_network_paths()
+{
+    static const int blocks[] = {8, 16};
+    network net = load_reference_network(1);
+    float *planar = predict_golden_input(net);
+    int b, failures = verify_input_u8(net);
+    failures += verify_predict_into(net, "layer by layer");
+
+    char name[64];
+    int rewrites = optimize_network(&net);
+    float *optimized = predict_golden_input(net);
+    sprintf(name, "optimize_network, %d rewrites", rewrites);
+    failures += compare_outputs("graph", name, optimized, planar, net.outputs);
+    xfree(optimized);
+
+    // from here on the network runs from its plan, recompiled by each of the changes below
+    int ops = compile_network(&net);
+    float *planned = predict_golden_input(net);
+    sprintf(name, "compile_network, %d/%d native ops", net.plan->native, ops);
+    failures += compare_outputs("plan", name, planned, planar, net.outputs);
+    failures += verify_predict_top_k(net, planned);
+    failures += verify_predict_into(net, "plan");
+    xfree(planned);
+
+    for (b = 0; b < NUM_VARIANTS(blocks); ++b) {
+        int layers = set_network_channel_block(&net, blocks[b]);
+        float *out = predict_golden_input(net);
+        sprintf(name, "NCHW%dc, %d layers", blocks[b], layers);
+        failures += compare_outputs("layout", name, out, planar, net.outputs);
+        xfree(out);
+    }
+
+    // resized in place, the rewritten and blocked network has to match one parsed and resized as
+    // NCHW, and give the original outputs again once it is back at its own resolution
+    int w = net.w, h = net.h;
+    network resized = load_reference_network(1);
+    resize_network(&resized, 160, 160);
+    float *expected = predict_golden_input(resized);
+    resize_network(&net, 160, 160);
+    float *out = predict_golden_input(net);
+    failures += compare_outputs("resize", "160x160", out, expected, net.outputs);
+    xfree(out);
+    resize_network(&net, w, h);
+    out = predict_golden_input(net);
+    failures += compare_outputs("resize", "back to network size", out, planar, net.outputs);
+    xfree(out);
+    xfree(expected);
+    free_network(resized);
+
+    xfree(planar);
+    free_network(net);
+    return failures;
+}
+
+typedef struct verify_client {
+    batcher *b;
+    float *input;
+    float *output;
+} verify_client;
+
+static void *verify_client_thread(void *ptr)
+{
+    verify_client *c = (verify_client*)ptr;
+    batcher_predict(c->b, c->input, c->output);
+    return 0;
+}
+
+// Concurrent requests through a batcher, served in full and partial batches, have to get the
+// outputs network_predict() gives each image on its own
+static int verify_batcher()
+{
+    const int max_batch = 4, clients = 6;
+    network single = load_reference_network(1);
+    network batched = load_reference_network(max_batch);
+    compile_network(&batched);
+
+    int i, n = single.outputs;
+    float *inputs = (float*)xcalloc((size_t)clients*single.inputs, sizeof(float));
+    float *expected = (float*)xcalloc((size_t)clients*n, sizeof(float));
+    float *out = (float*)xcalloc((size_t)clients*n, sizeof(float));
+    fill_random(inputs, (size_t)clients*single.inputs);
+    for (i = 0; i < clients; ++i) {
+        memcpy(expected + (size_t)i*n, network_predict(single, inputs + (size_t)i*single.inputs), n*sizeof(float));
+    }
+
+    batcher *b = make_batcher(&batched, max_batch, 1000);
+    verify_client c[6];
+    pthread_t threads[6];
+    for (i = 0; i < clients; ++i) {
+        c[i].b = b;
+        c[i].input = inputs + (size_t)i*single.inputs;
+        c[i].output = out + (size_t)i*n;
+        if (pthread_create(&threads[i], 0, verify_client_thread, &c[i])) error("Thread creation failed", DARKNET_LOC);
+    }
+    for (i = 0; i < clients; ++i) pthread_join(threads[i], 0);
+    batcher_stats s = get_batcher_stats(b);
+    free_batcher(b);
+
+    char name[64];
+    sprintf(name, "%d requests in %d batches", clients, (int)s.batches);
+    int bad = compare_outputs("batcher", name, out, expected, clients*n);
+
+    // partial batches must leave the network batch as it was, so it can take another batcher;
+    // freeing that one while requests wait on a 10 s deadline has to serve them
+    if (batched.batch != max_batch) {
+        fprintf(stderr, " batcher  network batch left at %d instead of %d  FAILED\n", batched.batch, max_batch);
+        bad = 1;
+    }
+    else {
+        const int pending = 2;
+        memset(out, 0, (size_t)clients*n*sizeof(float));
+        b = make_batcher(&batched, max_batch, 10000000);
+        for (i = 0; i < pending; ++i) {
+            c[i].b = b;
+            if (pthread_create(&threads[i], 0, verify_client_thread, &c[i])) error("Thread creation failed", DARKNET_LOC);
+        }
+        int queued = 0;
+        while (queued < pending) {
+            usleep(1000);
+            pthread_mutex_lock(&b->mutex);
+            queued = b->queued;
+            pthread_mutex_unlock(&b->mutex);
+        }
+        free_batcher(b);
+        for (i = 0; i < pending; ++i) pthread_join(threads[i], 0);
+        sprintf(name, "%d requests drained on free", pending);
+        bad += compare_outputs("batcher", name, out, expected, pending*n);
+    }
+    xfree(inputs); xfree(expected); xfree(out);
+    free_network(single);
+    free_network(batched);
+    return bad;
+}
+
+typedef struct verify_ipc_server {
+    network net;
+    const char *socket_path;
+    int stop;
+} verify_ipc_server;
+
+static void *verify_ipc_server_thread(void *ptr)
+{
+    verify_ipc_server *s = (verify_ipc_server*)ptr;
+    run_classifier_ipc_until(s->net, s->socket_path, 2, 5, &s->stop);
+    return 0;
+}
+
+typedef struct verify_ipc_acquire {
+    ipc_ring *r;
+    int slot;
+} verify_ipc_acquire;
+
+static void *verify_ipc_acquire_thread(void *ptr)
+{
+    verify_ipc_acquire *a = (verify_ipc_acquire*)ptr;
+    __atomic_store_n(&a->slot, ipc_acquire_slot(a->r), __ATOMIC_RELEASE);
+    return 0;
+}
+
+// Frames sent through the shared-memory ring by a client of the socket, uint8 HWC and float CHW
+// over 2 slots so slots are reused, have to get the classes network_predict_top_k() picks
+static int verify_ipc_ring()
+{
+#ifdef __linux__
+    enum { frames = 5, k = 5 };
+    network net = load_reference_network(1);
+
+    int f, i, j, bad = 0;
+    int size = net.w*net.h*net.c;
+    unsigned char *bytes = (unsigned char*)xcalloc((size_t)frames*size, 1);
+    float *chw = (float*)xcalloc((size_t)frames*size, sizeof(float));
+    int expected_indexes[frames*k], indexes[frames*k];
+    float expected_probs[frames*k], probs[frames*k];
+    for (i = 0; i < frames*size; ++i) bytes[i] = rand() % 256;
+    for (f = 0; f < frames; ++f) {
+        for (j = 0; j < net.c; ++j) {
+            for (i = 0; i < net.w*net.h; ++i) chw[(size_t)f*size + j*net.w*net.h + i] = bytes[(size_t)f*size + i*net.c + j] / 255.f;
+        }
+        network_predict_top_k(net, chw + (size_t)f*size, k, expected_indexes + f*k, expected_probs + f*k);
+    }
+
+    // a file that isn't a socket is never replaced
+    char socket_path[64];
+    sprintf(socket_path, "/tmp/darknet_verify_%d.sock", (int)getpid());
+    FILE *fp = fopen(socket_path, "w");
+    if (fp) {
+        fclose(fp);
+        struct stat st;
+        if (run_classifier_ipc_until(net, socket_path, 2, k, 0) != -1 || stat(socket_path, &st) != 0 || !S_ISREG(st.st_mode)) {
+            fprintf(stderr, "ipc ring: the server replaced the regular file %s\n", socket_path);
+            bad = 1;
+        }
+        unlink(socket_path);
+    }
+
+    // the server thread has the network to itself from here on
+    verify_ipc_server server = {net, socket_path, 0};
+    pthread_t thread;
+    if (pthread_create(&thread, 0, verify_ipc_server_thread, &server)) error("Thread creation failed", DARKNET_LOC);
+    ipc_ring *r = 0;
+    for (i = 0; i < 5000 && !r; ++i) {
+        if (access(socket_path, F_OK) == 0) r = open_ipc_ring(socket_path);
+        if (!r) usleep(1000);
+    }
+
+    struct stat st;
+    if (r && (stat(socket_path, &st) != 0 || (st.st_mode & 0777) != 0600)) {
+        fprintf(stderr, "ipc ring: socket mode is %o, expected 600\n", (unsigned)(st.st_mode & 0777));
+        bad = 1;
+    }
+
+    for (f = 0; f < frames && r; ++f) {
+        int uint8 = f % 2 == 0;
+        int s = ipc_acquire_slot(r);
+        if (uint8) memcpy(get_ipc_slot_data(r, s), bytes + (size_t)f*size, size);
+        else memcpy(get_ipc_slot_data(r, s), chw + (size_t)f*size, size*sizeof(float));
+        ipc_submit(r, s, uint8 ? IPC_UINT8 : IPC_FLOAT32, k);
+        ipc_slot *slot = ipc_wait(r, s);
+        if (slot->status != 0 || slot->top != k) {
+            fprintf(stderr, "ipc ring: frame %d came back with status %d, %d classes\n", f, slot->status, slot->top);
+            bad = 1;
+        }
+        for (j = 0; j < k; ++j) {
+            indexes[f*k + j] = slot->index[j];
+            probs[f*k + j] = slot->prob[j];
+            if (indexes[f*k + j] != expected_indexes[f*k + j]) {
+                fprintf(stderr, "ipc ring: frame %d class %d is %d, expected %d\n", f, j, indexes[f*k + j], expected_indexes[f*k + j]);
+                bad = 1;
+            }
+        }
+        ipc_release_slot(r, s);
+    }
+
+    // with every slot taken a client sleeps on the release counter until one is freed
+    if (r) {
+        int s0 = ipc_acquire_slot(r), s1 = ipc_acquire_slot(r);
+        verify_ipc_acquire a = {r, -1};
+        pthread_t waiter;
+        if (pthread_create(&waiter, 0, verify_ipc_acquire_thread, &a)) error("Thread creation failed", DARKNET_LOC);
+        usleep(20000);
+        int early = __atomic_load_n(&a.slot, __ATOMIC_ACQUIRE);
+        ipc_release_slot(r, s0);
+        pthread_join(waiter, 0);
+        if (early != -1 || a.slot != s0) {
+            fprintf(stderr, "ipc ring: acquire on a full ring got slot %d before and %d after slot %d was released\n", early, a.slot, s0);
+            bad = 1;
+        }
+        ipc_release_slot(r, a.slot);
+        ipc_release_slot(r, s1);
+    }
+
+    __atomic_store_n(&server.stop, 1, __ATOMIC_RELEASE);
+    if (r) ipc_ring_doorbell(r);
+    pthread_join(thread, 0);
+    if (!r) {
+        fprintf(stderr, " ipc      couldn't connect to %s  FAILED\n", socket_path);
+        bad = 1;
+    }
+    else {
+        char name[64];
+        sprintf(name, "%d frames over 2 slots", frames);
+        if (!bad) bad = compare_outputs("ipc", name, probs, expected_probs, frames*k);
+        close_ipc_ring(r);
+    }
+    xfree(bytes);
+    xfree(chw);
+    free_network(net);
+    return bad;
+#else
+    return 0;
+#endif
+}
+
+int run_verify(int argc, char **argv)
+{
+    int cases = find_int_arg(argc, argv, "-cases", 200);
+    int seed = find_int_arg(argc, argv, "-seed", 1);
+    char *golden = find_char_arg(argc, argv, "-golden", 0);
+    char *write_golden = find_char_arg(argc, argv, "-write_golden", 0);
+    int failures = 0;
+    int i;
+
+    srand(seed);
+    fprintf(stderr, "Verifying kernels against reference implementations, seed %d\n", seed);
+    for (i = 0; i < NUM_VARIANTS(gemm_variants); ++i) failures += verify_gemm(&gemm_variants[i], cases);
+    for (i = 0; i < NUM_VARIANTS(im2col_variants); ++i) failures += verify_im2col(&im2col_variants[i], cases);
+    for (i = 0; i < NUM_VARIANTS(maxpool_variants); ++i) failures += verify_maxpool(&maxpool_variants[i], cases);
+    failures += verify_avgpool(cases);
+    failures += verify_top_k(cases);
+    for (i = 0; i < NUM_VARIANTS(conv_variants); ++i) failures += verify_conv(&conv_variants[i], cases/4);
+    failures += verify_xnor(cases/4);
+    failures += verify_gather();
+    failures += verify_network_paths();
+    failures += verify_batcher();
+    failures += verify_ipc_ring();
+
+    if (write_golden) failures += verify_golden(write_golden, 1);
+    else if (golden) failures += verify_golden(golden, 0);
+
+    fprintf(stderr, "%s\n", failures ? "FAILED" : "All checks passed");
+    return failures ? 1 : 0;
+}